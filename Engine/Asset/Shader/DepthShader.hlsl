@@ -9,12 +9,25 @@ cbuffer PerFrame : register(b1)
 	row_major float4x4 Projection;	// Projection Matrix Calculation of MVP Matrix
 };
 
+#ifdef INSTANCED
+// 인스턴스 드로우: 월드 행렬(과 색)을 SV_InstanceID로 읽음 (C++ FInstanceData와 같은 배치)
+struct FInstanceData
+{
+	row_major float4x4 World;
+	float4 Color;
+};
+StructuredBuffer<FInstanceData> Instances : register(t8);
+#endif
+
 struct VS_INPUT
 {
 	float3 position : POSITION;
 	float3 normal : NORMAL;
 	float4 color : COLOR;
 	float2 tex : TEXCOORD0;
+#ifdef INSTANCED
+	uint instanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
@@ -28,7 +41,11 @@ PS_INPUT mainVS(VS_INPUT input)
 	PS_INPUT output;
 
 	float4 tmp = float4(input.position, 1.0f);
+#ifdef INSTANCED
+	tmp = mul(tmp, Instances[input.instanceID].World);
+#else
 	tmp = mul(tmp, world);
+#endif
 	tmp = mul(tmp, View);
 
 	// Store view-space depth before projection
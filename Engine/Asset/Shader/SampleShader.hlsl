@@ -14,23 +14,44 @@ cbuffer PerFrame : register(b2)
 	float4 totalColor;
 };
 
+#ifdef INSTANCED
+// 인스턴스 드로우: 월드 행렬(과 색)을 SV_InstanceID로 읽음 (C++ FInstanceData와 같은 배치)
+struct FInstanceData
+{
+	row_major float4x4 World;
+	float4 Color;
+};
+StructuredBuffer<FInstanceData> Instances : register(t8);
+#endif
+
 struct VS_INPUT
 {
     float4 position : POSITION;		// Input position from vertex buffer
     float4 color : COLOR;			// Input color from vertex buffer
+#ifdef INSTANCED
+    uint instanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
 {
     float4 position : SV_POSITION;	// Transformed position to pass to the pixel shader
     float4 color : COLOR;			// Color to pass to the pixel shader
+#ifdef INSTANCED
+    float4 instanceColor : COLOR1;	// 인스턴스마다 다른 totalColor
+#endif
 };
 
 PS_INPUT mainVS(VS_INPUT input)
 {
     PS_INPUT output;
 	float4 tmp = input.position;
+#ifdef INSTANCED
+    tmp = mul(tmp, Instances[input.instanceID].World);
+    output.instanceColor = Instances[input.instanceID].Color;
+#else
     tmp = mul(tmp, world);
+#endif
     tmp = mul(tmp, View);
     tmp = mul(tmp, Projection);
 
@@ -42,7 +63,11 @@ PS_INPUT mainVS(VS_INPUT input)
 
 float4 mainPS(PS_INPUT input) : SV_TARGET
 {
+#ifdef INSTANCED
+	float4 finalColor = lerp(input.color, input.instanceColor, input.instanceColor.a);
+#else
 	float4 finalColor = lerp(input.color, totalColor, totalColor.a);
+#endif
 
 	return finalColor;
 }
@@ -21,6 +21,16 @@ cbuffer MaterialConstants : register(b2)
 	float Time;
 };
 
+#ifdef INSTANCED
+// 인스턴스 드로우: 월드 행렬(과 색)을 SV_InstanceID로 읽음 (C++ FInstanceData와 같은 배치)
+struct FInstanceData
+{
+	row_major float4x4 World;
+	float4 Color;
+};
+StructuredBuffer<FInstanceData> Instances : register(t8);
+#endif
+
 Texture2D DiffuseTexture : register(t0);	// map_Kd
 Texture2D AmbientTexture : register(t1);	// map_Ka
 Texture2D SpecularTexture : register(t2);	// map_Ks
@@ -44,6 +54,9 @@ struct VS_INPUT
 	float3 normal : NORMAL;
 	float4 color : COLOR;
 	float2 tex : TEXCOORD0;
+#ifdef INSTANCED
+	uint instanceID : SV_InstanceID;
+#endif
 };
 
 struct PS_INPUT
@@ -58,7 +71,11 @@ PS_INPUT mainVS(VS_INPUT input)
 	PS_INPUT output;
 
 	float4 tmp = float4(input.position, 1.0f);
+#ifdef INSTANCED
+	tmp = mul(tmp, Instances[input.instanceID].World);
+#else
 	tmp = mul(tmp, world);
+#endif
 	tmp = mul(tmp, View);
 	tmp = mul(tmp, Projection);
 	output.position = tmp;
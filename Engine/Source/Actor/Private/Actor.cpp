@@ -22,9 +22,13 @@ AActor::AActor(UObject* InOuter)
 
 AActor::~AActor()
 {
-	for (UActorComponent* Component : OwnedComponents)
+	// 공유 중인 컴포넌트는 원본 액터 소유
+	if (!SharedComponentSource)
 	{
-		SafeDelete(Component);
+		for (UActorComponent* Component : OwnedComponents)
+		{
+			SafeDelete(Component);
+		}
 	}
 	SetOuter(nullptr);
 	OwnedComponents.clear();
@@ -201,8 +205,9 @@ void AActor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 }
 
 
-void AActor::SetActorLocation(const FVector& InLocation) const
+void AActor::SetActorLocation(const FVector& InLocation)
 {
+	MaterializeSharedComponentsInLevel();
 	if (RootComponent)
 	{
 		RootComponent->SetRelativeLocation(InLocation);
@@ -210,8 +215,9 @@ void AActor::SetActorLocation(const FVector& InLocation) const
 	GWorld->GetLevel()->UpdateSceneBVHComponent(RootComponent);
 }
 
-void AActor::SetActorRotation(const FVector& InRotation) const
+void AActor::SetActorRotation(const FVector& InRotation)
 {
+	MaterializeSharedComponentsInLevel();
 	if (RootComponent)
 	{
 		RootComponent->SetRelativeRotation(InRotation);
@@ -219,8 +225,9 @@ void AActor::SetActorRotation(const FVector& InRotation) const
 	GWorld->GetLevel()->UpdateSceneBVHComponent(RootComponent);
 }
 
-void AActor::SetActorScale3D(const FVector& InScale) const
+void AActor::SetActorScale3D(const FVector& InScale)
 {
+	MaterializeSharedComponentsInLevel();
 	if (RootComponent)
 	{
 		RootComponent->SetRelativeScale3D(InScale);
@@ -230,6 +237,7 @@ void AActor::SetActorScale3D(const FVector& InScale) const
 
 void AActor::SetUniformScale(bool IsUniform)
 {
+	MaterializeSharedComponentsInLevel();
 	if (RootComponent)
 	{
 		RootComponent->SetUniformScale(IsUniform);
@@ -289,6 +297,8 @@ UObject* AActor::Duplicate()
 
 void AActor::RegisterComponent(UActorComponent* InNewComponent)
 {
+	MaterializeSharedComponentsInLevel();
+
 	if (!InNewComponent || InNewComponent->GetOwner() != this)
 	{
 		InNewComponent->SetOwner(this);
@@ -318,6 +328,13 @@ void AActor::RegisterComponent(UActorComponent* InNewComponent)
 
 bool AActor::RemoveComponent(UActorComponent* InComponentToDelete)
 {
+    // 공유 중이면 원본 컴포넌트가 전달되었을 수 있으므로 복사본으로 바꿔서 처리
+    if (SharedComponentSource)
+    {
+        if (!GWorld->GetLevel()) { return false; }
+        InComponentToDelete = GWorld->GetLevel()->ResolveSharedComponentForEdit(InComponentToDelete);
+    }
+
     auto It = std::find(OwnedComponents.begin(), OwnedComponents.end(), InComponentToDelete);
     if (It == OwnedComponents.end())
     {
@@ -398,8 +415,13 @@ bool AActor::RemoveComponent(UActorComponent* InComponentToDelete)
 void AActor::DuplicateSubObjects(UObject* DuplicatedObject)
 {
 	Super::DuplicateSubObjects(DuplicatedObject);
-	AActor* DuplicatedActor = Cast<AActor>(DuplicatedObject);
+	DuplicateComponentsInto(Cast<AActor>(DuplicatedObject));
+}
+
+void AActor::DuplicateComponentsInto(AActor* DuplicatedActor)
+{
 	USceneComponent* DuplicatedRoot = Cast<USceneComponent>(GetRootComponent()->Duplicate());
+	DuplicatedActor->OwnedComponents.reserve(OwnedComponents.size());
 
 	TQueue<USceneComponent*> DuplicatedChildren;
 	DuplicatedChildren.push(DuplicatedRoot);
@@ -430,6 +452,65 @@ void AActor::DuplicateSubObjects(UObject* DuplicatedObject)
 	}
 }
 
+bool AActor::CanShareComponentsWithDuplicate() const
+{
+	if (bCanEverTick || !RootComponent || SharedComponentSource)
+	{
+		return false;
+	}
+
+	for (UActorComponent* Component : OwnedComponents)
+	{
+		if (!Component || !Component->CanShareWithDuplicatedLevel())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+AActor* AActor::DuplicateSharingComponents()
+{
+	AActor* Actor = Cast<AActor>(NewObject(GetClass()));
+	Actor->bCanEverTick = bCanEverTick;
+	Actor->bBegunPlay = false;
+	Actor->SharedComponentSource = this;
+	Actor->RootComponent = RootComponent;
+	Actor->OwnedComponents = OwnedComponents;
+	return Actor;
+}
+
+void AActor::MaterializeSharedComponents()
+{
+	AActor* Source = SharedComponentSource;
+	if (!Source)
+	{
+		return;
+	}
+
+	SharedComponentSource = nullptr;
+	RootComponent = nullptr;
+	OwnedComponents.clear();
+	Source->DuplicateComponentsInto(this);
+
+	// 원본 컴포넌트의 BeginPlay는 에디터 월드에서 이미 호출되었으므로 복사본만 시작
+	if (bBegunPlay)
+	{
+		for (UActorComponent* Component : OwnedComponents)
+		{
+			Component->BeginPlay();
+		}
+	}
+}
+
+void AActor::MaterializeSharedComponentsInLevel()
+{
+	if (SharedComponentSource && GWorld && GWorld->GetLevel())
+	{
+		GWorld->GetLevel()->MaterializeSharedActor(this);
+	}
+}
+
 void AActor::Tick(float DeltaTimes)
 {
 	for (auto& Component : OwnedComponents)
@@ -450,6 +531,13 @@ void AActor::BeginPlay()
 	}
 	bBegunPlay = true;
 	UE_LOG("BeginPlay: %s (Components: %zu)", GetName().ToString().c_str(), OwnedComponents.size());
+
+	// 공유 중인 컴포넌트는 원본 월드 소유이므로 BeginPlay/EndPlay를 전달하지 않음
+	if (SharedComponentSource)
+	{
+		return;
+	}
+
 	for (auto& Component : OwnedComponents)
 	{
 		if (Component)
@@ -463,6 +551,11 @@ void AActor::EndPlay()
 {
 	if (!bBegunPlay) return;
 	bBegunPlay = false;
+	if (SharedComponentSource)
+	{
+		return;
+	}
+
 	for (auto& Component : OwnedComponents)
 	{
 		if (Component)
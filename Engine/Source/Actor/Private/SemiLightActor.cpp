@@ -9,7 +9,8 @@ IMPLEMENT_CLASS(ASemiLightActor, AActor)
 
 ASemiLightActor::ASemiLightActor()
 {
-	bCanEverTick = true;
+	// Scale 고정/데칼 박스 동기화는 Transform 변경 통지로 처리하므로 Tick 불필요
+	bCanEverTick = false;
 	bTickInEditor = true;
 }
 
@@ -22,9 +22,10 @@ public:
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
-	void SetActorLocation(const FVector& InLocation) const;
-	void SetActorRotation(const FVector& InRotation) const;
-	void SetActorScale3D(const FVector& InScale) const;
+	// Copy-on-write로 복제된 액터는 변경 전에 공유 컴포넌트를 자기 소유로 교체(RootComponent / OwnedComponents 변경)하므로 const가 아님
+	void SetActorLocation(const FVector& InLocation);
+	void SetActorRotation(const FVector& InRotation);
+	void SetActorScale3D(const FVector& InScale);
 	void SetUniformScale(bool IsUniform);
 	virtual UClass* GetDefaultRootComponent();
 	virtual void InitializeComponents();
@@ -112,6 +113,31 @@ public:
 	bool CanTickInEditor() const { return bTickInEditor; }
 	void SetTickInEditor(bool InbTickInEditor) { bTickInEditor = InbTickInEditor; }
 
+	// ========================================
+	// Copy-on-write 복제 (PIE)
+	// ========================================
+
+	/**
+	 * @brief 컴포넌트를 복사하지 않고 공유하는 복제본을 만들 수 있는지 여부
+	 * Tick이 없고 모든 컴포넌트가 공유 가능한 액터만 해당
+	 */
+	bool CanShareComponentsWithDuplicate() const;
+
+	/**
+	 * @brief 컴포넌트를 복사하지 않고 이 액터의 컴포넌트를 그대로 참조하는 복제본 생성
+	 * 복제본은 첫 변경 전에 ULevel::MaterializeSharedActor로 자기 컴포넌트를 가져야 함
+	 */
+	AActor* DuplicateSharingComponents();
+
+	/**
+	 * @brief 공유 중인 컴포넌트를 원본에서 복사해 자기 소유로 전환
+	 * 레벨 자료구조(Octree, BVH)의 포인터 교체는 호출자(ULevel)가 담당
+	 */
+	void MaterializeSharedComponents();
+
+	bool IsSharingComponents() const { return SharedComponentSource != nullptr; }
+	AActor* GetSharedComponentSource() const { return SharedComponentSource; }
+
 protected:
 	bool bCanEverTick = false;
 	bool bTickInEditor = false;
@@ -121,6 +147,12 @@ private:
 	USceneComponent* RootComponent = nullptr;
 	UUUIDTextComponent* UUIDTextComponent = nullptr;
 	TArray<UActorComponent*> OwnedComponents;
+
+	// 컴포넌트를 공유 중인 원본 액터 (소유하지 않으므로 삭제하지 않음)
+	AActor* SharedComponentSource = nullptr;
+
+	void DuplicateComponentsInto(AActor* InDuplicatedActor);
+	void MaterializeSharedComponentsInLevel();
 	
 public:
 	virtual UObject* Duplicate() override;
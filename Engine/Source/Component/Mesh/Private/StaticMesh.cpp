@@ -69,6 +69,11 @@ const TArray<uint32>& UStaticMesh::GetIndices() const
 	return EmptyIndices;
 }
 
+uint32 UStaticMesh::GetIndexStride() const
+{
+	return StaticMeshAsset ? StaticMeshAsset->IndexStride : sizeof(uint32);
+}
+
 UMaterial* UStaticMesh::GetMaterial(int32 MaterialIndex) const
 {
 	return (MaterialIndex >= 0 && MaterialIndex < Materials.size()) ? Materials[MaterialIndex] : nullptr;
@@ -101,3 +106,13 @@ const TArray<FMeshSection>& UStaticMesh::GetSections() const
 	static const TArray<FMeshSection> EmptySections;
 	return EmptySections;
 }
+
+const TArray<FStaticMeshLOD>& UStaticMesh::GetLODs() const
+{
+	if (StaticMeshAsset)
+	{
+		return StaticMeshAsset->LODs;
+	}
+	static const TArray<FStaticMeshLOD> EmptyLODs;
+	return EmptyLODs;
+}
@@ -1,5 +1,4 @@
 #include "pch.h"
-#include "Core/Public/ObjectIterator.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Mesh/Public/MeshComponent.h"
 #include "Manager/Asset/Public/ObjManager.h"
@@ -13,6 +12,8 @@
 
 IMPLEMENT_CLASS(UStaticMeshComponent, UMeshComponent)
 
+int32 UStaticMeshComponent::ForcedLOD = -1;
+
 UStaticMeshComponent::UStaticMeshComponent()
 	: bIsScrollEnabled(false)
 {
@@ -52,16 +53,10 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				FString MaterialPath;
 				FJsonSerializer::ReadString(MaterialPathDataJson, "Path", MaterialPath);
 
-				for (TObjectIterator<UMaterial> It; It; ++It)
+				// Material 라이브러리는 지연 로드되므로 AssetManager에서 검색 (없으면 라이브러리 로드 후 재검색)
+				if (UMaterial* Mat = UAssetManager::GetInstance().FindMaterialByDiffuseTexturePath(MaterialPath))
 				{
-					UMaterial* Mat = *It;
-					if (!Mat) continue;
-
-					if (Mat->GetDiffuseTexture()->GetFilePath() == MaterialPath)
-					{
-						SetMaterial(MaterialId, Mat);
-						break;
-					}
+					SetMaterial(MaterialId, Mat);
 				}
 			}
 		}
@@ -99,7 +94,8 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 {
 	UAssetManager& AssetManager = UAssetManager::GetInstance();
 
-	UStaticMesh* NewStaticMesh = FObjManager::LoadObjStaticMesh(InObjPath);
+	// 로더 스레드와 같은 설정으로 로드해야 .objbin 캐시와 좌표계가 일치
+	UStaticMesh* NewStaticMesh = FObjManager::LoadObjStaticMesh(InObjPath, FObjManager::GetDefaultConfiguration());
 
 	if (NewStaticMesh)
 	{
@@ -112,10 +108,13 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 		Indices = &(StaticMesh->GetIndices());
 		IndexBuffer = AssetManager.GetIndexBuffer(InObjPath);
 		NumIndices = static_cast<uint32>(Indices->size());
+		IndexStride = StaticMesh->GetIndexStride();
 
 		RenderState.CullMode = ECullMode::Back;
 		RenderState.FillMode = EFillMode::Solid;
 		BoundingBox = &AssetManager.GetStaticMeshAABB(InObjPath);
+		bIsAABBCacheDirty = true;
+		MarkRenderStateDirty();
 	}
 }
 
@@ -137,6 +136,13 @@ void UStaticMeshComponent::SetMaterial(int32 Index, UMaterial* InMaterial)
 		OverrideMaterials.resize(Index + 1, nullptr);
 	}
 	OverrideMaterials[Index] = InMaterial;
+	MarkRenderStateDirty();
+}
+
+int32 UStaticMeshComponent::GetNumMaterialSlots() const
+{
+	const int32 MeshSlots = StaticMesh ? StaticMesh->GetNumMaterials() : 0;
+	return std::max(MeshSlots, static_cast<int32>(OverrideMaterials.size()));
 }
 
 const FRenderState& UStaticMeshComponent::GetClassDefaultRenderState()
@@ -145,6 +151,68 @@ const FRenderState& UStaticMeshComponent::GetClassDefaultRenderState()
 	return DefaultRenderState;
 }
 
+int32 UStaticMeshComponent::SelectLOD(const FVector& InViewOrigin, const FMatrix& InProjection)
+{
+	FStaticMesh* StaticMeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+	if (!StaticMeshAsset || StaticMeshAsset->LODs.empty())
+	{
+		return 0;
+	}
+
+	// 월드 AABB 캐시는 스케일이 반영되어 있으므로 그대로 사용
+	FVector WorldMin, WorldMax;
+	GetWorldAABB(WorldMin, WorldMax);
+	return SelectLODForBounds(*StaticMeshAsset, WorldMin, WorldMax, InViewOrigin, InProjection);
+}
+
+int32 UStaticMeshComponent::SelectLODForBounds(const FStaticMesh& InStaticMesh, const FVector& InWorldMin, const FVector& InWorldMax,
+	const FVector& InViewOrigin, const FMatrix& InProjection)
+{
+	if (InStaticMesh.LODs.empty())
+	{
+		return 0;
+	}
+
+	if (ForcedLOD >= 0)
+	{
+		return std::min(ForcedLOD, static_cast<int32>(InStaticMesh.LODs.size()));
+	}
+
+	// 월드 AABB의 외접구로 근사
+	const FVector Center = (InWorldMin + InWorldMax) * 0.5f;
+	const float Radius = (InWorldMax - InWorldMin).Length() * 0.5f;
+
+	return SelectLODForScreenSize(InStaticMesh, CalculateScreenSize(Center, Radius, InViewOrigin, InProjection));
+}
+
+float UStaticMeshComponent::CalculateScreenSize(const FVector& InCenter, float InRadius, const FVector& InViewOrigin, const FMatrix& InProjection)
+{
+	// Projection[1][1]: 원근이면 cot(FovY / 2), 직교면 2 / 뷰 높이
+	const float ProjectionScaleY = InProjection.Data[1][1];
+	if (InProjection.Data[3][3] == 1.0f)
+	{
+		return InRadius * ProjectionScaleY;
+	}
+
+	const float Distance = std::max((InCenter - InViewOrigin).Length(), InRadius);
+	return Distance > 0.0f ? InRadius * ProjectionScaleY / Distance : FLT_MAX;
+}
+
+int32 UStaticMeshComponent::SelectLODForScreenSize(const FStaticMesh& InStaticMesh, float InScreenSize)
+{
+	// LOD의 ScreenSize는 뒤로 갈수록 작아지므로 만족하는 마지막 LOD가 가장 단순한 LOD
+	int32 LODIndex = 0;
+	for (size_t i = 0; i < InStaticMesh.LODs.size(); ++i)
+	{
+		if (InScreenSize > InStaticMesh.LODs[i].ScreenSize)
+		{
+			break;
+		}
+		LODIndex = static_cast<int32>(i) + 1;
+	}
+	return LODIndex;
+}
+
 UObject* UStaticMeshComponent::Duplicate()
 {
 	UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Super::Duplicate());
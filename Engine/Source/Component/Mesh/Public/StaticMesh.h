@@ -12,6 +12,19 @@ struct FMeshSection
 	uint32 MaterialSlot;
 };
 
+/**
+ * @brief 단순화된 LOD 하나 (정점은 LOD0과 같은 버퍼를 공유하고 인덱스만 별도)
+ */
+struct FStaticMeshLOD
+{
+	TArray<uint32> Indices;
+	TArray<FMeshSection> Sections;	// StartIndex는 이 LOD의 Indices 기준
+
+	uint32 FirstIndex = 0;		// GPU 인덱스 버퍼에서 이 LOD가 시작하는 위치 (LOD0 뒤에 이어 붙임)
+	float Error = 0.0f;			// LOD0 대비 오차 (메시 바운딩 박스 대각선 대비 비율)
+	float ScreenSize = 0.0f;	// 화면 크기가 이 값 이하일 때 사용
+};
+
 /**
 * @brief 스태틱 메시 Cooked Data.
 * @note 엔진 내부 관점에서 Static Mesh Asset은 이 구조체를 의미합니다.
@@ -24,6 +37,9 @@ struct FStaticMesh
 	TArray<uint32> Indices;
 	FBVH BVH; // 메시의 가속 구조
 
+	// GPU 인덱스 버퍼 원소 크기 (CPU 쪽 Indices는 항상 uint32, 쿡 단계에서 정점 수가 작으면 16비트로 줄임)
+	uint32 IndexStride = sizeof(uint32);
+
 	// --- 2. 재질 정보 (Materials) ---
 	// 이 메시에 사용되는 모든 고유 재질의 목록 (페인트 팔레트)
 	//TArray<UMaterial> Materials;
@@ -33,6 +49,10 @@ struct FStaticMesh
 	// --- 3. 연결 정보 (Sections) ---
 	// 각 재질을 어떤 기하 구간에 칠할지에 대한 지시서
 	TArray<FMeshSection> Sections;
+
+	// --- 4. LOD ---
+	// LOD1부터 순서대로 (LOD0은 위의 Indices / Sections), BVH와 Decal은 LOD0만 사용
+	TArray<FStaticMeshLOD> LODs;
 };
 
 
@@ -70,6 +90,7 @@ public:
 	const TArray<FNormalVertex>& GetVertices() const;
 	TArray<FNormalVertex>& GetVertices();
 	const TArray<uint32>& GetIndices() const;
+	uint32 GetIndexStride() const;
 
 	// Material Data
 	/**
@@ -86,6 +107,7 @@ public:
 
 	int32 GetNumMaterials() const;
 	const TArray<FMeshSection>& GetSections() const;
+	const TArray<FStaticMeshLOD>& GetLODs() const;
 
 	// 유효성 검사
 	bool IsValid() const { return StaticMeshAsset != nullptr; }
@@ -26,16 +26,41 @@ public:
 
 	UMaterial* GetMaterial(int32 Index) const;
 	void SetMaterial(int32 Index, UMaterial* InMaterial);
+	// 메시 머티리얼과 오버라이드 중 많은 쪽의 슬롯 수
+	int32 GetNumMaterialSlots() const;
 
-	void EnableScroll() { bIsScrollEnabled = true; }
-	void DisableScroll() { bIsScrollEnabled = false; }
+	void EnableScroll() { bIsScrollEnabled = true; MarkRenderStateDirty(); }
+	void DisableScroll() { bIsScrollEnabled = false; MarkRenderStateDirty(); }
 	bool IsScrollEnabled() const { return bIsScrollEnabled; }
 
+	// 스크롤 메시는 렌더링 중 ElapsedTime이 갱신되므로 공유 불가
+	bool CanShareWithDuplicatedLevel() const override { return Super::CanShareWithDuplicatedLevel() && !bIsScrollEnabled; }
+
 	void SetElapsedTime(float InElapsedTime) { ElapsedTime = InElapsedTime; }
 	float GetElapsedTime() const { return ElapsedTime; }
 
 	static const FRenderState& GetClassDefaultRenderState(); 
 
+	// LOD
+	/**
+	 * @brief 카메라 기준 화면 크기로 그릴 LOD 선택 (0 = 원본, n = FStaticMesh::LODs[n - 1])
+	 * 컴포넌트에 상태를 남기지 않으므로 PIE와 공유 중인 컴포넌트도 뷰마다 따로 선택됨
+	 */
+	int32 SelectLOD(const FVector& InViewOrigin, const FMatrix& InProjection);
+
+	/**
+	 * @brief 바운딩 구가 화면 높이에서 차지하는 비율 (지름 기준, 원근/직교 모두 지원)
+	 */
+	static float CalculateScreenSize(const FVector& InCenter, float InRadius, const FVector& InViewOrigin, const FMatrix& InProjection);
+	static int32 SelectLODForScreenSize(const FStaticMesh& InStaticMesh, float InScreenSize);
+	// 월드 AABB로 LOD 선택 (렌더 프록시처럼 컴포넌트 없이 바운드만 가진 경우)
+	static int32 SelectLODForBounds(const FStaticMesh& InStaticMesh, const FVector& InWorldMin, const FVector& InWorldMax,
+		const FVector& InViewOrigin, const FMatrix& InProjection);
+
+	// -1이면 화면 크기로 선택, 0 이상이면 모든 메시를 해당 LOD로 고정 (디버그용)
+	static void SetForcedLOD(int32 InForcedLOD) { ForcedLOD = InForcedLOD; }
+	static int32 GetForcedLOD() { return ForcedLOD; }
+
 private:
 	UStaticMesh* StaticMesh;
 
@@ -45,6 +70,8 @@ private:
 	// Scroll
 	bool bIsScrollEnabled;
 	float ElapsedTime;
+
+	static int32 ForcedLOD;
 	
 public:
 	virtual UObject* Duplicate() override;
@@ -8,7 +8,6 @@
 #include "Component/Public/BillBoardComponent.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Level/Public/Level.h"
-#include "Core/Public/ObjectIterator.h"
 
 IMPLEMENT_CLASS(UDecalComponent, USceneComponent)
 
@@ -59,8 +58,21 @@ void UDecalComponent::MarkAsDirty()
     // 부모 클래스의 MarkAsDirty 호출 (트랜스폼 더티 플래그 설정)
     Super::MarkAsDirty();
 
-    // SceneBVH는 Editor/ActorDetailWidget에서 드래그 종료 시 RefitComponent로 업데이트
-    // 여기서는 Transform Dirty Flag만 설정하고, BVH 업데이트는 드래그 완료 시에만 수행
+    // Transform Dirty Flag만 설정하고, Level 알림은 OnTransformChanged에서 프레임당 한 번만 수행
+}
+
+void UDecalComponent::OnTransformChanged()
+{
+    Super::OnTransformChanged();
+
+    // 같은 프레임에 여러 번 움직여도 한 번만 Level에 알림
+    if (GWorld)
+    {
+        if (ULevel* Level = GWorld->GetLevel())
+        {
+            Level->UpdateDecalDirtyFlag(this);
+        }
+    }
 }
 
 void UDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -92,19 +104,7 @@ void UDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         if (bHasMat && !MatPath.empty())
         {
             // a) 기존 머티리얼 풀에서 찾기(StaticMeshComponent 방식과 동일)
-            UMaterial* Found = nullptr;
-            for (TObjectIterator<UMaterial> It; It; ++It)
-            {
-                UMaterial* Mat = *It; if (!Mat) continue;
-                if (UTexture* Diff = Mat->GetDiffuseTexture())
-                {
-                    if (Diff->GetFilePath() == FName(MatPath))
-                    {
-                        Found = Mat;
-                        break;
-                    }
-                }
-            }
+            UMaterial* Found = UAssetManager::GetInstance().FindMaterialByDiffuseTexturePath(MatPath);
             if (Found)
             {
                 SetMaterial(Found);
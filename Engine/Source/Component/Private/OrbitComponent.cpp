@@ -119,8 +119,9 @@ void UOrbitComponent::RegenerateOrbit()
 
 void UOrbitComponent::CreateOrbitBuffers()
 {
-	// 기존 버퍼 해제
+	// 기존 버퍼 해제 (렌더 프록시는 다음 렌더링 전에 새 버퍼를 다시 읽음)
 	ReleaseOrbitBuffers();
+	MarkRenderStateDirty();
 
 	if (OrbitVertices.empty() || OrbitIndices.empty())
 	{
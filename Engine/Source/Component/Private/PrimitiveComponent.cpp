@@ -4,13 +4,15 @@
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
 #include "Physics/Public/OBB.h"
+#include "Level/Public/Level.h"
 
 IMPLEMENT_CLASS(UPrimitiveComponent, USceneComponent)
 
 UPrimitiveComponent::UPrimitiveComponent()
 {
 	ComponentType = EComponentType::Primitive;
-	bCanEverTick = true;
+	// Transform 변경은 OnTransformChanged 통지로 처리하므로 기본적으로 Tick하지 않음
+	bCanEverTick = false;
 }
 
 void UPrimitiveComponent::TickComponent()
@@ -71,6 +73,7 @@ uint32 UPrimitiveComponent::GetNumIndices() const
 void UPrimitiveComponent::SetTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology)
 {
 	Topology = InTopology;
+	MarkRenderStateDirty();
 }
 
 D3D11_PRIMITIVE_TOPOLOGY UPrimitiveComponent::GetTopology() const
@@ -146,6 +149,31 @@ void UPrimitiveComponent::MarkAsDirty()
 	Super::MarkAsDirty();
 }
 
+void UPrimitiveComponent::MarkRenderStateDirty()
+{
+	if (GWorld)
+	{
+		if (ULevel* Level = GWorld->GetLevel())
+		{
+			Level->MarkRenderProxyDirty(this);
+		}
+	}
+}
+
+void UPrimitiveComponent::OnTransformChanged()
+{
+	Super::OnTransformChanged();
+
+	if (GWorld)
+	{
+		if (ULevel* Level = GWorld->GetLevel())
+		{
+			Level->MarkSceneBVHComponentDirty(this);
+			Level->MarkRenderProxyDirty(this);
+		}
+	}
+}
+
 
 UObject* UPrimitiveComponent::Duplicate()
 {
@@ -163,6 +191,7 @@ UObject* UPrimitiveComponent::Duplicate()
 	PrimitiveComponent->IndexBuffer = IndexBuffer;
 	PrimitiveComponent->NumVertices = NumVertices;
 	PrimitiveComponent->NumIndices = NumIndices;
+	PrimitiveComponent->IndexStride = IndexStride;
 	PrimitiveComponent->BoundingBox = BoundingBox;
 	
 	return PrimitiveComponent;
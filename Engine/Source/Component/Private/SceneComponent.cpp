@@ -17,6 +17,24 @@ USceneComponent::USceneComponent()
 	ComponentType = EComponentType::Scene;
 }
 
+USceneComponent::~USceneComponent()
+{
+	// 통지 대기열에 남아있다면 슬롯을 비워서 Flush 시 댕글링 포인터 접근 방지
+	// 레벨 단위로 대량 삭제될 때 선형 탐색이 누적되지 않도록 위치를 기억해 두고 사용
+	// Flush 중이면 아직 통지받지 않은 컴포넌트는 Flush 중인 목록에 있으므로 두 목록 모두 확인
+	if (bIsTransformChangePending)
+	{
+		for (TArray<USceneComponent*>* Queue : { &PendingTransformChangedComponents, &FlushingTransformChangedComponents })
+		{
+			if (PendingTransformChangeIndex < Queue->size() && (*Queue)[PendingTransformChangeIndex] == this)
+			{
+				(*Queue)[PendingTransformChangeIndex] = nullptr;
+				break;
+			}
+		}
+	}
+}
+
 void USceneComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -113,12 +131,77 @@ void USceneComponent::MarkAsDirty()
 	bIsTransformDirty = true;
 	bIsTransformDirtyInverse = true;
 
+	QueueTransformChangedNotification();
+
 	for (USceneComponent* Child : Children)
 	{
 		Child->MarkAsDirty();
 	}
 }
 
+uint32 USceneComponent::BindOnTransformChanged(const FOnTransformChanged& InDelegate)
+{
+	const uint32 Handle = NextTransformListenerHandle++;
+	TransformChangedListeners.emplace_back(Handle, InDelegate);
+	return Handle;
+}
+
+void USceneComponent::UnbindOnTransformChanged(uint32 InHandle)
+{
+	TransformChangedListeners.erase(
+		std::remove_if(TransformChangedListeners.begin(), TransformChangedListeners.end(),
+			[InHandle](const TPair<uint32, FOnTransformChanged>& Listener) { return Listener.first == InHandle; }),
+		TransformChangedListeners.end());
+}
+
+void USceneComponent::OnTransformChanged()
+{
+}
+
+void USceneComponent::QueueTransformChangedNotification()
+{
+	// 같은 프레임의 중복 변경은 하나로 합침
+	if (bIsTransformChangePending)
+	{
+		return;
+	}
+
+	bIsTransformChangePending = true;
+	PendingTransformChangeIndex = static_cast<uint32>(PendingTransformChangedComponents.size());
+	PendingTransformChangedComponents.push_back(this);
+}
+
+void USceneComponent::FlushTransformChangedNotifications()
+{
+	if (PendingTransformChangedComponents.empty())
+	{
+		return;
+	}
+
+	// 통지 중 발생한 변경은 다음 프레임에 처리되도록 대기열을 교체한 뒤 순회
+	// 통지 중에 뒤쪽 컴포넌트가 삭제되면 소멸자가 이 목록의 슬롯을 비움
+	FlushingTransformChangedComponents.swap(PendingTransformChangedComponents);
+
+	for (size_t Index = 0; Index < FlushingTransformChangedComponents.size(); ++Index)
+	{
+		USceneComponent* Component = FlushingTransformChangedComponents[Index];
+		if (!Component)
+		{
+			continue;
+		}
+
+		// 통지 직전에 내려야 아직 통지받지 않은 컴포넌트의 소멸자가 슬롯을 비울 수 있음
+		// (통지 전 변경은 대기 중 플래그 때문에 다시 등록되지 않고 이번 통지에 합쳐짐)
+		Component->bIsTransformChangePending = false;
+		Component->OnTransformChanged();
+		for (const auto& Listener : Component->TransformChangedListeners)
+		{
+			Listener.second(Component);
+		}
+	}
+	FlushingTransformChangedComponents.clear();
+}
+
 void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
 	RelativeLocation = Location;
@@ -130,8 +213,7 @@ void USceneComponent::SetRelativeLocation(const FVector& Location)
 		ULevel* Level = GWorld->GetLevel();
 		Level->UpdatePrimitiveInOctree(PrimitiveComponent);
 
-		// SceneBVH 업데이트는 Editor에서 기즈모 드래그 종료 시에만 수행
-		// (매 프레임 업데이트하면 성능 저하 발생)
+		// SceneBVH는 프레임 끝 Transform 변경 통지 후 ULevel::FlushSceneBVHRefit에서 일괄 리핏
 	}
 }
 
@@ -146,8 +228,7 @@ void USceneComponent::SetRelativeRotation(const FVector& Rotation)
 		ULevel* Level = GWorld->GetLevel();
 		Level->UpdatePrimitiveInOctree(PrimitiveComponent);
 
-		// SceneBVH 업데이트는 Editor에서 기즈모 드래그 종료 시에만 수행
-		// (매 프레임 업데이트하면 성능 저하 발생)
+		// SceneBVH는 프레임 끝 Transform 변경 통지 후 ULevel::FlushSceneBVHRefit에서 일괄 리핏
 	}
 }
 
@@ -162,8 +243,7 @@ void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 		ULevel* Level = GWorld->GetLevel();
 		Level->UpdatePrimitiveInOctree(PrimitiveComponent);
 
-		// SceneBVH 업데이트는 Editor에서 기즈모 드래그 종료 시에만 수행
-		// (매 프레임 업데이트하면 성능 저하 발생)
+		// SceneBVH는 프레임 끝 Transform 변경 통지 후 ULevel::FlushSceneBVHRefit에서 일괄 리핏
 	}
 }
 
@@ -11,8 +11,8 @@ IMPLEMENT_CLASS(USemiLightComponent, USceneComponent)
 
 USemiLightComponent::USemiLightComponent()
 {
-	// Scale 변경 감지를 위해 Tick 활성화
-	bCanEverTick = true;
+	// Scale 변경은 OnTransformChanged 통지로 감지하므로 Tick 불필요
+	bCanEverTick = false;
 }
 
 USemiLightComponent::~USemiLightComponent() = default;
@@ -30,13 +30,26 @@ void USemiLightComponent::SetDecalComponent(UDecalComponent* InDecalComponent)
 void USemiLightComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 로드/복제 직후 상태를 한 번 동기화
+	OnTransformChanged();
 }
 
-void USemiLightComponent::TickComponent()
+void USemiLightComponent::OnTransformChanged()
 {
-	Super::TickComponent();
+	Super::OnTransformChanged();
+
+	// Scale은 항상 1로 고정하고, 실제 크기는 ProjectionDistance3D로 조절
+	// 이미 1이면 다시 설정하지 않아야 불필요한 Dirty 전파가 일어나지 않음
+	const FVector WorldScale = GetWorldScale3D();
+	constexpr float Tolerance = 1e-4f;
+	if (fabsf(WorldScale.X - 1.0f) > Tolerance ||
+		fabsf(WorldScale.Y - 1.0f) > Tolerance ||
+		fabsf(WorldScale.Z - 1.0f) > Tolerance)
+	{
+		SetWorldScale3D({1.0f, 1.0f, 1.0f});
+	}
 
-	SetWorldScale3D({1.0f, 1.0f, 1.0f});
 	UpdateDecalBoxFromScale();
 }
 
@@ -75,24 +88,9 @@ void USemiLightComponent::SetBlendFactor(float InFactor)
 void USemiLightComponent::SetProjectionDistance3D(const FVector& InDistance)
 {
 	ProjectionDistance3D = InDistance;
-	UpdateDecalProperties();
 
-	// 새로운 박스 크기에 맞는 최대 각도 계산
-	const float MaxAngle = GetMaxAngleForDecalBox();
-
-	// 현재 각도가 최대치를 초과하면 자동으로 조정
-	if (SpotAngle > MaxAngle)
-	{
-		SpotAngle = MaxAngle;
-
-		// DecalComponent의 SpotAngle도 업데이트
-		if (DecalComponent)
-		{
-			DecalComponent->SetSpotAngle(SpotAngle);
-		}
-	}
-
-	UpdateDecalProperties();
+	// 박스 크기 재계산 + 최대 각도에 맞춰 SpotAngle 재조정
+	UpdateDecalBoxFromScale();
 }
 
 void USemiLightComponent::SetDecalBoxSize(const FVector& InSize)
@@ -147,9 +145,17 @@ void USemiLightComponent::UpdateDecalBoxFromScale()
 
 	// DecalComponent는 Y축 90도 회전 → 로컬 X축=부모 -Z, 로컬 Y=부모 Y, 로컬 Z=부모 X
 	// DecalBoxSize는 DecalComponent 로컬 좌표계 기준
-	DecalBoxSize.X = ProjectionDistance3D.X * CurrentScale.Z;  // DecalBox 깊이 (투사 방향) = 부모 Z Scale
-	DecalBoxSize.Y = ProjectionDistance3D.Y * CurrentScale.Y;  // DecalBox Y 반경 = 부모 Y Scale
-	DecalBoxSize.Z = ProjectionDistance3D.Z * CurrentScale.X;  // DecalBox Z 반경 = 부모 X Scale
+	FVector NewBoxSize;
+	NewBoxSize.X = ProjectionDistance3D.X * CurrentScale.Z;  // DecalBox 깊이 (투사 방향) = 부모 Z Scale
+	NewBoxSize.Y = ProjectionDistance3D.Y * CurrentScale.Y;  // DecalBox Y 반경 = 부모 Y Scale
+	NewBoxSize.Z = ProjectionDistance3D.Z * CurrentScale.X;  // DecalBox Z 반경 = 부모 X Scale
+
+	// 크기가 그대로면 데칼을 건드리지 않음 (데칼 Dirty/BVH 작업 방지)
+	if (NewBoxSize == DecalBoxSize && DecalComponent && DecalComponent->GetDecalSize() == DecalBoxSize)
+	{
+		return;
+	}
+	DecalBoxSize = NewBoxSize;
 
 	// Decal 프로퍼티 업데이트
 	UpdateDecalProperties();
@@ -30,6 +30,12 @@ public:
 	 */
 	virtual UClass* GetSpecificWidgetClass() const { return nullptr; }
 
+	/**
+	 * @brief PIE 레벨 복제 시 복사하지 않고 에디터 컴포넌트를 그대로 참조해도 되는지 여부
+	 * 선택/편집 없이 렌더링만 되는 동안 스스로 상태를 바꾸지 않는 컴포넌트만 true로 재정의
+	 */
+	virtual bool CanShareWithDuplicatedLevel() const { return false; }
+
 
 	EComponentType GetComponentType() { return ComponentType; }
 
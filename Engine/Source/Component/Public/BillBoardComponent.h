@@ -28,6 +28,9 @@ public:
 	static const FRenderState& GetClassDefaultRenderState(); 
 
 	void UpdateBillboardMatrix(const FVector& CameraLocation);
+
+	// 매 프레임 카메라 기준 행렬을 갱신하므로 공유 불가
+	bool CanShareWithDuplicatedLevel() const override { return false; }
 	FMatrix GetRTMatrix() const { return RTMatrix; }
 
 	void SetOffset(float Offset) { ZOffset = Offset; }
@@ -85,6 +85,9 @@ public:
     float GetFadeOutDuration() const { return FadeOutDuration; }
     float GetFadeAlpha() const { return FadeAlpha; }
 protected:
+    // Transform 변경 통지 (프레임당 한 번) - Level에 Dirty 알림
+    void OnTransformChanged() override;
+
     UMaterial* DecalMaterial = nullptr;
     class UTexture* DecalTexture = nullptr;
     USpriteMaterial* SpriteMaterial = nullptr;
@@ -18,12 +18,16 @@ public:
 	// 렌더와 일치하는 바운딩 변환 훅(기본은 월드 변환)
 	virtual FMatrix GetBoundingTransform() const { return GetWorldTransformMatrix(); }
 
+	// Tick이 없는 프리미티브는 렌더링 중 상태가 바뀌지 않으므로 공유 가능
+	bool CanShareWithDuplicatedLevel() const override { return !CanTick(); }
+
 	const TArray<FNormalVertex>* GetVerticesData() const;
 	const TArray<uint32>* GetIndicesData() const;
 	ID3D11Buffer* GetVertexBuffer() const;
 	ID3D11Buffer* GetIndexBuffer() const;
 	uint32 GetNumVertices() const;
 	uint32 GetNumIndices() const;
+	uint32 GetIndexStride() const { return IndexStride; }
 
 	const FRenderState& GetRenderState() const { return RenderState; }
 
@@ -32,10 +36,10 @@ public:
 	//void Render(const URenderer& Renderer) const override;
 
 	bool IsVisible() const { return bVisible; }
-	void SetVisibility(bool bVisibility) { bVisible = bVisibility; }
+	void SetVisibility(bool bVisibility) { bVisible = bVisibility; MarkRenderStateDirty(); }
 
 	FVector4 GetColor() const { return Color; }
-	void SetColor(const FVector4& InColor) { Color = InColor; }
+	void SetColor(const FVector4& InColor) { Color = InColor; MarkRenderStateDirty(); }
 
 	const IBoundingVolume* GetBoundingBox();
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax);
@@ -44,10 +48,19 @@ public:
 
 	virtual void MarkAsDirty() override;
 
+	/**
+	 * @brief 메시 / 머티리얼 / 색 / 가시성 등 렌더링에 쓰는 상태가 바뀌었음을 레벨의 렌더 씬에 알림
+	 * 다음 프레임 렌더링 전에 이 컴포넌트의 프록시만 다시 읽음
+	 */
+	void MarkRenderStateDirty();
+
 	// 다른 곳에서 사용할 인덱스
 	mutable int32 CachedAABBIndex = -1;
 	mutable uint32 CachedFrame = 0;
 
+	// 렌더 씬(FRenderScene)의 프록시 인덱스, 프록시가 없으면 -1
+	int32 GetRenderProxyIndex() const { return RenderProxyIndex; }
+
 protected:
 	const TArray<FNormalVertex>* Vertices = nullptr;
 	const TArray<uint32>* Indices = nullptr;
@@ -57,6 +70,7 @@ protected:
 
 	uint32 NumVertices = 0;
 	uint32 NumIndices = 0;
+	uint32 IndexStride = sizeof(uint32);	// IndexBuffer 원소 크기 (2면 16비트 인덱스)
 
 	FVector4 Color = FVector4{ 0.f,0.f,0.f,0.f };
 
@@ -72,9 +86,17 @@ protected:
 	mutable FVector CachedWorldMax;
 	mutable bool bIsAABBCacheDirty = true;
 
+	// 이동 컴포넌트 등으로 Transform이 바뀌면 Level의 Scene BVH 일괄 리핏 대상으로 등록
+	void OnTransformChanged() override;
+
 public:
 	virtual UObject* Duplicate() override;
 
 protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject) override;
+
+private:
+	// 프록시 슬롯과 어긋나지 않도록 렌더 씬만 변경
+	friend class FRenderScene;
+	int32 RenderProxyIndex = -1;
 };
@@ -4,6 +4,14 @@
 namespace json { class JSON; }
 using JSON = json::JSON;
 
+class USceneComponent;
+
+/**
+ * @brief Transform 변경 통지 델리게이트
+ * 한 프레임 내에서 여러 번 변경되어도 FlushTransformChangedNotifications()에서 한 번만 호출됩니다.
+ */
+using FOnTransformChanged = TFunction<void(USceneComponent*)>;
+
 UCLASS()
 class USceneComponent : public UActorComponent
 {
@@ -12,6 +20,7 @@ class USceneComponent : public UActorComponent
 
 public:
 	USceneComponent();
+	~USceneComponent() override;
 
 	void BeginPlay() override;
 	void TickComponent() override;
@@ -25,6 +34,19 @@ public:
 	
 	virtual void MarkAsDirty();
 
+	/**
+	 * @brief Transform 변경 리스너 등록
+	 * @return 해제에 사용할 핸들
+	 */
+	uint32 BindOnTransformChanged(const FOnTransformChanged& InDelegate);
+	void UnbindOnTransformChanged(uint32 InHandle);
+
+	/**
+	 * @brief 이번 프레임에 Transform이 변경된 컴포넌트들에게 변경을 통지
+	 * World Tick 마지막에 호출되며, 컴포넌트당 프레임마다 최대 한 번만 통지합니다.
+	 */
+	static void FlushTransformChangedNotifications();
+
 	void SetRelativeLocation(const FVector& Location);
 	void SetRelativeRotation(const FVector& Rotation);
 	void SetRelativeScale3D(const FVector& Scale);
@@ -50,7 +72,26 @@ public:
     void SetWorldRotation(const FVector& NewRotation);
     void SetWorldScale3D(const FVector& NewScale);
 
+protected:
+	/**
+	 * @brief Transform 변경 시 (프레임당 한 번) 호출되는 훅
+	 * 매 프레임 Tick에서 변경 여부를 확인하는 대신 이 함수를 재정의해서 사용
+	 */
+	virtual void OnTransformChanged();
+
 private:
+	void QueueTransformChangedNotification();
+
+	bool bIsTransformChangePending = false;
+	// 대기열 내 위치 (소멸 시 O(1)로 슬롯을 비우기 위함)
+	uint32 PendingTransformChangeIndex = 0;
+	uint32 NextTransformListenerHandle = 1;
+	TArray<TPair<uint32, FOnTransformChanged>> TransformChangedListeners;
+
+	static inline TArray<USceneComponent*> PendingTransformChangedComponents;
+	// FlushTransformChangedNotifications가 통지 중인 목록 (Flush 밖에서는 비어 있음)
+	static inline TArray<USceneComponent*> FlushingTransformChangedComponents;
+
 	mutable bool bIsTransformDirty = true;
 	mutable bool bIsTransformDirtyInverse = true;
 	mutable FMatrix WorldTransformMatrix;
@@ -22,7 +22,6 @@ public:
     ~USemiLightComponent() override;
 
     void BeginPlay() override;
-    void TickComponent() override;
 
     // Component Setters (Actor에서 생성 후 설정)
     void SetIconComponent(UBillBoardComponent* InIconComponent);
@@ -46,6 +45,9 @@ public:
     // Serialization
     void Serialize(bool bInIsLoading, JSON& InOutHandle) override;
 
+protected:
+    void OnTransformChanged() override;
+
 private:
     void UpdateDecalProperties();
     void UpdateDecalBoxFromScale();
@@ -41,6 +41,8 @@ int FClientApp::Run(HINSTANCE InInstanceHandle, int InCmdShow)
 	_CrtSetBreakAlloc(0);
 #endif
 
+	StartupCycles = FWindowsPlatformTime::Cycles64();
+
 	// Window Object Initialize
 	Window = new FAppWindow(this);
 	if (!Window->Init(InInstanceHandle, InCmdShow))
@@ -114,6 +116,11 @@ void FClientApp::UpdateSystem() const
 	auto& InputManager = UInputManager::GetInstance();
 	auto& UIManager = UUIManager::GetInstance();
 	auto& Renderer = URenderer::GetInstance();
+	{
+		// 로더 스레드가 끝낸 애셋의 GPU 리소스 생성 (메인 스레드 업로드 단계)
+		TIME_PROFILE(AssetUpload)
+		UAssetManager::GetInstance().FlushAsyncLoads();
+	}
 	{
 		TIME_PROFILE(GEditor)
 		GEditor->Tick(DT);
@@ -155,9 +162,14 @@ void FClientApp::MainLoop()
 	}
 #endif
 
+	FProfiler& Profiler = FProfiler::GetInstance();
+	FProfiler::SetThreadName("Main");
+
 	bool bIsExit = false;
+	bool bIsFirstFrame = true;
 	while (!bIsExit)
 	{
+		Profiler.BeginFrame();
 		TStatId StatId("DeltaTime");
 		FScopeCycleCounter CycleCounter(StatId);
 		// Async Message Process
@@ -179,10 +191,30 @@ void FClientApp::MainLoop()
 		// Game System Update
 		UpdateSystem();
 
+		if (bIsFirstFrame)
+		{
+			bIsFirstFrame = false;
+			ReportTimeToFirstFrame();
+		}
+
 		UTimeManager::GetInstance().SetDeltaTime(static_cast<float>(CycleCounter.Finish() / 1000));
+		Profiler.EndFrame();
 	}
 }
 
+/**
+ * @brief 시작부터 첫 프레임 완료까지 걸린 시간과 그 시점의 애셋 로드 상태를 출력
+ * 애셋 라이브러리 크기가 달라도 첫 레벨이 쓰는 애셋만 기다리는지 확인하는 용도
+ */
+void FClientApp::ReportTimeToFirstFrame() const
+{
+	const UAssetManager& AssetManager = UAssetManager::GetInstance();
+	UE_LOG("Startup: Time to first frame %.2f ms (StaticMesh %u loaded / %zu in library, %u pending)",
+		FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartupCycles),
+		AssetManager.GetLoadedStaticMeshCount(), AssetManager.GetStaticMeshPaths().size(),
+		AssetManager.GetPendingAsyncLoadCount());
+}
+
 /**
  * @brief 시스템 종료 처리
  * 모든 리소스를 안전하게 해제하고 매니저들을 정리합니다.
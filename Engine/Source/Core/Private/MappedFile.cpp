@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "Core/Public/MappedFile.h"
+
+FMappedFile::~FMappedFile()
+{
+	Close();
+}
+
+bool FMappedFile::Open(const std::filesystem::path& InFilePath)
+{
+	Close();
+
+	FileHandle = CreateFileW(InFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (FileHandle == INVALID_HANDLE_VALUE)
+	{
+		UE_LOG_ERROR("MappedFile: 파일을 열지 못했습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	LARGE_INTEGER FileSize;
+	if (!GetFileSizeEx(FileHandle, &FileSize))
+	{
+		UE_LOG_ERROR("MappedFile: 파일 크기를 읽지 못했습니다: %s", InFilePath.string().c_str());
+		Close();
+		return false;
+	}
+
+	// 크기가 0인 파일은 매핑할 수 없으므로 빈 데이터로 취급
+	Size = static_cast<size_t>(FileSize.QuadPart);
+	if (Size == 0)
+	{
+		return true;
+	}
+
+	MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!MappingHandle)
+	{
+		UE_LOG_ERROR("MappedFile: 파일 매핑을 만들지 못했습니다: %s", InFilePath.string().c_str());
+		Close();
+		return false;
+	}
+
+	Data = static_cast<const char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (!Data)
+	{
+		UE_LOG_ERROR("MappedFile: 파일 뷰를 매핑하지 못했습니다: %s", InFilePath.string().c_str());
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FMappedFile::Close()
+{
+	if (Data)
+	{
+		UnmapViewOfFile(Data);
+		Data = nullptr;
+	}
+	if (MappingHandle)
+	{
+		CloseHandle(MappingHandle);
+		MappingHandle = nullptr;
+	}
+	if (FileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(FileHandle);
+		FileHandle = INVALID_HANDLE_VALUE;
+	}
+	Size = 0;
+}
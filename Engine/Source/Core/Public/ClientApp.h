@@ -10,6 +10,7 @@ class FAppWindow;
  * @var AcceleratorTable 키보드 단축키 테이블 핸들
  * @var MainMessage 윈도우 메시지 구조체
  * @var Window 윈도우 객체 포인터
+ * @var StartupCycles Run 진입 시점 (첫 프레임까지 걸린 시간 측정용)
  */
 class FClientApp
 {
@@ -25,9 +26,11 @@ private:
     void UpdateSystem() const;
     void MainLoop();
 	void ShutdownSystem() const;
+	void ReportTimeToFirstFrame() const;
 
     HACCEL AcceleratorTable;
     MSG MainMessage;
     FAppWindow* Window;
+	uint64 StartupCycles = 0;
 	//UEditor* Editor = nullptr;
 };
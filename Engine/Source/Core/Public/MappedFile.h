@@ -0,0 +1,30 @@
+#pragma once
+
+#include <filesystem>
+
+/**
+ * @brief 읽기 전용 메모리 매핑 파일
+ * 큰 텍스트 애셋을 한 번에 복사하지 않고 페이지 단위로 읽기 위해 사용
+ * 빈 파일은 Open에 성공하고 GetData()가 nullptr, GetSize()가 0
+ */
+class FMappedFile
+{
+public:
+	FMappedFile() = default;
+	~FMappedFile();
+
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	bool Open(const std::filesystem::path& InFilePath);
+	void Close();
+
+	const char* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	HANDLE FileHandle = INVALID_HANDLE_VALUE;
+	HANDLE MappingHandle = nullptr;
+	const char* Data = nullptr;
+	size_t Size = 0;
+};
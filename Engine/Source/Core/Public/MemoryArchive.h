@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstring>
+
+#include "Core/Public/Archive.h"
+
+/**
+ * @brief 바이트 배열 끝에 이어 쓰는 메모리 Archive
+ * 파일에 쓰기 전에 데이터 블록 크기를 먼저 알아야 할 때 사용
+ */
+struct FMemoryWriter : public FArchive
+{
+	explicit FMemoryWriter(TArray<uint8>& InBytes)
+		: Bytes(InBytes)
+	{
+	}
+
+	bool IsLoading() const override { return false; }
+
+	void Serialize(void* V, size_t Length) override
+	{
+		if (Length == 0)
+		{
+			return;
+		}
+
+		const size_t Offset = Bytes.size();
+		Bytes.resize(Offset + Length);
+		memcpy(Bytes.data() + Offset, V, Length);
+	}
+
+private:
+	TArray<uint8>& Bytes;
+};
+
+/**
+ * @brief 외부 메모리 구간을 읽는 Archive (복사하지 않음)
+ * 범위를 넘는 읽기는 0으로 채우고 오류 상태로 전환되므로 호출자는 HasError로 확인
+ * 손상된 데이터로 인한 잘못된 길이가 거대한 할당으로 이어지지 않도록 GetRemaining으로 미리 검사 가능
+ */
+struct FMemoryReader : public FArchive
+{
+	FMemoryReader(const uint8* InData, size_t InSize)
+		: Data(InData), Size(InSize)
+	{
+	}
+
+	bool IsLoading() const override { return true; }
+
+	void Serialize(void* V, size_t Length) override
+	{
+		if (bError || Length > Size - Position)
+		{
+			bError = true;
+			memset(V, 0, Length);
+			return;
+		}
+
+		memcpy(V, Data + Position, Length);
+		Position += Length;
+	}
+
+	bool HasError() const { return bError; }
+	void SetError() { bError = true; }
+	size_t GetRemaining() const { return Size - Position; }
+	bool IsAtEnd() const { return Position == Size; }
+
+private:
+	const uint8* Data = nullptr;
+	size_t Size = 0;
+	size_t Position = 0;
+	bool bError = false;
+};
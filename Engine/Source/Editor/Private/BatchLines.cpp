@@ -4,6 +4,32 @@
 #include "Editor/Public/EditorPrimitive.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Editor/Public/Camera.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	// Bounding Box 라인 인덱스 (LineList), 꼭짓점 순서는 AppendBox와 같음
+	constexpr uint32 BoxLineIndices[] = {
+		// 앞면
+		0, 1,
+		1, 2,
+		2, 3,
+		3, 0,
+
+		// 뒷면
+		4, 5,
+		5, 6,
+		6, 7,
+		7, 4,
+
+		// 옆면 연결
+		0, 4,
+		1, 5,
+		2, 6,
+		3, 7
+	};
+}
 
 UBatchLines::UBatchLines() : Grid(), BoundingBoxLines(), ConeLines()
 {
@@ -24,13 +50,10 @@ UBatchLines::UBatchLines() : Grid(), BoundingBoxLines(), ConeLines()
 	/*AddWorldGridVerticesAndConstData();
 	AddBoundingBoxVertices();*/
 
-	Primitive.NumVertices = static_cast<uint32>(Vertices.size());
-	Primitive.NumIndices = static_cast<uint32>(Indices.size());
-	Primitive.IndexBuffer = FRenderResourceFactory::CreateIndexBuffer(Indices.data(), Primitive.NumIndices * sizeof(uint32));
+	// 디버그 라인이 늘어나면 ReserveBuffers에서 다시 만듦
+	ReserveBuffers(static_cast<uint32>(Vertices.size()), static_cast<uint32>(Indices.size()));
 	//Primitive.Color = FVector4(1, 1, 1, 0.2f);
 	Primitive.Topology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
-	Primitive.Vertexbuffer = FRenderResourceFactory::CreateVertexBuffer(
-		Vertices.data(), Primitive.NumVertices * sizeof(FVector), true);
 	Primitive.Location = FVector(0, 0, 0);
 	Primitive.Rotation = FVector(0, 0, 0);
 	Primitive.Scale = FVector(1, 1, 1);
@@ -44,10 +67,40 @@ UBatchLines::~UBatchLines()
 	SafeRelease(Primitive.Vertexbuffer);
 	Primitive.InputLayout->Release();
 	Primitive.VertexShader->Release();
-	Primitive.IndexBuffer->Release();
+	SafeRelease(Primitive.IndexBuffer);
 	Primitive.PixelShader->Release();
 }
 
+void UBatchLines::BeginFrame()
+{
+	LastFrameStats = FrameStats;
+	FrameStats = {};
+
+	for (uint32 Mode = 0; Mode < NumDepthModes; ++Mode)
+	{
+		DebugBoxes[Mode].clear();
+		DebugLineVertices[Mode].clear();
+	}
+}
+
+void UBatchLines::AddLine(const FVector& InStart, const FVector& InEnd, bool bInAlwaysVisible)
+{
+	TArray<FVector>& LineVertices = DebugLineVertices[bInAlwaysVisible ? 1 : 0];
+	LineVertices.push_back(InStart);
+	LineVertices.push_back(InEnd);
+}
+
+void UBatchLines::AddBox(const FAABB& InBox, bool bInAlwaysVisible)
+{
+	DebugBoxes[bInAlwaysVisible ? 1 : 0].push_back(InBox);
+}
+
+void UBatchLines::AddBoxes(const TArray<FAABB>& InBoxes, bool bInAlwaysVisible)
+{
+	TArray<FAABB>& Boxes = DebugBoxes[bInAlwaysVisible ? 1 : 0];
+	Boxes.insert(Boxes.end(), InBoxes.begin(), InBoxes.end());
+}
+
 void UBatchLines::UpdateUGridVertices(const float newCellSize)
 {
 	if (newCellSize == Grid.GetCellSize())
@@ -56,14 +109,12 @@ void UBatchLines::UpdateUGridVertices(const float newCellSize)
 	}
 	Grid.UpdateVerticesBy(newCellSize);
 	Grid.MergeVerticesAt(Vertices, 0);
-	bChangedVertices = true;
 }
 
 void UBatchLines::UpdateBoundingBoxVertices(const IBoundingVolume* NewBoundingVolume)
 {
 	BoundingBoxLines.UpdateVertices(NewBoundingVolume);
 	BoundingBoxLines.MergeVerticesAt(Vertices, Grid.GetNumVertices());
-	bChangedVertices = true;
 }
 
 void UBatchLines::UpdateConeVertices(const FVector& Apex, const FVector& Direction, const FVector& UpVector,
@@ -71,24 +122,117 @@ void UBatchLines::UpdateConeVertices(const FVector& Apex, const FVector& Directi
 {
 	ConeLines.UpdateVertices(Apex, Direction, UpVector, Angle, DecalBoxSize);
 	ConeLines.MergeVerticesAt(Vertices, Grid.GetNumVertices() + BoundingBoxLines.GetNumVertices());
-	bChangedVertices = true;
 }
 
-void UBatchLines::UpdateVertexBuffer()
+void UBatchLines::Render(const UCamera* InCamera)
 {
-	if (bChangedVertices)
+	URenderer& Renderer = URenderer::GetInstance();
+
+	// 절두체를 만들 수 없으면 (퇴화된 투영) 거르지 않고 모두 그림
+	FFrustum Frustum;
+	const bool bCanCull = InCamera && Frustum.Build(InCamera->GetFViewProjConstants());
+
+	StreamVertices.assign(Vertices.begin(), Vertices.end());
+	StreamIndices.clear();
+
+	uint32 SectionStart[NumDepthModes] = {};
+	uint32 SectionCount[NumDepthModes] = {};
+	for (uint32 Mode = 0; Mode < NumDepthModes; ++Mode)
 	{
-		FRenderResourceFactory::UpdateVertexBufferData(Primitive.Vertexbuffer, Vertices);
+		SectionStart[Mode] = static_cast<uint32>(StreamIndices.size());
+
+		// 그리드 / 선택 박스 / 콘은 깊이 테스트 구간 앞에 둠
+		if (Mode == 0)
+		{
+			StreamIndices.insert(StreamIndices.end(), Indices.begin(), Indices.end());
+		}
+
+		for (const FAABB& Box : DebugBoxes[Mode])
+		{
+			if (bCanCull && Frustum.CheckIntersection(Box) == EBoundCheckResult::Outside)
+			{
+				++FrameStats.CulledBoxes;
+				continue;
+			}
+			AppendBox(Box);
+			++FrameStats.Boxes;
+		}
+
+		const TArray<FVector>& LineVertices = DebugLineVertices[Mode];
+		for (size_t Index = 0; Index + 1 < LineVertices.size(); Index += 2)
+		{
+			const uint32 FirstVertex = static_cast<uint32>(StreamVertices.size());
+			StreamVertices.push_back(LineVertices[Index]);
+			StreamVertices.push_back(LineVertices[Index + 1]);
+			StreamIndices.push_back(FirstVertex);
+			StreamIndices.push_back(FirstVertex + 1);
+		}
+
+		SectionCount[Mode] = static_cast<uint32>(StreamIndices.size()) - SectionStart[Mode];
+	}
+
+	ReserveBuffers(static_cast<uint32>(StreamVertices.size()), static_cast<uint32>(StreamIndices.size()));
+	if (!Primitive.Vertexbuffer || !Primitive.IndexBuffer)
+	{
+		return;
 	}
-	bChangedVertices = false;
+	FRenderResourceFactory::UpdateVertexBufferData(Primitive.Vertexbuffer, StreamVertices);
+	FRenderResourceFactory::UpdateVertexBufferData(Primitive.IndexBuffer, StreamIndices);
+
+	// 깊이 모드마다 한 번씩 그림
+	Primitive.NumVertices = static_cast<uint32>(StreamVertices.size());
+	for (uint32 Mode = 0; Mode < NumDepthModes; ++Mode)
+	{
+		if (SectionCount[Mode] == 0)
+		{
+			continue;
+		}
+
+		Primitive.StartIndex = SectionStart[Mode];
+		Primitive.NumIndices = SectionCount[Mode];
+		Primitive.bShouldAlwaysVisible = Mode == 1;
+		Renderer.RenderEditorPrimitive(Primitive, Primitive.RenderState, sizeof(FVector), sizeof(uint32));
+		++FrameStats.Draws;
+	}
+
+	++FrameStats.Viewports;
+	FrameStats.Lines += static_cast<uint32>(StreamIndices.size()) / 2;
 }
 
-void UBatchLines::Render()
+void UBatchLines::AppendBox(const FAABB& InBox)
 {
-	URenderer& Renderer = URenderer::GetInstance();
+	const uint32 FirstVertex = static_cast<uint32>(StreamVertices.size());
+	StreamVertices.emplace_back(InBox.Min.X, InBox.Min.Y, InBox.Min.Z);
+	StreamVertices.emplace_back(InBox.Max.X, InBox.Min.Y, InBox.Min.Z);
+	StreamVertices.emplace_back(InBox.Max.X, InBox.Max.Y, InBox.Min.Z);
+	StreamVertices.emplace_back(InBox.Min.X, InBox.Max.Y, InBox.Min.Z);
+	StreamVertices.emplace_back(InBox.Min.X, InBox.Min.Y, InBox.Max.Z);
+	StreamVertices.emplace_back(InBox.Max.X, InBox.Min.Y, InBox.Max.Z);
+	StreamVertices.emplace_back(InBox.Max.X, InBox.Max.Y, InBox.Max.Z);
+	StreamVertices.emplace_back(InBox.Min.X, InBox.Max.Y, InBox.Max.Z);
 
-	// to do: 아래 함수를 batch에 맞게 수정해야 함.
-	Renderer.RenderEditorPrimitive(Primitive, Primitive.RenderState, sizeof(FVector), sizeof(uint32));
+	for (uint32 Index : BoxLineIndices)
+	{
+		StreamIndices.push_back(FirstVertex + Index);
+	}
+}
+
+void UBatchLines::ReserveBuffers(uint32 InVertexCount, uint32 InIndexCount)
+{
+	// 모자랄 때만 두 배씩 늘려서 다시 만듦 (이전 버퍼를 그린 명령은 즉시 실행되었으므로 바로 해제해도 됨)
+	if (InVertexCount > VertexCapacity || !Primitive.Vertexbuffer)
+	{
+		VertexCapacity = std::max(InVertexCount, VertexCapacity * 2);
+		SafeRelease(Primitive.Vertexbuffer);
+		Primitive.Vertexbuffer = FRenderResourceFactory::CreateVertexBuffer(nullptr, VertexCapacity * sizeof(FVector), true);
+	}
+
+	if (InIndexCount > IndexCapacity || !Primitive.IndexBuffer)
+	{
+		IndexCapacity = std::max(InIndexCount, IndexCapacity * 2);
+		SafeRelease(Primitive.IndexBuffer);
+		Primitive.IndexBuffer = FRenderResourceFactory::CreateIndexBuffer(nullptr, IndexCapacity * sizeof(uint32), true);
+	}
 }
 
 void UBatchLines::SetIndices()
@@ -101,31 +245,10 @@ void UBatchLines::SetIndices()
 		Indices.push_back(index);
 	}
 
-	// Bounding Box 라인 인덱스 (LineList)
-	uint32 boundingBoxLineIdx[] = {
-		// 앞면
-		0, 1,
-		1, 2,
-		2, 3,
-		3, 0,
-
-		// 뒷면
-		4, 5,
-		5, 6,
-		6, 7,
-		7, 4,
-
-		// 옆면 연결
-		0, 4,
-		1, 5,
-		2, 6,
-		3, 7
-	};
-
 	// numGridVertices 이후에 추가된 8개의 꼭짓점에 맞춰 오프셋 적용
-	for (uint32 i = 0; i < std::size(boundingBoxLineIdx); ++i)
+	for (uint32 i = 0; i < std::size(BoxLineIndices); ++i)
 	{
-		Indices.push_back(numGridVertices + boundingBoxLineIdx[i]);
+		Indices.push_back(numGridVertices + BoxLineIndices[i]);
 	}
 
 	// Cone 라인 인덱스 (LineList)
@@ -6,6 +6,22 @@
 
 #include "Component/Public/PrimitiveComponent.h"
 #include "Level/Public/Level.h"
+#include "Render/Renderer/Public/RenderScene.h"
+
+namespace
+{
+	// FNV-1a
+	uint64 HashViewProj(const FViewProjConstants& InViewProj)
+	{
+		const uint8* Bytes = reinterpret_cast<const uint8*>(&InViewProj);
+		uint64 Hash = 14695981039346656037ull;
+		for (size_t Index = 0; Index < sizeof(FViewProjConstants); ++Index)
+		{
+			Hash = (Hash ^ Bytes[Index]) * 1099511628211ull;
+		}
+		return Hash;
+	}
+}
 
 UCamera::UCamera() :
 	ViewProjConstants(FViewProjConstants()),
@@ -112,11 +128,21 @@ void UCamera::Update(const D3D11_VIEWPORT& InViewport)
 		break;
 	}
 
-	// 카메라가 업데이트할 때마다 Cull한다.
-	// 카메라가 업데이트하지 않으면 Culling을 갱신할 이유가 없다.
+	// 카메라 행렬과 씬(등록 / 해제 / 이동)이 지난 컬링과 같으면 보이는 집합도 같으므로 다시 Cull하지 않는다.
+	// 씬 리비전은 레벨마다 다른 값이라 레벨이 바뀌어도 다시 Cull한다.
     ULevel* CurrentLevel = GWorld->GetLevel();
     if (CurrentLevel)
     {
+        const uint64 ViewHash = HashViewProj(ViewProjConstants);
+        const uint64 SceneRevision = CurrentLevel->GetRenderScene()->GetRevision();
+        if (ViewHash == CulledViewHash && SceneRevision == CulledSceneRevision)
+        {
+            return;
+        }
+        CulledViewHash = ViewHash;
+        CulledSceneRevision = SceneRevision;
+
+        TIME_PROFILE(Culling);
         ViewVolumeCuller.Cull(
             CurrentLevel->GetStaticOctree(),
             CurrentLevel->GetDynamicPrimitives(),
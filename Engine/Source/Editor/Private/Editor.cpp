@@ -80,15 +80,16 @@ void UEditor::Update()
 		}
 	}
 
+	BatchLines.BeginFrame();
 	UpdateBatchLines();
-	BatchLines.UpdateVertexBuffer();
 
 	ProcessMouseInput();
 
-	// SceneBVH 디버그 데이터 업데이트
+	// SceneBVH 디버그 데이터 업데이트 후 박스를 BatchLines에 모음 (뷰포트마다 절두체로 걸러서 한 번에 그림)
 	if (ULevel* CurrentLevel = GWorld->GetLevel())
 	{
 		CurrentLevel->RenderSceneBVHDebug();
+		AddSceneBVHLines(CurrentLevel);
 	}
 
 	UpdateLayout();
@@ -107,11 +108,9 @@ void UEditor::RenderDebugPrimitives(UCamera* InCamera)
 		return;
 	}
 
-	BatchLines.Render();
+	// 그리드 / 선택 박스 / 콘 / SceneBVH 박스
+	BatchLines.Render(InCamera);
 	Axis.Render();
-
-	// SceneBVH 디버그 렌더링
-	RenderSceneBVH();
 }
 
 void UEditor::RenderGizmo(UCamera* InCamera)
@@ -538,7 +537,7 @@ void UEditor::ProcessMouseInput()
 					Candidate.insert(Candidate.end(), DynamicCandidates.begin(), DynamicCandidates.end());
 				}
 				
-				FScopeCycleCounter PickCounter;
+				FScopeCycleCounter PickCounter(TStatId("Picking"));
 				UPrimitiveComponent* PrimitiveCollided = ObjectPicker.PickPrimitive(CurrentCamera, WorldRay, Candidate, &ActorDistance);
 				ActorPicked = PrimitiveCollided ? PrimitiveCollided->GetOwner() : nullptr;
 				float ElapsedMs = static_cast<float>(PickCounter.Finish()); // 피킹 시간 측정 종료
@@ -711,6 +710,12 @@ void UEditor::ValidateSelectionForCurrentWorld()
 
 void UEditor::SelectActor(AActor* InActor)
 {
+	// PIE 레벨이 컴포넌트를 공유 중인 액터라면 선택(OnSelected의 색상 변경) 전에 복사본으로 전환
+	if (InActor && GWorld && GWorld->GetLevel())
+	{
+		InActor = GWorld->GetLevel()->ResolveSharedActorForEdit(InActor);
+	}
+
 	if (InActor == SelectedActor) return;
 
 	SelectedActor = InActor;
@@ -735,6 +740,11 @@ AActor* UEditor::GetSelectedActor()
 
 void UEditor::SelectComponent(UActorComponent* InComponent)
 {
+	if (InComponent && GWorld && GWorld->GetLevel())
+	{
+		InComponent = GWorld->GetLevel()->ResolveSharedComponentForEdit(InComponent);
+	}
+
 	if (InComponent == SelectedComponent) return;
 
 	if (SelectedComponent) { SelectedComponent->OnDeselected(); }
@@ -763,71 +773,8 @@ UUUIDTextComponent* UEditor::GetPickedBillboard() const
 	return PickedBillboard;
 }
 
-void UEditor::RenderSceneBVH()
+void UEditor::AddSceneBVHLines(ULevel* InLevel)
 {
-	ULevel* CurrentLevel = GWorld->GetLevel();
-	if (!CurrentLevel) return;
-
-	const TArray<FAABB>& Boxes = CurrentLevel->GetCachedDebugBoxes();
-	const TArray<FVector4>& Colors = CurrentLevel->GetCachedDebugColors();
-
-	if (Boxes.empty()) return;
-
-	// 각 박스 렌더링
-	for (size_t i = 0; i < Boxes.size(); ++i)
-	{
-		RenderBVHBox(Boxes[i], Colors[i]);
-	}
-}
-
-void UEditor::RenderBVHBox(const FAABB& Box, const FVector4& Color)
-{
-	// 8개의 코너 버텍스 생성
-	FVector Corners[8];
-	Corners[0] = FVector(Box.Min.X, Box.Min.Y, Box.Min.Z);
-	Corners[1] = FVector(Box.Max.X, Box.Min.Y, Box.Min.Z);
-	Corners[2] = FVector(Box.Max.X, Box.Max.Y, Box.Min.Z);
-	Corners[3] = FVector(Box.Min.X, Box.Max.Y, Box.Min.Z);
-	Corners[4] = FVector(Box.Min.X, Box.Min.Y, Box.Max.Z);
-	Corners[5] = FVector(Box.Max.X, Box.Min.Y, Box.Max.Z);
-	Corners[6] = FVector(Box.Max.X, Box.Max.Y, Box.Max.Z);
-	Corners[7] = FVector(Box.Min.X, Box.Max.Y, Box.Max.Z);
-
-	// 12개 엣지의 인덱스 (LineList)
-	uint32 Indices[] = {
-		// 앞면 (Z = Min)
-		0, 1,  1, 2,  2, 3,  3, 0,
-		// 뒷면 (Z = Max)
-		4, 5,  5, 6,  6, 7,  7, 4,
-		// 연결 엣지
-		0, 4,  1, 5,  2, 6,  3, 7
-	};
-
-	// FEditorPrimitive 설정
-	FEditorPrimitive LinePrimitive;
-	LinePrimitive.NumVertices = 8;
-	LinePrimitive.NumIndices = 24;
-	LinePrimitive.Topology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
-	LinePrimitive.Color = Color;
-
-	// 버텍스 버퍼 생성
-	LinePrimitive.Vertexbuffer = FRenderResourceFactory::CreateVertexBuffer(
-		Corners, LinePrimitive.NumVertices * sizeof(FVector), false);
-
-	// 인덱스 버퍼 생성
-	LinePrimitive.IndexBuffer = FRenderResourceFactory::CreateIndexBuffer(
-		Indices, LinePrimitive.NumIndices * sizeof(uint32));
-
-	// 셰이더 설정
-	LinePrimitive.VertexShader = UAssetManager::GetInstance().GetVertexShader(EShaderType::BatchLine);
-	LinePrimitive.InputLayout = UAssetManager::GetInstance().GetIputLayout(EShaderType::BatchLine);
-	LinePrimitive.PixelShader = UAssetManager::GetInstance().GetPixelShader(EShaderType::BatchLine);
-
-	// 렌더링
-	URenderer& Renderer = URenderer::GetInstance();
-	Renderer.RenderEditorPrimitive(LinePrimitive, LinePrimitive.RenderState, sizeof(FVector), sizeof(uint32));
-
-	// 리소스 해제
-	SafeRelease(LinePrimitive.Vertexbuffer);
-	SafeRelease(LinePrimitive.IndexBuffer);
+	// 색은 BatchLine 셰이더가 한 색으로 그리므로 쓰지 않음
+	BatchLines.AddBoxes(InLevel->GetCachedDebugBoxes());
 }
@@ -3,6 +3,8 @@
 #include "Editor/Public/EditorEngine.h"
 #include "Editor/Public/Editor.h"
 #include "Level/Public/Level.h"
+#include "Actor/Public/CubeActor.h"
+#include "Component/Public/SceneComponent.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Path/Public/PathManager.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
@@ -77,6 +79,18 @@ void UEditorEngine::Tick(float DeltaSeconds)
     {
         EditorModule->Update();
     }
+
+    // 월드 Tick과 에디터 조작으로 이번 프레임에 Transform이 바뀐 컴포넌트들에게만 통지 (컴포넌트당 1회)
+    {
+        TIME_PROFILE(TransformNotify);
+        USceneComponent::FlushTransformChangedNotifications();
+    }
+
+    // 통지로 모인 이동 Primitive들의 Scene BVH 리프를 렌더링 전에 한 번에 리핏
+    if (GWorld && GWorld->GetLevel())
+    {
+        GWorld->GetLevel()->FlushSceneBVHRefit();
+    }
 }
 
 bool UEditorEngine::IsPIESessionActive() const
@@ -112,7 +126,15 @@ void UEditorEngine::StartPIE()
         SavedViewMode = EditorModule->GetViewMode();
         EditorModule->SetViewMode(EViewModeIndex::VMI_Lit);
     }
+    ULevel* EditorLevel = EditorWorld->GetLevel();
+    EditorLevelFingerprint = EditorLevel ? EditorLevel->ComputeStateFingerprint() : 0;
+
+    const auto DuplicateStartTime = std::chrono::high_resolution_clock::now();
     UWorld* PIEWorld = Cast<UWorld>(EditorWorld->Duplicate());
+    UE_LOG_SUCCESS("PIE: World duplicated in %.2f ms (%zu actors, %u shared)",
+        std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - DuplicateStartTime).count(),
+        EditorLevel ? EditorLevel->GetActors().size() : static_cast<size_t>(0),
+        PIEWorld && PIEWorld->GetLevel() ? PIEWorld->GetLevel()->GetSharedActorCount() : 0u);
 
     if (PIEWorld)
     {
@@ -148,9 +170,100 @@ void UEditorEngine::EndPIE()
     }
 
     GWorld = GetEditorWorldContext().World();
+
+    // Copy-on-write 복제에서 PIE가 공유 컴포넌트를 직접 변경하면 에디터 레벨 상태가 달라짐
+    if (ULevel* EditorLevel = GWorld->GetLevel())
+    {
+        if (EditorLevel->ComputeStateFingerprint() != EditorLevelFingerprint)
+        {
+            UE_LOG_ERROR("PIE: Editor level was modified during PIE session");
+            assert(!"PIE modified the editor level");
+        }
+    }
+
     GWorld->BeginPlay();
 }
 
+bool UEditorEngine::RunPIECheck(uint32 InTickCount, FPIECheckResult& OutResult)
+{
+    UWorld* EditorWorld = GetEditorWorldContext().World();
+    ULevel* EditorLevel = EditorWorld ? EditorWorld->GetLevel() : nullptr;
+    if (PIEState != EPIEState::Stopped || !EditorLevel)
+    {
+        return false;
+    }
+
+    OutResult = FPIECheckResult();
+    OutResult.ActorCount = static_cast<uint32>(EditorLevel->GetActors().size());
+    OutResult.TickCount = InTickCount;
+
+    constexpr float DeltaSeconds = 1.0f / 60.0f;
+    const uint64 Fingerprint = EditorLevel->ComputeStateFingerprint();
+    const ELevelDuplicationMode PreviousMode = ULevel::GetDuplicationMode();
+
+    for (ELevelDuplicationMode Mode : { ELevelDuplicationMode::Full, ELevelDuplicationMode::CopyOnWrite })
+    {
+        ULevel::SetDuplicationMode(Mode);
+        StartPIE();
+
+        FWorldContext* PIEContext = GetPIEWorldContext();
+        UWorld* PIEWorld = PIEContext ? PIEContext->World() : nullptr;
+        if (PIEWorld && PIEWorld->GetLevel())
+        {
+            for (uint32 Tick = 0; Tick < InTickCount; ++Tick)
+            {
+                PIEWorld->Tick(DeltaSeconds);
+            }
+
+            // 편집 도중 배열이 바뀌므로 복사본으로 순회
+            const TArray<AActor*> Actors = PIEWorld->GetLevel()->GetActors();
+            uint32 EditedActorCount = 0;
+
+            // 네 개 중 하나는 이동 / 회전 / 크기 변경
+            for (size_t Index = 0; Index < Actors.size(); Index += 4)
+            {
+                AActor* Actor = Actors[Index];
+                Actor->SetActorLocation(Actor->GetActorLocation() + FVector(1.0f, 2.0f, 3.0f));
+                Actor->SetActorRotation(Actor->GetActorRotation() + FVector(0.0f, 0.0f, 15.0f));
+                Actor->SetActorScale3D(Actor->GetActorScale3D() * 1.5f);
+                ++EditedActorCount;
+            }
+
+            // 선택만 해도 공유 컴포넌트가 복사되어야 함
+            if (EditorModule && Actors.size() > 1)
+            {
+                EditorModule->SelectActor(Actors[1]);
+                EditorModule->SelectActor(nullptr);
+                ++EditedActorCount;
+            }
+
+            if (Actors.size() > 2)
+            {
+                PIEWorld->DestroyActor(Actors.back());
+                ++EditedActorCount;
+            }
+
+            if (AActor* SpawnedActor = PIEWorld->SpawnActor(ACubeActor::StaticClass()))
+            {
+                SpawnedActor->SetActorLocation(FVector(10.0f, 0.0f, 0.0f));
+                ++EditedActorCount;
+            }
+
+            // 삭제 예약 처리와 이동 후 상태 반영
+            PIEWorld->Tick(DeltaSeconds);
+            OutResult.EditedActorCount = EditedActorCount;
+        }
+
+        EndPIE();
+
+        const bool bModified = EditorLevel->ComputeStateFingerprint() != Fingerprint;
+        (Mode == ELevelDuplicationMode::Full ? OutResult.bFullModified : OutResult.bCopyOnWriteModified) = bModified;
+    }
+
+    ULevel::SetDuplicationMode(PreviousMode);
+    return true;
+}
+
 void UEditorEngine::PausePIE()
 {
     if (PIEState != EPIEState::Playing) { return; }
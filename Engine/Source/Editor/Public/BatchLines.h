@@ -7,22 +7,47 @@
 #include "Editor/Public/ConeLines.h"
 
 struct FVertex;
+class UCamera;
 
+/**
+ * @brief 에디터 디버그 라인 통계 (render lines), 모든 뷰포트 합
+ */
+struct FBatchLineStats
+{
+	uint32 Viewports = 0;
+	uint32 Lines = 0;			// 스트림에 넣어 그린 라인 수 (그리드 / 선택 박스 / 콘 포함)
+	uint32 Boxes = 0;			// 절두체 안에 있어 그린 디버그 박스 수
+	uint32 CulledBoxes = 0;		// 절두체 밖이라 스트림에 넣지 않은 디버그 박스 수
+	uint32 Draws = 0;
+};
+
+/**
+ * @brief 에디터 디버그 라인 (그리드, 선택 박스, 데칼 콘, SceneBVH 등)을 한 스트림으로 모아 그림
+ *
+ * 그리드 / 선택 박스 / 콘은 항상 스트림 앞에 두고, 프레임마다 AddBox / AddLine으로 받은 라인을 뒤에 붙임
+ * 뷰포트마다 절두체 밖 박스는 빼고 정점 / 인덱스 버퍼를 한 번씩 갱신한 뒤
+ * 깊이 테스트 구간과 항상 보이는 구간을 각각 한 번에 그림
+ */
 class UBatchLines : UObject
 {
 public:
 	UBatchLines();
 	~UBatchLines();
 
+	// 지난 프레임의 디버그 박스 / 라인을 비우고 통계를 넘김 (에디터 Update에서 프레임마다 한 번)
+	void BeginFrame();
+	void AddLine(const FVector& InStart, const FVector& InEnd, bool bInAlwaysVisible = false);
+	void AddBox(const FAABB& InBox, bool bInAlwaysVisible = false);
+	void AddBoxes(const TArray<FAABB>& InBoxes, bool bInAlwaysVisible = false);
+
+	const FBatchLineStats& GetLastFrameStats() const { return LastFrameStats; }
+
 	// 종류별 Vertices 업데이트
 	void UpdateUGridVertices(const float newCellSize);
 	void UpdateBoundingBoxVertices(const IBoundingVolume* NewBoundingVolume);
 	void UpdateConeVertices(const FVector& Apex, const FVector& Direction, const FVector& UpVector,
 							float Angle, const FVector& DecalBoxSize);
 
-	// GPU VertexBuffer에 복사
-	void UpdateVertexBuffer();
-
 	float GetCellSize() const
 	{
 		return Grid.GetCellSize();
@@ -42,26 +67,40 @@ public:
 	{
 		ConeLines.Disable();
 		ConeLines.MergeVerticesAt(Vertices, Grid.GetNumVertices() + BoundingBoxLines.GetNumVertices());
-		bChangedVertices = true;
 	}
 
 	//void UpdateConstant(FBoundingBox boundingBoxInfo);
 
 	//void Update();
 
-	void Render();
+	// InCamera의 절두체로 디버그 박스 / 라인을 걸러 내고 그림 (뷰포트마다 호출)
+	void Render(const UCamera* InCamera);
 
 private:
 	void SetIndices();
+	void AppendBox(const FAABB& InBox);
+	void ReserveBuffers(uint32 InVertexCount, uint32 InIndexCount);
 
 	/*void AddWorldGridVerticesAndConstData();
 	void AddBoundingBoxVertices();*/
 
-	bool bChangedVertices = false;
-
 	TArray<FVector> Vertices; // 그리드 라인 정보 + (offset 후)디폴트 바운딩 박스 라인 정보(minx, miny가 0,0에 정의된 크기가 1인 cube)
 	TArray<uint32> Indices; // 월드 그리드는 그냥 정점 순서, 바운딩 박스는 실제 인덱싱
 
+	// 이번 프레임에 받은 디버그 라인 ([0] 깊이 테스트, [1] 항상 보임)
+	static constexpr uint32 NumDepthModes = 2;
+	TArray<FAABB> DebugBoxes[NumDepthModes];
+	TArray<FVector> DebugLineVertices[NumDepthModes];	// 두 점이 한 라인
+
+	// 뷰포트마다 다시 채우는 스트림 (Vertices / Indices 뒤에 보이는 디버그 라인을 붙임)
+	TArray<FVector> StreamVertices;
+	TArray<uint32> StreamIndices;
+	uint32 VertexCapacity = 0;
+	uint32 IndexCapacity = 0;
+
+	FBatchLineStats FrameStats;
+	FBatchLineStats LastFrameStats;
+
 	FEditorPrimitive Primitive;
 
 	UGrid Grid;
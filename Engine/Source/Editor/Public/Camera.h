@@ -107,6 +107,9 @@ private:
 
 	// 절두체 컬링을 이용한 최적화
 	ViewVolumeCuller ViewVolumeCuller;
+	// 지난 컬링의 입력 (View / Projection 해시와 씬 리비전이 모두 같으면 컬링을 건너뜀)
+	uint64 CulledViewHash = 0;
+	uint64 CulledSceneRevision = 0;
 
 	// Dynamic Movement Speed
 	float CurrentMoveSpeed = DEFAULT_SPEED;
@@ -44,14 +44,14 @@ public:
 	void SelectComponent(UActorComponent* InComponent);
 	UActorComponent* GetSelectedComponent();
 	UUUIDTextComponent* GetPickedBillboard() const;
+	const FBatchLineStats& GetBatchLineStats() const { return BatchLines.GetLastFrameStats(); }
 
 private:
 	void InitializeLayout();
 	void UpdateBatchLines();
 	void ProcessMouseInput();
 	void UpdateLayout();
-	void RenderSceneBVH();
-	void RenderBVHBox(const FAABB& Box, const FVector4& Color);
+	void AddSceneBVHLines(ULevel* InLevel);
 	TArray<UPrimitiveComponent*> FindCandidatePrimitives(ULevel* InLevel);
 
 	// 모든 기즈모 드래그 함수가 ActiveCamera를 받도록 통일
@@ -24,6 +24,19 @@ enum class EPIEState
     Paused
 };
 
+/**
+ * @brief PIE 자체 검사 결과
+ * 복제 방식마다 PIE를 한 번씩 돌린 뒤 에디터 레벨 상태 해시가 그대로인지 기록
+ */
+struct FPIECheckResult
+{
+    uint32 ActorCount = 0;
+    uint32 TickCount = 0;
+    uint32 EditedActorCount = 0;
+    bool bFullModified = false;
+    bool bCopyOnWriteModified = false;
+};
+
 /**
  * @brief 에디터의 최상위 제어 객체, World들을 관리
  * ClientApp 이외의 곳에서 별도로 생성하거나, GEditor 교체 절대 금지
@@ -69,6 +82,12 @@ public:
      * @brief PIE 재개
      */
     void ResumePIE();
+    /**
+     * @brief Full / CopyOnWrite 복제 방식마다 PIE 시작 -> 틱 -> 액터 이동 / 선택 / 스폰 / 삭제 -> PIE 종료를 실행하고
+     * 에디터 레벨 상태 해시가 PIE 전후로 같은지 검사
+     * @return PIE가 실행 중이거나 레벨이 없어 검사하지 못했으면 false
+     */
+    bool RunPIECheck(uint32 InTickCount, FPIECheckResult& OutResult);
 
     // Level Management
     /**
@@ -105,6 +124,9 @@ private:
 
     // PIE 시작 전 에디터의 ViewMode 저장
     EViewModeIndex SavedViewMode = EViewModeIndex::VMI_Lit;
+
+    // PIE 시작 시점 에디터 레벨 상태 해시 (PIE가 에디터 월드를 변경하지 않았는지 종료 시 검사)
+    uint64 EditorLevelFingerprint = 0;
 };
 
 // UEditorEngine의 전역 인스턴스 포인터
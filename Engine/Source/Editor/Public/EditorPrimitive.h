@@ -11,6 +11,7 @@ struct FEditorPrimitive
 	ID3D11Buffer* IndexBuffer = nullptr;
 	uint32 NumVertices;
 	uint32 NumIndices;
+	uint32 StartIndex = 0;	// 인덱스 버퍼의 일부만 그릴 때 시작 위치
 	D3D11_PRIMITIVE_TOPOLOGY Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 	FVector4 Color;
 	FVector Location;
@@ -454,6 +454,65 @@ bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
 	return true; // Traverse successful
 }
 
+bool FBVH::TraverseBox(const FMatrix& InLocalToBox, TArray<int32>& OutTriangleIndices) const
+{
+	OutTriangleIndices.clear();
+
+	if (RootIndex < 0 || RootIndex >= static_cast<int32>(Nodes.size()))
+	{
+		return false;
+	}
+
+	TArray<int32> NodeStack;
+	NodeStack.push_back(RootIndex);
+
+	while (!NodeStack.empty())
+	{
+		const FNode& CurrentNode = Nodes[NodeStack.back()];
+		NodeStack.pop_back();
+
+		// 노드 AABB를 박스 공간으로 옮긴 뒤 다시 감싸는 AABB (중심 변환 + |M| * Extents)
+		const FVector LocalCenter = CurrentNode.Box.GetCenter();
+		const FVector LocalExtents = (CurrentNode.Box.Max - CurrentNode.Box.Min) * 0.5f;
+		const FVector BoxCenter = InLocalToBox.TransformPosition(LocalCenter);
+
+		bool bSeparated = false;
+		for (int32 Axis = 0; Axis < 3 && !bSeparated; ++Axis)
+		{
+			const float BoxExtent =
+				LocalExtents.X * std::abs(InLocalToBox.Data[0][Axis]) +
+				LocalExtents.Y * std::abs(InLocalToBox.Data[1][Axis]) +
+				LocalExtents.Z * std::abs(InLocalToBox.Data[2][Axis]);
+			const float Center = Axis == 0 ? BoxCenter.X : (Axis == 1 ? BoxCenter.Y : BoxCenter.Z);
+			bSeparated = std::abs(Center) > 1.0f + BoxExtent;
+		}
+
+		if (bSeparated)
+		{
+			continue;
+		}
+
+		if (CurrentNode.bIsLeaf)
+		{
+			// TraverseRay와 같이 외부에는 삼각형 번호로 반환
+			OutTriangleIndices.push_back(CurrentNode.TriangleBaseIndex / 3);
+		}
+		else
+		{
+			if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
+			{
+				NodeStack.push_back(CurrentNode.Child1);
+			}
+			if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
+			{
+				NodeStack.push_back(CurrentNode.Child2);
+			}
+		}
+	}
+
+	return true;
+}
+
 void FBVH::Build(FStaticMesh* InMesh)
 {
 	if (!InMesh)
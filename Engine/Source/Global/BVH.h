@@ -51,6 +51,15 @@ public:
 	*/
 	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
 
+	/**
+	* @brief: 로컬 좌표를 박스 공간으로 옮겼을 때 [-1, 1]^3 박스와 AABB가 겹치는 리프의 삼각형 인덱스 리스트를 반환
+	* @param InLocalToBox: 메시 로컬 좌표 -> 박스 공간 변환 (비균등 스케일, 회전 포함 가능)
+	* @param OutTriangleIndices: 후보 삼각형 번호 리스트 (output, TraverseRay와 같이 Triangle ordinal)
+	* @return: 순회에 성공하면 true (후보가 없어도 true), 빈 트리면 false
+	* @note: 노드 판정은 변환된 AABB를 감싸는 AABB로 하므로 보수적, 정확한 삼각형 판정은 호출자가 수행
+	*/
+	bool TraverseBox(const FMatrix& InLocalToBox, TArray<int32>& OutTriangleIndices) const;
+
 	/**
 	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
 	* @param CandidateIndex: 후보 형제 노드 인덱스
@@ -3,86 +3,59 @@
 #define DT UTimeManager::GetInstance().GetDeltaTime()
 
 // UE_LOG Macro 시스템
+// 호출 스레드에서는 포맷 문자열 포인터와 인자만 캡처하고,
+// 실제 포맷팅과 stdout / 로그 파일 / 콘솔 출력은 FAsyncLogger의 로그 스레드에서 수행
+// 포맷 지정자와 인자의 개수 및 타입은 UELogFormat에서 컴파일 타임에 검증
 // 기본 UE_LOG (Info 타입)
 #define UE_LOG(fmt, ...) \
     do { \
-        printf(fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog("" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Info, "", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 // 로그 타입별 매크로들
 #define UE_LOG_INFO(fmt, ...) \
     do { \
-        printf("[INFO] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Info, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Info, "[INFO] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_WARNING(fmt, ...) \
     do { \
-        printf("[WARNING] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Warning, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Warning, "[WARNING] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_ERROR(fmt, ...) \
     do { \
-        printf("[ERROR] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Error, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Error, "[ERROR] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_SUCCESS(fmt, ...) \
     do { \
-        printf("[SUCCESS] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Success, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Success, "[SUCCESS] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_SYSTEM(fmt, ...) \
     do { \
-        printf("[SYSTEM] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::System, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::System, "[SYSTEM] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_DEBUG(fmt, ...) \
     do { \
-        printf("[DEBUG] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Debug, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Debug, "[DEBUG] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_COMMAND(fmt, ...) \
     do { \
-        printf("[CMD] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Command, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Command, "[CMD] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_TERMINAL(fmt, ...) \
     do { \
-        printf("[TERMINAL] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Terminal, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::Terminal, "[TERMINAL] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 #define UE_LOG_TERMINAL_ERROR(fmt, ...) \
     do { \
-        printf("[TERMINAL_ERROR] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::TerminalError, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
+        FAsyncLogger::Log(ELogType::TerminalError, "[TERMINAL_ERROR] ", UE_FORMAT_STRING("" fmt), ##__VA_ARGS__); \
     } while(0)
 
 
@@ -5,9 +5,26 @@
 
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+std::atomic<uint32> TotalAllocationBytes = 0;
+std::atomic<uint32> TotalAllocationCount = 0;
+std::atomic<uint32> PeakAllocationBytes = 0;
+
+/**
+ * @brief 할당 통계 갱신
+ * 통계 용도이므로 순서 보장 없이 relaxed로 처리
+ */
+static void RecordAllocation(size_t InSize)
+{
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	const uint32 NewTotalBytes = TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), std::memory_order_relaxed)
+		+ static_cast<uint32>(InSize);
+
+	uint32 PeakBytes = PeakAllocationBytes.load(std::memory_order_relaxed);
+	while (NewTotalBytes > PeakBytes &&
+		!PeakAllocationBytes.compare_exchange_weak(PeakBytes, NewTotalBytes, std::memory_order_relaxed))
+	{
+	}
+}
 
 /**
  * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
@@ -16,8 +33,7 @@ uint32 TotalAllocationCount = 0;
  */
 void* operator new(size_t InSize)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	RecordAllocation(InSize);
 
 	// Debug Print
 	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
@@ -48,23 +64,13 @@ void operator delete(void* InMemory) noexcept
 	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
 	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
 
-	if (TotalAllocationCount > 0)
-	{
-		--TotalAllocationCount;
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
-	}
+	const uint32 PreviousCount = TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+	assert(PreviousCount > 0 && u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
+	(void)PreviousCount;
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
-	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
-	}
+	const uint32 PreviousBytes = TotalAllocationBytes.fetch_sub(static_cast<uint32>(MemoryAllocSize), std::memory_order_relaxed);
+	assert(PreviousBytes >= MemoryAllocSize && u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
+	(void)PreviousBytes;
 
 	if (MemoryHeader->bIsAligned)
 	{
@@ -103,8 +109,7 @@ void* operator new(size_t InSize, align_val_t InAlignment)
 {
 	size_t Alignment = static_cast<size_t>(InAlignment);
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	RecordAllocation(InSize);
 
 	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
 	size_t TotalSize = sizeof(AllocHeader) + InSize;
@@ -1,7 +1,11 @@
 #pragma once
+#include <atomic>
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+// 로그 스레드 / 워커 스레드에서도 할당이 일어나므로 원자적으로 갱신
+extern std::atomic<uint32> TotalAllocationBytes;
+extern std::atomic<uint32> TotalAllocationCount;
+// 측정 구간의 최대 할당량 확인용 (구간 시작 시 TotalAllocationBytes로 초기화해서 사용)
+extern std::atomic<uint32> PeakAllocationBytes;
 
 struct AllocHeader
 {
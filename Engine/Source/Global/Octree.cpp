@@ -271,6 +271,44 @@ void FOctree::DeepCopy(FOctree* OutOctree) const
 	}
 }
 
+void FOctree::DeepCopy(FOctree* OutOctree, const TMap<UPrimitiveComponent*, UPrimitiveComponent*>& InRemap) const
+{
+	if (!OutOctree) { return; }
+
+	OutOctree->BoundingBox = BoundingBox;
+	OutOctree->Depth = Depth;
+
+	// 프리미티브는 매핑된 대상 포인터로 교체
+	OutOctree->Primitives.clear();
+	OutOctree->Primitives.reserve(Primitives.size());
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		if (auto It = InRemap.find(Primitive); It != InRemap.end())
+		{
+			OutOctree->Primitives.push_back(It->second);
+		}
+	}
+
+	for (FOctree* Child : OutOctree->Children)
+	{
+		SafeDelete(Child);
+	}
+	OutOctree->Children.clear();
+	OutOctree->Children.resize(8, nullptr);
+
+	if (!IsLeaf())
+	{
+		for (int Index = 0; Index < 8; ++Index)
+		{
+			if (Children[Index] != nullptr)
+			{
+				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth);
+				Children[Index]->DeepCopy(OutOctree->Children[Index], InRemap);
+			}
+		}
+	}
+}
+
 bool FOctree::RemoveByIdentityInternal(FOctree* Node, UPrimitiveComponent* Prim)
 {
 	if (!Node || !Prim) return false;
@@ -36,6 +36,16 @@ public:
 	 */
 	void DeepCopy(FOctree* OutOctree) const;
 
+	/**
+	 * DeepCopy와 같은 구조 복사이지만 Primitive 포인터를 InRemap에 따라 교체합니다.
+	 * - 복제된 레벨처럼 동일한 Transform의 새 컴포넌트로 트리를 옮길 때 사용 (AABB 재계산/재삽입 없음)
+	 * - InRemap에 없는 Primitive는 복사하지 않습니다.
+	 *
+	 * @param OutOctree 복사 대상 Octree (nullptr가 아니어야 함)
+	 * @param InRemap 원본 Primitive -> 대상 Primitive 매핑
+	 */
+	void DeepCopy(FOctree* OutOctree, const TMap<UPrimitiveComponent*, UPrimitiveComponent*>& InRemap) const;
+
 	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
 	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
 
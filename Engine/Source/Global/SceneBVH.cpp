@@ -21,6 +21,39 @@ void FSceneBVH::Clear()
 	RootIndex = -1;
 	Cost = 0.0f;
 	ComponentToNodeMap.clear();
+	RefitMarks.clear();
+	RefitPendingChildCounts.clear();
+}
+
+bool FSceneBVH::CopyFrom(const FSceneBVH& InSource, const TMap<UPrimitiveComponent*, UPrimitiveComponent*>& InRemap)
+{
+	Nodes = InSource.Nodes;
+	RootIndex = InSource.RootIndex;
+	Cost = InSource.Cost;
+
+	ComponentToNodeMap.clear();
+	ComponentToNodeMap.reserve(InSource.ComponentToNodeMap.size());
+
+	for (int32 Index = 0; Index < static_cast<int32>(Nodes.size()); ++Index)
+	{
+		FSceneNode& Node = Nodes[Index];
+		if (!Node.bIsLeaf || !Node.Component)
+		{
+			continue;
+		}
+
+		auto It = InRemap.find(Node.Component);
+		if (It == InRemap.end())
+		{
+			Clear();
+			return false;
+		}
+
+		Node.Component = It->second;
+		ComponentToNodeMap[Node.Component] = Index;
+	}
+
+	return true;
 }
 
 int32 FSceneBVH::InsertLeaf(UPrimitiveComponent* InComponent)
@@ -701,17 +734,119 @@ bool FSceneBVH::RefitComponent(UPrimitiveComponent* InComponent)
 		return true;
 	}
 
-	// 2. Leaf 노드의 AABB를 새 Transform에 맞춰 갱신
+	// 2. Leaf 노드의 AABB를 새 Transform에 맞춰 갱신하고 부모부터 루트까지 리핏
+	MarkLeafForRefit(InComponent);
+	RefitMarkedAncestors();
+
+	return true;
+}
+
+int32 FSceneBVH::RefitComponents(const TArray<UPrimitiveComponent*>& InComponents)
+{
+	int32 RefitLeafCount = 0;
+	for (UPrimitiveComponent* Component : InComponents)
+	{
+		if (MarkLeafForRefit(Component))
+		{
+			++RefitLeafCount;
+		}
+	}
+
+	RefitMarkedAncestors();
+	return RefitLeafCount;
+}
+
+bool FSceneBVH::MarkLeafForRefit(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return false;
+	}
+
+	const int32 LeafIndex = FindLeafNode(InComponent);
+	if (LeafIndex == -1)
+	{
+		return false;
+	}
+
+	if (RefitMarks.size() < Nodes.size())
+	{
+		RefitMarks.resize(Nodes.size(), 0);
+		RefitPendingChildCounts.resize(Nodes.size(), 0);
+	}
+
+	// 같은 리프가 여러 번 들어오면 한 번만 갱신
+	if (RefitMarks[LeafIndex])
+	{
+		return false;
+	}
+	RefitMarks[LeafIndex] = 1;
+	RefitLeafIndices.push_back(LeafIndex);
+
 	FVector WorldMin, WorldMax;
 	InComponent->GetWorldAABB(WorldMin, WorldMax);
-	FAABB NewLeafAABB(WorldMin, WorldMax);
-
 	FSceneNode& LeafNode = Nodes[LeafIndex];
+	const FAABB NewLeafAABB(WorldMin, WorldMax);
+	Cost += NewLeafAABB.GetSurfaceArea() - LeafNode.Box.GetSurfaceArea();
 	LeafNode.Box = NewLeafAABB;
 
-	// 3. 부모 노드부터 루트까지 올라가며 AABB 리핏
-	// RefitAncestors는 내부적으로 부모부터 시작하므로 LeafIndex 전달
-	RefitAncestors(LeafIndex);
+	// 이미 표시된 조상을 만나면 그 위는 다른 리프가 표시한 경로이므로 중단
+	int32 AncestorIndex = LeafNode.ParentIndex;
+	while (AncestorIndex != -1 && !RefitMarks[AncestorIndex])
+	{
+		RefitMarks[AncestorIndex] = 1;
+		RefitAncestorIndices.push_back(AncestorIndex);
+		AncestorIndex = Nodes[AncestorIndex].ParentIndex;
+	}
 
 	return true;
 }
+
+void FSceneBVH::RefitMarkedAncestors()
+{
+	// 표시된 조상마다 "표시된 자식 조상 수"를 세고, 0인 노드부터 처리 (자식이 항상 부모보다 먼저 리핏됨)
+	for (int32 AncestorIndex : RefitAncestorIndices)
+	{
+		const int32 ParentIndex = Nodes[AncestorIndex].ParentIndex;
+		if (ParentIndex != -1)
+		{
+			++RefitPendingChildCounts[ParentIndex];
+		}
+	}
+
+	RefitReadyIndices.clear();
+	for (int32 AncestorIndex : RefitAncestorIndices)
+	{
+		if (RefitPendingChildCounts[AncestorIndex] == 0)
+		{
+			RefitReadyIndices.push_back(AncestorIndex);
+		}
+	}
+
+	while (!RefitReadyIndices.empty())
+	{
+		const int32 CurrentIndex = RefitReadyIndices.back();
+		RefitReadyIndices.pop_back();
+
+		FSceneNode& Current = Nodes[CurrentIndex];
+		const FAABB NewBox = Union(Nodes[Current.Child1].Box, Nodes[Current.Child2].Box);
+		Cost += NewBox.GetSurfaceArea() - Current.Box.GetSurfaceArea();
+		Current.Box = NewBox;
+
+		if (Current.ParentIndex != -1 && --RefitPendingChildCounts[Current.ParentIndex] == 0)
+		{
+			RefitReadyIndices.push_back(Current.ParentIndex);
+		}
+	}
+
+	for (int32 LeafIndex : RefitLeafIndices)
+	{
+		RefitMarks[LeafIndex] = 0;
+	}
+	for (int32 AncestorIndex : RefitAncestorIndices)
+	{
+		RefitMarks[AncestorIndex] = 0;
+	}
+	RefitLeafIndices.clear();
+	RefitAncestorIndices.clear();
+}
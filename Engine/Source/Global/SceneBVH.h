@@ -35,6 +35,15 @@ public:
 	*/
 	void Build(const TArray<UPrimitiveComponent*>& InComponents);
 
+	/**
+	* @brief: 다른 BVH의 노드 구조를 그대로 복사하고 리프의 Component만 InRemap에 따라 교체
+	* @param InSource: 복사할 원본 BVH
+	* @param InRemap: 원본 Component -> 대상 Component 매핑
+	* @return: 모든 리프가 매핑되어 복사에 성공하면 true (실패 시 BVH는 비워짐)
+	* @note: 대상 Component가 원본과 같은 Transform일 때만 유효 (PIE 레벨 복제용, AABB 재계산 없음)
+	*/
+	bool CopyFrom(const FSceneBVH& InSource, const TMap<UPrimitiveComponent*, UPrimitiveComponent*>& InRemap);
+
 	/**
 	* @brief: BVH 초기화
 	*/
@@ -98,6 +107,15 @@ public:
 	*/
 	bool RefitComponent(UPrimitiveComponent* InComponent);
 
+	/**
+	* @brief: 여러 Component의 Transform 변경을 한 번에 반영
+	* @param InComponents: Transform이 변경된 Component 배열 (중복 허용, BVH에 없는 Component는 무시)
+	* @return: 갱신된 리프 수
+	* @note: 리프 AABB를 모두 갱신한 뒤 영향받은 조상을 아래에서 위로 한 번씩만 리핏
+	*        비용은 O(리프 수 + 영향받은 조상 수), Component마다 루트까지 올라가는 RefitComponent 반복보다 빠름
+	*/
+	int32 RefitComponents(const TArray<UPrimitiveComponent*>& InComponents);
+
 	/**
 	* @brief: 특정 Component를 BVH에서 제거
 	* @param InComponent: 제거할 Component
@@ -143,10 +161,24 @@ private:
 	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
 	void RefitAncestors(int32 RefitStartIndex);
 
+	// --- 일괄 리핏 보조 메소드들 ---
+
+	//@brief 리프 AABB를 갱신하고, 아직 표시되지 않은 조상까지만 올라가며 리핏 대상으로 표시.
+	bool MarkLeafForRefit(UPrimitiveComponent* InComponent);
+	//@brief 표시된 조상들을 자식이 먼저 처리되는 순서로 리핏하고 표시를 해제.
+	void RefitMarkedAncestors();
+
 	TArray<FSceneNode> Nodes;
 	int32 RootIndex = -1;
 	float Cost = 0.0f;
 
 	// Component -> Node Index 매핑 (O(1) 검색을 위함)
 	TMap<UPrimitiveComponent*, int32> ComponentToNodeMap;
+
+	// 일괄 리핏용 작업 버퍼 (Nodes와 같은 인덱스, 리핏이 끝나면 항상 0으로 되돌림)
+	TArray<uint8> RefitMarks;
+	TArray<uint8> RefitPendingChildCounts;
+	TArray<int32> RefitLeafIndices;
+	TArray<int32> RefitAncestorIndices;
+	TArray<int32> RefitReadyIndices;
 };
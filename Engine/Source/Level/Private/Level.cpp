@@ -9,9 +9,13 @@
 #include "Render/Renderer/Public/Renderer.h"
 #include "Editor/Public/Viewport.h"
 #include "Utility/Public/JsonSerializer.h"
+#include "Utility/Public/JsonStreamReader.h"
+#include "Level/Public/LevelBinaryFormat.h"
 #include "Utility/Public/ActorTypeMapper.h"
 #include "Global/Octree.h"
 #include "Global/SceneBVH.h"
+#include "Render/Renderer/Public/RenderScene.h"
+#include "Manager/Asset/Public/AssetManager.h"
 #include <json.hpp>
 
 #include "Component/Public/UUIDTextComponent.h"
@@ -19,15 +23,52 @@
 
 IMPLEMENT_CLASS(ULevel, UObject)
 
+namespace
+{
+	// 레벨 로드 시 스폰보다 먼저 읽어둘 액터 수
+	// 이 구간의 StaticMesh를 로더 스레드가 읽는 동안 메인 스레드는 앞쪽 액터를 스폰
+	constexpr size_t AssetPrefetchWindow = 64;
+
+	// 액터 JSON 안의 모든 "ObjStaticMeshAsset" 경로를 로더 스레드에 요청
+	void PrefetchActorAssets(const JSON& InJson)
+	{
+		if (InJson.JSONType() == JSON::Class::Object)
+		{
+			for (const auto& Pair : InJson.ObjectRange())
+			{
+				if (Pair.first == "ObjStaticMeshAsset" && Pair.second.JSONType() == JSON::Class::String)
+				{
+					UAssetManager::GetInstance().PrefetchStaticMesh(FName(Pair.second.ToString()));
+				}
+				else
+				{
+					PrefetchActorAssets(Pair.second);
+				}
+			}
+		}
+		else if (InJson.JSONType() == JSON::Class::Array)
+		{
+			for (const JSON& Element : InJson.ArrayRange())
+			{
+				PrefetchActorAssets(Element);
+			}
+		}
+	}
+}
+
+ELevelDuplicationMode ULevel::DuplicationMode = ELevelDuplicationMode::Full;
+
 ULevel::ULevel()
 {
 	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	RenderScene = new FRenderScene();
 }
 
 ULevel::ULevel(const FName& InName)
 	: UObject(InName)
 {
 	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	RenderScene = new FRenderScene();
 }
 
 ULevel::~ULevel()
@@ -42,6 +83,7 @@ ULevel::~ULevel()
 	// 모든 액터 객체가 삭제되었으므로, 포인터를 담고 있던 컨테이너들을 비웁니다.
 	SafeDelete(StaticOctree);
 	SafeDelete(SceneBVH);
+	SafeDelete(RenderScene);
 	DynamicPrimitives.clear();
 }
 
@@ -59,8 +101,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		JSON PerspectiveCameraData;
 		if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
 		{
-			UConfigManager::GetInstance().SetCameraSettingsFromJson(PerspectiveCameraData);
-			URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
+			ApplyPerspectiveCameraJson(PerspectiveCameraData);
 		}
 
 		JSON ActorsJson;
@@ -68,14 +109,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		{
 			for (auto& Pair : ActorsJson.ObjectRange())
 			{
-				const FString& IdString = Pair.first;
-				JSON& ActorDataJson = Pair.second;
-
-				FString TypeString;
-				FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
-
-				UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-				AActor* NewActor = SpawnActorToLevel(NewClass, IdString, &ActorDataJson);
+				SpawnActorFromJson(Pair.first, Pair.second);
 			}
 		}
 
@@ -90,9 +124,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		// NOTE: 레벨 로드 시 NextUUID를 변경하면 UUID 충돌이 발생하므로 관련 기능 구현을 보류합니다.
 		InOutHandle["NextUUID"] = 0;
 
-		// GetCameraSetting 호출 전에 뷰포트 클라이언트의 최신 데이터를 ConfigManager로 동기화합니다.
-		URenderer::GetInstance().GetViewportClient()->UpdateCameraSettingsToConfig();
-		InOutHandle["PerspectiveCamera"] = UConfigManager::GetInstance().GetCameraSettingsAsJson();
+		InOutHandle["PerspectiveCamera"] = CapturePerspectiveCameraJson();
 
 		JSON ActorsJson = json::Object();
 		for (AActor* Actor : Actors)
@@ -107,6 +139,148 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
+bool ULevel::LoadFromJsonStream(FJsonStreamReader& InReader)
+{
+	if (!InReader.ReadObjectStart())
+	{
+		return false;
+	}
+
+	FString Key;
+	while (InReader.ReadNextKey(Key))
+	{
+		if (Key == "Actors")
+		{
+			if (!InReader.ReadObjectStart())
+			{
+				break;
+			}
+
+			// 액터를 AssetPrefetchWindow개만큼 앞서 읽어 애셋을 미리 요청하고, 스폰은 그 뒤를 따라가며 수행
+			// 스폰한 액터의 JSON은 바로 해제하므로 메모리에는 창 크기만큼만 남음
+			TDeque<TPair<FString, JSON>> PendingActors;
+			FString IdString;
+			while (InReader.ReadNextKey(IdString))
+			{
+				JSON ActorDataJson;
+				if (!InReader.ReadValue(ActorDataJson))
+				{
+					break;
+				}
+
+				PrefetchActorAssets(ActorDataJson);
+				PendingActors.emplace_back(std::move(IdString), std::move(ActorDataJson));
+				if (PendingActors.size() > AssetPrefetchWindow)
+				{
+					SpawnActorFromJson(PendingActors.front().first, PendingActors.front().second);
+					PendingActors.pop_front();
+				}
+			}
+
+			for (auto& PendingActor : PendingActors)
+			{
+				SpawnActorFromJson(PendingActor.first, PendingActor.second);
+			}
+		}
+		else if (Key == "PerspectiveCamera")
+		{
+			JSON PerspectiveCameraData;
+			if (InReader.ReadValue(PerspectiveCameraData))
+			{
+				ApplyPerspectiveCameraJson(PerspectiveCameraData);
+			}
+		}
+		else
+		{
+			// NOTE: NextUUID는 Serialize와 마찬가지로 UUID 충돌 문제로 사용하지 않음
+			InReader.SkipValue();
+		}
+	}
+
+	// 모든 액터 로드 완료 후 BVH 리빌드 플래그 설정
+	bBVHNeedsRebuild = true;
+
+	return !InReader.HasError();
+}
+
+AActor* ULevel::SpawnActorFromJson(const FString& InIdString, JSON& InActorDataJson)
+{
+	FString TypeString;
+	FJsonSerializer::ReadString(InActorDataJson, "Type", TypeString);
+
+	UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
+	return SpawnActorToLevel(NewClass, InIdString, &InActorDataJson);
+}
+
+void ULevel::ApplyPerspectiveCameraJson(JSON& InCameraJson)
+{
+	UConfigManager::GetInstance().SetCameraSettingsFromJson(InCameraJson);
+	URenderer::GetInstance().GetViewportClient()->ApplyAllCameraDataToViewportClients();
+}
+
+JSON ULevel::CapturePerspectiveCameraJson()
+{
+	// GetCameraSetting 호출 전에 뷰포트 클라이언트의 최신 데이터를 ConfigManager로 동기화합니다.
+	URenderer::GetInstance().GetViewportClient()->UpdateCameraSettingsToConfig();
+	return UConfigManager::GetInstance().GetCameraSettingsAsJson();
+}
+
+bool ULevel::SaveToBinaryFile(const path& InFilePath)
+{
+	// Actor::Serialize는 엔진 상태를 참조하므로 액터 JSON 생성까지는 호출 스레드에서 수행
+	TArray<FLevelBinaryActorRecord> Records(Actors.size());
+	for (size_t Index = 0; Index < Actors.size(); ++Index)
+	{
+		AActor* Actor = Actors[Index];
+		FLevelBinaryActorRecord& Record = Records[Index];
+		Record.IdString = std::to_string(Actor->GetUUID());
+		Record.TypeString = FActorTypeMapper::ActorToType(Actor->GetClass());
+		Record.Data["Type"] = Record.TypeString;
+		Actor->Serialize(false, Record.Data);
+	}
+
+	return FLevelBinaryFormat::Write(InFilePath, CapturePerspectiveCameraJson(), Records);
+}
+
+bool ULevel::LoadFromBinaryFile(const path& InFilePath)
+{
+	// JSON 로드와 같이 AssetPrefetchWindow개만큼 앞서 애셋을 요청하고 스폰은 뒤따라가며 수행
+	TDeque<FLevelBinaryActorRecord> PendingRecords;
+	auto SpawnRecord = [this](FLevelBinaryActorRecord& InRecord)
+	{
+		UClass* NewClass = FActorTypeMapper::TypeToActor(InRecord.TypeString);
+		SpawnActorToLevel(NewClass, InRecord.IdString, &InRecord.Data);
+	};
+
+	JSON PerspectiveCameraData;
+	const bool bSucceeded = FLevelBinaryFormat::Read(InFilePath, PerspectiveCameraData,
+		[&PendingRecords, &SpawnRecord](FLevelBinaryActorRecord& InRecord)
+		{
+			PrefetchActorAssets(InRecord.Data);
+			PendingRecords.push_back(std::move(InRecord));
+			if (PendingRecords.size() > AssetPrefetchWindow)
+			{
+				SpawnRecord(PendingRecords.front());
+				PendingRecords.pop_front();
+			}
+		});
+
+	for (FLevelBinaryActorRecord& Record : PendingRecords)
+	{
+		SpawnRecord(Record);
+	}
+
+	if (PerspectiveCameraData.JSONType() == JSON::Class::Object)
+	{
+		ApplyPerspectiveCameraJson(PerspectiveCameraData);
+	}
+
+	// 모든 액터 로드 완료 후 BVH 리빌드 플래그 설정
+	bBVHNeedsRebuild = true;
+
+	return bSucceeded;
+}
+
 void ULevel::Init()
 {
 	// TEST CODE
@@ -188,8 +362,11 @@ void ULevel::RegisterPrimitiveComponent(UPrimitiveComponent* InComponent)
 	if (SceneBVH && !Cast<UUUIDTextComponent>(InComponent))
 	{
 		SceneBVH->RefitComponent(InComponent);
+		PendingDecalReceiverPatches.push_back(InComponent);
 	}
 
+	RenderScene->AddPrimitive(InComponent);
+
 	UE_LOG("Level: '%s' 컴포넌트를 씬에 등록했습니다.", InComponent->GetName().ToString().data());
 }
 
@@ -215,6 +392,22 @@ void ULevel::UnregisterPrimitiveComponent(UPrimitiveComponent* InComponent)
 	{
 		SceneBVH->RemoveComponent(InComponent);
 	}
+
+	// 리핏 대기 중이었다면 대기열에서도 제거
+	if (auto It = std::find(PendingBVHRefitComponents.begin(), PendingBVHRefitComponents.end(), InComponent);
+		It != PendingBVHRefitComponents.end())
+	{
+		*It = PendingBVHRefitComponents.back();
+		PendingBVHRefitComponents.pop_back();
+	}
+
+	RenderScene->RemovePrimitive(InComponent);
+
+	// Decal Receiver 캐시에서 제거
+	DetachDecalReceiver(InComponent);
+	PendingDecalReceiverPatches.erase(
+		std::remove(PendingDecalReceiverPatches.begin(), PendingDecalReceiverPatches.end(), InComponent),
+		PendingDecalReceiverPatches.end());
 }
 
 void ULevel::AddPrimitiveComponent(AActor* Actor)
@@ -230,6 +423,7 @@ void ULevel::AddPrimitiveComponent(AActor* Actor)
 		{
 			DynamicPrimitives.push_back(PrimitiveComponent);
 		}
+		RenderScene->AddPrimitive(PrimitiveComponent);
 	}
 
 	// BVH 재구축은 호출자가 명시적으로 수행
@@ -241,6 +435,12 @@ bool ULevel::DestroyActor(AActor* InActor)
 {
 	if (!InActor) return false;
 
+	// 공유 중인 액터는 복사 없이 이 레벨의 자료구조에서만 제거하고, 컴포넌트는 원본 소유로 남김
+	if (InActor->IsSharingComponents())
+	{
+		SharedActorProxies.erase(InActor->GetSharedComponentSource());
+	}
+
 	// 컴포넌트들을 옥트리와 BVH에서 제거
 	for (auto& Component : InActor->GetOwnedComponents())
 	{
@@ -292,6 +492,9 @@ void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* Primitive)
 			DynamicPrimitives.push_back(Primitive);
 		}
 	}
+
+	// 옥트리에서 빠지면 컬링 경로가 바뀌므로 카메라가 다시 컬링하도록 함
+	RenderScene->BumpRevision();
 }
 
 UObject* ULevel::Duplicate()
@@ -301,62 +504,315 @@ UObject* ULevel::Duplicate()
 	return Level;
 }
 
+namespace
+{
+	/**
+	 * @brief 원본 액터와 복제 액터의 컴포넌트 트리를 나란히 순회하며 같은 위치의 컴포넌트 쌍마다 InFunction 호출
+	 * USceneComponent::DuplicateSubObjects가 자식 순서를 유지하며 복제하므로 같은 위치끼리 대응됨
+	 */
+	template<typename FunctionType>
+	void ForEachDuplicatedComponentPair(USceneComponent* InSourceRoot, USceneComponent* InDuplicatedRoot, FunctionType&& InFunction)
+	{
+		TArray<TPair<USceneComponent*, USceneComponent*>> Stack;
+		Stack.emplace_back(InSourceRoot, InDuplicatedRoot);
+
+		while (!Stack.empty())
+		{
+			auto [Source, Duplicated] = Stack.back();
+			Stack.pop_back();
+			if (!Source || !Duplicated)
+			{
+				continue;
+			}
+
+			InFunction(Source, Duplicated);
+
+			const TArray<USceneComponent*> SourceChildren = Source->GetChildren();
+			const TArray<USceneComponent*> DuplicatedChildren = Duplicated->GetChildren();
+			const size_t ChildCount = std::min(SourceChildren.size(), DuplicatedChildren.size());
+			for (size_t Index = 0; Index < ChildCount; ++Index)
+			{
+				Stack.emplace_back(SourceChildren[Index], DuplicatedChildren[Index]);
+			}
+		}
+	}
+
+	/**
+	 * @brief 원본 액터와 복제 액터의 컴포넌트 트리로 원본 -> 복제 매핑 추가
+	 */
+	void AddComponentRemap(USceneComponent* InSourceRoot, USceneComponent* InDuplicatedRoot,
+		TMap<UPrimitiveComponent*, UPrimitiveComponent*>& OutPrimitiveRemap,
+		TMap<UDecalComponent*, UDecalComponent*>& OutDecalRemap)
+	{
+		ForEachDuplicatedComponentPair(InSourceRoot, InDuplicatedRoot,
+			[&](USceneComponent* Source, USceneComponent* Duplicated)
+			{
+				if (UPrimitiveComponent* SourcePrimitive = Cast<UPrimitiveComponent>(Source))
+				{
+					OutPrimitiveRemap.emplace(SourcePrimitive, static_cast<UPrimitiveComponent*>(Duplicated));
+				}
+				else if (UDecalComponent* SourceDecal = Cast<UDecalComponent>(Source))
+				{
+					OutDecalRemap.emplace(SourceDecal, static_cast<UDecalComponent*>(Duplicated));
+				}
+			});
+	}
+
+	template<typename T>
+	void RemapPointers(const TArray<T*>& InSource, const TMap<T*, T*>& InRemap, TArray<T*>& OutDestination)
+	{
+		OutDestination.clear();
+		OutDestination.reserve(InSource.size());
+		for (T* Pointer : InSource)
+		{
+			if (auto It = InRemap.find(Pointer); It != InRemap.end())
+			{
+				OutDestination.push_back(It->second);
+			}
+		}
+	}
+}
+
+/**
+ * @brief PIE 레벨 복제
+ * 액터/컴포넌트는 복제하되, Octree / SceneBVH / Decal 캐시는 다시 삽입하지 않고
+ * 원본 구조를 그대로 복사한 뒤 원본 -> 복제 컴포넌트 매핑으로 포인터만 교체
+ * 복제 직후 컴포넌트의 Transform은 원본과 동일하므로 저장된 AABB를 그대로 사용할 수 있음
+ *
+ * CopyOnWrite 모드에서는 공유 가능한 액터의 컴포넌트를 복사하지 않고 원본 포인터를 그대로 매핑
+ * (MaterializeSharedActor에서 첫 선택/변경/삭제 시점에 복사)
+ */
 void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 {
 	Super::DuplicateSubObjects(DuplicatedObject);
 	ULevel* DuplicatedLevel = Cast<ULevel>(DuplicatedObject);
 
+	// 복제 레벨의 컨테이너는 원본 크기로 미리 할당
+	const size_t PrimitiveCountEstimate = DynamicPrimitives.size() + Actors.size() * 2;
+	TMap<UPrimitiveComponent*, UPrimitiveComponent*> PrimitiveRemap;
+	TMap<UDecalComponent*, UDecalComponent*> DecalRemap;
+	PrimitiveRemap.reserve(PrimitiveCountEstimate);
+	DecalRemap.reserve(AllDecals.size());
+	DuplicatedLevel->Actors.reserve(Actors.size());
+
+	const bool bCopyOnWrite = DuplicationMode == ELevelDuplicationMode::CopyOnWrite;
 	for (AActor* Actor : Actors)
 	{
-		AActor* DuplicatedActor = Cast<AActor>(Actor->Duplicate());
+		AActor* DuplicatedActor = nullptr;
+		if (bCopyOnWrite && Actor->CanShareComponentsWithDuplicate())
+		{
+			DuplicatedActor = Actor->DuplicateSharingComponents();
+			DuplicatedLevel->SharedActorProxies.emplace(Actor, DuplicatedActor);
+		}
+		else
+		{
+			DuplicatedActor = Cast<AActor>(Actor->Duplicate());
+		}
 		DuplicatedLevel->Actors.push_back(DuplicatedActor);
-		DuplicatedLevel->AddPrimitiveComponent(DuplicatedActor);
+		AddComponentRemap(Actor->GetRootComponent(), DuplicatedActor->GetRootComponent(), PrimitiveRemap, DecalRemap);
+	}
+
+	// Octree / Dynamic 목록 구조 복사
+	StaticOctree->DeepCopy(DuplicatedLevel->StaticOctree, PrimitiveRemap);
+	RemapPointers(DynamicPrimitives, PrimitiveRemap, DuplicatedLevel->DynamicPrimitives);
 
-		// DecalComponent도 등록 (PrimitiveComponent와 별도 관리)
-		for (auto& Component : DuplicatedActor->GetOwnedComponents())
+	// Decal 캐시 복사 (RegisterDecalComponent와 같이 전부 Dirty로 시작)
+	RemapPointers(AllDecals, DecalRemap, DuplicatedLevel->AllDecals);
+	RemapPointers(VisibleDecals, DecalRemap, DuplicatedLevel->VisibleDecals);
+	DuplicatedLevel->DirtyDecals.clear();
+	DuplicatedLevel->DirtyDecals.reserve(DuplicatedLevel->AllDecals.size());
+	DuplicatedLevel->DirtyDecals.insert(DuplicatedLevel->AllDecals.begin(), DuplicatedLevel->AllDecals.end());
+	DuplicatedLevel->bDecalsDirty = !DuplicatedLevel->AllDecals.empty();
+
+	// SceneBVH 노드 배열 복사
+	// 원본이 리빌드 대기 중이면 복사할 구조가 없으므로 복제 레벨도 다음 TickLevel에서 빌드
+	if (SceneBVH)
+	{
+		SafeDelete(DuplicatedLevel->SceneBVH);
+		DuplicatedLevel->SceneBVH = new FSceneBVH();
+
+		if (bBVHNeedsRebuild || !DuplicatedLevel->SceneBVH->CopyFrom(*SceneBVH, PrimitiveRemap))
 		{
-			if (UDecalComponent* DecalComp = Cast<UDecalComponent>(Component))
-			{
-				DuplicatedLevel->RegisterDecalComponent(DecalComp);
-			}
+			DuplicatedLevel->bBVHNeedsRebuild = true;
 		}
 	}
+	else
+	{
+		DuplicatedLevel->bBVHNeedsRebuild = bBVHNeedsRebuild;
+	}
 
-	// SceneBVH 복제
-	// PIE 월드에서도 BVH를 사용할 수 있도록 복제
-	if (SceneBVH)
+	// 렌더 씬은 공유 컴포넌트의 프록시 인덱스를 복제 레벨 기준으로 다시 맞춰야 하므로 처음 그릴 때 재구축
+	DuplicatedLevel->RenderScene->MarkNeedsRebuild();
+
+	UE_LOG("Level: Duplicated %zu actors (Shared: %zu, Primitives: %zu, Decals: %zu, BVH nodes: %d)",
+		DuplicatedLevel->Actors.size(), DuplicatedLevel->SharedActorProxies.size(), PrimitiveRemap.size(),
+		DuplicatedLevel->AllDecals.size(), DuplicatedLevel->SceneBVH ? DuplicatedLevel->SceneBVH->GetNodeCount() : 0);
+}
+
+void ULevel::MaterializeSharedActor(AActor* InActor, TMap<USceneComponent*, USceneComponent*>* OutRemap)
+{
+	if (!InActor || !InActor->IsSharingComponents())
+	{
+		return;
+	}
+
+	AActor* Source = InActor->GetSharedComponentSource();
+	const TArray<UActorComponent*> SharedComponents = InActor->GetOwnedComponents();
+
+	// 공유 컴포넌트를 이 레벨의 자료구조에서 먼저 제거 (원본 컴포넌트 자체는 건드리지 않음)
+	for (UActorComponent* Component : SharedComponents)
+	{
+		UnregisterPrimitiveComponent(Cast<UPrimitiveComponent>(Component));
+	}
+
+	InActor->MaterializeSharedComponents();
+	SharedActorProxies.erase(Source);
+
+	for (UActorComponent* Component : InActor->GetOwnedComponents())
 	{
-		// 기존 BVH가 있으면 삭제
-		if (DuplicatedLevel->SceneBVH)
+		RegisterPrimitiveComponent(Cast<UPrimitiveComponent>(Component));
+	}
+
+	if (OutRemap)
+	{
+		ForEachDuplicatedComponentPair(Source->GetRootComponent(), InActor->GetRootComponent(),
+			[OutRemap](USceneComponent* InShared, USceneComponent* InDuplicated)
+			{
+				OutRemap->emplace(InShared, InDuplicated);
+			});
+	}
+
+	UE_LOG("Level: Materialized shared actor '%s' (%zu components, %zu still shared)",
+		InActor->GetName().ToString().data(), InActor->GetOwnedComponents().size(), SharedActorProxies.size());
+}
+
+AActor* ULevel::ResolveSharedActorForEdit(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return nullptr;
+	}
+
+	// 피킹 결과로 얻은 공유 컴포넌트의 Owner(원본 액터)라면 이 레벨의 복제 액터로 변환
+	if (auto It = SharedActorProxies.find(InActor); It != SharedActorProxies.end())
+	{
+		InActor = It->second;
+	}
+
+	MaterializeSharedActor(InActor);
+	return InActor;
+}
+
+UActorComponent* ULevel::ResolveSharedComponentForEdit(UActorComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return nullptr;
+	}
+
+	auto It = SharedActorProxies.find(InComponent->GetOwner());
+	if (It == SharedActorProxies.end())
+	{
+		return InComponent;
+	}
+
+	TMap<USceneComponent*, USceneComponent*> Remap;
+	MaterializeSharedActor(It->second, &Remap);
+
+	// 공유 가능한 액터의 컴포넌트는 모두 SceneComponent이므로 매핑에 없으면 이 레벨 소유가 아님
+	auto RemapIt = Remap.find(Cast<USceneComponent>(InComponent));
+	return RemapIt != Remap.end() ? RemapIt->second : nullptr;
+}
+
+uint64 ULevel::ComputeStateFingerprint() const
+{
+	// FNV-1a
+	uint64 Hash = 14695981039346656037ull;
+	auto HashBytes = [&Hash](const void* InData, size_t InSize)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(InData);
+		for (size_t Index = 0; Index < InSize; ++Index)
 		{
-			SafeDelete(DuplicatedLevel->SceneBVH);
+			Hash = (Hash ^ Bytes[Index]) * 1099511628211ull;
 		}
+	};
+	auto HashValue = [&HashBytes](const auto& InValue)
+	{
+		HashBytes(&InValue, sizeof(InValue));
+	};
 
-		// 새로운 BVH 생성하고 복제된 컴포넌트들로 빌드
-		DuplicatedLevel->SceneBVH = new FSceneBVH();
+	HashValue(Actors.size());
+	for (AActor* Actor : Actors)
+	{
+		HashValue(Actor->GetUUID());
+		HashValue(Actor->GetOwnedComponents().size());
 
-		// 복제된 레벨의 모든 PrimitiveComponent 수집
-		TArray<UPrimitiveComponent*> DuplicatedPrimitives;
-		for (AActor* Actor : DuplicatedLevel->Actors)
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
 		{
-			if (!Actor) continue;
+			HashValue(Component->GetUUID());
+			HashValue(Component->GetClass());
+			HashValue(Component->GetOwner());
 
-			for (auto& Component : Actor->GetOwnedComponents())
+			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
 			{
-				UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component);
-				if (!PrimitiveComponent) continue;
-				if (Cast<UUUIDTextComponent>(PrimitiveComponent)) continue;
+				HashValue(SceneComponent->GetRelativeLocation());
+				HashValue(SceneComponent->GetRelativeRotation());
+				HashValue(SceneComponent->GetRelativeScale3D());
+				HashValue(SceneComponent->GetParentAttachment());
+				HashValue(SceneComponent->GetChildren().size());
+			}
 
-				DuplicatedPrimitives.push_back(PrimitiveComponent);
+			if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+			{
+				HashValue(Primitive->IsVisible());
+				HashValue(Primitive->GetColor());
+				HashValue(Primitive->GetVertexBuffer());
+				HashValue(Primitive->GetIndexBuffer());
+			}
+			else if (UDecalComponent* Decal = Cast<UDecalComponent>(Component))
+			{
+				HashValue(Decal->IsVisible());
 			}
 		}
+	}
 
-		// 복제된 컴포넌트들로 BVH 빌드
-		DuplicatedLevel->SceneBVH->Build(DuplicatedPrimitives);
+	return Hash;
+}
 
-		UE_LOG("Level: Duplicated Scene BVH built with %d nodes (Total primitives: %zu)",
-		       DuplicatedLevel->SceneBVH->GetNodeCount(), DuplicatedPrimitives.size());
+FLevelDuplicateBenchmarkResult ULevel::RunDuplicateBenchmark()
+{
+	using Clock = std::chrono::high_resolution_clock;
+
+	FLevelDuplicateBenchmarkResult Result;
+	Result.ActorCount = static_cast<uint32>(Actors.size());
+
+	// 구조 일괄 복사는 Full / CopyOnWrite 모드 각각 측정
+	const ELevelDuplicationMode PreviousMode = DuplicationMode;
+	for (ELevelDuplicationMode Mode : { ELevelDuplicationMode::Full, ELevelDuplicationMode::CopyOnWrite })
+	{
+		DuplicationMode = Mode;
+		const int64 StartBytes = TotalAllocationBytes.load();
+		const auto StartTime = Clock::now();
+		ULevel* DuplicatedLevel = Cast<ULevel>(Duplicate());
+		const double Milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+		const int64 AllocatedBytes = static_cast<int64>(TotalAllocationBytes.load()) - StartBytes;
+
+		if (Mode == ELevelDuplicationMode::Full)
+		{
+			Result.BulkMilliseconds = Milliseconds;
+			Result.BulkAllocatedBytes = AllocatedBytes;
+		}
+		else
+		{
+			Result.CopyOnWriteMilliseconds = Milliseconds;
+			Result.CopyOnWriteAllocatedBytes = AllocatedBytes;
+			Result.SharedActorCount = DuplicatedLevel->GetSharedActorCount();
+		}
+		SafeDelete(DuplicatedLevel);
 	}
+	DuplicationMode = PreviousMode;
+
+	return Result;
 }
 
 // ========================================
@@ -393,6 +849,8 @@ void ULevel::UnregisterDecalComponent(UDecalComponent* InDecal)
 {
 	if (!InDecal) return;
 
+	InvalidateDecalReceivers(InDecal);
+
 	// AllDecals에서 제거
 	if (auto It = std::find(AllDecals.begin(), AllDecals.end(), InDecal);
 		It != AllDecals.end())
@@ -466,6 +924,139 @@ void ULevel::MarkDecalIndexClean()
 	bDecalsDirty = false;
 }
 
+uint32 ULevel::UpdateDecalReceiverCache()
+{
+	// 1. 변경된 Decal은 캐시를 버리고 다음 질의에서 BVH로 다시 계산
+	if (bDecalsDirty)
+	{
+		for (UDecalComponent* Decal : DirtyDecals)
+		{
+			InvalidateDecalReceivers(Decal);
+		}
+		MarkDecalIndexClean();
+	}
+
+	if (PendingDecalReceiverPatches.empty())
+	{
+		return 0;
+	}
+
+	// 2. 리프가 바뀐 Receiver는 기존 쌍을 끊고, 캐시된 Decal OBB들과 다시 검사해서 겹치는 쌍만 추가
+	// BVH 질의와 같은 기준(리프 AABB = GetWorldAABB)을 사용하므로 다시 질의한 결과와 같음
+	std::sort(PendingDecalReceiverPatches.begin(), PendingDecalReceiverPatches.end());
+	PendingDecalReceiverPatches.erase(
+		std::unique(PendingDecalReceiverPatches.begin(), PendingDecalReceiverPatches.end()),
+		PendingDecalReceiverPatches.end());
+
+	uint32 PatchedCount = 0;
+	for (UPrimitiveComponent* Receiver : PendingDecalReceiverPatches)
+	{
+		DetachDecalReceiver(Receiver);
+		if (DecalReceiverCache.empty())
+		{
+			continue;
+		}
+
+		FVector WorldMin, WorldMax;
+		Receiver->GetWorldAABB(WorldMin, WorldMax);
+		const FAABB ReceiverAABB(WorldMin, WorldMax);
+
+		for (auto& [Decal, Entry] : DecalReceiverCache)
+		{
+			if (CheckIntersectionOBBAABB(Entry.DecalOBB, ReceiverAABB))
+			{
+				Entry.Receivers.push_back(Receiver);
+				ReceiverToCachedDecals[Receiver].push_back(Decal);
+			}
+		}
+		++PatchedCount;
+	}
+	PendingDecalReceiverPatches.clear();
+
+	return PatchedCount;
+}
+
+const TArray<UPrimitiveComponent*>& ULevel::GetDecalReceivers(UDecalComponent* InDecal, const FOBB& InDecalOBB, bool& bOutCacheHit)
+{
+	if (auto It = DecalReceiverCache.find(InDecal); It != DecalReceiverCache.end())
+	{
+		// Transform 변경 통지 전에 바뀐 경우(같은 프레임의 UI 편집 등)를 위해 OBB도 비교
+		const FOBB& CachedOBB = It->second.DecalOBB;
+		if (CachedOBB.Center == InDecalOBB.Center && CachedOBB.Extents == InDecalOBB.Extents &&
+			memcmp(&CachedOBB.ScaleRotation, &InDecalOBB.ScaleRotation, sizeof(FMatrix)) == 0)
+		{
+			bOutCacheHit = true;
+			return It->second.Receivers;
+		}
+		InvalidateDecalReceivers(InDecal);
+	}
+
+	bOutCacheHit = false;
+
+	FDecalReceiverCacheEntry& Entry = DecalReceiverCache.try_emplace(InDecal, FDecalReceiverCacheEntry{ InDecalOBB, {} }).first->second;
+	QueryOverlappingComponentsWithBVH(InDecalOBB, Entry.Receivers);
+	for (UPrimitiveComponent* Receiver : Entry.Receivers)
+	{
+		ReceiverToCachedDecals[Receiver].push_back(InDecal);
+	}
+
+	return Entry.Receivers;
+}
+
+void ULevel::InvalidateDecalReceivers(UDecalComponent* InDecal)
+{
+	auto It = DecalReceiverCache.find(InDecal);
+	if (It == DecalReceiverCache.end())
+	{
+		return;
+	}
+
+	for (UPrimitiveComponent* Receiver : It->second.Receivers)
+	{
+		auto ReverseIt = ReceiverToCachedDecals.find(Receiver);
+		if (ReverseIt == ReceiverToCachedDecals.end())
+		{
+			continue;
+		}
+
+		TArray<UDecalComponent*>& Decals = ReverseIt->second;
+		Decals.erase(std::remove(Decals.begin(), Decals.end(), InDecal), Decals.end());
+		if (Decals.empty())
+		{
+			ReceiverToCachedDecals.erase(ReverseIt);
+		}
+	}
+
+	DecalReceiverCache.erase(It);
+}
+
+void ULevel::DetachDecalReceiver(UPrimitiveComponent* InReceiver)
+{
+	auto ReverseIt = ReceiverToCachedDecals.find(InReceiver);
+	if (ReverseIt == ReceiverToCachedDecals.end())
+	{
+		return;
+	}
+
+	for (UDecalComponent* Decal : ReverseIt->second)
+	{
+		if (auto It = DecalReceiverCache.find(Decal); It != DecalReceiverCache.end())
+		{
+			TArray<UPrimitiveComponent*>& Receivers = It->second.Receivers;
+			Receivers.erase(std::remove(Receivers.begin(), Receivers.end(), InReceiver), Receivers.end());
+		}
+	}
+
+	ReceiverToCachedDecals.erase(ReverseIt);
+}
+
+void ULevel::ClearDecalReceiverCache()
+{
+	DecalReceiverCache.clear();
+	ReceiverToCachedDecals.clear();
+	PendingDecalReceiverPatches.clear();
+}
+
 // ========================================
 // Scene BVH Implementation
 // ========================================
@@ -504,6 +1095,9 @@ void ULevel::BuildSceneBVH()
 
 	SceneBVH->Build(AllPrimitives);
 
+	// 리프 구성이 새로 만들어졌으므로 Decal Receiver 캐시도 처음부터 다시 질의
+	ClearDecalReceiverCache();
+
 	UE_LOG("Level: Scene BVH built with %d nodes (Total primitives: %zu)",
 	       SceneBVH->GetNodeCount(), AllPrimitives.size());
 }
@@ -536,15 +1130,8 @@ void ULevel::RenderSceneBVHDebug()
 	// 디버그 정보 가져와서 캐싱
 	SceneBVH->GetDebugDrawInfo(CachedDebugBoxes, CachedDebugColors, BVHDebugMaxDepth);
 
-	// 실제 렌더링은 여기서 하지 않고, 렌더러나 Editor에서
-	// GetCachedDebugBoxes()를 통해 데이터를 가져가서 그리도록 함
-
-	// TODO: 실제 라인 렌더링은 BatchLines나 별도의 DebugDrawer를 통해 수행
-	// 예시:
-	// for (int32 i = 0; i < CachedDebugBoxes.size(); ++i)
-	// {
-	//     DrawDebugBox(CachedDebugBoxes[i], CachedDebugColors[i]);
-	// }
+	// 실제 렌더링은 여기서 하지 않고, UEditor가 GetCachedDebugBoxes()를 BatchLines에 넘겨
+	// 다른 디버그 라인과 한 스트림으로 그림
 }
 
 void ULevel::UpdateSceneBVHComponent(USceneComponent* InComponent)
@@ -569,6 +1156,7 @@ void ULevel::UpdateSceneBVHComponent(USceneComponent* InComponent)
 		// Transform 변경만 → Refit 사용 (O(depth), 빠름)
 		// 노드 구조는 그대로, AABB만 갱신
 		SceneBVH->RefitComponent(Primitive);
+		PendingDecalReceiverPatches.push_back(Primitive);
 	}
 
 	// 자식 컴포넌트들도 재귀적으로 업데이트
@@ -587,6 +1175,50 @@ void ULevel::UpdateSceneBVHComponent(USceneComponent* InComponent)
 	}
 }
 
+void ULevel::MarkSceneBVHComponentDirty(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent || Cast<UUUIDTextComponent>(InComponent))
+	{
+		return;
+	}
+
+	PendingBVHRefitComponents.push_back(InComponent);
+}
+
+void ULevel::MarkRenderProxyDirty(UPrimitiveComponent* InComponent)
+{
+	RenderScene->MarkDirty(InComponent);
+}
+
+void ULevel::FlushSceneBVHRefit()
+{
+	if (PendingBVHRefitComponents.empty())
+	{
+		return;
+	}
+	TIME_PROFILE(SceneBVHRefit);
+
+	// 리빌드 예정이면 리빌드가 새 Transform을 반영하므로 리핏 불필요
+	if (SceneBVH && !bBVHNeedsRebuild)
+	{
+		SceneBVH->RefitComponents(PendingBVHRefitComponents);
+
+		// 리프가 바뀐 Receiver는 Decal 캐시에서 해당 쌍만 다시 검사
+		if (!DecalReceiverCache.empty())
+		{
+			PendingDecalReceiverPatches.insert(PendingDecalReceiverPatches.end(),
+				PendingBVHRefitComponents.begin(), PendingBVHRefitComponents.end());
+		}
+
+		if (bShowSceneBVH)
+		{
+			SceneBVH->GetDebugDrawInfo(CachedDebugBoxes, CachedDebugColors, BVHDebugMaxDepth);
+		}
+	}
+
+	PendingBVHRefitComponents.clear();
+}
+
 bool ULevel::QueryOverlappingComponentsWithBVH(const FOBB& OBB, TArray<UPrimitiveComponent*>& OutComponents) const
 {
 	if (!SceneBVH)
@@ -604,6 +1236,7 @@ void ULevel::TickLevel()
 	if (bBVHNeedsRebuild)
 	{
 		// 이 시점에는 모든 World Transform이 갱신됨
+		TIME_PROFILE(BuildSceneBVH);
 		BuildSceneBVH();
 		bBVHNeedsRebuild = false;
 
@@ -0,0 +1,660 @@
+#include "pch.h"
+#include "Level/Public/LevelBinaryFormat.h"
+#include "Core/Public/MemoryArchive.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
+#include "Utility/Public/JsonSerializer.h"
+#include "Utility/Public/JsonStreamReader.h"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+	enum class EBinaryJsonTag : uint8
+	{
+		Null,
+		False,
+		True,
+		Integral,
+		Floating,
+		String,
+		Array,
+		Object
+	};
+
+	constexpr uint32 MaxJsonDepth = 256;
+
+	// 워커 하나가 한 번에 가져가는 작업 수
+	constexpr uint32 ParallelGrainSize = 64;
+
+	/**
+	 * @brief 파일 맨 앞 고정 크기 헤더
+	 */
+	struct FLevelBinaryHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint32 ActorCount = 0;
+		uint32 Reserved = 0;
+		uint64 MetadataSize = 0;
+		uint64 TocSize = 0;
+		uint64 BlockSectionSize = 0;
+	};
+
+	/**
+	 * @brief [0, InCount) 범위를 워커 스레드와 호출 스레드가 나눠서 처리
+	 * 작업량이 적으면 호출 스레드에서 바로 처리
+	 */
+	template<typename FBody>
+	void ParallelForEachIndex(uint32 InCount, const FBody& InBody)
+	{
+		const uint32 HardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+		const uint32 WorkerCount = std::min(HardwareThreadCount, (InCount + ParallelGrainSize - 1) / ParallelGrainSize);
+		if (WorkerCount <= 1)
+		{
+			for (uint32 Index = 0; Index < InCount; ++Index)
+			{
+				InBody(Index);
+			}
+			return;
+		}
+
+		std::atomic<uint32> NextIndex = 0;
+		auto Worker = [&]()
+		{
+			for (;;)
+			{
+				const uint32 Begin = NextIndex.fetch_add(ParallelGrainSize, std::memory_order_relaxed);
+				if (Begin >= InCount)
+				{
+					break;
+				}
+
+				const uint32 End = std::min(InCount, Begin + ParallelGrainSize);
+				for (uint32 Index = Begin; Index < End; ++Index)
+				{
+					InBody(Index);
+				}
+			}
+		};
+
+		TArray<std::thread> Threads;
+		Threads.reserve(WorkerCount - 1);
+		for (uint32 ThreadIndex = 1; ThreadIndex < WorkerCount; ++ThreadIndex)
+		{
+			Threads.emplace_back(Worker);
+		}
+		Worker();
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+
+	/**
+	 * @brief json.hpp의 ToString이 적용하는 이스케이프를 되돌려 원래 문자열 복원
+	 */
+	FString UnescapeJsonString(const FString& InEscaped)
+	{
+		FString Result;
+		Result.reserve(InEscaped.size());
+		for (size_t Index = 0; Index < InEscaped.size(); ++Index)
+		{
+			const char Character = InEscaped[Index];
+			if (Character != '\\' || Index + 1 == InEscaped.size())
+			{
+				Result += Character;
+				continue;
+			}
+
+			switch (InEscaped[++Index])
+			{
+			case '"': Result += '"'; break;
+			case '\\': Result += '\\'; break;
+			case 'b': Result += '\b'; break;
+			case 'f': Result += '\f'; break;
+			case 'n': Result += '\n'; break;
+			case 'r': Result += '\r'; break;
+			case 't': Result += '\t'; break;
+			default:
+				Result += '\\';
+				Result += InEscaped[Index];
+				break;
+			}
+		}
+		return Result;
+	}
+
+	void WriteString(FArchive& Ar, const FString& InString)
+	{
+		uint32 Length = static_cast<uint32>(InString.size());
+		Ar << Length;
+		Ar.Serialize(const_cast<char*>(InString.data()), Length);
+	}
+
+	void ReadBytes(FWindowsBinReader& InReader, TArray<uint8>& OutBytes, uint64 InSize)
+	{
+		OutBytes.resize(static_cast<size_t>(InSize));
+		if (InSize > 0)
+		{
+			InReader.Serialize(OutBytes.data(), OutBytes.size());
+		}
+	}
+}
+
+bool FLevelBinaryFormat::HasBinaryExtension(const path& InFilePath)
+{
+	FString Extension = InFilePath.extension().string();
+	std::transform(Extension.begin(), Extension.end(), Extension.begin(),
+		[](unsigned char InCharacter) { return static_cast<char>(tolower(InCharacter)); });
+	return Extension == FileExtension;
+}
+
+bool FLevelBinaryFormat::IsBinaryLevelFile(const path& InFilePath)
+{
+	std::ifstream Stream(InFilePath, std::ios::binary);
+	uint32 FileMagic = 0;
+	if (!Stream.read(reinterpret_cast<char*>(&FileMagic), sizeof(FileMagic)))
+	{
+		return false;
+	}
+	return FileMagic == Magic;
+}
+
+void FLevelBinaryFormat::EncodeJson(FArchive& Ar, const JSON& InValue)
+{
+	EBinaryJsonTag Tag = EBinaryJsonTag::Null;
+	switch (InValue.JSONType())
+	{
+	case JSON::Class::Null:
+		Ar << Tag;
+		break;
+
+	case JSON::Class::Boolean:
+		Tag = InValue.ToBool() ? EBinaryJsonTag::True : EBinaryJsonTag::False;
+		Ar << Tag;
+		break;
+
+	case JSON::Class::Integral:
+	{
+		Tag = EBinaryJsonTag::Integral;
+		int64 Value = InValue.ToInt();
+		Ar << Tag << Value;
+		break;
+	}
+
+	case JSON::Class::Floating:
+	{
+		Tag = EBinaryJsonTag::Floating;
+		double Value = InValue.ToFloat();
+		Ar << Tag << Value;
+		break;
+	}
+
+	case JSON::Class::String:
+		Tag = EBinaryJsonTag::String;
+		Ar << Tag;
+		WriteString(Ar, UnescapeJsonString(InValue.ToString()));
+		break;
+
+	case JSON::Class::Array:
+	{
+		Tag = EBinaryJsonTag::Array;
+		uint32 Count = static_cast<uint32>(InValue.length());
+		Ar << Tag << Count;
+		for (const JSON& Element : InValue.ArrayRange())
+		{
+			EncodeJson(Ar, Element);
+		}
+		break;
+	}
+
+	case JSON::Class::Object:
+	{
+		Tag = EBinaryJsonTag::Object;
+		uint32 Count = static_cast<uint32>(InValue.size());
+		Ar << Tag << Count;
+		for (const auto& Pair : InValue.ObjectRange())
+		{
+			WriteString(Ar, Pair.first);
+			EncodeJson(Ar, Pair.second);
+		}
+		break;
+	}
+	}
+}
+
+bool FLevelBinaryFormat::DecodeJson(FMemoryReader& Ar, JSON& OutValue)
+{
+	return DecodeJsonInternal(Ar, OutValue, 0) && !Ar.HasError();
+}
+
+bool FLevelBinaryFormat::ReadBoundedString(FMemoryReader& Ar, FString& OutString)
+{
+	uint32 Length = 0;
+	Ar << Length;
+	if (Ar.HasError() || Length > Ar.GetRemaining())
+	{
+		Ar.SetError();
+		return false;
+	}
+
+	OutString.resize(Length);
+	Ar.Serialize(OutString.data(), Length);
+	return !Ar.HasError();
+}
+
+bool FLevelBinaryFormat::DecodeJsonInternal(FMemoryReader& Ar, JSON& OutValue, uint32 InDepth)
+{
+	if (InDepth > MaxJsonDepth)
+	{
+		Ar.SetError();
+		return false;
+	}
+
+	EBinaryJsonTag Tag = EBinaryJsonTag::Null;
+	Ar << Tag;
+	if (Ar.HasError())
+	{
+		return false;
+	}
+
+	switch (Tag)
+	{
+	case EBinaryJsonTag::Null:
+		OutValue = JSON();
+		return true;
+
+	case EBinaryJsonTag::False:
+	case EBinaryJsonTag::True:
+		OutValue = (Tag == EBinaryJsonTag::True);
+		return true;
+
+	case EBinaryJsonTag::Integral:
+	{
+		int64 Value = 0;
+		Ar << Value;
+		OutValue = static_cast<long>(Value);
+		return !Ar.HasError();
+	}
+
+	case EBinaryJsonTag::Floating:
+	{
+		double Value = 0.0;
+		Ar << Value;
+		OutValue = Value;
+		return !Ar.HasError();
+	}
+
+	case EBinaryJsonTag::String:
+	{
+		FString Value;
+		if (!ReadBoundedString(Ar, Value))
+		{
+			return false;
+		}
+		OutValue = std::move(Value);
+		return true;
+	}
+
+	case EBinaryJsonTag::Array:
+	{
+		uint32 Count = 0;
+		Ar << Count;
+		// 원소 하나는 최소 태그 1바이트이므로 남은 크기보다 많을 수 없음
+		if (Ar.HasError() || Count > Ar.GetRemaining())
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		OutValue = json::Array();
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			if (!DecodeJsonInternal(Ar, OutValue[Index], InDepth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	case EBinaryJsonTag::Object:
+	{
+		uint32 Count = 0;
+		Ar << Count;
+		if (Ar.HasError() || Count > Ar.GetRemaining())
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		OutValue = json::Object();
+		FString Key;
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			if (!ReadBoundedString(Ar, Key) || !DecodeJsonInternal(Ar, OutValue[Key], InDepth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	}
+
+	Ar.SetError();
+	return false;
+}
+
+bool FLevelBinaryFormat::Write(const path& InFilePath, const JSON& InCameraJson, const TArray<FLevelBinaryActorRecord>& InActors)
+{
+	const uint32 ActorCount = static_cast<uint32>(InActors.size());
+
+	// 액터 블록 인코딩 (액터끼리 독립적이므로 병렬 처리)
+	TArray<TArray<uint8>> ActorBlocks(ActorCount);
+	ParallelForEachIndex(ActorCount, [&](uint32 InIndex)
+	{
+		FMemoryWriter BlockWriter(ActorBlocks[InIndex]);
+		EncodeJson(BlockWriter, InActors[InIndex].Data);
+	});
+
+	TArray<uint8> MetadataBytes;
+	{
+		FMemoryWriter MetadataWriter(MetadataBytes);
+		EncodeJson(MetadataWriter, InCameraJson);
+	}
+
+	TArray<uint8> TocBytes;
+	uint64 BlockOffset = 0;
+	{
+		FMemoryWriter TocWriter(TocBytes);
+		for (uint32 Index = 0; Index < ActorCount; ++Index)
+		{
+			uint64 BlockSize = ActorBlocks[Index].size();
+			WriteString(TocWriter, InActors[Index].IdString);
+			WriteString(TocWriter, InActors[Index].TypeString);
+			TocWriter << BlockOffset << BlockSize;
+			BlockOffset += BlockSize;
+		}
+	}
+
+	FLevelBinaryHeader Header;
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.ActorCount = ActorCount;
+	Header.MetadataSize = MetadataBytes.size();
+	Header.TocSize = TocBytes.size();
+	Header.BlockSectionSize = BlockOffset;
+
+	FWindowsBinWriter Writer(InFilePath);
+	Writer << Header;
+	Writer.Serialize(MetadataBytes.data(), MetadataBytes.size());
+	Writer.Serialize(TocBytes.data(), TocBytes.size());
+	for (TArray<uint8>& Block : ActorBlocks)
+	{
+		Writer.Serialize(Block.data(), Block.size());
+	}
+
+	return true;
+}
+
+bool FLevelBinaryFormat::Read(const path& InFilePath, JSON& OutCameraJson, const FOnActorDecoded& InOnActorDecoded)
+{
+	std::error_code ErrorCode;
+	const uint64 FileSize = std::filesystem::file_size(InFilePath, ErrorCode);
+	if (ErrorCode || FileSize < sizeof(FLevelBinaryHeader))
+	{
+		UE_LOG_ERROR("LevelBinary: 파일이 없거나 헤더보다 작습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	FWindowsBinReader Reader(InFilePath);
+
+	FLevelBinaryHeader Header;
+	Reader << Header;
+	if (Header.Magic != Magic)
+	{
+		UE_LOG_ERROR("LevelBinary: 바이너리 레벨 파일이 아닙니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+	if (Header.Version != Version)
+	{
+		UE_LOG_ERROR("LevelBinary: 지원하지 않는 버전입니다 (%u): %s", Header.Version, InFilePath.string().c_str());
+		return false;
+	}
+
+	const uint64 BodySize = FileSize - sizeof(FLevelBinaryHeader);
+	if (Header.MetadataSize > BodySize || Header.TocSize > BodySize - Header.MetadataSize ||
+		Header.BlockSectionSize > BodySize - Header.MetadataSize - Header.TocSize)
+	{
+		UE_LOG_ERROR("LevelBinary: 헤더의 영역 크기가 파일 크기와 맞지 않습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	TArray<uint8> MetadataBytes;
+	ReadBytes(Reader, MetadataBytes, Header.MetadataSize);
+	{
+		FMemoryReader MetadataReader(MetadataBytes.data(), MetadataBytes.size());
+		if (!DecodeJson(MetadataReader, OutCameraJson))
+		{
+			UE_LOG_ERROR("LevelBinary: 메타데이터가 손상되었습니다: %s", InFilePath.string().c_str());
+			return false;
+		}
+	}
+
+	// TOC 전체를 먼저 읽어 블록 경계 확정
+	TArray<uint8> TocBytes;
+	ReadBytes(Reader, TocBytes, Header.TocSize);
+
+	struct FTocEntry
+	{
+		FString IdString;
+		FString TypeString;
+		uint64 Offset = 0;
+		uint64 Size = 0;
+	};
+
+	TArray<FTocEntry> TocEntries(Header.ActorCount);
+	{
+		FMemoryReader TocReader(TocBytes.data(), TocBytes.size());
+		uint64 ExpectedOffset = 0;
+		for (FTocEntry& Entry : TocEntries)
+		{
+			ReadBoundedString(TocReader, Entry.IdString);
+			ReadBoundedString(TocReader, Entry.TypeString);
+			TocReader << Entry.Offset << Entry.Size;
+
+			// 블록은 TOC 순서대로 빈틈없이 기록되므로 순차 읽기만으로 충분
+			if (TocReader.HasError() || Entry.Offset != ExpectedOffset || Entry.Size > Header.BlockSectionSize - ExpectedOffset)
+			{
+				UE_LOG_ERROR("LevelBinary: TOC가 손상되었습니다: %s", InFilePath.string().c_str());
+				return false;
+			}
+			ExpectedOffset += Entry.Size;
+		}
+	}
+
+	// 배치 단위로 블록 읽기 -> 병렬 디코딩 -> 호출 스레드에서 순서대로 전달
+	TArray<uint8> BatchBytes;
+	TArray<FLevelBinaryActorRecord> BatchRecords;
+	TArray<uint8> BatchResults;
+	for (uint32 BatchBegin = 0; BatchBegin < Header.ActorCount; BatchBegin += DecodeBatchSize)
+	{
+		const uint32 BatchEnd = std::min(Header.ActorCount, BatchBegin + DecodeBatchSize);
+		const uint32 BatchCount = BatchEnd - BatchBegin;
+		const uint64 BatchBaseOffset = TocEntries[BatchBegin].Offset;
+		const uint64 BatchByteSize = TocEntries[BatchEnd - 1].Offset + TocEntries[BatchEnd - 1].Size - BatchBaseOffset;
+
+		ReadBytes(Reader, BatchBytes, BatchByteSize);
+
+		BatchRecords.clear();
+		BatchRecords.resize(BatchCount);
+		BatchResults.assign(BatchCount, 0);
+		ParallelForEachIndex(BatchCount, [&](uint32 InIndex)
+		{
+			const FTocEntry& Entry = TocEntries[BatchBegin + InIndex];
+			FMemoryReader BlockReader(BatchBytes.data() + (Entry.Offset - BatchBaseOffset), static_cast<size_t>(Entry.Size));
+			BatchResults[InIndex] = DecodeJson(BlockReader, BatchRecords[InIndex].Data) ? 1 : 0;
+		});
+
+		for (uint32 Index = 0; Index < BatchCount; ++Index)
+		{
+			if (!BatchResults[Index])
+			{
+				UE_LOG_ERROR("LevelBinary: 액터 블록이 손상되었습니다 (Id: %s): %s",
+					TocEntries[BatchBegin + Index].IdString.c_str(), InFilePath.string().c_str());
+				return false;
+			}
+
+			FLevelBinaryActorRecord& Record = BatchRecords[Index];
+			Record.IdString = std::move(TocEntries[BatchBegin + Index].IdString);
+			Record.TypeString = std::move(TocEntries[BatchBegin + Index].TypeString);
+			InOnActorDecoded(Record);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief 벤치마크용 액터 레코드 생성
+ * JsonStreamReader의 벤치마크 레벨과 같은 구조 (StaticMeshActor + StaticMeshComponent)
+ */
+static void BuildBenchmarkRecords(uint32 InActorCount, TArray<FLevelBinaryActorRecord>& OutRecords)
+{
+	OutRecords.resize(InActorCount);
+	for (uint32 Index = 0; Index < InActorCount; ++Index)
+	{
+		FLevelBinaryActorRecord& Record = OutRecords[Index];
+		Record.IdString = std::to_string(Index + 1);
+		Record.TypeString = "StaticMeshActor";
+
+		JSON Component = json::Object();
+		Component["Location"] = json::Array(
+			static_cast<float>(Index % 100) * 2.0f,
+			static_cast<float>((Index / 100) % 100) * 2.0f,
+			static_cast<float>(Index / 10000) * 2.0f);
+		Component["Name"] = "StaticMeshComponent_" + std::to_string(Index);
+		Component["ObjStaticMeshAsset"] = "Data/Cube.obj";
+		Component["ParentName"] = "";
+		Component["Rotation"] = json::Array(0.0f, 0.0f, 0.0f);
+		Component["Scale"] = json::Array(1.0f, 1.0f, 1.0f);
+		Component["Type"] = "StaticMeshComponent";
+
+		Record.Data = json::Object();
+		Record.Data["Type"] = Record.TypeString;
+		Record.Data["Components"] = json::Array(Component);
+	}
+}
+
+FLevelFormatBenchmarkResult RunLevelFormatBenchmark(uint32 InActorCount)
+{
+	using Clock = std::chrono::high_resolution_clock;
+
+	FLevelFormatBenchmarkResult Result;
+	Result.ActorCount = InActorCount;
+
+	const path TempDirectory = std::filesystem::temp_directory_path();
+	const path JsonFilePath = TempDirectory / "LevelFormatBenchmark.scene";
+	const path BinaryFilePath = TempDirectory / "LevelFormatBenchmark.scenebin";
+
+	TArray<FLevelBinaryActorRecord> Records;
+	BuildBenchmarkRecords(InActorCount, Records);
+	JSON CameraJson = json::Object();
+	CameraJson["FarClip"] = 1000.0f;
+	CameraJson["FOV"] = 90.0f;
+
+	// JSON 저장: UWorld::SaveCurrentLevel과 동일하게 레벨 DOM 구성 후 SaveJsonToFile
+	{
+		const auto StartTime = Clock::now();
+
+		JSON LevelJson;
+		LevelJson["NextUUID"] = 0;
+		LevelJson["PerspectiveCamera"] = CameraJson;
+		JSON ActorsJson = json::Object();
+		for (const FLevelBinaryActorRecord& Record : Records)
+		{
+			ActorsJson[Record.IdString] = Record.Data;
+		}
+		LevelJson["Actors"] = std::move(ActorsJson);
+		FJsonSerializer::SaveJsonToFile(LevelJson, JsonFilePath.string());
+
+		Result.JsonSaveMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+	}
+
+	// 바이너리 저장
+	{
+		const auto StartTime = Clock::now();
+		FLevelBinaryFormat::Write(BinaryFilePath, CameraJson, Records);
+		Result.BinarySaveMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+	}
+
+	Records.clear();
+	Result.JsonFileSize = std::filesystem::file_size(JsonFilePath);
+	Result.BinaryFileSize = std::filesystem::file_size(BinaryFilePath);
+
+	// JSON 로드: UWorld::LoadLevel과 동일한 스트리밍 방식
+	uint32 JsonActorCount = 0;
+	{
+		const auto StartTime = Clock::now();
+
+		FJsonStreamReader Reader(JsonFilePath.string());
+		FString Key;
+		if (Reader.ReadObjectStart())
+		{
+			while (Reader.ReadNextKey(Key))
+			{
+				if (Key != "Actors")
+				{
+					Reader.SkipValue();
+					continue;
+				}
+
+				FString IdString;
+				Reader.ReadObjectStart();
+				while (Reader.ReadNextKey(IdString))
+				{
+					JSON ActorJson;
+					if (!Reader.ReadValue(ActorJson))
+					{
+						break;
+					}
+					FString TypeString;
+					FJsonSerializer::ReadString(ActorJson, "Type", TypeString);
+					JsonActorCount += TypeString.empty() ? 0 : 1;
+				}
+			}
+		}
+
+		Result.JsonLoadMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+	}
+
+	// 바이너리 로드
+	uint32 BinaryActorCount = 0;
+	{
+		const auto StartTime = Clock::now();
+
+		JSON LoadedCameraJson;
+		FLevelBinaryFormat::Read(BinaryFilePath, LoadedCameraJson, [&BinaryActorCount](FLevelBinaryActorRecord& InRecord)
+		{
+			FString TypeString;
+			FJsonSerializer::ReadString(InRecord.Data, "Type", TypeString);
+			BinaryActorCount += TypeString.empty() ? 0 : 1;
+		});
+
+		Result.BinaryLoadMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+	}
+
+	if (JsonActorCount != InActorCount || BinaryActorCount != InActorCount)
+	{
+		UE_LOG_WARNING("LevelFormatBenchmark: 로드된 액터 수가 다릅니다 (JSON: %u, Binary: %u, Expected: %u)",
+			JsonActorCount, BinaryActorCount, InActorCount);
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::remove(JsonFilePath, ErrorCode);
+	std::filesystem::remove(BinaryFilePath, ErrorCode);
+	return Result;
+}
@@ -2,6 +2,8 @@
 #include "Level/Public/World.h"
 #include "Level/Public/Level.h"
 #include "Utility/Public/JsonSerializer.h"
+#include "Utility/Public/JsonStreamReader.h"
+#include "Level/Public/LevelBinaryFormat.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Path/Public/PathManager.h"
 #include "Component/Public/ActorComponent.h"
@@ -88,6 +90,7 @@ void UWorld::Tick(float DeltaTimes)
 	{
 		return;
 	}
+	TIME_PROFILE(WorldTick);
 
 	// 스폰 / 삭제 처리
 	FlushPendingDestroy();
@@ -131,7 +134,6 @@ ULevel* UWorld::GetLevel() const
 */
 bool UWorld::LoadLevel(path InLevelFilePath)
 {
-	JSON LevelJson;
 	ULevel* NewLevel = nullptr;
 
 	try
@@ -139,16 +141,35 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 		FString LevelNameString = InLevelFilePath.stem().string();
 		NewLevel = new ULevel(FName(LevelNameString));
 
-		if (!FJsonSerializer::LoadJsonFromFile(LevelJson, InLevelFilePath.string()))
+		// 확장자와 무관하게 파일 앞의 Magic으로 바이너리 레벨 여부 판단
+		if (FLevelBinaryFormat::IsBinaryLevelFile(InLevelFilePath))
 		{
-			UE_LOG_ERROR("World: Level JSON 로드에 실패했습니다: %s", InLevelFilePath.string().c_str());
-			SafeDelete(NewLevel);
-			return false;
+			NewLevel->SetOuter(this);
+			SwitchToLevel(NewLevel);
+			if (!NewLevel->LoadFromBinaryFile(InLevelFilePath))
+			{
+				UE_LOG_ERROR("World: 바이너리 Level 로드 중 오류가 발생했습니다: %s", InLevelFilePath.string().c_str());
+			}
 		}
+		else
+		{
+			// 파일 전체를 DOM으로 만들지 않고 액터 단위로 읽으면서 바로 스폰
+			FJsonStreamReader Reader(InLevelFilePath.string());
+			if (!Reader.IsOpen())
+			{
+				UE_LOG_ERROR("World: Level JSON 로드에 실패했습니다: %s", InLevelFilePath.string().c_str());
+				SafeDelete(NewLevel);
+				return false;
+			}
 
-		NewLevel->SetOuter(this);
-		SwitchToLevel(NewLevel);
-		NewLevel->Serialize(true, LevelJson);
+			NewLevel->SetOuter(this);
+			SwitchToLevel(NewLevel);
+			if (!NewLevel->LoadFromJsonStream(Reader))
+			{
+				UE_LOG_ERROR("World: Level JSON 파싱 중 오류가 발생했습니다 (%s): %s",
+					Reader.GetErrorMessage().c_str(), InLevelFilePath.string().c_str());
+			}
+		}
 
 		// 에디터에서도 틱/삭제/페이드가 다시 돌도록 보장
 		BeginPlay();
@@ -188,6 +209,17 @@ bool UWorld::SaveCurrentLevel(path InLevelFilePath) const
 
 	try
 	{
+		// 바이너리 포맷은 .scenebin 확장자로 저장할 때만 사용하고, 그 외에는 JSON 유지
+		if (FLevelBinaryFormat::HasBinaryExtension(InLevelFilePath))
+		{
+			if (!Level->SaveToBinaryFile(InLevelFilePath))
+			{
+				UE_LOG_ERROR("World: 바이너리 Level 저장에 실패했습니다: %s", InLevelFilePath.string().c_str());
+				return false;
+			}
+			return true;
+		}
+
 		JSON LevelJson;
 		Level->Serialize(false, LevelJson);
 
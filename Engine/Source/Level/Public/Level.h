@@ -2,6 +2,7 @@
 #include "Core/Public/Object.h"
 #include "Editor/Public/Camera.h"
 #include "Global/Enum.h"
+#include "Physics/Public/OBB.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -10,8 +11,37 @@ class UWorld;
 class AActor;
 class UPrimitiveComponent;
 class UDecalComponent;
+class UActorComponent;
+class USceneComponent;
 class FOctree;
 class FSceneBVH;
+class FRenderScene;
+class FJsonStreamReader;
+
+/**
+ * @brief 레벨 복제(PIE 시작) 방식
+ * Full: 모든 액터의 컴포넌트를 복사 (기본값)
+ * CopyOnWrite: 공유 가능한 액터는 에디터 컴포넌트를 참조하다가 선택/변경/삭제 시점에 복사
+ */
+enum class ELevelDuplicationMode : uint8
+{
+	Full,
+	CopyOnWrite,
+};
+
+/**
+ * @brief 레벨 복제(PIE 시작) 방식별 측정 결과
+ * AllocatedBytes는 복제 직후 늘어난 할당량
+ */
+struct FLevelDuplicateBenchmarkResult
+{
+	uint32 ActorCount = 0;
+	uint32 SharedActorCount = 0;
+	double BulkMilliseconds = 0.0;
+	double CopyOnWriteMilliseconds = 0.0;
+	int64 BulkAllocatedBytes = 0;
+	int64 CopyOnWriteAllocatedBytes = 0;
+};
 
 UCLASS()
 class ULevel :
@@ -28,6 +58,21 @@ public:
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
+	/**
+	 * @brief 레벨 파일을 스트리밍으로 읽으면서 액터 객체 하나가 완성될 때마다 바로 스폰
+	 * Actors 전체를 담는 DOM 없이 액터 단위의 작은 JSON만 만들었다가 버림
+	 * @return 파싱 오류 없이 끝까지 읽었는지 여부 (오류 전까지 스폰된 액터는 유지)
+	 */
+	bool LoadFromJsonStream(FJsonStreamReader& InReader);
+
+	/**
+	 * @brief 바이너리 레벨 파일(.scenebin) 저장/로드
+	 * 액터 JSON 생성과 스폰은 호출 스레드에서, 블록 인코딩/디코딩은 워커 스레드에서 수행
+	 * @return 로드의 경우 오류 없이 끝까지 읽었는지 여부 (오류 전까지 스폰된 액터는 유지)
+	 */
+	bool SaveToBinaryFile(const path& InFilePath);
+	bool LoadFromBinaryFile(const path& InFilePath);
+
 	const TArray<AActor*>& GetActors() const { return Actors; }
 
 	void AddPrimitiveComponent(AActor* Actor);
@@ -96,10 +141,24 @@ public:
 
 	/**
 	 * 변경된 Decal 집합
-	 * 증분 BVH 업데이트에 사용
+	 * UpdateDecalReceiverCache()에서 해당 Decal의 Receiver 캐시를 무효화한 뒤 비움
 	 */
 	const TSet<UDecalComponent*>& GetDirtyDecals() const { return DirtyDecals; }
 
+	/**
+	 * Decal -> Receiver 캐시 갱신 (DecalPass 실행 전 호출, 같은 프레임의 두 번째 호출부터는 할 일 없음)
+	 * Dirty Decal의 캐시는 버리고, BVH 리프가 바뀐 Receiver는 캐시된 Decal들과 다시 검사해서 해당 쌍만 부분 갱신
+	 * @return 부분 갱신한 Receiver 수
+	 */
+	uint32 UpdateDecalReceiverCache();
+
+	/**
+	 * Decal이 투영될 Receiver 목록 (Scene BVH 질의 결과 캐시)
+	 * @param InDecalOBB: 현재 Decal OBB, 캐시된 OBB와 다르면 알림 전의 변경으로 보고 다시 질의
+	 * @param bOutCacheHit: 캐시에서 바로 얻었으면 true
+	 */
+	const TArray<UPrimitiveComponent*>& GetDecalReceivers(UDecalComponent* InDecal, const FOBB& InDecalOBB, bool& bOutCacheHit);
+
 	// ========================================
 	// Scene BVH Management API
 	// ========================================
@@ -143,6 +202,18 @@ public:
 	 */
 	void UpdateSceneBVHComponent(USceneComponent* InComponent);
 
+	/**
+	 * Transform이 변경된 Primitive를 Scene BVH 일괄 리핏 대상으로 등록
+	 * UPrimitiveComponent::OnTransformChanged()에서 호출 (컴포넌트당 프레임마다 최대 한 번)
+	 */
+	void MarkSceneBVHComponentDirty(UPrimitiveComponent* InComponent);
+
+	/**
+	 * 등록된 Primitive들의 BVH 리프를 한 번에 리핏
+	 * Transform 변경 통지가 끝난 뒤, 렌더링 전에 프레임마다 호출
+	 */
+	void FlushSceneBVHRefit();
+
 	/**
 	 * Scene BVH를 사용하여 OBB와 겹치는 Component들 찾기
 	 * @param OBB: 검사할 OBB
@@ -151,6 +222,21 @@ public:
 	 */
 	bool QueryOverlappingComponentsWithBVH(const struct FOBB& OBB, TArray<UPrimitiveComponent*>& OutComponents) const;
 
+	// ========================================
+	// Render Scene API
+	// ========================================
+
+	/**
+	 * 렌더링용 프록시 씬 (등록 / 이동 / 상태 변경된 Primitive만 갱신)
+	 */
+	FRenderScene* GetRenderScene() const { return RenderScene; }
+
+	/**
+	 * Transform이나 렌더 상태가 바뀐 Primitive의 프록시를 다음 렌더링 전에 다시 읽도록 등록
+	 * UPrimitiveComponent::OnTransformChanged() / MarkRenderStateDirty()에서 호출
+	 */
+	void MarkRenderProxyDirty(UPrimitiveComponent* InComponent);
+
 	/**
 	 * 레벨 틱 (BVH 리빌드 등 처리)
 	 */
@@ -160,13 +246,54 @@ public:
 public:
 	virtual UObject* Duplicate() override;
 
+	static ELevelDuplicationMode GetDuplicationMode() { return DuplicationMode; }
+	static void SetDuplicationMode(ELevelDuplicationMode InMode) { DuplicationMode = InMode; }
+
+	/**
+	 * @brief 컴포넌트를 공유 중인 액터를 자기 컴포넌트를 가진 액터로 전환하고
+	 * Octree / Dynamic 목록 / SceneBVH의 공유 컴포넌트 포인터를 복사본으로 교체
+	 * @param OutRemap 공유 컴포넌트 -> 복사본 매핑 (필요한 경우만)
+	 */
+	void MaterializeSharedActor(AActor* InActor, TMap<USceneComponent*, USceneComponent*>* OutRemap = nullptr);
+
+	/**
+	 * @brief 편집(선택 포함) 대상 액터/컴포넌트를 이 레벨 소유 객체로 변환
+	 * 공유 중인 원본 액터나 컴포넌트가 들어오면 해당 복제 액터를 전환한 뒤 복사본을 반환
+	 * 공유와 무관한 객체는 그대로 반환
+	 */
+	AActor* ResolveSharedActorForEdit(AActor* InActor);
+	UActorComponent* ResolveSharedComponentForEdit(UActorComponent* InComponent);
+
+	uint32 GetSharedActorCount() const { return static_cast<uint32>(SharedActorProxies.size()); }
+
+	/**
+	 * @brief 액터/컴포넌트 상태(트랜스폼, 계층, 가시성, 색상, 메시)의 해시
+	 * PIE가 에디터 월드를 변경하지 않았는지 확인하는 용도
+	 */
+	uint64 ComputeStateFingerprint() const;
+
+	/**
+	 * @brief 현재 레벨을 구조 일괄 복사(Full), Copy-on-write 방식으로 각각 복제해
+	 * 소요 시간과 할당량 비교, 복제된 레벨은 측정 후 바로 삭제
+	 */
+	FLevelDuplicateBenchmarkResult RunDuplicateBenchmark();
+
 protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject) override;
 
 private:
 	AActor* SpawnActorToLevel(UClass* InActorClass, const FName& InName = FName::GetNone(), JSON* ActorJsonData = nullptr);
+	AActor* SpawnActorFromJson(const FString& InIdString, JSON& InActorDataJson);
+	static void ApplyPerspectiveCameraJson(JSON& InCameraJson);
+	static JSON CapturePerspectiveCameraJson();
 
 	TArray<AActor*> Actors;	// 레벨이 보유하고 있는 모든 Actor를 배열로 저장합니다.
+
+	// Copy-on-write 복제 시 원본 액터 -> 컴포넌트를 공유 중인 복제 액터
+	// 공유 컴포넌트의 Owner는 원본 액터이므로 피킹 결과를 복제 액터로 되돌릴 때 사용
+	TMap<AActor*, AActor*> SharedActorProxies;
+
+	static ELevelDuplicationMode DuplicationMode;
 	FOctree* StaticOctree = nullptr;
 	TArray<UPrimitiveComponent*> DynamicPrimitives;
 
@@ -188,6 +315,22 @@ private:
 	TSet<UDecalComponent*> DirtyDecals;           // 변경된 Decal
 	bool bDecalsDirty = false;                     // BVH 재구축 플래그
 
+	// Decal -> Receiver 캐시 (질의 당시 OBB와 함께 저장)
+	struct FDecalReceiverCacheEntry
+	{
+		FOBB DecalOBB;
+		TArray<UPrimitiveComponent*> Receivers;
+	};
+	TMap<UDecalComponent*, FDecalReceiverCacheEntry> DecalReceiverCache;
+	// Receiver -> 이 Receiver를 캐시에 가진 Decal (Receiver가 움직이거나 제거될 때 해당 쌍만 찾기 위함)
+	TMap<UPrimitiveComponent*, TArray<UDecalComponent*>> ReceiverToCachedDecals;
+	// BVH 리프가 바뀌어 캐시 반영이 필요한 Receiver
+	TArray<UPrimitiveComponent*> PendingDecalReceiverPatches;
+
+	void InvalidateDecalReceivers(UDecalComponent* InDecal);
+	void DetachDecalReceiver(UPrimitiveComponent* InReceiver);
+	void ClearDecalReceiverCache();
+
 	// ========================================
 	// Scene BVH
 	// ========================================
@@ -196,6 +339,14 @@ private:
 	bool bBVHNeedsRebuild = false;
 	int32 BVHDebugMaxDepth = -1;
 
+	// 이번 프레임에 Transform이 바뀌어 리핏이 필요한 Primitive (이동 컴포넌트, 기즈모 등)
+	TArray<UPrimitiveComponent*> PendingBVHRefitComponents;
+
+	// ========================================
+	// Render Scene
+	// ========================================
+	FRenderScene* RenderScene = nullptr;
+
 	// 디버그 렌더링용 데이터
 	TArray<FAABB> CachedDebugBoxes;
 	TArray<FVector4> CachedDebugColors;
@@ -0,0 +1,96 @@
+#pragma once
+#include <json.hpp>
+
+using JSON = json::JSON;
+
+struct FArchive;
+struct FMemoryReader;
+
+/**
+ * @brief 레벨 파일 안의 액터 한 개 분량 데이터
+ * Data는 ULevel::Serialize가 만드는 액터 JSON과 같은 구조 (Type, Components)
+ */
+struct FLevelBinaryActorRecord
+{
+	FString IdString;
+	FString TypeString;
+	JSON Data;
+};
+
+/**
+ * @brief 바이너리 레벨 파일 포맷 (.scenebin)
+ *
+ * [Header]   Magic, Version, ActorCount, 액터 블록 영역 크기
+ * [Metadata] PerspectiveCamera JSON (바이너리 인코딩)
+ * [TOC]      액터마다 Id, Type, 블록 오프셋, 블록 크기
+ * [Blocks]   액터 JSON을 바이너리로 인코딩한 블록들
+ *
+ * 컴포넌트 직렬화가 JSON 기반이므로 값 구조는 JSON 포맷과 동일하게 두고 표현만 바이너리로 바꿈
+ * TOC로 블록 경계를 미리 알 수 있어 디코딩은 워커 스레드에서 병렬로 하고,
+ * 스폰은 호출한 스레드(메인 스레드)에서 TOC 순서대로 수행
+ * JSON(.scene)은 외부 도구와 주고받는 용도로 그대로 유지
+ */
+class FLevelBinaryFormat
+{
+public:
+	static constexpr uint32 Magic = 0x4256454C; // "LEVB"
+	static constexpr uint32 Version = 1;
+	static constexpr const char* FileExtension = ".scenebin";
+
+	// 디코딩 배치 하나에 담을 액터 수 (메모리 사용량 상한)
+	static constexpr uint32 DecodeBatchSize = 4096;
+
+	using FOnActorDecoded = TFunction<void(FLevelBinaryActorRecord&)>;
+
+	/**
+	 * @brief 확장자로 바이너리 레벨 저장 대상인지 판단 (대소문자 무시)
+	 */
+	static bool HasBinaryExtension(const path& InFilePath);
+
+	/**
+	 * @brief 파일 앞의 Magic으로 바이너리 레벨 파일인지 판단
+	 */
+	static bool IsBinaryLevelFile(const path& InFilePath);
+
+	/**
+	 * @brief 레벨 파일 쓰기
+	 * 액터 JSON 인코딩은 워커 스레드에서 병렬로 수행
+	 */
+	static bool Write(const path& InFilePath, const JSON& InCameraJson, const TArray<FLevelBinaryActorRecord>& InActors);
+
+	/**
+	 * @brief 레벨 파일 읽기
+	 * DecodeBatchSize개씩 블록을 읽어 워커 스레드에서 디코딩한 뒤,
+	 * 호출한 스레드에서 TOC 순서대로 InOnActorDecoded 호출
+	 * @return 끝까지 오류 없이 읽었는지 여부 (오류 전까지 전달된 액터는 유지)
+	 */
+	static bool Read(const path& InFilePath, JSON& OutCameraJson, const FOnActorDecoded& InOnActorDecoded);
+
+	static void EncodeJson(FArchive& Ar, const JSON& InValue);
+	static bool DecodeJson(FMemoryReader& Ar, JSON& OutValue);
+
+private:
+	static bool DecodeJsonInternal(FMemoryReader& Ar, JSON& OutValue, uint32 InDepth);
+	static bool ReadBoundedString(FMemoryReader& Ar, FString& OutString);
+};
+
+/**
+ * @brief 레벨 포맷별 저장/로드 측정 결과
+ */
+struct FLevelFormatBenchmarkResult
+{
+	uint32 ActorCount = 0;
+	uint64 JsonFileSize = 0;
+	uint64 BinaryFileSize = 0;
+	double JsonSaveMilliseconds = 0.0;
+	double JsonLoadMilliseconds = 0.0;
+	double BinarySaveMilliseconds = 0.0;
+	double BinaryLoadMilliseconds = 0.0;
+};
+
+/**
+ * @brief 액터 InActorCount개짜리 레벨 데이터를 JSON과 바이너리 포맷으로 각각 저장/로드해 시간 비교
+ * 실제 액터 스폰과 Actor::Serialize는 두 포맷이 동일하므로 제외하고,
+ * 액터 단위 JSON을 넘겨받아 파일로 쓰기까지 / 파일에서 액터 단위 JSON을 얻기까지만 측정
+ */
+FLevelFormatBenchmarkResult RunLevelFormatBenchmark(uint32 InActorCount);
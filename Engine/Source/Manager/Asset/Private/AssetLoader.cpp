@@ -0,0 +1,210 @@
+#include "pch.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Texture/Public/Material.h"
+
+#include <fstream>
+
+namespace
+{
+	bool ReadFileBytes(const path& InFilePath, TArray<uint8>& OutBytes)
+	{
+		std::ifstream File(InFilePath, std::ios::binary | std::ios::ate);
+		if (!File)
+		{
+			return false;
+		}
+
+		const std::streamsize FileSize = File.tellg();
+		if (FileSize <= 0)
+		{
+			return false;
+		}
+
+		OutBytes.resize(static_cast<size_t>(FileSize));
+		File.seekg(0, std::ios::beg);
+		return static_cast<bool>(File.read(reinterpret_cast<char*>(OutBytes.data()), FileSize));
+	}
+}
+
+FAssetLoader::~FAssetLoader()
+{
+	Shutdown();
+}
+
+void FAssetLoader::Start(uint32 InThreadCount)
+{
+	if (!Workers.empty())
+	{
+		return;
+	}
+
+	bStopping = false;
+	const uint32 ThreadCount = std::max(1u, InThreadCount);
+	Workers.reserve(ThreadCount);
+	for (uint32 i = 0; i < ThreadCount; ++i)
+	{
+		Workers.emplace_back(&FAssetLoader::WorkerLoop, this);
+	}
+}
+
+void FAssetLoader::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopping = true;
+		Queue.clear();
+	}
+	QueueCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Requested.clear();
+	Loading.clear();
+	Completed.clear();
+}
+
+bool FAssetLoader::Request(const FString& InPathString)
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (bStopping || Workers.empty() || !Requested.insert(InPathString).second)
+		{
+			return false;
+		}
+		Queue.push_back(InPathString);
+	}
+	QueueCondition.notify_one();
+	return true;
+}
+
+bool FAssetLoader::Wait(const FString& InPathString)
+{
+	std::unique_lock<std::mutex> Lock(Mutex);
+	if (Requested.find(InPathString) == Requested.end())
+	{
+		return false;
+	}
+
+	// 아직 워커가 집어가지 않았으면 큐에서 빼서 직접 로드 (워커 차례를 기다리지 않음)
+	auto QueueIter = std::find(Queue.begin(), Queue.end(), InPathString);
+	if (QueueIter != Queue.end())
+	{
+		Queue.erase(QueueIter);
+		Loading.insert(InPathString);
+		Lock.unlock();
+
+		FStaticMeshLoadResult Result = LoadStaticMesh(InPathString);
+
+		Lock.lock();
+		Loading.erase(InPathString);
+		Completed.push_back(std::move(Result));
+		Lock.unlock();
+		CompletedCondition.notify_all();
+		return true;
+	}
+
+	CompletedCondition.wait(Lock, [this, &InPathString]()
+	{
+		return Loading.find(InPathString) == Loading.end();
+	});
+	return true;
+}
+
+void FAssetLoader::DrainCompleted(TArray<FStaticMeshLoadResult>& OutResults)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	for (FStaticMeshLoadResult& Result : Completed)
+	{
+		Requested.erase(Result.PathString);
+		OutResults.push_back(std::move(Result));
+	}
+	Completed.clear();
+}
+
+uint32 FAssetLoader::GetPendingCount() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return static_cast<uint32>(Requested.size());
+}
+
+void FAssetLoader::WorkerLoop()
+{
+	FProfiler::SetThreadName("AssetLoader");
+
+	while (true)
+	{
+		FString PathString;
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			QueueCondition.wait(Lock, [this]() { return bStopping || !Queue.empty(); });
+			if (bStopping)
+			{
+				return;
+			}
+
+			PathString = std::move(Queue.front());
+			Queue.pop_front();
+			Loading.insert(PathString);
+		}
+
+		FStaticMeshLoadResult Result = LoadStaticMesh(PathString);
+
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Loading.erase(PathString);
+			Completed.push_back(std::move(Result));
+		}
+		CompletedCondition.notify_all();
+	}
+}
+
+FStaticMeshLoadResult FAssetLoader::LoadStaticMesh(const FString& InPathString)
+{
+	TIME_PROFILE(LoadStaticMesh);
+
+	FStaticMeshLoadResult Result;
+	Result.PathString = InPathString;
+	Result.StaticMesh = FObjManager::BuildStaticMeshAsset(InPathString, FObjManager::GetDefaultConfiguration());
+	if (!Result.StaticMesh)
+	{
+		return Result;
+	}
+
+	// FObjManager::CreateMaterialsFromMTL이 읽을 텍스처 파일을 미리 메모리로 올려둠
+	const path ObjDirectory = path(InPathString).parent_path();
+	TSet<FString> VisitedTextures;
+	for (const FMaterial& MaterialInfo : Result.StaticMesh->MaterialInfo)
+	{
+		for (const FString* TextureMap : { &MaterialInfo.KdMap, &MaterialInfo.KaMap, &MaterialInfo.KsMap, &MaterialInfo.DMap })
+		{
+			if (TextureMap->empty())
+			{
+				continue;
+			}
+
+			FString TexturePathString = (ObjDirectory / *TextureMap).generic_string();
+			if (!VisitedTextures.insert(TexturePathString).second)
+			{
+				continue;
+			}
+
+			TArray<uint8> Bytes;
+			if (ReadFileBytes(TexturePathString, Bytes))
+			{
+				Result.TextureFiles.emplace_back(std::move(TexturePathString), std::move(Bytes));
+			}
+		}
+	}
+
+	return Result;
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Core/Public/ObjectIterator.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "DirectXTK/WICTextureLoader.h"
 #include "DirectXTK/DDSTextureLoader.h"
@@ -10,6 +11,7 @@
 #include "Texture/Public/SpriteMaterial.h"
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Texture/Public/Material.h"
 
 #include <unordered_map>
 #include <algorithm>
@@ -121,13 +123,12 @@ UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
-	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
-	// (obj 로드 시 mtllib로 참조된 mtl 파일도 함께 로드됨)
-	LoadAllObjStaticMesh();
+	// 시작 시에는 Data 폴더의 .obj 경로만 스캔하고 StaticMesh / Material / Texture는 처음 사용될 때 로드
+	// (레벨 로드 중에는 액터 목록을 보고 로더 스레드에서 미리 읽어둠)
+	ScanStaticMeshLibrary();
 
-	// Data 폴더 속 모든 .mtl 파일 로드 및 캐싱
-	// (obj가 없는 독립적인 mtl 파일만 추가로 로드)
-	LoadAllMaterials();
+	const uint32 HardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+	AsyncLoader.Start(std::clamp(HardwareThreadCount - 1, 1u, 4u));
 
 	VertexDatas.emplace(EPrimitiveType::Cube, &VerticesCube);
 	VertexDatas.emplace(EPrimitiveType::Sphere, &VerticesSphere);
@@ -195,21 +196,6 @@ void UAssetManager::Initialize()
 		AABBs[Type] = CalculateAABB(*Vertices);
 	}
 
-	// Calculate AABB for each StaticMesh
-	for (const auto& MeshPair : StaticMeshCache)
-	{
-		const FName& ObjPath = MeshPair.first;
-		const auto& Mesh = MeshPair.second;
-		if (!Mesh || !Mesh->IsValid())
-			continue;
-
-		const auto& Vertices = Mesh->GetVertices();
-		if (Vertices.empty())
-			continue;
-
-		StaticMeshAABBs[ObjPath] = CalculateAABB(Vertices);
-	}
-
 	// Initialize Shaders
 	ID3D11VertexShader* vertexShader;
 	ID3D11InputLayout* inputLayout;
@@ -229,6 +215,12 @@ void UAssetManager::Initialize()
 
 void UAssetManager::Release()
 {
+	// 로더 스레드를 먼저 멈춰야 아래에서 해제하는 캐시와 겹치지 않음
+	AsyncLoader.Shutdown();
+	PrefetchedTextureFiles.clear();
+	StaticMeshPaths.clear();
+	bAllMaterialsLoaded = false;
+
 	// Material Resource 해제
 	for (auto& Pair : MaterialCache)
 	{
@@ -269,13 +261,12 @@ void UAssetManager::Release()
 }
 
 /**
- * @brief Data/ 경로 하위에 모든 .obj 파일을 로드 후 캐싱한다
+ * @brief Data/ 경로 하위의 모든 .obj 파일 경로를 수집한다 (파일은 읽지 않음)
  */
-void UAssetManager::LoadAllObjStaticMesh()
+void UAssetManager::ScanStaticMeshLibrary()
 {
-	URenderer& Renderer = URenderer::GetInstance();
+	StaticMeshPaths.clear();
 
-	TArray<FName> ObjList;
 	const FString DataDirectory = "Data/"; // 검색할 기본 디렉토리
 	// 디렉토리가 실제로 존재하는지 먼저 확인합니다.
 	if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
@@ -287,36 +278,65 @@ void UAssetManager::LoadAllObjStaticMesh()
 			if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
 			{
 				// .generic_string()을 사용하여 OS에 상관없이 '/' 구분자를 사용하는 경로를 바로 얻습니다.
-				FString PathString = Entry.path().generic_string();
-
-				// 찾은 파일 경로를 FName으로 변환하여 ObjList에 추가합니다.
-				ObjList.push_back(FName(PathString));
+				StaticMeshPaths.push_back(FName(Entry.path().generic_string()));
 			}
 		}
 	}
 
-	// Enable winding order flip for this OBJ file
-	FObjImporter::Configuration Config;
-	Config.bFlipWindingOrder = false;
-	Config.bIsBinaryEnabled = true;
-	Config.bUVToUEBasis = true;
-	Config.bPositionToUEBasis = true;
+	UE_LOG("AssetManager: StaticMesh 라이브러리 %zu개 (사용 시 로드)", StaticMeshPaths.size());
+}
 
-	// 범위 기반 for문을 사용하여 배열의 모든 요소를 순회합니다.
-	for (const FName& ObjPath : ObjList)
+void UAssetManager::PrefetchStaticMesh(const FName& InObjPath)
+{
+	if (InObjPath.IsNone() || StaticMeshCache.find(InObjPath) != StaticMeshCache.end())
 	{
-		// FObjManager가 UStaticMesh 포인터를 반환한다고 가정합니다.
-		UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(ObjPath, Config);
+		return;
+	}
+
+	AsyncLoader.Request(InObjPath.ToString());
+}
+
+uint32 UAssetManager::FlushAsyncLoads()
+{
+	TArray<FStaticMeshLoadResult> Results;
+	AsyncLoader.DrainCompleted(Results);
 
-		// 로드에 성공했는지 확인합니다.
-		if (LoadedMesh)
+	uint32 RegisteredCount = 0;
+	for (FStaticMeshLoadResult& Result : Results)
+	{
+		if (!Result.StaticMesh)
+		{
+			continue;
+		}
+
+		// 로더 스레드가 읽어둔 텍스처 파일은 CreateMaterialsFromMTL -> LoadTexture에서 디코딩
+		for (auto& TextureFile : Result.TextureFiles)
 		{
-			StaticMeshCache.emplace(ObjPath, LoadedMesh);
+			PrefetchedTextureFiles.emplace(FName(TextureFile.first), std::move(TextureFile.second));
+		}
 
-			StaticMeshVertexBuffers.emplace(ObjPath, this->CreateVertexBuffer(LoadedMesh->GetVertices()));
-			StaticMeshIndexBuffers.emplace(ObjPath, this->CreateIndexBuffer(LoadedMesh->GetIndices()));
+		const FName ObjPath(Result.PathString);
+		FStaticMesh* StaticMeshAsset = FObjManager::RegisterStaticMeshAsset(ObjPath, std::move(Result.StaticMesh));
+		if (FObjManager::CreateStaticMesh(ObjPath, StaticMeshAsset))
+		{
+			++RegisteredCount;
 		}
 	}
+
+	// 이미 캐시에 있던 텍스처처럼 사용되지 않은 파일 데이터는 버림
+	PrefetchedTextureFiles.clear();
+	return RegisteredCount;
+}
+
+bool UAssetManager::WaitForAsyncStaticMesh(const FName& InObjPath)
+{
+	if (!AsyncLoader.Wait(InObjPath.ToString()))
+	{
+		return false;
+	}
+
+	FlushAsyncLoads();
+	return true;
 }
 
 ID3D11Buffer* UAssetManager::GetVertexBuffer(FName InObjPath)
@@ -342,8 +362,18 @@ ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices
 	return FRenderResourceFactory::CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
 }
 
-ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
+ID3D11Buffer* UAssetManager::CreateIndexBuffer(const TArray<uint32>& InIndices, uint32 InStride)
 {
+	if (InStride == sizeof(uint16))
+	{
+		TArray<uint16> ShortIndices;
+		ShortIndices.reserve(InIndices.size());
+		for (uint32 Index : InIndices)
+		{
+			ShortIndices.push_back(static_cast<uint16>(Index));
+		}
+		return FRenderResourceFactory::CreateIndexBuffer(ShortIndices.data(), static_cast<int>(ShortIndices.size()) * sizeof(uint16));
+	}
 	return FRenderResourceFactory::CreateIndexBuffer(InIndices.data(), static_cast<int>(InIndices.size()) * sizeof(uint32));
 }
 
@@ -423,9 +453,30 @@ void UAssetManager::AddStaticMeshToCache(const FName& InObjPath, UStaticMesh* In
 	if (!InStaticMesh)
 		return;
 
-	if (StaticMeshCache.find(InObjPath) == StaticMeshCache.end())
+	if (StaticMeshCache.find(InObjPath) != StaticMeshCache.end())
+		return;
+
+	StaticMeshCache.emplace(InObjPath, std::unique_ptr<UStaticMesh>(InStaticMesh));
+
+	// 처음 사용될 때 로드되므로 GPU 버퍼와 AABB도 캐시에 들어올 때 같이 만든다
+	StaticMeshVertexBuffers.emplace(InObjPath, CreateVertexBuffer(InStaticMesh->GetVertices()));
+	// LOD 인덱스는 LOD0 뒤에 이어 붙여 버퍼 하나로 만들고, 그릴 때 FStaticMeshLOD::FirstIndex로 구분
+	if (InStaticMesh->GetLODs().empty())
+	{
+		StaticMeshIndexBuffers.emplace(InObjPath, CreateIndexBuffer(InStaticMesh->GetIndices(), InStaticMesh->GetIndexStride()));
+	}
+	else
+	{
+		TArray<uint32> AllIndices = InStaticMesh->GetIndices();
+		for (const FStaticMeshLOD& LOD : InStaticMesh->GetLODs())
+		{
+			AllIndices.insert(AllIndices.end(), LOD.Indices.begin(), LOD.Indices.end());
+		}
+		StaticMeshIndexBuffers.emplace(InObjPath, CreateIndexBuffer(AllIndices, InStaticMesh->GetIndexStride()));
+	}
+	if (!InStaticMesh->GetVertices().empty())
 	{
-		StaticMeshCache.emplace(InObjPath, std::unique_ptr<UStaticMesh>(InStaticMesh));
+		StaticMeshAABBs[InObjPath] = CalculateAABB(InStaticMesh->GetVertices());
 	}
 }
 
@@ -444,8 +495,18 @@ ComPtr<ID3D11ShaderResourceView> UAssetManager::LoadTexture(const FName& InFileP
 		return Iter->second;
 	}
 
-	// 새로운 텍스처 로드
-	ID3D11ShaderResourceView* TextureSRV = CreateTextureFromFile(InFilePath.ToString());
+	// 새로운 텍스처 로드 (로더 스레드가 파일을 미리 읽어뒀으면 메모리에서 생성)
+	ID3D11ShaderResourceView* TextureSRV = nullptr;
+	auto PrefetchedIter = PrefetchedTextureFiles.find(InFilePath);
+	if (PrefetchedIter != PrefetchedTextureFiles.end())
+	{
+		TextureSRV = CreateTextureFromMemory(PrefetchedIter->second.data(), PrefetchedIter->second.size());
+		PrefetchedTextureFiles.erase(PrefetchedIter);
+	}
+	else
+	{
+		TextureSRV = CreateTextureFromFile(InFilePath.ToString());
+	}
 	if (TextureSRV)
 	{
 		TextureCache[InFilePath] = TextureSRV;
@@ -756,6 +817,48 @@ void UAssetManager::LoadAllMaterials()
 		MtlList.size(), MaterialCache.size());
 }
 
+void UAssetManager::EnsureAllMaterialsLoaded()
+{
+	if (bAllMaterialsLoaded)
+	{
+		return;
+	}
+
+	bAllMaterialsLoaded = true;
+	LoadAllMaterials();
+}
+
+UMaterial* UAssetManager::FindMaterialByDiffuseTexturePath(const FString& InTexturePath)
+{
+	const FName TexturePath(InTexturePath);
+	auto FindLoaded = [&TexturePath]() -> UMaterial*
+	{
+		for (TObjectIterator<UMaterial> It; It; ++It)
+		{
+			UMaterial* Material = *It;
+			UTexture* DiffuseTexture = Material ? Material->GetDiffuseTexture() : nullptr;
+			if (DiffuseTexture && DiffuseTexture->GetFilePath() == TexturePath)
+			{
+				return Material;
+			}
+		}
+		return nullptr;
+	};
+
+	if (UMaterial* Found = FindLoaded())
+	{
+		return Found;
+	}
+
+	if (bAllMaterialsLoaded)
+	{
+		return nullptr;
+	}
+
+	EnsureAllMaterialsLoaded();
+	return FindLoaded();
+}
+
 TArray<UMaterial*> UAssetManager::LoadMaterialsFromMTL(const FName& InMtlPath)
 {
 	TArray<UMaterial*> LoadedMaterials;
@@ -0,0 +1,295 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshCooker.h"
+
+namespace
+{
+	constexpr uint32 InvalidVertex = UINT32_MAX;
+
+	// Forsyth 점수 상수 (원 논문 값)
+	constexpr uint32 MaxValenceScore = 32;
+	constexpr float CacheDecayPower = 1.5f;
+	constexpr float LastTriangleScore = 0.75f;
+	constexpr float ValenceBoostScale = 2.0f;
+	constexpr float ValenceBoostPower = 0.5f;
+
+	struct FVertexScoreTable
+	{
+		float Cache[FMeshCooker::VertexCacheSize];
+		float Valence[MaxValenceScore];
+
+		FVertexScoreTable()
+		{
+			// 방금 그린 삼각형의 정점 3개는 순서에 상관없이 같은 점수
+			constexpr float Scaler = 1.0f / (FMeshCooker::VertexCacheSize - 3);
+			for (uint32 Position = 0; Position < FMeshCooker::VertexCacheSize; ++Position)
+			{
+				Cache[Position] = Position < 3
+					? LastTriangleScore
+					: powf(1.0f - static_cast<float>(Position - 3) * Scaler, CacheDecayPower);
+			}
+
+			Valence[0] = 0.0f;
+			for (uint32 LiveValence = 1; LiveValence < MaxValenceScore; ++LiveValence)
+			{
+				Valence[LiveValence] = ValenceBoostScale * powf(static_cast<float>(LiveValence), -ValenceBoostPower);
+			}
+		}
+	};
+
+	/**
+	 * @brief 캐시 위치와 남은 삼각형 수로 정점 점수 계산
+	 * 남은 삼각형이 적을수록 점수를 높여 외톨이 삼각형이 끝까지 남지 않게 함
+	 */
+	float GetVertexScore(const FVertexScoreTable& InTable, int32 InCachePosition, uint32 InLiveValence)
+	{
+		if (InLiveValence == 0)
+		{
+			return -1.0f;
+		}
+
+		float Score = InCachePosition >= 0 ? InTable.Cache[InCachePosition] : 0.0f;
+		Score += InLiveValence < MaxValenceScore
+			? InTable.Valence[InLiveValence]
+			: ValenceBoostScale * powf(static_cast<float>(InLiveValence), -ValenceBoostPower);
+		return Score;
+	}
+}
+
+void FMeshCooker::Cook(FStaticMesh& InOutStaticMesh, FMeshCookStats* OutStats)
+{
+	TArray<uint32>& Indices = InOutStaticMesh.Indices;
+	const size_t IndexCount = Indices.size();
+
+	if (OutStats)
+	{
+		OutStats->SourceACMR = CalculateACMR(Indices, InOutStaticMesh.Vertices.size());
+	}
+
+	// 섹션 경계를 넘어 삼각형을 옮기면 머티리얼이 바뀌므로 섹션(과 섹션 사이 구간)마다 따로 재정렬
+	TArray<size_t> Boundaries = { 0, IndexCount };
+	for (const FMeshSection& Section : InOutStaticMesh.Sections)
+	{
+		Boundaries.push_back(std::min<size_t>(Section.StartIndex, IndexCount));
+		Boundaries.push_back(std::min<size_t>(static_cast<size_t>(Section.StartIndex) + Section.IndexCount, IndexCount));
+	}
+	std::sort(Boundaries.begin(), Boundaries.end());
+	Boundaries.erase(std::unique(Boundaries.begin(), Boundaries.end()), Boundaries.end());
+
+	for (size_t i = 0; i + 1 < Boundaries.size(); ++i)
+	{
+		OptimizeVertexCache(Indices.data() + Boundaries[i], Boundaries[i + 1] - Boundaries[i], InOutStaticMesh.Vertices.size());
+	}
+
+	OptimizeVertexFetch(InOutStaticMesh.Vertices, Indices);
+
+	// 트라이앵글 리스트는 strip cut 값(0xFFFF)의 영향을 받지 않으므로 정점 65536개까지 16비트 사용 가능
+	InOutStaticMesh.IndexStride = InOutStaticMesh.Vertices.size() <= 0x10000 ? sizeof(uint16) : sizeof(uint32);
+
+	if (OutStats)
+	{
+		OutStats->VertexCount = static_cast<uint32>(InOutStaticMesh.Vertices.size());
+		OutStats->TriangleCount = static_cast<uint32>(IndexCount / 3);
+		OutStats->CookedACMR = CalculateACMR(Indices, InOutStaticMesh.Vertices.size());
+		OutStats->b16BitIndices = InOutStaticMesh.IndexStride == sizeof(uint16);
+	}
+}
+
+void FMeshCooker::OptimizeVertexCache(uint32* InOutIndices, size_t InIndexCount, size_t InVertexCount)
+{
+	const size_t TriangleCount = InIndexCount / 3;
+	if (TriangleCount < 2)
+	{
+		return;
+	}
+
+	static const FVertexScoreTable ScoreTable;
+
+	// 범위에서 쓰이는 정점만 로컬 번호로 압축
+	TArray<uint32> GlobalToLocal(InVertexCount, InvalidVertex);
+	TArray<uint32> LocalToGlobal;
+	TArray<uint32> LocalIndices(TriangleCount * 3);
+	for (size_t i = 0; i < LocalIndices.size(); ++i)
+	{
+		uint32& Local = GlobalToLocal[InOutIndices[i]];
+		if (Local == InvalidVertex)
+		{
+			Local = static_cast<uint32>(LocalToGlobal.size());
+			LocalToGlobal.push_back(InOutIndices[i]);
+		}
+		LocalIndices[i] = Local;
+	}
+	const size_t VertexCount = LocalToGlobal.size();
+
+	// 정점별 인접 삼각형 목록, 앞쪽 LiveValence개가 아직 출력되지 않은 삼각형
+	TArray<uint32> LiveValence(VertexCount, 0);
+	for (uint32 Vertex : LocalIndices)
+	{
+		++LiveValence[Vertex];
+	}
+
+	TArray<uint32> TriangleOffset(VertexCount + 1, 0);
+	for (size_t Vertex = 0; Vertex < VertexCount; ++Vertex)
+	{
+		TriangleOffset[Vertex + 1] = TriangleOffset[Vertex] + LiveValence[Vertex];
+	}
+
+	TArray<uint32> AdjacentTriangles(LocalIndices.size());
+	{
+		TArray<uint32> FillOffset(TriangleOffset.begin(), TriangleOffset.end() - 1);
+		for (size_t i = 0; i < LocalIndices.size(); ++i)
+		{
+			AdjacentTriangles[FillOffset[LocalIndices[i]]++] = static_cast<uint32>(i / 3);
+		}
+	}
+
+	TArray<int32> CachePosition(VertexCount, -1);
+	TArray<float> VertexScore(VertexCount);
+	for (size_t Vertex = 0; Vertex < VertexCount; ++Vertex)
+	{
+		VertexScore[Vertex] = GetVertexScore(ScoreTable, -1, LiveValence[Vertex]);
+	}
+
+	TArray<float> TriangleScore(TriangleCount);
+	TArray<uint8> bEmitted(TriangleCount, 0);
+	uint32 BestTriangle = 0;
+	for (size_t Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		const uint32* Corner = &LocalIndices[Triangle * 3];
+		TriangleScore[Triangle] = VertexScore[Corner[0]] + VertexScore[Corner[1]] + VertexScore[Corner[2]];
+		if (TriangleScore[Triangle] > TriangleScore[BestTriangle])
+		{
+			BestTriangle = static_cast<uint32>(Triangle);
+		}
+	}
+
+	uint32 Cache[VertexCacheSize + 3];
+	uint32 NewCache[VertexCacheSize + 3];
+	uint32 CacheCount = 0;
+	size_t EmittedCount = 0;
+	size_t Cursor = 0;
+
+	while (BestTriangle != InvalidVertex)
+	{
+		const uint32* Corner = &LocalIndices[static_cast<size_t>(BestTriangle) * 3];
+		bEmitted[BestTriangle] = 1;
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			InOutIndices[EmittedCount * 3 + k] = LocalToGlobal[Corner[k]];
+		}
+		++EmittedCount;
+
+		// 출력한 삼각형을 인접 목록의 살아있는 구간에서 제거
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			const uint32 Vertex = Corner[k];
+			uint32* Begin = &AdjacentTriangles[TriangleOffset[Vertex]];
+			uint32* End = Begin + LiveValence[Vertex];
+			uint32* Found = std::find(Begin, End, BestTriangle);
+			std::swap(*Found, *(End - 1));
+			--LiveValence[Vertex];
+		}
+
+		// LRU 갱신: 방금 쓴 정점을 앞으로 보내고 나머지는 순서 유지
+		uint32 NewCount = 0;
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			if (std::find(NewCache, NewCache + NewCount, Corner[k]) == NewCache + NewCount)
+			{
+				NewCache[NewCount++] = Corner[k];
+			}
+		}
+		for (uint32 i = 0; i < CacheCount; ++i)
+		{
+			if (Cache[i] != Corner[0] && Cache[i] != Corner[1] && Cache[i] != Corner[2])
+			{
+				NewCache[NewCount++] = Cache[i];
+			}
+		}
+
+		for (uint32 i = 0; i < NewCount; ++i)
+		{
+			const uint32 Vertex = NewCache[i];
+			CachePosition[Vertex] = i < VertexCacheSize ? static_cast<int32>(i) : -1;
+			VertexScore[Vertex] = GetVertexScore(ScoreTable, CachePosition[Vertex], LiveValence[Vertex]);
+		}
+
+		// 점수가 바뀐 정점(밀려난 정점 포함)의 삼각형 점수를 갱신하고, 캐시에 걸친 삼각형 중 최고점을 다음으로 선택
+		BestTriangle = InvalidVertex;
+		float BestScore = -1.0f;
+		for (uint32 i = 0; i < NewCount; ++i)
+		{
+			const uint32 Vertex = NewCache[i];
+			const uint32* Begin = &AdjacentTriangles[TriangleOffset[Vertex]];
+			for (const uint32* Triangle = Begin; Triangle != Begin + LiveValence[Vertex]; ++Triangle)
+			{
+				const uint32* Other = &LocalIndices[static_cast<size_t>(*Triangle) * 3];
+				const float Score = VertexScore[Other[0]] + VertexScore[Other[1]] + VertexScore[Other[2]];
+				TriangleScore[*Triangle] = Score;
+				if (i < VertexCacheSize && Score > BestScore)
+				{
+					BestScore = Score;
+					BestTriangle = *Triangle;
+				}
+			}
+		}
+
+		CacheCount = std::min(NewCount, VertexCacheSize);
+		std::copy(NewCache, NewCache + CacheCount, Cache);
+
+		// 캐시와 이어진 삼각형이 없으면 (연결이 끊긴 조각) 아직 출력되지 않은 다음 삼각형에서 재시작
+		if (BestTriangle == InvalidVertex)
+		{
+			while (Cursor < TriangleCount && bEmitted[Cursor])
+			{
+				++Cursor;
+			}
+			if (Cursor < TriangleCount)
+			{
+				BestTriangle = static_cast<uint32>(Cursor);
+			}
+		}
+	}
+}
+
+void FMeshCooker::OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices)
+{
+	TArray<uint32> Remap(InOutVertices.size(), InvalidVertex);
+	TArray<FNormalVertex> Reordered;
+	Reordered.reserve(InOutVertices.size());
+
+	for (uint32& Index : InOutIndices)
+	{
+		uint32& NewIndex = Remap[Index];
+		if (NewIndex == InvalidVertex)
+		{
+			NewIndex = static_cast<uint32>(Reordered.size());
+			Reordered.push_back(InOutVertices[Index]);
+		}
+		Index = NewIndex;
+	}
+
+	InOutVertices = std::move(Reordered);
+}
+
+float FMeshCooker::CalculateACMR(const TArray<uint32>& InIndices, size_t InVertexCount, uint32 InCacheSize)
+{
+	if (InIndices.size() < 3)
+	{
+		return 0.0f;
+	}
+
+	// FIFO 시뮬레이션: 정점이 들어온 시각을 기록하고, 그 뒤로 InCacheSize개가 더 들어오면 밀려난 것으로 판단
+	TArray<uint32> InsertTime(InVertexCount, 0);
+	uint32 Time = InCacheSize + 1;
+	size_t MissCount = 0;
+	for (uint32 Index : InIndices)
+	{
+		if (Time - InsertTime[Index] > InCacheSize)
+		{
+			InsertTime[Index] = Time++;
+			++MissCount;
+		}
+	}
+
+	return static_cast<float>(MissCount) / static_cast<float>(InIndices.size() / 3);
+}
@@ -0,0 +1,497 @@
+#include "pch.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Manager/Asset/Public/MeshCooker.h"
+#include <queue>
+
+namespace
+{
+	constexpr uint32 InvalidRange = UINT32_MAX;
+
+	/**
+	 * @brief 평면 거리 제곱 합을 나타내는 대칭 4x4 행렬 (상삼각 10개 성분)
+	 */
+	struct FQuadric
+	{
+		double A00 = 0, A01 = 0, A02 = 0, A03 = 0;
+		double A11 = 0, A12 = 0, A13 = 0;
+		double A22 = 0, A23 = 0;
+		double A33 = 0;
+
+		static FQuadric FromPlane(double InA, double InB, double InC, double InD)
+		{
+			FQuadric Quadric;
+			Quadric.A00 = InA * InA; Quadric.A01 = InA * InB; Quadric.A02 = InA * InC; Quadric.A03 = InA * InD;
+			Quadric.A11 = InB * InB; Quadric.A12 = InB * InC; Quadric.A13 = InB * InD;
+			Quadric.A22 = InC * InC; Quadric.A23 = InC * InD;
+			Quadric.A33 = InD * InD;
+			return Quadric;
+		}
+
+		FQuadric& operator+=(const FQuadric& InOther)
+		{
+			A00 += InOther.A00; A01 += InOther.A01; A02 += InOther.A02; A03 += InOther.A03;
+			A11 += InOther.A11; A12 += InOther.A12; A13 += InOther.A13;
+			A22 += InOther.A22; A23 += InOther.A23;
+			A33 += InOther.A33;
+			return *this;
+		}
+
+		double Evaluate(const FVector& InPoint) const
+		{
+			const double X = InPoint.X, Y = InPoint.Y, Z = InPoint.Z;
+			const double Error = A00 * X * X + 2.0 * A01 * X * Y + 2.0 * A02 * X * Z + 2.0 * A03 * X
+				+ A11 * Y * Y + 2.0 * A12 * Y * Z + 2.0 * A13 * Y
+				+ A22 * Z * Z + 2.0 * A23 * Z
+				+ A33;
+			return std::max(Error, 0.0);
+		}
+	};
+
+	struct FCollapse
+	{
+		double Cost;
+		uint32 From;
+		uint32 To;
+
+		bool operator>(const FCollapse& InOther) const { return Cost > InOther.Cost; }
+	};
+
+	/**
+	 * @brief 단순화 작업 상태
+	 * 삼각형은 제자리에서 정점 번호만 바뀌고, 정점별 인접 목록에는 죽은 삼각형이 남아 있을 수 있음 (순회할 때 건너뜀)
+	 */
+	struct FSimplifyState
+	{
+		const TArray<FNormalVertex>& Vertices;
+		TArray<uint32> Triangles;			// 3개씩 정점 번호
+		TArray<uint32> TriangleRange;		// 삼각형이 속한 섹션 구간
+		TArray<uint8> bTriangleAlive;
+		TArray<TArray<uint32>> VertexTriangles;
+		TArray<FQuadric> Quadrics;
+		TArray<uint8> bVertexLocked;
+		TArray<uint8> bVertexRemoved;
+		size_t LiveTriangleCount = 0;
+
+		explicit FSimplifyState(const TArray<FNormalVertex>& InVertices) : Vertices(InVertices) {}
+
+		bool TriangleHasVertex(uint32 InTriangle, uint32 InVertex) const
+		{
+			const uint32* Corner = &Triangles[static_cast<size_t>(InTriangle) * 3];
+			return Corner[0] == InVertex || Corner[1] == InVertex || Corner[2] == InVertex;
+		}
+
+		double GetCost(uint32 InFrom, uint32 InTo) const
+		{
+			FQuadric Quadric = Quadrics[InFrom];
+			Quadric += Quadrics[InTo];
+			return Quadric.Evaluate(Vertices[InTo].Position);
+		}
+
+		bool IsEdge(uint32 InFrom, uint32 InTo) const
+		{
+			for (uint32 Triangle : VertexTriangles[InFrom])
+			{
+				if (bTriangleAlive[Triangle] && TriangleHasVertex(Triangle, InTo))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * @brief InFrom을 InTo로 옮겼을 때 뒤집히거나 면적이 0이 되는 삼각형이 있는지 검사
+		 */
+		bool FlipsTriangle(uint32 InFrom, uint32 InTo) const
+		{
+			for (uint32 Triangle : VertexTriangles[InFrom])
+			{
+				if (!bTriangleAlive[Triangle] || TriangleHasVertex(Triangle, InTo))
+				{
+					continue;
+				}
+
+				const uint32* Corner = &Triangles[static_cast<size_t>(Triangle) * 3];
+				FVector Before[3];
+				FVector After[3];
+				for (uint32 k = 0; k < 3; ++k)
+				{
+					Before[k] = Vertices[Corner[k]].Position;
+					After[k] = Corner[k] == InFrom ? Vertices[InTo].Position : Before[k];
+				}
+
+				const FVector NormalBefore = (Before[1] - Before[0]).Cross(Before[2] - Before[0]);
+				const FVector NormalAfter = (After[1] - After[0]).Cross(After[2] - After[0]);
+				const float LengthBefore = NormalBefore.Length();
+				const float LengthAfter = NormalAfter.Length();
+				if (LengthAfter <= LengthBefore * 1e-4f || NormalBefore.Dot(NormalAfter) <= 0.2f * LengthBefore * LengthAfter)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void Collapse(uint32 InFrom, uint32 InTo)
+		{
+			for (uint32 Triangle : VertexTriangles[InFrom])
+			{
+				if (!bTriangleAlive[Triangle])
+				{
+					continue;
+				}
+
+				if (TriangleHasVertex(Triangle, InTo))
+				{
+					bTriangleAlive[Triangle] = 0;
+					--LiveTriangleCount;
+					continue;
+				}
+
+				uint32* Corner = &Triangles[static_cast<size_t>(Triangle) * 3];
+				for (uint32 k = 0; k < 3; ++k)
+				{
+					if (Corner[k] == InFrom)
+					{
+						Corner[k] = InTo;
+					}
+				}
+				VertexTriangles[InTo].push_back(Triangle);
+			}
+
+			Quadrics[InTo] += Quadrics[InFrom];
+			bVertexRemoved[InFrom] = 1;
+			VertexTriangles[InFrom].clear();
+
+			TArray<uint32>& ToTriangles = VertexTriangles[InTo];
+			ToTriangles.erase(std::remove_if(ToTriangles.begin(), ToTriangles.end(),
+				[this](uint32 Triangle) { return !bTriangleAlive[Triangle]; }), ToTriangles.end());
+		}
+
+		void PushEdges(uint32 InVertex, std::priority_queue<FCollapse, TArray<FCollapse>, std::greater<FCollapse>>& InOutHeap) const
+		{
+			for (uint32 Triangle : VertexTriangles[InVertex])
+			{
+				if (!bTriangleAlive[Triangle])
+				{
+					continue;
+				}
+
+				const uint32* Corner = &Triangles[static_cast<size_t>(Triangle) * 3];
+				for (uint32 k = 0; k < 3; ++k)
+				{
+					const uint32 Other = Corner[k];
+					if (Other == InVertex)
+					{
+						continue;
+					}
+					if (!bVertexLocked[InVertex])
+					{
+						InOutHeap.push({ GetCost(InVertex, Other), InVertex, Other });
+					}
+					if (!bVertexLocked[Other])
+					{
+						InOutHeap.push({ GetCost(Other, InVertex), Other, InVertex });
+					}
+				}
+			}
+		}
+	};
+
+	/**
+	 * @brief 섹션 시작/끝을 경계로 인덱스 배열을 구간으로 나눔 (섹션 사이의 빈 구간도 별도 구간)
+	 */
+	TArray<size_t> GetRangeBoundaries(const TArray<FMeshSection>& InSections, size_t InIndexCount)
+	{
+		TArray<size_t> Boundaries = { 0, InIndexCount };
+		for (const FMeshSection& Section : InSections)
+		{
+			Boundaries.push_back(std::min<size_t>(Section.StartIndex, InIndexCount));
+			Boundaries.push_back(std::min<size_t>(static_cast<size_t>(Section.StartIndex) + Section.IndexCount, InIndexCount));
+		}
+		std::sort(Boundaries.begin(), Boundaries.end());
+		Boundaries.erase(std::unique(Boundaries.begin(), Boundaries.end()), Boundaries.end());
+		return Boundaries;
+	}
+
+	/**
+	 * @brief 같은 위치를 공유하는 정점을 하나의 번호로 묶음 (UV/노멀 seam 판별용)
+	 */
+	TArray<uint32> WeldPositions(const TArray<FNormalVertex>& InVertices, uint32& OutPositionCount)
+	{
+		TArray<uint32> Order(InVertices.size());
+		for (size_t i = 0; i < Order.size(); ++i)
+		{
+			Order[i] = static_cast<uint32>(i);
+		}
+
+		auto Less = [&InVertices](uint32 A, uint32 B)
+		{
+			const FVector& PA = InVertices[A].Position;
+			const FVector& PB = InVertices[B].Position;
+			if (PA.X != PB.X) return PA.X < PB.X;
+			if (PA.Y != PB.Y) return PA.Y < PB.Y;
+			return PA.Z < PB.Z;
+		};
+		std::sort(Order.begin(), Order.end(), Less);
+
+		TArray<uint32> PositionId(InVertices.size());
+		OutPositionCount = 0;
+		for (size_t i = 0; i < Order.size(); ++i)
+		{
+			if (i > 0 && Less(Order[i - 1], Order[i]))
+			{
+				++OutPositionCount;
+			}
+			PositionId[Order[i]] = OutPositionCount;
+		}
+		if (!Order.empty())
+		{
+			++OutPositionCount;
+		}
+		return PositionId;
+	}
+}
+
+float FMeshSimplifier::Simplify(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+	const TArray<FMeshSection>& InSections, size_t InTargetTriangleCount,
+	TArray<uint32>& OutIndices, TArray<FMeshSection>& OutSections)
+{
+	const size_t VertexCount = InVertices.size();
+	const size_t TriangleCount = InIndices.size() / 3;
+	const TArray<size_t> Boundaries = GetRangeBoundaries(InSections, TriangleCount * 3);
+
+	FSimplifyState State(InVertices);
+	State.Triangles.assign(InIndices.begin(), InIndices.begin() + TriangleCount * 3);
+	State.TriangleRange.resize(TriangleCount);
+	State.bTriangleAlive.assign(TriangleCount, 1);
+	State.VertexTriangles.resize(VertexCount);
+	State.Quadrics.resize(VertexCount);
+	State.bVertexLocked.assign(VertexCount, 0);
+	State.bVertexRemoved.assign(VertexCount, 0);
+	State.LiveTriangleCount = TriangleCount;
+
+	for (size_t Range = 0; Range + 1 < Boundaries.size(); ++Range)
+	{
+		for (size_t Triangle = Boundaries[Range] / 3; Triangle < Boundaries[Range + 1] / 3; ++Triangle)
+		{
+			State.TriangleRange[Triangle] = static_cast<uint32>(Range);
+		}
+	}
+
+	// #1. 삼각형 평면으로 정점 quadric 누적, 인접 목록 구성
+	TArray<uint32> VertexRange(VertexCount, InvalidRange);
+	for (size_t Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		const uint32* Corner = &State.Triangles[Triangle * 3];
+		const FVector& P0 = InVertices[Corner[0]].Position;
+		FVector Normal = (InVertices[Corner[1]].Position - P0).Cross(InVertices[Corner[2]].Position - P0);
+		Normal.Normalize();
+		const FQuadric Plane = FQuadric::FromPlane(Normal.X, Normal.Y, Normal.Z, -Normal.Dot(P0));
+
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			const uint32 Vertex = Corner[k];
+			State.Quadrics[Vertex] += Plane;
+			State.VertexTriangles[Vertex].push_back(static_cast<uint32>(Triangle));
+
+			// 서로 다른 섹션이 공유하는 정점은 머티리얼 경계
+			if (VertexRange[Vertex] == InvalidRange)
+			{
+				VertexRange[Vertex] = State.TriangleRange[Triangle];
+			}
+			else if (VertexRange[Vertex] != State.TriangleRange[Triangle])
+			{
+				State.bVertexLocked[Vertex] = 1;
+			}
+		}
+	}
+
+	// #2. seam (같은 위치에 정점이 여러 개) 과 열린 경계 (한 삼각형만 쓰는 edge) 정점 고정
+	uint32 PositionCount = 0;
+	const TArray<uint32> PositionId = WeldPositions(InVertices, PositionCount);
+	{
+		TArray<uint32> VerticesPerPosition(PositionCount, 0);
+		for (size_t Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			if (!State.VertexTriangles[Vertex].empty())
+			{
+				++VerticesPerPosition[PositionId[Vertex]];
+			}
+		}
+		for (size_t Vertex = 0; Vertex < VertexCount; ++Vertex)
+		{
+			if (VerticesPerPosition[PositionId[Vertex]] > 1)
+			{
+				State.bVertexLocked[Vertex] = 1;
+			}
+		}
+
+		TMap<uint64, uint32> EdgeUseCount;
+		EdgeUseCount.reserve(TriangleCount * 3);
+		for (size_t Triangle = 0; Triangle < TriangleCount; ++Triangle)
+		{
+			const uint32* Corner = &State.Triangles[Triangle * 3];
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				const uint32 A = PositionId[Corner[k]];
+				const uint32 B = PositionId[Corner[(k + 1) % 3]];
+				++EdgeUseCount[(static_cast<uint64>(std::min(A, B)) << 32) | std::max(A, B)];
+			}
+		}
+		for (size_t Triangle = 0; Triangle < TriangleCount; ++Triangle)
+		{
+			const uint32* Corner = &State.Triangles[Triangle * 3];
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				const uint32 A = PositionId[Corner[k]];
+				const uint32 B = PositionId[Corner[(k + 1) % 3]];
+				if (EdgeUseCount[(static_cast<uint64>(std::min(A, B)) << 32) | std::max(A, B)] == 1)
+				{
+					State.bVertexLocked[Corner[k]] = 1;
+					State.bVertexLocked[Corner[(k + 1) % 3]] = 1;
+				}
+			}
+		}
+	}
+
+	// #3. 오차가 작은 collapse부터 적용 (비용은 꺼낼 때 다시 계산해서 바뀌었으면 다시 넣음)
+	std::priority_queue<FCollapse, TArray<FCollapse>, std::greater<FCollapse>> Heap;
+	for (size_t Vertex = 0; Vertex < VertexCount; ++Vertex)
+	{
+		if (State.bVertexLocked[Vertex])
+		{
+			continue;
+		}
+		for (uint32 Triangle : State.VertexTriangles[Vertex])
+		{
+			const uint32* Corner = &State.Triangles[static_cast<size_t>(Triangle) * 3];
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				if (Corner[k] != Vertex)
+				{
+					Heap.push({ State.GetCost(static_cast<uint32>(Vertex), Corner[k]), static_cast<uint32>(Vertex), Corner[k] });
+				}
+			}
+		}
+	}
+
+	double MaxCost = 0.0;
+	while (State.LiveTriangleCount > InTargetTriangleCount && !Heap.empty())
+	{
+		const FCollapse Candidate = Heap.top();
+		Heap.pop();
+
+		if (State.bVertexRemoved[Candidate.From] || State.bVertexRemoved[Candidate.To] ||
+			!State.IsEdge(Candidate.From, Candidate.To))
+		{
+			continue;
+		}
+
+		const double Cost = State.GetCost(Candidate.From, Candidate.To);
+		if (Cost > Candidate.Cost * (1.0 + 1e-6) + 1e-12)
+		{
+			Heap.push({ Cost, Candidate.From, Candidate.To });
+			continue;
+		}
+
+		if (State.FlipsTriangle(Candidate.From, Candidate.To))
+		{
+			continue;
+		}
+
+		State.Collapse(Candidate.From, Candidate.To);
+		MaxCost = std::max(MaxCost, Cost);
+		State.PushEdges(Candidate.To, Heap);
+	}
+
+	// #4. 살아남은 삼각형을 구간 순서대로 모아 섹션 재구성
+	OutIndices.clear();
+	OutIndices.reserve(State.LiveTriangleCount * 3);
+	TArray<size_t> RangeStart(Boundaries.size(), 0);
+	for (size_t Range = 0; Range + 1 < Boundaries.size(); ++Range)
+	{
+		RangeStart[Range] = OutIndices.size();
+		for (size_t Triangle = Boundaries[Range] / 3; Triangle < Boundaries[Range + 1] / 3; ++Triangle)
+		{
+			if (State.bTriangleAlive[Triangle])
+			{
+				OutIndices.insert(OutIndices.end(), &State.Triangles[Triangle * 3], &State.Triangles[Triangle * 3] + 3);
+			}
+		}
+		FMeshCooker::OptimizeVertexCache(OutIndices.data() + RangeStart[Range], OutIndices.size() - RangeStart[Range], VertexCount);
+	}
+	RangeStart.back() = OutIndices.size();
+
+	OutSections = InSections;
+	for (FMeshSection& Section : OutSections)
+	{
+		const size_t Start = std::min<size_t>(Section.StartIndex, TriangleCount * 3);
+		const size_t End = std::min<size_t>(static_cast<size_t>(Section.StartIndex) + Section.IndexCount, TriangleCount * 3);
+		const size_t StartRange = std::lower_bound(Boundaries.begin(), Boundaries.end(), Start) - Boundaries.begin();
+		const size_t EndRange = std::lower_bound(Boundaries.begin(), Boundaries.end(), End) - Boundaries.begin();
+		Section.StartIndex = static_cast<uint32>(RangeStart[StartRange]);
+		Section.IndexCount = static_cast<uint32>(RangeStart[EndRange] - RangeStart[StartRange]);
+	}
+
+	return static_cast<float>(sqrt(MaxCost));
+}
+
+void FMeshSimplifier::BuildLODs(FStaticMesh& InOutStaticMesh)
+{
+	InOutStaticMesh.LODs.clear();
+	if (InOutStaticMesh.Vertices.empty() || InOutStaticMesh.Indices.size() / 3 < MinLODTriangles * 2)
+	{
+		return;
+	}
+
+	// 오차를 메시 크기(바운딩 박스 대각선) 대비 비율로 저장해야 화면 크기와 비교 가능
+	FVector Min(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (const FNormalVertex& Vertex : InOutStaticMesh.Vertices)
+	{
+		Min.X = std::min(Min.X, Vertex.Position.X); Max.X = std::max(Max.X, Vertex.Position.X);
+		Min.Y = std::min(Min.Y, Vertex.Position.Y); Max.Y = std::max(Max.Y, Vertex.Position.Y);
+		Min.Z = std::min(Min.Z, Vertex.Position.Z); Max.Z = std::max(Max.Z, Vertex.Position.Z);
+	}
+	const float Diameter = std::max((Max - Min).Length(), 1e-6f);
+
+	InOutStaticMesh.LODs.reserve(MaxLODCount - 1);
+	const TArray<uint32>* SourceIndices = &InOutStaticMesh.Indices;
+	const TArray<FMeshSection>* SourceSections = &InOutStaticMesh.Sections;
+	uint32 FirstIndex = static_cast<uint32>(InOutStaticMesh.Indices.size());
+	float PreviousError = 0.0f;
+	float PreviousScreenSize = FLT_MAX;
+
+	for (uint32 LODIndex = 1; LODIndex < MaxLODCount; ++LODIndex)
+	{
+		const size_t SourceTriangleCount = SourceIndices->size() / 3;
+		const size_t TargetTriangleCount = static_cast<size_t>(static_cast<float>(SourceTriangleCount) * LODReduction);
+		if (TargetTriangleCount < MinLODTriangles)
+		{
+			break;
+		}
+
+		FStaticMeshLOD LOD;
+		const float Error = Simplify(InOutStaticMesh.Vertices, *SourceIndices, *SourceSections, TargetTriangleCount,
+			LOD.Indices, LOD.Sections);
+
+		// 고정 정점 때문에 거의 줄지 않았으면 LOD로서 의미가 없음
+		if (LOD.Indices.size() / 3 > SourceTriangleCount * 4 / 5)
+		{
+			break;
+		}
+
+		// 이전 LOD에서 다시 단순화하므로 오차는 누적된 것으로 봄
+		LOD.Error = PreviousError + Error / Diameter;
+		LOD.ScreenSize = LOD.Error > 0.0f ? std::min(PreviousScreenSize, MaxScreenError / LOD.Error) : PreviousScreenSize;
+		LOD.FirstIndex = FirstIndex;
+		FirstIndex += static_cast<uint32>(LOD.Indices.size());
+
+		PreviousError = LOD.Error;
+		PreviousScreenSize = LOD.ScreenSize;
+		InOutStaticMesh.LODs.push_back(std::move(LOD));
+		SourceIndices = &InOutStaticMesh.LODs.back().Indices;
+		SourceSections = &InOutStaticMesh.LODs.back().Sections;
+	}
+}
@@ -0,0 +1,739 @@
+#include "pch.h"
+#include "Manager/Asset/Public/ObjFastParser.h"
+#include "Core/Public/MappedFile.h"
+#include "Core/Public/MemoryArchive.h"
+
+#include <cfloat>
+#include <charconv>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+	bool IsSpace(char InChar)
+	{
+		// istream >> 와 같은 공백 집합 ("C" 로케일 isspace)
+		return InChar == ' ' || InChar == '\t' || InChar == '\r' || InChar == '\n' || InChar == '\v' || InChar == '\f';
+	}
+
+	bool IsDigit(char InChar)
+	{
+		return InChar >= '0' && InChar <= '9';
+	}
+
+	/**
+	 * @brief [InBegin, InEnd)에서 float 하나를 읽고 읽은 끝 위치를 반환 (실패 시 nullptr)
+	 * 유효 숫자 19자리 이하, 10진 지수 +-22 이내면 double로 정확히 계산한 뒤 float로 변환
+	 * double 결과가 float 반올림 경계(중간값)에 걸리거나 범위를 벗어나면 std::from_chars로 다시 계산해
+	 * 항상 정확히 반올림된 float를 돌려줌
+	 */
+	const char* ScanFloat(const char* InBegin, const char* InEnd, float& OutValue)
+	{
+		static constexpr double Pow10[] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		// std::from_chars는 '+' 부호를 받지 않으므로 건너뜀 ('-'는 그대로 넘김)
+		const char* NumberBegin = InBegin;
+		if (NumberBegin < InEnd && *NumberBegin == '+')
+		{
+			++NumberBegin;
+		}
+
+		const char* Cursor = NumberBegin;
+		bool bNegative = false;
+		if (Cursor < InEnd && *Cursor == '-')
+		{
+			bNegative = true;
+			++Cursor;
+		}
+
+		uint64 Mantissa = 0;
+		int32 SignificantDigits = 0;
+		int32 Exponent10 = 0;
+		bool bHasDigit = false;
+		bool bTruncated = false;
+
+		for (; Cursor < InEnd && IsDigit(*Cursor); ++Cursor)
+		{
+			bHasDigit = true;
+			const uint32 Digit = static_cast<uint32>(*Cursor - '0');
+			if (Mantissa == 0 && Digit == 0)
+			{
+				continue;
+			}
+			if (SignificantDigits < 19)
+			{
+				Mantissa = Mantissa * 10 + Digit;
+				++SignificantDigits;
+			}
+			else
+			{
+				++Exponent10;
+				bTruncated = true;
+			}
+		}
+
+		if (Cursor < InEnd && *Cursor == '.')
+		{
+			++Cursor;
+			for (; Cursor < InEnd && IsDigit(*Cursor); ++Cursor)
+			{
+				bHasDigit = true;
+				const uint32 Digit = static_cast<uint32>(*Cursor - '0');
+				if (Mantissa == 0 && Digit == 0)
+				{
+					--Exponent10;
+				}
+				else if (SignificantDigits < 19)
+				{
+					Mantissa = Mantissa * 10 + Digit;
+					++SignificantDigits;
+					--Exponent10;
+				}
+				else
+				{
+					bTruncated = true;
+				}
+			}
+		}
+
+		if (!bHasDigit)
+		{
+			return nullptr;
+		}
+
+		// 지수부는 뒤에 숫자가 있을 때만 소비 (from_chars general 형식과 동일)
+		if (Cursor < InEnd && (*Cursor == 'e' || *Cursor == 'E'))
+		{
+			const char* ExponentCursor = Cursor + 1;
+			bool bNegativeExponent = false;
+			if (ExponentCursor < InEnd && (*ExponentCursor == '+' || *ExponentCursor == '-'))
+			{
+				bNegativeExponent = *ExponentCursor == '-';
+				++ExponentCursor;
+			}
+
+			if (ExponentCursor < InEnd && IsDigit(*ExponentCursor))
+			{
+				int32 ExplicitExponent = 0;
+				for (; ExponentCursor < InEnd && IsDigit(*ExponentCursor); ++ExponentCursor)
+				{
+					ExplicitExponent = std::min(ExplicitExponent * 10 + (*ExponentCursor - '0'), 100000);
+				}
+				Exponent10 += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+				Cursor = ExponentCursor;
+			}
+		}
+
+		if (Mantissa == 0 && !bTruncated)
+		{
+			OutValue = bNegative ? -0.0f : 0.0f;
+			return Cursor;
+		}
+
+		if (!bTruncated && Mantissa <= (1ull << 53) && Exponent10 >= -22 && Exponent10 <= 22)
+		{
+			// 두 피연산자가 모두 double로 정확하므로 곱/나눗셈 한 번의 결과는 정확히 반올림된 double
+			double Value = static_cast<double>(Mantissa);
+			Value = Exponent10 < 0 ? Value / Pow10[-Exponent10] : Value * Pow10[Exponent10];
+
+			if (Value >= static_cast<double>(FLT_MIN) && Value <= static_cast<double>(FLT_MAX))
+			{
+				// double에서 버려지는 하위 29비트가 정확히 중간값이면 이중 반올림 오차 가능 -> 느린 경로
+				uint64 Bits;
+				memcpy(&Bits, &Value, sizeof(Bits));
+				constexpr uint64 DroppedMask = (1ull << 29) - 1;
+				if ((Bits & DroppedMask) != (1ull << 28))
+				{
+					const float Result = static_cast<float>(Value);
+					OutValue = bNegative ? -Result : Result;
+					return Cursor;
+				}
+			}
+		}
+
+		float Value = 0.0f;
+		const std::from_chars_result Result = std::from_chars(NumberBegin, InEnd, Value);
+		if (Result.ec != std::errc())
+		{
+			return nullptr;
+		}
+		OutValue = Value;
+		return Result.ptr;
+	}
+
+	/**
+	 * @brief std::stoull과 같은 규칙으로 10진 정수를 읽음 (부호 허용, 숫자 뒤 나머지는 무시)
+	 */
+	bool ScanIndex(std::string_view InText, size_t& OutValue)
+	{
+		const char* Cursor = InText.data();
+		const char* End = Cursor + InText.size();
+
+		bool bNegative = false;
+		if (Cursor < End && (*Cursor == '+' || *Cursor == '-'))
+		{
+			bNegative = *Cursor == '-';
+			++Cursor;
+		}
+
+		if (Cursor >= End || !IsDigit(*Cursor))
+		{
+			return false;
+		}
+
+		uint64 Value = 0;
+		for (; Cursor < End && IsDigit(*Cursor); ++Cursor)
+		{
+			const uint64 Digit = static_cast<uint64>(*Cursor - '0');
+			if (Value > (UINT64_MAX - Digit) / 10)
+			{
+				return false;
+			}
+			Value = Value * 10 + Digit;
+		}
+
+		OutValue = static_cast<size_t>(bNegative ? 0 - Value : Value);
+		return true;
+	}
+
+	struct FLineCursor
+	{
+		const char* Current;
+		const char* End;
+
+		std::string_view ReadToken()
+		{
+			while (Current < End && IsSpace(*Current))
+			{
+				++Current;
+			}
+
+			const char* TokenBegin = Current;
+			while (Current < End && !IsSpace(*Current))
+			{
+				++Current;
+			}
+			return std::string_view(TokenBegin, static_cast<size_t>(Current - TokenBegin));
+		}
+
+		bool ReadFloat(float& OutValue)
+		{
+			while (Current < End && IsSpace(*Current))
+			{
+				++Current;
+			}
+			if (Current >= End)
+			{
+				return false;
+			}
+
+			const char* Next = ScanFloat(Current, End, OutValue);
+			if (!Next)
+			{
+				return false;
+			}
+			Current = Next;
+			return true;
+		}
+	};
+
+	/** @brief 면을 이루는 정점 하나 ("v", "v/vt", "v//vn", "v/vt/vn") */
+	struct FFaceVertex
+	{
+		size_t Vertex = 0;
+		size_t TexCoord = 0;
+		size_t Normal = 0;
+		bool bHasTexCoord = false;
+		bool bHasNormal = false;
+	};
+
+	/**
+	 * @brief FObjImporter::ParseFaceBuffer와 같은 규칙으로 면 토큰 하나를 해석
+	 * @return 실패 시 오류 메시지, 성공 시 nullptr
+	 */
+	const char* ParseFaceVertex(std::string_view InToken, FFaceVertex& OutFaceVertex)
+	{
+		// std::getline(Token, '/') 분할과 같은 규칙: 마지막 '/' 뒤의 빈 조각은 만들지 않음
+		std::string_view Parts[3];
+		size_t PartCount = 0;
+		size_t Start = 0;
+		while (Start < InToken.size())
+		{
+			const size_t Slash = InToken.find('/', Start);
+			const std::string_view Part = InToken.substr(Start, Slash == std::string_view::npos ? std::string_view::npos : Slash - Start);
+			if (PartCount < 3)
+			{
+				Parts[PartCount] = Part;
+			}
+			++PartCount;
+
+			if (Slash == std::string_view::npos)
+			{
+				break;
+			}
+			Start = Slash + 1;
+		}
+
+		if (PartCount == 0)
+		{
+			return "면 형식이 잘못되었습니다";
+		}
+		if (Parts[0].empty())
+		{
+			return "정점 위치 형식이 잘못되었습니다";
+		}
+		if (!ScanIndex(Parts[0], OutFaceVertex.Vertex))
+		{
+			return "정점 위치 인덱스 형식이 잘못되었습니다";
+		}
+		--OutFaceVertex.Vertex;
+
+		// 조각이 4개 이상이면 기존 파서와 같이 위치만 사용
+		if (PartCount == 2)
+		{
+			if (Parts[1].empty() || !ScanIndex(Parts[1], OutFaceVertex.TexCoord))
+			{
+				return "정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다";
+			}
+			--OutFaceVertex.TexCoord;
+			OutFaceVertex.bHasTexCoord = true;
+		}
+		else if (PartCount == 3)
+		{
+			if (Parts[1].empty())
+			{
+				if (Parts[2].empty() || !ScanIndex(Parts[2], OutFaceVertex.Normal))
+				{
+					return "정점 법선 인덱스 형식이 잘못되었습니다";
+				}
+				--OutFaceVertex.Normal;
+				OutFaceVertex.bHasNormal = true;
+			}
+			else
+			{
+				if (Parts[2].empty() || !ScanIndex(Parts[1], OutFaceVertex.TexCoord) || !ScanIndex(Parts[2], OutFaceVertex.Normal))
+				{
+					return "정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다";
+				}
+				--OutFaceVertex.TexCoord;
+				--OutFaceVertex.Normal;
+				OutFaceVertex.bHasTexCoord = true;
+				OutFaceVertex.bHasNormal = true;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void AppendFaceVertex(const FFaceVertex& InFaceVertex, FObjectInfo& OutObjectInfo)
+	{
+		OutObjectInfo.VertexIndexList.push_back(InFaceVertex.Vertex);
+		if (InFaceVertex.bHasTexCoord)
+		{
+			OutObjectInfo.TexCoordIndexList.push_back(InFaceVertex.TexCoord);
+		}
+		if (InFaceVertex.bHasNormal)
+		{
+			OutObjectInfo.NormalIndexList.push_back(InFaceVertex.Normal);
+		}
+	}
+
+	/**
+	 * @brief 청크 안에서 'o' 줄로 나뉘는 구간
+	 * 첫 구간은 이전 청크의 마지막 오브젝트를 이어받으므로 이름이 없고, 병합할 때 이어 붙임
+	 * 그룹 / 머티리얼 시작 면 번호는 구간 기준이며 병합할 때 오브젝트 기준으로 보정
+	 */
+	struct FObjChunkSegment
+	{
+		bool bStartsObject = false;	// 'o' 줄로 시작한 구간
+		bool bTouched = false;		// g / f / usemtl이 있어 현재 오브젝트가 필요 (없으면 기본 오브젝트 생성)
+		FObjectInfo ObjectInfo;
+		size_t FaceCount = 0;
+	};
+
+	struct FObjChunkResult
+	{
+		TArray<FVector> VertexList;
+		TArray<FVector> NormalList;
+		TArray<FVector2> TexCoordList;
+		TArray<FObjChunkSegment> Segments;
+		TArray<FString> MaterialLibraries;
+		const char* Error = nullptr;
+	};
+
+	void ParseChunk(const char* InBegin, const char* InEnd, const FObjImporter::Configuration& InConfig, FObjChunkResult& OutResult)
+	{
+		TIME_PROFILE(ObjParseChunk);
+		OutResult.Segments.emplace_back();
+
+		TArray<std::string_view> FaceTokens;
+		TArray<FFaceVertex> FaceVertices;
+
+		const char* LineBegin = InBegin;
+		while (LineBegin < InEnd)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', static_cast<size_t>(InEnd - LineBegin)));
+			if (!LineEnd)
+			{
+				LineEnd = InEnd;
+			}
+
+			FLineCursor Line{ LineBegin, LineEnd };
+			LineBegin = LineEnd < InEnd ? LineEnd + 1 : InEnd;
+
+			const std::string_view Prefix = Line.ReadToken();
+			if (Prefix.empty())
+			{
+				continue;
+			}
+
+			FObjChunkSegment& Segment = OutResult.Segments.back();
+
+			if (Prefix == "v")
+			{
+				FVector Position;
+				if (!Line.ReadFloat(Position.X) || !Line.ReadFloat(Position.Y) || !Line.ReadFloat(Position.Z))
+				{
+					OutResult.Error = "정점 위치 형식이 잘못되었습니다";
+					return;
+				}
+				OutResult.VertexList.emplace_back(InConfig.bPositionToUEBasis ? FVector(Position.X, -Position.Y, Position.Z) : Position);
+			}
+			else if (Prefix == "vn")
+			{
+				FVector Normal;
+				if (!Line.ReadFloat(Normal.X) || !Line.ReadFloat(Normal.Y) || !Line.ReadFloat(Normal.Z))
+				{
+					OutResult.Error = "정점 법선 형식이 잘못되었습니다";
+					return;
+				}
+				OutResult.NormalList.emplace_back(Normal);
+			}
+			else if (Prefix == "vt")
+			{
+				/** @note: Ignore 3D Texture */
+				FVector2 TexCoord;
+				if (!Line.ReadFloat(TexCoord.X) || !Line.ReadFloat(TexCoord.Y))
+				{
+					OutResult.Error = "정점 텍스쳐 좌표 형식이 잘못되었습니다";
+					return;
+				}
+				OutResult.TexCoordList.emplace_back(InConfig.bUVToUEBasis ? FVector2(TexCoord.X, 1.0f - TexCoord.Y) : TexCoord);
+			}
+			else if (Prefix == "f")
+			{
+				Segment.bTouched = true;
+
+				FaceTokens.clear();
+				for (std::string_view Token = Line.ReadToken(); !Token.empty(); Token = Line.ReadToken())
+				{
+					FaceTokens.push_back(Token);
+				}
+
+				if (FaceTokens.size() < 2)
+				{
+					OutResult.Error = "면 형식이 잘못되었습니다";
+					return;
+				}
+
+				// 토큰이 2개면 삼각형이 없으므로 기존 파서처럼 해석하지 않음
+				if (FaceTokens.size() < 3)
+				{
+					continue;
+				}
+
+				FaceVertices.resize(FaceTokens.size());
+				for (size_t i = 0; i < FaceTokens.size(); ++i)
+				{
+					FaceVertices[i] = FFaceVertex();
+					if (const char* Error = ParseFaceVertex(FaceTokens[i], FaceVertices[i]))
+					{
+						OutResult.Error = Error;
+						return;
+					}
+				}
+
+				/** @todo: 오목 다각형에 대한 지원 필요, 현재는 볼록 다각형만 지원 */
+				for (size_t i = 1; i + 1 < FaceVertices.size(); ++i)
+				{
+					AppendFaceVertex(FaceVertices[0], Segment.ObjectInfo);
+					AppendFaceVertex(FaceVertices[InConfig.bFlipWindingOrder ? i + 1 : i], Segment.ObjectInfo);
+					AppendFaceVertex(FaceVertices[InConfig.bFlipWindingOrder ? i : i + 1], Segment.ObjectInfo);
+					++Segment.FaceCount;
+				}
+			}
+			else if (Prefix == "o")
+			{
+				if (!InConfig.bIsObjectEnabled)
+				{
+					continue; // Ignore 'o' prefix
+				}
+
+				const std::string_view ObjectName = Line.ReadToken();
+				if (ObjectName.empty())
+				{
+					OutResult.Error = "오브젝트 이름 형식이 잘못되었습니다";
+					return;
+				}
+
+				FObjChunkSegment& NewSegment = OutResult.Segments.emplace_back();
+				NewSegment.bStartsObject = true;
+				NewSegment.ObjectInfo.Name = FString(ObjectName);
+			}
+			else if (Prefix == "g")
+			{
+				Segment.bTouched = true;
+
+				const std::string_view GroupName = Line.ReadToken();
+				if (GroupName.empty())
+				{
+					OutResult.Error = "잘못된 그룹 이름 형식입니다";
+					return;
+				}
+
+				Segment.ObjectInfo.GroupNameList.emplace_back(GroupName);
+				Segment.ObjectInfo.GroupIndexList.emplace_back(Segment.FaceCount);
+			}
+			else if (Prefix == "mtllib")
+			{
+				OutResult.MaterialLibraries.emplace_back(Line.ReadToken());
+			}
+			else if (Prefix == "usemtl")
+			{
+				Segment.bTouched = true;
+
+				Segment.ObjectInfo.MaterialNameList.emplace_back(Line.ReadToken());
+				Segment.ObjectInfo.MaterialIndexList.emplace_back(Segment.FaceCount);
+			}
+		}
+	}
+
+	template <typename T>
+	void AppendMoved(TArray<T>& OutTarget, TArray<T>& InSource)
+	{
+		if (OutTarget.empty())
+		{
+			OutTarget = std::move(InSource);
+			return;
+		}
+		OutTarget.insert(OutTarget.end(), std::make_move_iterator(InSource.begin()), std::make_move_iterator(InSource.end()));
+		InSource.clear();
+	}
+
+	void AppendWithOffset(TArray<size_t>& OutTarget, const TArray<size_t>& InSource, size_t InOffset)
+	{
+		OutTarget.reserve(OutTarget.size() + InSource.size());
+		for (size_t Value : InSource)
+		{
+			OutTarget.push_back(Value + InOffset);
+		}
+	}
+}
+
+bool FObjFastParser::Parse(const std::filesystem::path& InFilePath, FObjInfo* OutObjInfo, const FObjImporter::Configuration& InConfig)
+{
+	if (!OutObjInfo)
+	{
+		return false;
+	}
+	TIME_PROFILE(ObjParse);
+
+	FMappedFile File;
+	if (!File.Open(InFilePath))
+	{
+		UE_LOG_ERROR("파일을 열지 못했습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	const char* Data = File.GetData();
+	const size_t Size = File.GetSize();
+	if (Size == 0)
+	{
+		return true;
+	}
+
+	/** #1. 줄 경계에서 청크 분할 */
+	const size_t HardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+	const size_t ChunkCount = std::clamp<size_t>(Size / MinChunkBytes, 1, HardwareThreadCount);
+
+	TArray<const char*> ChunkBounds;
+	ChunkBounds.reserve(ChunkCount + 1);
+	ChunkBounds.push_back(Data);
+	for (size_t i = 1; i < ChunkCount; ++i)
+	{
+		const char* Target = std::max(Data + Size * i / ChunkCount, ChunkBounds.back());
+		const char* LineEnd = static_cast<const char*>(memchr(Target, '\n', static_cast<size_t>(Data + Size - Target)));
+		ChunkBounds.push_back(LineEnd ? LineEnd + 1 : Data + Size);
+	}
+	ChunkBounds.push_back(Data + Size);
+
+	/** #2. 청크별 병렬 파싱 (첫 청크는 호출한 스레드에서) */
+	TArray<FObjChunkResult> Chunks(ChunkCount);
+	TArray<std::thread> Workers;
+	Workers.reserve(ChunkCount - 1);
+	for (size_t i = 1; i < ChunkCount; ++i)
+	{
+		Workers.emplace_back([&, i]()
+		{
+			FProfiler::SetThreadName("ObjParser");
+			ParseChunk(ChunkBounds[i], ChunkBounds[i + 1], InConfig, Chunks[i]);
+		});
+	}
+	ParseChunk(ChunkBounds[0], ChunkBounds[1], InConfig, Chunks[0]);
+	for (std::thread& Worker : Workers)
+	{
+		Worker.join();
+	}
+
+	for (const FObjChunkResult& Chunk : Chunks)
+	{
+		if (Chunk.Error)
+		{
+			UE_LOG_ERROR("%s", Chunk.Error);
+			return false;
+		}
+	}
+
+	/** #3. 청크 순서대로 병합 (면 인덱스는 파일 전체 기준이라 그대로, 그룹 / 머티리얼 시작 면 번호만 보정) */
+	size_t VertexCount = OutObjInfo->VertexList.size();
+	size_t NormalCount = OutObjInfo->NormalList.size();
+	size_t TexCoordCount = OutObjInfo->TexCoordList.size();
+	for (const FObjChunkResult& Chunk : Chunks)
+	{
+		VertexCount += Chunk.VertexList.size();
+		NormalCount += Chunk.NormalList.size();
+		TexCoordCount += Chunk.TexCoordList.size();
+	}
+	OutObjInfo->VertexList.reserve(VertexCount);
+	OutObjInfo->NormalList.reserve(NormalCount);
+	OutObjInfo->TexCoordList.reserve(TexCoordCount);
+
+	TOptional<FObjectInfo> OptObjectInfo;
+	size_t FaceCount = 0;
+
+	for (FObjChunkResult& Chunk : Chunks)
+	{
+		AppendMoved(OutObjInfo->VertexList, Chunk.VertexList);
+		AppendMoved(OutObjInfo->NormalList, Chunk.NormalList);
+		AppendMoved(OutObjInfo->TexCoordList, Chunk.TexCoordList);
+
+		for (const FString& MaterialFileName : Chunk.MaterialLibraries)
+		{
+			std::filesystem::path MaterialFilePath = InFilePath.parent_path() / MaterialFileName;
+			MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
+
+			if (!FObjImporter::LoadMaterial(MaterialFilePath, OutObjInfo))
+			{
+				UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %s", MaterialFilePath.string().c_str());
+				return false;
+			}
+		}
+
+		for (FObjChunkSegment& Segment : Chunk.Segments)
+		{
+			if (Segment.bStartsObject)
+			{
+				if (OptObjectInfo)
+				{
+					OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+				}
+				OptObjectInfo.emplace();
+				OptObjectInfo->Name = std::move(Segment.ObjectInfo.Name);
+				FaceCount = 0;
+			}
+			else if (!Segment.bTouched)
+			{
+				continue;
+			}
+			else if (!OptObjectInfo)
+			{
+				OptObjectInfo.emplace();
+				OptObjectInfo->Name = InConfig.DefaultName;
+			}
+
+			FObjectInfo& Target = *OptObjectInfo;
+			FObjectInfo& Source = Segment.ObjectInfo;
+			AppendMoved(Target.VertexIndexList, Source.VertexIndexList);
+			AppendMoved(Target.NormalIndexList, Source.NormalIndexList);
+			AppendMoved(Target.TexCoordIndexList, Source.TexCoordIndexList);
+			AppendMoved(Target.GroupNameList, Source.GroupNameList);
+			AppendWithOffset(Target.GroupIndexList, Source.GroupIndexList, FaceCount);
+			AppendMoved(Target.MaterialNameList, Source.MaterialNameList);
+			AppendWithOffset(Target.MaterialIndexList, Source.MaterialIndexList, FaceCount);
+			FaceCount += Segment.FaceCount;
+		}
+	}
+
+	if (OptObjectInfo)
+	{
+		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+	}
+
+	return true;
+}
+
+FObjParseBenchmarkResult RunObjParseBenchmark(const TArray<std::filesystem::path>& InFilePaths)
+{
+	using Clock = std::chrono::high_resolution_clock;
+
+	FObjParseBenchmarkResult Result;
+	const FObjImporter::Configuration Config;
+
+	for (const std::filesystem::path& FilePath : InFilePaths)
+	{
+		std::error_code ErrorCode;
+		const uintmax_t FileSize = std::filesystem::file_size(FilePath, ErrorCode);
+		if (ErrorCode)
+		{
+			++Result.FailedCount;
+			continue;
+		}
+
+		FObjInfo StreamInfo;
+		FObjInfo FastInfo;
+
+		auto T0 = Clock::now();
+		const bool bStreamSucceeded = FObjImporter::ParseObjStream(FilePath, &StreamInfo, Config);
+		auto T1 = Clock::now();
+		const bool bFastSucceeded = FObjFastParser::Parse(FilePath, &FastInfo, Config);
+		auto T2 = Clock::now();
+
+		++Result.FileCount;
+		Result.TotalBytes += FileSize;
+		Result.StreamMilliseconds += std::chrono::duration<double, std::milli>(T1 - T0).count();
+		Result.FastMilliseconds += std::chrono::duration<double, std::milli>(T2 - T1).count();
+
+		if (!bStreamSucceeded || !bFastSucceeded)
+		{
+			++Result.FailedCount;
+			if (bStreamSucceeded != bFastSucceeded)
+			{
+				++Result.MismatchCount;
+				UE_LOG_ERROR("ObjParseBench: %s: Stream %s, Fast %s", FilePath.string().c_str(),
+					bStreamSucceeded ? "succeeded" : "failed", bFastSucceeded ? "succeeded" : "failed");
+			}
+			continue;
+		}
+
+		// .objbin과 같은 직렬화로 비교해서 바이트 단위 동일성 확인
+		TArray<uint8> StreamBytes;
+		TArray<uint8> FastBytes;
+		FMemoryWriter StreamWriter(StreamBytes);
+		FMemoryWriter FastWriter(FastBytes);
+		StreamWriter << StreamInfo;
+		FastWriter << FastInfo;
+
+		if (StreamBytes != FastBytes)
+		{
+			++Result.MismatchCount;
+			UE_LOG_ERROR("ObjParseBench: %s: 결과가 다릅니다 (Stream %zu bytes, Fast %zu bytes)", FilePath.string().c_str(),
+				StreamBytes.size(), FastBytes.size());
+		}
+	}
+
+	return Result;
+}
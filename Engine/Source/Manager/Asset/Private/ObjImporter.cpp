@@ -3,6 +3,7 @@
 #include "Core/Public/WindowsBinReader.h"
 #include "Core/Public/WindowsBinWriter.h"
 #include "Manager/Asset/Public/ObjImporter.h"
+#include "Manager/Asset/Public/ObjFastParser.h"
 
 bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
 {
@@ -45,6 +46,27 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		return false;
 	}
 
+	if (!FObjFastParser::Parse(FilePath, OutObjInfo, Config))
+	{
+		return false;
+	}
+
+	if (Config.bIsBinaryEnabled)
+	{
+		FWindowsBinWriter WindowsBinWriter(BinFilePath);
+		WindowsBinWriter << *OutObjInfo;
+	}
+
+	return true;
+}
+
+bool FObjImporter::ParseObjStream(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config)
+{
+	if (!OutObjInfo)
+	{
+		return false;
+	}
+
 	std::ifstream File(FilePath);
 	if (!File)
 	{
@@ -278,12 +300,6 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
 	}
 
-	if (Config.bIsBinaryEnabled)
-	{
-		FWindowsBinWriter WindowsBinWriter(BinFilePath);
-		WindowsBinWriter << *OutObjInfo;
-	}
-
 	return true;
 }
 
@@ -4,6 +4,8 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/MeshCooker.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
 #include <filesystem>
@@ -11,24 +13,86 @@
 // static 멤버 변수의 실체를 정의(메모리 할당)합니다.
 TMap<FName, std::unique_ptr<FStaticMesh>> FObjManager::ObjFStaticMeshMap;
 
-/** @brief: Vertex Key for creating index buffer */
-using VertexKey = std::tuple<size_t, size_t, size_t>;
-
-struct VertexKeyHash
+namespace
 {
-	std::size_t operator() (VertexKey Key) const
+	/**
+	 * @brief (위치, 노멀, UV) 인덱스 조합 -> 정점 번호를 저장하는 open addressing 해시 테이블
+	 * 키 개수의 상한(면 정점 수)을 미리 알기 때문에 처음부터 2배 이상 크기로 잡고 rehash 없이 선형 탐사
+	 * 노드 기반 TMap과 달리 항목마다 할당이 없고 슬롯이 연속 메모리에 있음
+	 */
+	class FVertexKeyTable
 	{
-		auto Hash1 = std::hash<size_t>{}(std::get<0>(Key));
-		auto Hash2 = std::hash<size_t>{}(std::get<1>(Key));
-		auto Hash3 = std::hash<size_t>{}(std::get<2>(Key));
+	public:
+		explicit FVertexKeyTable(size_t InMaxKeyCount)
+		{
+			size_t Capacity = 16;
+			while (Capacity < InMaxKeyCount * 2)
+			{
+				Capacity <<= 1;
+			}
+			Slots.resize(Capacity);
+			Mask = Capacity - 1;
+		}
 
-		std::size_t Seed = Hash1;
-		Seed ^= Hash2 + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
-		Seed ^= Hash3 + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
+		/**
+		 * @brief 키가 있으면 저장된 정점 번호를, 없으면 InNewValue를 저장하고 반환
+		 */
+		uint32 FindOrAdd(size_t InPosition, size_t InNormal, size_t InTexCoord, uint32 InNewValue, bool& bOutAdded)
+		{
+			size_t Slot = Hash(InPosition, InNormal, InTexCoord) & Mask;
+			while (true)
+			{
+				FSlot& Entry = Slots[Slot];
+				if (Entry.Value == EmptyValue)
+				{
+					Entry = { InPosition, InNormal, InTexCoord, InNewValue };
+					bOutAdded = true;
+					return InNewValue;
+				}
+				if (Entry.Position == InPosition && Entry.Normal == InNormal && Entry.TexCoord == InTexCoord)
+				{
+					bOutAdded = false;
+					return Entry.Value;
+				}
+				Slot = (Slot + 1) & Mask;
+			}
+		}
 
-		return Seed;
-	}
-};
+	private:
+		static constexpr uint32 EmptyValue = UINT32_MAX;
+
+		struct FSlot
+		{
+			size_t Position = 0;
+			size_t Normal = 0;
+			size_t TexCoord = 0;
+			uint32 Value = EmptyValue;
+		};
+
+		// 인접한 인덱스끼리 같은 슬롯 근처에 몰리지 않도록 곱셈 후 상위 비트를 섞음
+		static size_t Hash(size_t InPosition, size_t InNormal, size_t InTexCoord)
+		{
+			uint64 Mixed = static_cast<uint64>(InPosition) * 0x9E3779B97F4A7C15ULL;
+			Mixed ^= static_cast<uint64>(InNormal) * 0xC2B2AE3D27D4EB4FULL;
+			Mixed ^= static_cast<uint64>(InTexCoord) * 0x165667B19E3779F9ULL;
+			Mixed ^= Mixed >> 29;
+			return static_cast<size_t>(Mixed);
+		}
+
+		TArray<FSlot> Slots;
+		size_t Mask = 0;
+	};
+}
+
+FObjImporter::Configuration FObjManager::GetDefaultConfiguration()
+{
+	FObjImporter::Configuration Config;
+	Config.bFlipWindingOrder = false;
+	Config.bIsBinaryEnabled = true;
+	Config.bUVToUEBasis = true;
+	Config.bPositionToUEBasis = true;
+	return Config;
+}
 
 /** @todo: std::filesystem으로 변경 */
 FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
@@ -39,16 +103,42 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return Iter->second.get();
 	}
 
+	return RegisterStaticMeshAsset(PathFileName, BuildStaticMeshAsset(PathFileName.ToString(), Config));
+}
+
+FStaticMesh* FObjManager::RegisterStaticMeshAsset(const FName& PathFileName, std::unique_ptr<FStaticMesh> InStaticMesh)
+{
+	if (!InStaticMesh)
+	{
+		return nullptr;
+	}
+
+	auto Iter = ObjFStaticMeshMap.find(PathFileName);
+	if (Iter != ObjFStaticMeshMap.end())
+	{
+		return Iter->second.get();
+	}
+
+	InStaticMesh->PathFileName = PathFileName;
+
+	// BVH는 FStaticMesh 주소를 들고 있으므로 unique_ptr 이동 후에도 같은 객체를 가리킴
+	FStaticMesh* Registered = InStaticMesh.get();
+	ObjFStaticMeshMap.emplace(PathFileName, std::move(InStaticMesh));
+	return Registered;
+}
+
+std::unique_ptr<FStaticMesh> FObjManager::BuildStaticMeshAsset(const FString& PathString, const FObjImporter::Configuration& Config,
+	FMeshCookStats* OutCookStats)
+{
 	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
 	FObjInfo ObjInfo;
-	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
+	if (!FObjImporter::LoadObj(PathString, &ObjInfo, Config))
 	{
-		UE_LOG_ERROR("파일 정보를 읽어오는데 실패했습니다: %s", PathFileName.ToString().c_str());
+		UE_LOG_ERROR("파일 정보를 읽어오는데 실패했습니다: %s", PathString.c_str());
 		return nullptr;
 	}
 
 	auto StaticMesh = std::make_unique<FStaticMesh>();
-	StaticMesh->PathFileName = PathFileName;
 
 	if (ObjInfo.ObjectInfoList.size() == 0)
 	{
@@ -60,7 +150,8 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 	/** @note: Use only first object in '.obj' file to create FStaticMesh. */
 	FObjectInfo& ObjectInfo = ObjInfo.ObjectInfoList[0];
 
-	TMap<VertexKey, size_t, VertexKeyHash> VertexMap;
+	FVertexKeyTable VertexTable(ObjectInfo.VertexIndexList.size());
+	StaticMesh->Indices.reserve(ObjectInfo.VertexIndexList.size());
 	for (size_t i = 0; i < ObjectInfo.VertexIndexList.size(); ++i)
 	{
 		size_t VertexIndex = ObjectInfo.VertexIndexList[i];
@@ -77,9 +168,12 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 			TexCoordIndex = ObjectInfo.TexCoordIndexList[i];
 		}
 
-		VertexKey Key{ VertexIndex, NormalIndex, TexCoordIndex };
-		auto It = VertexMap.find(Key);
-		if (It == VertexMap.end())
+		bool bAdded = false;
+		const uint32 Index = VertexTable.FindOrAdd(VertexIndex, NormalIndex, TexCoordIndex,
+			static_cast<uint32>(StaticMesh->Vertices.size()), bAdded);
+		StaticMesh->Indices.push_back(Index);
+
+		if (bAdded)
 		{
 			FNormalVertex Vertex = {};
 			Vertex.Position = ObjInfo.VertexList[VertexIndex];
@@ -96,26 +190,20 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 				Vertex.TexCoord = ObjInfo.TexCoordList[TexCoordIndex];
 			}
 
-			size_t Index = StaticMesh->Vertices.size();
 			StaticMesh->Vertices.push_back(Vertex);
-			StaticMesh->Indices.push_back(static_cast<uint32>(Index));
-			VertexMap[Key] = Index;
-		}
-		else
-		{
-			StaticMesh->Indices.push_back(static_cast<uint32>(It->second));
 		}
 	}
 
 	/** #3. 오브젝트가 사용하는 머티리얼의 목록을 저장 */
-	TSet<FName> UniqueMaterialNames;
+	// 로더 스레드에서도 호출되므로 FName(전역 이름 테이블) 대신 FString으로 비교
+	TSet<FString> UniqueMaterialNames;
 	for (const auto& MaterialName : ObjectInfo.MaterialNameList)
 	{
 		UniqueMaterialNames.insert(MaterialName);
 	}
 
 	StaticMesh->MaterialInfo.resize(UniqueMaterialNames.size());
-	TMap<FName, int32> MaterialNameToSlot;
+	TMap<FString, int32> MaterialNameToSlot;
 	int32 CurrentMaterialSlot = 0;
 
 	for (const auto& MaterialName : UniqueMaterialNames)
@@ -160,7 +248,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 			StaticMesh->Sections[i].IndexCount = static_cast<uint32>((StaticMesh->Indices.size() / 3 - ObjectInfo.MaterialIndexList[i]) * 3);
 		}
 
-		const FName& MaterialName = ObjectInfo.MaterialNameList[i];
+		const FString& MaterialName = ObjectInfo.MaterialNameList[i];
 		auto It = MaterialNameToSlot.find(MaterialName);
 		if (It != MaterialNameToSlot.end())
 		{
@@ -172,10 +260,15 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
+	/** #5. 정점 캐시 / fetch 순서로 재배치 (섹션 범위는 유지, BVH는 재배치된 인덱스로 구축) */
+	FMeshCooker::Cook(*StaticMesh, OutCookStats);
+
+	/** #6. 쿡된 LOD0에서 LOD 체인 생성 (같은 정점 버퍼 공유) */
+	FMeshSimplifier::BuildLODs(*StaticMesh);
+
 	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
-	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
 
-	return ObjFStaticMeshMap[PathFileName].get();
+	return StaticMesh;
 }
 
 /**
@@ -297,22 +390,41 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FName& PathFileName, const FOb
 		return Cached;
 	}
 
-	// 2) Load asset-level data (FStaticMesh) if not cached
-	FStaticMesh* StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(PathFileName, Config);
-	if (StaticMeshAsset)
+	// 2) Wait for an in-flight background load instead of parsing the same file twice
+	if (AssetManager.WaitForAsyncStaticMesh(PathFileName))
 	{
-		// Create runtime UStaticMesh and register to AssetManager cache (ownership there)
-		UStaticMesh* StaticMesh = new UStaticMesh();
-		StaticMesh->SetStaticMeshAsset(StaticMeshAsset);
+		if (UStaticMesh* Loaded = AssetManager.GetStaticMeshFromCache(PathFileName))
+		{
+			return Loaded;
+		}
+	}
 
-		// Create materials based on MTL information
-		CreateMaterialsFromMTL(StaticMesh, StaticMeshAsset, PathFileName);
+	// 3) Load asset-level data (FStaticMesh) synchronously
+	return CreateStaticMesh(PathFileName, FObjManager::LoadObjStaticMeshAsset(PathFileName, Config));
+}
 
-		// Register into AssetManager's cache (takes ownership)
-		AssetManager.AddStaticMeshToCache(PathFileName, StaticMesh);
+UStaticMesh* FObjManager::CreateStaticMesh(const FName& PathFileName, FStaticMesh* StaticMeshAsset)
+{
+	if (!StaticMeshAsset)
+	{
+		return nullptr;
+	}
 
-		return StaticMesh;
+	UAssetManager& AssetManager = UAssetManager::GetInstance();
+	if (UStaticMesh* Cached = AssetManager.GetStaticMeshFromCache(PathFileName))
+	{
+		return Cached;
 	}
 
-	return nullptr;
+	// Create runtime UStaticMesh and register to AssetManager cache (ownership there)
+	UStaticMesh* StaticMesh = new UStaticMesh();
+	StaticMesh->SetStaticMeshAsset(StaticMeshAsset);
+
+	// Create materials based on MTL information
+	CreateMaterialsFromMTL(StaticMesh, StaticMeshAsset, PathFileName);
+
+	// Register into AssetManager's cache (takes ownership, creates GPU buffers)
+	AssetManager.AddStaticMeshToCache(PathFileName, StaticMesh);
+
+	return StaticMesh;
 }
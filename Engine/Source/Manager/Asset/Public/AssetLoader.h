@@ -0,0 +1,76 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Component/Mesh/Public/StaticMesh.h"
+
+/**
+ * @brief 로더 스레드가 메인 스레드로 넘기는 StaticMesh 하나 분량의 결과
+ * GPU 리소스와 UObject는 만들지 않은 상태 (업로드는 UAssetManager::FlushAsyncLoads)
+ */
+struct FStaticMeshLoadResult
+{
+	FString PathString;
+	std::unique_ptr<FStaticMesh> StaticMesh;
+
+	// MTL이 참조하는 텍스처 파일 경로 -> 파일 내용 (디코딩은 메인 스레드에서)
+	TArray<TPair<FString, TArray<uint8>>> TextureFiles;
+};
+
+/**
+ * @brief StaticMesh 애셋을 백그라운드에서 읽어오는 로더 스레드 풀
+ * 워커는 파일 IO, OBJ 파싱, BVH 구축, 텍스처 파일 읽기까지만 수행하고
+ * FName / UObject / D3D 리소스는 건드리지 않음 (모두 메인 스레드 전용)
+ * 같은 경로는 결과가 회수되기 전까지 한 번만 요청됨
+ */
+class FAssetLoader
+{
+public:
+	FAssetLoader() = default;
+	~FAssetLoader();
+
+	FAssetLoader(const FAssetLoader&) = delete;
+	FAssetLoader& operator=(const FAssetLoader&) = delete;
+
+	void Start(uint32 InThreadCount);
+	void Shutdown();
+
+	/**
+	 * @brief 경로를 로드 큐에 추가
+	 * @return 새로 큐에 넣었으면 true, 이미 요청되어 있으면 false
+	 */
+	bool Request(const FString& InPathString);
+
+	/**
+	 * @brief 요청된 경로의 로드가 끝날 때까지 대기
+	 * 아직 큐에 남아 있으면 워커를 기다리지 않고 호출한 스레드에서 바로 로드
+	 * @return 요청된 적이 있는 경로면 true (결과는 DrainCompleted로 회수)
+	 */
+	bool Wait(const FString& InPathString);
+
+	/**
+	 * @brief 완료된 결과를 모두 꺼내옴 (메인 스레드)
+	 */
+	void DrainCompleted(TArray<FStaticMeshLoadResult>& OutResults);
+
+	/**
+	 * @brief 큐에 있거나 로드 중이거나 회수되지 않은 요청 수
+	 */
+	uint32 GetPendingCount() const;
+
+private:
+	void WorkerLoop();
+	static FStaticMeshLoadResult LoadStaticMesh(const FString& InPathString);
+
+	TArray<std::thread> Workers;
+
+	mutable std::mutex Mutex;
+	std::condition_variable QueueCondition;
+	std::condition_variable CompletedCondition;
+
+	TDeque<FString> Queue;
+	TSet<FString> Requested;	// 큐 + 로드 중 + 회수 대기
+	TSet<FString> Loading;		// 워커(또는 Wait 호출 스레드)가 로드 중인 경로
+	TArray<FStaticMeshLoadResult> Completed;
+	bool bStopping = false;
+};
@@ -2,6 +2,7 @@
 
 #include "ObjImporter.h"
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/AssetLoader.h"
 
 struct FAABB;
 
@@ -42,7 +43,33 @@ public:
 	bool HasTexture(const FName& InFilePath) const;
 
 	// StaticMesh 관련 함수
-	void LoadAllObjStaticMesh();
+	/**
+	 * @brief Data/ 폴더의 모든 .obj 경로 (로드 여부와 무관한 애셋 라이브러리)
+	 * StaticMesh는 이 경로로 참조하고, 처음 사용될 때 로드됨
+	 */
+	const TArray<FName>& GetStaticMeshPaths() const { return StaticMeshPaths; }
+
+	/**
+	 * @brief StaticMesh를 로더 스레드에서 미리 읽기 시작 (이미 로드됐거나 요청됐으면 무시)
+	 * 결과는 FlushAsyncLoads에서 캐시에 등록됨
+	 */
+	void PrefetchStaticMesh(const FName& InObjPath);
+
+	/**
+	 * @brief 로더 스레드가 끝낸 StaticMesh를 캐시에 등록하고 GPU 리소스를 생성 (메인 스레드, 매 프레임)
+	 * @return 이번에 등록한 StaticMesh 수
+	 */
+	uint32 FlushAsyncLoads();
+
+	/**
+	 * @brief 로더 스레드에 요청된 경로면 완료까지 기다린 뒤 FlushAsyncLoads
+	 * @return 요청된 적이 있는 경로였는지 여부
+	 */
+	bool WaitForAsyncStaticMesh(const FName& InObjPath);
+
+	uint32 GetPendingAsyncLoadCount() const { return AsyncLoader.GetPendingCount(); }
+	uint32 GetLoadedStaticMeshCount() const { return static_cast<uint32>(StaticMeshCache.size()); }
+
 	ID3D11Buffer* GetVertexBuffer(FName InObjPath);
 	ID3D11Buffer* GetIndexBuffer(FName InObjPath);
 
@@ -56,6 +83,18 @@ public:
 	 */
 	void LoadAllMaterials();
 
+	/**
+	 * @brief Material 라이브러리 전체(.mtl)를 한 번만 로드
+	 * 시작 시에는 로드하지 않고, 에디터에서 Material 목록이 필요할 때 호출
+	 */
+	void EnsureAllMaterialsLoaded();
+
+	/**
+	 * @brief Diffuse 텍스처 경로가 같은 Material 검색
+	 * 로드된 Material에 없으면 Material 라이브러리를 로드한 뒤 다시 검색
+	 */
+	class UMaterial* FindMaterialByDiffuseTexturePath(const FString& InTexturePath);
+
 	/**
 	 * @brief .mtl 파일을 독립적으로 로드 (obj 파일 없이)
 	 * @param InMtlPath .mtl 파일 경로
@@ -122,13 +161,20 @@ private:
 	// Material Resource
 	TMap<FName, class UMaterial*> MaterialCache;        // Material 이름 -> Material
 	TMap<FName, TArray<FName>> MTLFileMaterials;        // MTL 파일 경로 -> Material 이름 목록
+	bool bAllMaterialsLoaded = false;
+
+	// Async Load
+	TArray<FName> StaticMeshPaths;
+	FAssetLoader AsyncLoader;
+	TMap<FName, TArray<uint8>> PrefetchedTextureFiles;	// FlushAsyncLoads 중에만 유효 (LoadTexture가 파일 대신 사용)
 
 	// Release Functions
 	void ReleaseAllTextures();
 
 	// Helper Functions
+	void ScanStaticMeshLibrary();
 	ID3D11Buffer* CreateVertexBuffer(TArray<FNormalVertex> InVertices);
-	ID3D11Buffer* CreateIndexBuffer(TArray<uint32> InIndices);
+	ID3D11Buffer* CreateIndexBuffer(const TArray<uint32>& InIndices, uint32 InStride = sizeof(uint32));
 	FAABB CalculateAABB(const TArray<FNormalVertex>& Vertices);
 
 	// AABB Resource
@@ -0,0 +1,45 @@
+#pragma once
+#include "Component/Mesh/Public/StaticMesh.h"
+
+/**
+ * @brief 쿡 단계 전후 정점 캐시 효율
+ * ACMR(Average Cache Miss Ratio) = 정점 셰이더 호출 수 / 삼각형 수 (낮을수록 좋음, 이상적으로 0.5 근처)
+ */
+struct FMeshCookStats
+{
+	uint32 VertexCount = 0;
+	uint32 TriangleCount = 0;
+	float SourceACMR = 0.0f;
+	float CookedACMR = 0.0f;
+	bool b16BitIndices = false;
+};
+
+/**
+ * @brief 임포트된 FStaticMesh를 GPU 친화적인 순서로 재배치하는 쿡 단계
+ * 1) 섹션마다 삼각형 순서를 정점 캐시 지역성 기준으로 재정렬 (Tom Forsyth, Linear-Speed Vertex Cache Optimisation)
+ * 2) 정점을 인덱스 버퍼에서 처음 사용되는 순서로 재배치 (정점 fetch 지역성)
+ * 3) 정점 수가 16비트로 표현 가능하면 GPU 인덱스 버퍼를 16비트로 생성하도록 표시
+ * 섹션 범위는 유지되고, BVH는 쿡 이후의 인덱스로 만들어야 함
+ */
+class FMeshCooker
+{
+public:
+	// Forsyth 점수 계산에 쓰는 LRU 캐시 모델 크기
+	static constexpr uint32 VertexCacheSize = 32;
+	// ACMR 측정에 쓰는 FIFO 캐시 크기 (일반적인 하드웨어 post-transform 캐시 근사)
+	static constexpr uint32 ACMRCacheSize = 16;
+
+	static void Cook(FStaticMesh& InOutStaticMesh, FMeshCookStats* OutStats = nullptr);
+
+	/**
+	 * @brief [InIndices, InIndices + InIndexCount) 범위의 삼각형 순서를 재정렬 (범위 밖 인덱스는 건드리지 않음)
+	 */
+	static void OptimizeVertexCache(uint32* InOutIndices, size_t InIndexCount, size_t InVertexCount);
+
+	/**
+	 * @brief 정점을 처음 참조되는 순서로 재배치하고 인덱스를 갱신 (참조되지 않는 정점은 제거)
+	 */
+	static void OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices);
+
+	static float CalculateACMR(const TArray<uint32>& InIndices, size_t InVertexCount, uint32 InCacheSize = ACMRCacheSize);
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include "Component/Mesh/Public/StaticMesh.h"
+
+/**
+ * @brief Quadric Error Metric 기반 메시 단순화 (Garland & Heckbert, half-edge collapse)
+ * 정점을 새로 만들지 않고 기존 정점으로만 collapse 하므로 모든 LOD가 LOD0의 정점 버퍼를 공유
+ * 섹션(머티리얼) 경계, UV/노멀 seam, 열린 경계에 있는 정점은 고정해서 경계 모양과 텍스처 매핑을 유지
+ * D3D 리소스를 건드리지 않으므로 로더 스레드나 렌더러 없이 실행 가능
+ */
+class FMeshSimplifier
+{
+public:
+	// LOD0 포함 최대 LOD 개수
+	static constexpr uint32 MaxLODCount = 4;
+	// LOD마다 삼각형 수를 이 비율로 줄임
+	static constexpr float LODReduction = 0.5f;
+	// 이보다 작은 LOD는 만들지 않음
+	static constexpr uint32 MinLODTriangles = 128;
+	// LOD 오차가 화면 높이의 이 비율을 넘지 않는 크기부터 해당 LOD를 사용
+	static constexpr float MaxScreenError = 0.002f;
+
+	/**
+	 * @brief 삼각형 수가 InTargetTriangleCount 이하가 될 때까지 오차가 작은 edge부터 collapse
+	 * @param OutSections InSections와 같은 순서/슬롯, StartIndex와 IndexCount만 OutIndices 기준으로 갱신
+	 * @return collapse 중 가장 큰 오차 (월드 단위 거리)
+	 */
+	static float Simplify(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+		const TArray<FMeshSection>& InSections, size_t InTargetTriangleCount,
+		TArray<uint32>& OutIndices, TArray<FMeshSection>& OutSections);
+
+	/**
+	 * @brief 쿡된 LOD0에서 LOD1..N을 차례로 만들어 InOutStaticMesh.LODs에 저장
+	 * 더 줄일 수 없거나(고정 정점이 많음) MinLODTriangles에 도달하면 중단
+	 */
+	static void BuildLODs(FStaticMesh& InOutStaticMesh);
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Manager/Asset/Public/ObjImporter.h"
+
+/**
+ * @brief 메모리 매핑 기반 .obj 파서
+ * 파일을 줄 경계에서 청크로 나눠 워커 스레드에서 병렬로 파싱한 뒤 청크 순서대로 병합
+ * 줄마다 문자열 스트림을 만들지 않고, 숫자는 직접 스캔 (float는 정확히 반올림되는 경우만 빠른 경로)
+ * 결과 FObjInfo는 FObjImporter::ParseObjStream과 바이트 단위로 동일
+ */
+class FObjFastParser
+{
+public:
+	// 청크 하나의 최소 크기 (작은 파일은 호출한 스레드에서 한 번에 파싱)
+	static constexpr size_t MinChunkBytes = 4 * 1024 * 1024;
+
+	/**
+	 * @brief .obj 파일을 파싱해서 OutObjInfo에 채움 (mtllib도 FObjImporter::LoadMaterial로 로드)
+	 * @note .objbin 캐시는 읽거나 쓰지 않음
+	 */
+	static bool Parse(const std::filesystem::path& InFilePath, FObjInfo* OutObjInfo, const FObjImporter::Configuration& InConfig);
+};
+
+/**
+ * @brief 기존 파서 / 빠른 파서 비교 결과
+ */
+struct FObjParseBenchmarkResult
+{
+	uint32 FileCount = 0;
+	uint32 MismatchCount = 0;
+	uint32 FailedCount = 0;
+	uint64 TotalBytes = 0;
+	double StreamMilliseconds = 0.0;
+	double FastMilliseconds = 0.0;
+};
+
+/**
+ * @brief 파일마다 ParseObjStream과 FObjFastParser::Parse를 각각 실행해 시간을 재고,
+ * 두 결과를 직렬화한 바이트가 같은지 비교
+ */
+FObjParseBenchmarkResult RunObjParseBenchmark(const TArray<std::filesystem::path>& InFilePaths);
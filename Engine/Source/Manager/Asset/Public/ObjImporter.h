@@ -169,6 +169,14 @@ struct FObjImporter
 	 */
 	static bool LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config = {});
 
+	/**
+	 * @brief Parses a .obj file line by line with std::getline / std::istringstream.
+	 * LoadObj uses FObjFastParser instead; this is kept as the reference implementation
+	 * that the fast parser's output is compared against.
+	 * @note Does not read or write the .objbin cache.
+	 */
+	static bool ParseObjStream(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, const Configuration& Config);
+
 	/**
 	 * @brief Loads and parses a .mtl material library file.
 	 * @param FilePath The path to the .mtl file.
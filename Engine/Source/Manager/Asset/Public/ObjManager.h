@@ -5,11 +5,42 @@
 #include <Manager/Asset/Public/ObjImporter.h>
 #include <memory>
 
+struct FMeshCookStats;
+
 class FObjManager
 {
 public:
 	static FStaticMesh* LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+
+	/**
+	 * @brief '.obj' 파일에서 FStaticMesh(BVH 포함)를 만들기만 하고 캐시에는 등록하지 않음
+	 * FName / UObject를 건드리지 않으므로 로더 스레드에서 호출 가능 (PathFileName은 등록 시 설정)
+	 * @param OutCookStats 쿡 단계 전후 ACMR (필요할 때만)
+	 */
+	static std::unique_ptr<FStaticMesh> BuildStaticMeshAsset(const FString& PathString, const FObjImporter::Configuration& Config = {},
+		FMeshCookStats* OutCookStats = nullptr);
+
+	/**
+	 * @brief 만들어둔 FStaticMesh를 캐시에 등록 (메인 스레드)
+	 * @return 등록된 FStaticMesh, 이미 같은 경로가 있으면 기존 것을 반환하고 InStaticMesh는 버림
+	 */
+	static FStaticMesh* RegisterStaticMeshAsset(const FName& PathFileName, std::unique_ptr<FStaticMesh> InStaticMesh);
+
+	/**
+	 * @brief 엔진 기본 Import 설정 (winding 유지, .objbin 캐시 사용, UE 좌표계 변환)
+	 */
+	static FObjImporter::Configuration GetDefaultConfiguration();
+
+	/**
+	 * @brief 경로의 UStaticMesh를 반환 (없으면 로드)
+	 * 백그라운드 로더가 같은 경로를 읽는 중이면 그 결과를 기다려 사용
+	 */
 	static UStaticMesh* LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+
+	/**
+	 * @brief 등록된 FStaticMesh로 UStaticMesh와 머티리얼을 만들고 AssetManager 캐시에 추가 (메인 스레드)
+	 */
+	static UStaticMesh* CreateStaticMesh(const FName& PathFileName, FStaticMesh* StaticMeshAsset);
 	static void CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* StaticMeshAsset, const FName& ObjFilePath);
 
 	static constexpr size_t INVALID_INDEX = SIZE_MAX;
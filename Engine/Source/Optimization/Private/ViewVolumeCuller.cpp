@@ -18,28 +18,12 @@ namespace
 void ViewVolumeCuller::Cull(FOctree* StaticOctree, TArray<UPrimitiveComponent*>& DynamicPrimitives, const FViewProjConstants& ViewProjConstants)
 {
 	// 이전의 Cull했던 정보를 지운다.
+	++CullCount;
 	RenderableObjects.clear();
 	CurrentFrustum.Clear();
 
 	// 1. 절두체 'Key' 생성 
-	FMatrix VP = ViewProjConstants.View * ViewProjConstants.Projection;
-	CurrentFrustum.Planes[0] = VP[3] + VP[0]; // Left
-	CurrentFrustum.Planes[1] = VP[3] - VP[0]; // Right
-	CurrentFrustum.Planes[2] = VP[3] + VP[1]; // Bottom
-	CurrentFrustum.Planes[3] = VP[3] - VP[1]; // Top
-	CurrentFrustum.Planes[4] = VP[2]; // Near
-	CurrentFrustum.Planes[5] = VP[3] - VP[2]; // Far
-
-	for (int i = 0; i < 6; i++)
-	{
-		const float Length = sqrt((CurrentFrustum.Planes[i].X * CurrentFrustum.Planes[i].X) +
-								(CurrentFrustum.Planes[i].Y * CurrentFrustum.Planes[i].Y) +
-								(CurrentFrustum.Planes[i].Z * CurrentFrustum.Planes[i].Z));
-
-		if (Length > -MATH_EPSILON && Length < MATH_EPSILON) { return; }
-
-		CurrentFrustum.Planes[i] /= -Length;
-	}
+	if (!CurrentFrustum.Build(ViewProjConstants)) { return; }
 
 	// 2. 옥트리를 이용해 보이는 객체만 RenderableObjects에 저장한다.
 	if (StaticOctree)
@@ -16,6 +16,30 @@ struct FFrustum
 {
     FVector4 Planes[6];
 
+    /**
+     * @brief View * Projection 행렬에서 6개 평면을 뽑아 정규화 (법선이 절두체 바깥을 향함)
+     * @return 길이가 0인 평면이 있으면 false (이때 평면은 일부만 채워짐)
+     */
+    bool Build(const FViewProjConstants& InViewProj)
+    {
+        const FMatrix VP = InViewProj.View * InViewProj.Projection;
+        Planes[0] = VP[3] + VP[0]; // Left
+        Planes[1] = VP[3] - VP[0]; // Right
+        Planes[2] = VP[3] + VP[1]; // Bottom
+        Planes[3] = VP[3] - VP[1]; // Top
+        Planes[4] = VP[2]; // Near
+        Planes[5] = VP[3] - VP[2]; // Far
+
+        for (int i = 0; i < 6; i++)
+        {
+            const float Length = sqrt((Planes[i].X * Planes[i].X) + (Planes[i].Y * Planes[i].Y) + (Planes[i].Z * Planes[i].Z));
+            if (Length > -MATH_EPSILON && Length < MATH_EPSILON) { return false; }
+
+            Planes[i] /= -Length;
+        }
+        return true;
+    }
+
     EBoundCheckResult CheckIntersection(const FAABB& BBox) const
     {
         EBoundCheckResult Result = EBoundCheckResult::Inside;
@@ -70,9 +94,12 @@ public:
 	);
 
 	const TArray<UPrimitiveComponent*>& GetRenderableObjects() const;
+	// Cull을 실행한 횟수 (값이 같으면 RenderableObjects도 그대로임)
+	uint64 GetCullCount() const { return CullCount; }
 private:
     void CullOctree(FOctree* Octree);
 
     FFrustum CurrentFrustum{};
     TArray<UPrimitiveComponent*> RenderableObjects{};
+    uint64 CullCount = 0;
 };
\ No newline at end of file
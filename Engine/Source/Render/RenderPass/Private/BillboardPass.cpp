@@ -1,7 +1,9 @@
 ﻿#include "pch.h"
 #include "Render/RenderPass/Public/BillboardPass.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
 #include "Editor/Public/Camera.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Render/UI/Overlay/Public/StatOverlay.h"
 
 FBillboardPass::FBillboardPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11Buffer* InConstantBufferModel,
                                ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS)
@@ -9,30 +11,79 @@ FBillboardPass::FBillboardPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBu
 {
 }
 
-void FBillboardPass::Execute(FRenderingContext& Context)
+void FBillboardPass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
+    TIME_PROFILE(BillboardPass);
     FRenderState RenderState = UBillBoardComponent::GetClassDefaultRenderState();
 
     static FPipelineInfo PipelineInfo = { InputLayout, VS, FRenderResourceFactory::GetRasterizerState(RenderState), DS, PS, nullptr };
-    Pipeline->UpdatePipeline(PipelineInfo);
+    CommandList.UpdatePipeline(PipelineInfo);
 
     if (!(Context.ShowFlags & EEngineShowFlags::SF_Billboard)) return;
-    for (UBillBoardComponent* BillBoardComp : Context.BillBoards)
+
+    const TArray<UBillBoardComponent*>& BillBoards = Context.BillBoards;
+    const FVector ViewOrigin = Context.CurrentCamera->GetLocation();
+
+    // 1) 스프라이트 -> 가까운 순 키 생성 (블렌딩 없이 그리므로 앞에서 뒤로)
+    SortItems.clear();
+    for (uint32 Index = 0; Index < static_cast<uint32>(BillBoards.size()); ++Index)
+    {
+        UBillBoardComponent* BillBoardComp = BillBoards[Index];
+        const uint32 SpriteId = static_cast<uint32>(BillBoardComp->GetSprite().first.GetComparisonIndex());
+        const uint16 DepthBucket = FDrawSortKey::QuantizeDepth((BillBoardComp->GetWorldLocation() - ViewOrigin).Length());
+        SortItems.push_back({ FDrawSortKey::Make(EDrawSortPass::Billboard, 0, 0, SpriteId, DepthBucket), Index, 0 });
+    }
+    RadixSortDrawItems(SortItems, SortScratch);
+
+    FDrawSortStats Stats;
+    ID3D11Buffer* CurrentVertexBuffer = nullptr;
+    ID3D11Buffer* CurrentIndexBuffer = nullptr;
+    ID3D11ShaderResourceView* CurrentSprite = nullptr;
+    ID3D11SamplerState* CurrentSampler = nullptr;
+    CommandList.SetConstantBuffer(0, true, ConstantBufferModel);
+
+    for (const FDrawSortItem& Item : SortItems)
     {
+        UBillBoardComponent* BillBoardComp = BillBoards[Item.Index];
+
         // 1) 카메라를 향하는 빌보드 전용 행렬을 갱신
-        BillBoardComp->UpdateBillboardMatrix(Context.CurrentCamera->GetLocation());
+        BillBoardComp->UpdateBillboardMatrix(ViewOrigin);
 
-        Pipeline->SetVertexBuffer(BillBoardComp->GetVertexBuffer(), sizeof(FNormalVertex));
-        Pipeline->SetIndexBuffer(BillBoardComp->GetIndexBuffer(), 0);
+        // 2) 빌보드는 대부분 같은 쿼드를 공유하므로 바뀔 때만 바인딩
+        if (CurrentVertexBuffer != BillBoardComp->GetVertexBuffer())
+        {
+            CurrentVertexBuffer = BillBoardComp->GetVertexBuffer();
+            CommandList.SetVertexBuffer(CurrentVertexBuffer, sizeof(FNormalVertex));
+            ++Stats.BufferBinds;
+        }
+        if (CurrentIndexBuffer != BillBoardComp->GetIndexBuffer())
+        {
+            CurrentIndexBuffer = BillBoardComp->GetIndexBuffer();
+            CommandList.SetIndexBuffer(CurrentIndexBuffer, 0);
+            ++Stats.BufferBinds;
+        }
 		
         // 3) 모델 상수버퍼에는 '월드행렬' 대신 '빌보드 RT 행렬'을 사용
-        FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, BillBoardComp->GetRTMatrix());
-        Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
+        CommandList.UpdateConstantBuffer(ConstantBufferModel, BillBoardComp->GetRTMatrix());
+        ++Stats.ConstantBufferUpdates;
 
-        Pipeline->SetTexture(0, false, BillBoardComp->GetSprite().second);
-        Pipeline->SetSamplerState(0, false, BillBoardComp->GetSampler());
-        Pipeline->DrawIndexed(BillBoardComp->GetNumIndices(), 0, 0);
+        if (CurrentSprite != BillBoardComp->GetSprite().second)
+        {
+            CurrentSprite = BillBoardComp->GetSprite().second;
+            CommandList.SetTexture(0, false, CurrentSprite);
+            ++Stats.TextureBinds;
+        }
+        if (CurrentSampler != BillBoardComp->GetSampler())
+        {
+            CurrentSampler = BillBoardComp->GetSampler();
+            CommandList.SetSamplerState(0, false, CurrentSampler);
+            ++Stats.TextureBinds;
+        }
+        CommandList.DrawIndexed(BillBoardComp->GetNumIndices(), 0, 0);
+        ++Stats.DrawCalls;
     }
+
+    UStatOverlay::GetInstance().RecordDrawSortStats(EDrawSortPass::Billboard, static_cast<uint32>(SortItems.size()), Stats);
 }
 
 void FBillboardPass::Release()
@@ -0,0 +1,198 @@
+#include "pch.h"
+#include "Render/RenderPass/Public/DecalMeshBuilder.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Physics/Public/OBB.h"
+#include "Component/Public/DecalComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Level/Public/Level.h"
+
+namespace
+{
+	// 박스 공간으로 옮긴 삼각형 하나를 판정해서 겹치면 인덱스 3개 추가
+	bool AppendIfOverlapping(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, uint32 InTriangleBaseIndex,
+		const FMatrix& InLocalToDecalBox, TArray<uint32>& OutIndices)
+	{
+		const uint32 I0 = InIndices[InTriangleBaseIndex];
+		const uint32 I1 = InIndices[InTriangleBaseIndex + 1];
+		const uint32 I2 = InIndices[InTriangleBaseIndex + 2];
+		if (I0 >= InVertices.size() || I1 >= InVertices.size() || I2 >= InVertices.size())
+		{
+			return false;
+		}
+
+		const FVector V0 = InLocalToDecalBox.TransformPosition(InVertices[I0].Position);
+		const FVector V1 = InLocalToDecalBox.TransformPosition(InVertices[I1].Position);
+		const FVector V2 = InLocalToDecalBox.TransformPosition(InVertices[I2].Position);
+		if (!FDecalMeshBuilder::TriangleOverlapsUnitBox(V0, V1, V2))
+		{
+			return false;
+		}
+
+		OutIndices.push_back(I0);
+		OutIndices.push_back(I1);
+		OutIndices.push_back(I2);
+		return true;
+	}
+
+	// 세 점을 Axis에 투영한 구간이 박스 투영 구간 [-R, R]과 떨어져 있는지
+	bool IsSeparatedOnAxis(const FVector& InAxis, const FVector& InV0, const FVector& InV1, const FVector& InV2)
+	{
+		const float P0 = InAxis.Dot(InV0);
+		const float P1 = InAxis.Dot(InV1);
+		const float P2 = InAxis.Dot(InV2);
+		const float R = std::abs(InAxis.X) + std::abs(InAxis.Y) + std::abs(InAxis.Z);
+		return std::min({ P0, P1, P2 }) > R || std::max({ P0, P1, P2 }) < -R;
+	}
+}
+
+FMatrix FDecalMeshBuilder::MakeWorldToDecalBox(const FOBB& InDecalOBB)
+{
+	// [-1, 1]^3 -> 월드 (FOBB::ToWorldAABB와 같은 순서) 의 역변환
+	const FMatrix DecalBoxToWorld = FMatrix::ScaleMatrix(InDecalOBB.Extents) * InDecalOBB.ScaleRotation *
+		FMatrix::TranslationMatrix(InDecalOBB.Center);
+	return DecalBoxToWorld.Inverse();
+}
+
+bool FDecalMeshBuilder::TriangleOverlapsUnitBox(const FVector& InV0, const FVector& InV1, const FVector& InV2)
+{
+	// 1. 박스 축 3개
+	if (std::min({ InV0.X, InV1.X, InV2.X }) > 1.0f || std::max({ InV0.X, InV1.X, InV2.X }) < -1.0f ||
+		std::min({ InV0.Y, InV1.Y, InV2.Y }) > 1.0f || std::max({ InV0.Y, InV1.Y, InV2.Y }) < -1.0f ||
+		std::min({ InV0.Z, InV1.Z, InV2.Z }) > 1.0f || std::max({ InV0.Z, InV1.Z, InV2.Z }) < -1.0f)
+	{
+		return false;
+	}
+
+	const FVector Edges[3] = { InV1 - InV0, InV2 - InV1, InV0 - InV2 };
+
+	// 2. 삼각형 법선 (세 점의 투영이 같으므로 V0 하나로 판정)
+	const FVector Normal = Edges[0].Cross(Edges[1]);
+	if (std::abs(Normal.Dot(InV0)) > std::abs(Normal.X) + std::abs(Normal.Y) + std::abs(Normal.Z))
+	{
+		return false;
+	}
+
+	// 3. 박스 축 x 삼각형 변 9개 (퇴화한 축은 투영이 모두 0이라 분리되지 않음)
+	const FVector BoxAxes[3] = { FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f) };
+	for (const FVector& BoxAxis : BoxAxes)
+	{
+		for (const FVector& Edge : Edges)
+		{
+			if (IsSeparatedOnAxis(BoxAxis.Cross(Edge), InV0, InV1, InV2))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+uint32 FDecalMeshBuilder::BuildClippedIndices(const FStaticMesh& InMesh, const FMatrix& InLocalToDecalBox, TArray<uint32>& OutIndices)
+{
+	TArray<int32> CandidateTriangles;
+	if (!InMesh.BVH.TraverseBox(InLocalToDecalBox, CandidateTriangles))
+	{
+		return BuildClippedIndicesBruteForce(InMesh.Vertices, InMesh.Indices, InLocalToDecalBox, OutIndices);
+	}
+
+	OutIndices.clear();
+
+	// 원래 삼각형 순서 유지 (BruteForce와 결과가 같아야 하고, 원본 메시의 그리기 순서도 보존)
+	std::sort(CandidateTriangles.begin(), CandidateTriangles.end());
+
+	uint32 TriangleCount = 0;
+	for (int32 Triangle : CandidateTriangles)
+	{
+		const uint32 TriangleBaseIndex = static_cast<uint32>(Triangle) * 3;
+		if (TriangleBaseIndex + 2 < InMesh.Indices.size() &&
+			AppendIfOverlapping(InMesh.Vertices, InMesh.Indices, TriangleBaseIndex, InLocalToDecalBox, OutIndices))
+		{
+			++TriangleCount;
+		}
+	}
+
+	return TriangleCount;
+}
+
+uint32 FDecalMeshBuilder::BuildClippedIndicesBruteForce(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+	const FMatrix& InLocalToDecalBox, TArray<uint32>& OutIndices)
+{
+	OutIndices.clear();
+
+	uint32 TriangleCount = 0;
+	for (uint32 TriangleBaseIndex = 0; TriangleBaseIndex + 2 < InIndices.size(); TriangleBaseIndex += 3)
+	{
+		if (AppendIfOverlapping(InVertices, InIndices, TriangleBaseIndex, InLocalToDecalBox, OutIndices))
+		{
+			++TriangleCount;
+		}
+	}
+
+	return TriangleCount;
+}
+
+FDecalClipCheckResult RunDecalClipCheck(ULevel* InLevel)
+{
+	using Clock = std::chrono::high_resolution_clock;
+
+	FDecalClipCheckResult Result;
+	if (!InLevel)
+	{
+		return Result;
+	}
+
+	TArray<UPrimitiveComponent*> Receivers;
+	TArray<uint32> BVHIndices;
+	TArray<uint32> BruteForceIndices;
+
+	for (UDecalComponent* Decal : InLevel->GetAllDecals())
+	{
+		const IBoundingVolume* DecalBV = Decal ? Decal->GetBoundingBox() : nullptr;
+		if (!DecalBV || DecalBV->GetType() != EBoundingVolumeType::OBB)
+		{
+			continue;
+		}
+
+		const FOBB& DecalOBB = *static_cast<const FOBB*>(DecalBV);
+		const FMatrix WorldToDecalBox = FDecalMeshBuilder::MakeWorldToDecalBox(DecalOBB);
+
+		Receivers.clear();
+		InLevel->QueryOverlappingComponentsWithBVH(DecalOBB, Receivers);
+
+		for (UPrimitiveComponent* Receiver : Receivers)
+		{
+			UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Receiver);
+			UStaticMesh* MeshAsset = StaticMeshComp ? StaticMeshComp->GetStaticMesh() : nullptr;
+			FStaticMesh* StaticMesh = MeshAsset ? MeshAsset->GetStaticMeshAsset() : nullptr;
+			if (!StaticMesh)
+			{
+				continue;
+			}
+
+			const FMatrix LocalToDecalBox = Receiver->GetWorldTransformMatrix() * WorldToDecalBox;
+
+			auto T0 = Clock::now();
+			FDecalMeshBuilder::BuildClippedIndices(*StaticMesh, LocalToDecalBox, BVHIndices);
+			auto T1 = Clock::now();
+			FDecalMeshBuilder::BuildClippedIndicesBruteForce(StaticMesh->Vertices, StaticMesh->Indices, LocalToDecalBox, BruteForceIndices);
+			auto T2 = Clock::now();
+
+			Result.BVHMilliseconds += std::chrono::duration<double, std::milli>(T1 - T0).count();
+			Result.BruteForceMilliseconds += std::chrono::duration<double, std::milli>(T2 - T1).count();
+
+			++Result.PairCount;
+			Result.SelectedTriangles += BVHIndices.size() / 3;
+			Result.SourceTriangles += StaticMesh->Indices.size() / 3;
+			if (BVHIndices != BruteForceIndices)
+			{
+				++Result.MismatchCount;
+				UE_LOG_ERROR("DecalClipCheck: %s -> %s: BVH %zu tris, BruteForce %zu tris",
+					Decal->GetName().ToString().c_str(), Receiver->GetName().ToString().c_str(),
+					BVHIndices.size() / 3, BruteForceIndices.size() / 3);
+			}
+		}
+	}
+
+	return Result;
+}
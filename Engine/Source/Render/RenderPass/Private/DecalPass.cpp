@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "Render/RenderPass/Public/DecalPass.h"
+#include "Render/RenderPass/Public/DecalMeshBuilder.h"
 #include "Render/Renderer/Public/Pipeline.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Render/RenderPass/Public/RenderingContext.h"
 #include "Component/Public/DecalComponent.h"
@@ -11,10 +13,28 @@
 #include "Texture/Public/SpriteMaterial.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Level/Public/Level.h"
+#include "Render/Renderer/Public/RenderScene.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 
 using Clock = std::chrono::high_resolution_clock;
 
+namespace
+{
+    // 같은 프레임에 먼저 기록한 다른 뷰의 리스트가 아직 이 버퍼를 그릴 수 있으므로 리스트 재생 뒤 해제
+    void RetireIndexBuffer(ID3D11Buffer*& InOutBuffer, FRenderCommandList* InCommandList)
+    {
+        if (InCommandList)
+        {
+            InCommandList->ReleaseAfterExecute(InOutBuffer);
+            InOutBuffer = nullptr;
+        }
+        else
+        {
+            SafeRelease(InOutBuffer);
+        }
+    }
+}
+
 FDecalPass::FDecalPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS_Read, ID3D11BlendState* InBlendState, bool bInIsAdditive)
     : FRenderPass(InPipeline, InConstantBufferViewProj, nullptr),
     VS(InVS), PS(InPS), InputLayout(InLayout), DS_Read(InDS_Read), BlendState(InBlendState), bIsAdditivePass(bInIsAdditive)
@@ -23,7 +43,7 @@ FDecalPass::FDecalPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferView
     ConstantBufferDecal = FRenderResourceFactory::CreateConstantBuffer<FDecalConstants>();
 }
 
-void FDecalPass::Execute(FRenderingContext& Context)
+void FDecalPass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
     // 플래그가 꺼져 있으면 전체 스킵
     if (!(Context.ShowFlags & EEngineShowFlags::SF_Decal)) { return; }
@@ -31,6 +51,7 @@ void FDecalPass::Execute(FRenderingContext& Context)
     const auto& DecalsToRender = bIsAdditivePass ? Context.AdditiveDecals : Context.AlphaDecals;
     if (DecalsToRender.empty())
     {
+        ReleaseClipCache(&CommandList);
         return;
     }
 
@@ -38,12 +59,20 @@ void FDecalPass::Execute(FRenderingContext& Context)
     uint32 DrawCalls = 0;
     uint32 TexBinds = 0, TexFallbacks = 0;
     uint32 MatSeen = 0, MatBinds = 0;
+    uint32 CacheHits = 0, CacheMisses = 0;
+    ClippedTriangles = SourceTriangles = ClipRebuilds = 0;
+    ++ClipFrame;
     TIME_PROFILE(DecalPass);
+
+    // Decal / Receiver 변경분만 Receiver 캐시에 반영 (같은 프레임의 다른 DecalPass에서는 할 일 없음)
+    ULevel* CurrentLevel = GWorld->GetLevel();
+    const uint32 PatchedReceivers = CurrentLevel ? CurrentLevel->UpdateDecalReceiverCache() : 0;
+
     // --- Set Pipeline State ---
     FPipelineInfo PipelineInfo = { InputLayout, VS, FRenderResourceFactory::GetRasterizerState({ ECullMode::Back, EFillMode::Solid }),
         DS_Read, PS, BlendState };
-    Pipeline->UpdatePipeline(PipelineInfo);
-    Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
+    CommandList.UpdatePipeline(PipelineInfo);
+    CommandList.SetConstantBuffer(1, true, ConstantBufferViewProj);
 
     // --- Render Decals ---
     for (UDecalComponent* Decal : DecalsToRender)
@@ -60,7 +89,7 @@ void FDecalPass::Execute(FRenderingContext& Context)
         }
 
         const FOBB* DecalOBB = static_cast<const FOBB*>(DecalBV);
-        const FAABB DecalWorldAABB = DecalOBB->ToWorldAABB();
+        const FMatrix WorldToDecalBox = FDecalMeshBuilder::MakeWorldToDecalBox(*DecalOBB);
         // --- Update Decal Constant Buffer ---
         FDecalConstants DecalConstants;
 
@@ -88,8 +117,8 @@ void FDecalPass::Execute(FRenderingContext& Context)
             DecalConstants.SubUVParams = SpriteMaterial->GetSubUVParams();
         }
 
-        FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferDecal, DecalConstants);
-        Pipeline->SetConstantBuffer(2, false, ConstantBufferDecal);
+        CommandList.UpdateConstantBuffer(ConstantBufferDecal, DecalConstants);
+        CommandList.SetConstantBuffer(2, false, ConstantBufferDecal);
 
         // --- Bind Decal Texture ---
         UTexture* BoundTexture = nullptr;
@@ -113,24 +142,31 @@ void FDecalPass::Execute(FRenderingContext& Context)
         {
             if (auto* Proxy = BoundTexture->GetRenderProxy())
             {
-                Pipeline->SetTexture(0, false, Proxy->GetSRV());
-                Pipeline->SetSamplerState(0, false, Proxy->GetSampler());
+                CommandList.SetTexture(0, false, Proxy->GetSRV());
+                CommandList.SetSamplerState(0, false, Proxy->GetSampler());
                 ++TexBinds;
                 if (FromMaterial) ++MatBinds;
             }
         }
 
-        // BVH를 사용하여 DecalOBB와 겹치는 Component만 필터링
-        ULevel* CurrentLevel = GWorld->GetLevel();
+        // BVH로 DecalOBB와 겹치는 Component만 필터링 (Decal과 Receiver가 그대로면 캐시된 결과 사용)
         if (CurrentLevel)
         {
-            TArray<UPrimitiveComponent*> OverlappingComponents;
-            if (CurrentLevel->QueryOverlappingComponentsWithBVH(*DecalOBB, OverlappingComponents))
+            bool bCacheHit = false;
+            const TArray<UPrimitiveComponent*>& Receivers = CurrentLevel->GetDecalReceivers(Decal, *DecalOBB, bCacheHit);
+            if (bCacheHit)
             {
-                // BVH로 필터링된 겹치는 Component들만 렌더링
-                for (UPrimitiveComponent* Prim : OverlappingComponents)
+                ++CacheHits;
+            }
+            else
+            {
+                ++CacheMisses;
+            }
+
+            for (UPrimitiveComponent* Prim : Receivers)
+            {
+                if (DrawDecalReceiver(CommandList, Decal, WorldToDecalBox, Prim))
                 {
-                    DrawDecalReceiver(Prim);
                     ++DrawCalls;
                 }
             }
@@ -138,53 +174,160 @@ void FDecalPass::Execute(FRenderingContext& Context)
         else
         {
             // BVH가 없는 경우 폴백: 모든 프리미티브 렌더링
-            for (UPrimitiveComponent* Prim : Context.DefaultPrimitives)
+            for (const TArray<uint32>* Proxies : { &Context.PrimitiveProxies, &Context.StaticMeshProxies })
             {
-                DrawDecalReceiver(Prim);
-                ++DrawCalls;
-            }
-
-            for (UStaticMeshComponent* SM : Context.StaticMeshes)
-            {
-                DrawDecalReceiver(SM);
-                ++DrawCalls;
+                for (uint32 Proxy : *Proxies)
+                {
+                    if (DrawDecalReceiver(CommandList, Decal, WorldToDecalBox, Context.Scene->GetComponent(Proxy)))
+                    {
+                        ++DrawCalls;
+                    }
+                }
             }
         }
     }
+    PruneClipCache(CommandList);
     TIME_PROFILE_END(DecalPass);
     auto t1 = Clock::now();
     float ms = std::chrono::duration<float, std::milli>(t1 - t0).count();
     UStatOverlay::GetInstance().RecordDecalDrawCalls(DrawCalls);
     UStatOverlay::GetInstance().RecordDecalTextureStats(TexBinds, TexFallbacks);
     UStatOverlay::GetInstance().RecordDecalMaterialStats(MatSeen, MatBinds);
+    UStatOverlay::GetInstance().RecordDecalReceiverCacheStats(CacheHits, CacheMisses, PatchedReceivers);
+    UStatOverlay::GetInstance().RecordDecalClipStats(ClippedTriangles, SourceTriangles, ClipRebuilds);
     UStatOverlay::GetInstance().RecordDecalPassMs(ms);
 }
 
-void FDecalPass::DrawDecalReceiver(UPrimitiveComponent* Prim)
+bool FDecalPass::DrawDecalReceiver(FRenderCommandList& CommandList, UDecalComponent* Decal, const FMatrix& WorldToDecalBox, UPrimitiveComponent* Prim)
 {
-    if (!Prim || !Prim->IsVisible()) return;
+    if (!Prim || !Prim->IsVisible()) return false;
+
+    // 인덱스 버퍼가 있으면 Decal 박스에 걸치는 삼각형만 그림
+    const FDecalClipCacheEntry* Clip = nullptr;
+    if (Prim->GetIndexBuffer() && Prim->GetIndicesData())
+    {
+        Clip = &GetClippedIndices(CommandList, Decal, WorldToDecalBox, Prim);
+        SourceTriangles += Prim->GetNumIndices() / 3;
+        ClippedTriangles += Clip->NumIndices / 3;
+        if (Clip->NumIndices == 0)
+        {
+            return false;
+        }
+    }
 
     FModelConstants ModelConstants{
         Prim->GetWorldTransformMatrix(),
         Prim->GetWorldTransformMatrixInverse().Transpose()
     };
-    FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferPrim, ModelConstants);
-    Pipeline->SetConstantBuffer(0, true, ConstantBufferPrim);
+    CommandList.UpdateConstantBuffer(ConstantBufferPrim, ModelConstants);
+    CommandList.SetConstantBuffer(0, true, ConstantBufferPrim);
 
-    Pipeline->SetVertexBuffer(Prim->GetVertexBuffer(), sizeof(FNormalVertex));
-    if (Prim->GetIndexBuffer() && Prim->GetIndicesData())
+    CommandList.SetVertexBuffer(Prim->GetVertexBuffer(), sizeof(FNormalVertex));
+    if (Clip)
     {
-        Pipeline->SetIndexBuffer(Prim->GetIndexBuffer(), 0);
-        Pipeline->DrawIndexed(Prim->GetNumIndices(), 0, 0);
+        CommandList.SetIndexBuffer(Clip->IndexBuffer, 0);
+        CommandList.DrawIndexed(Clip->NumIndices, 0, 0);
     }
     else
     {
-        Pipeline->Draw(Prim->GetNumVertices(), 0);
+        CommandList.Draw(Prim->GetNumVertices(), 0);
     }
 
+    return true;
 }
+
+const FDecalClipCacheEntry& FDecalPass::GetClippedIndices(FRenderCommandList& CommandList, UDecalComponent* Decal, const FMatrix& WorldToDecalBox, UPrimitiveComponent* Prim)
+{
+    const FMatrix LocalToDecalBox = Prim->GetWorldTransformMatrix() * WorldToDecalBox;
+    const TArray<uint32>* SourceIndices = Prim->GetIndicesData();
+
+    FDecalClipCacheEntry& Entry = ClipCache[Decal][Prim];
+    Entry.LastUsedFrame = ClipFrame;
+
+    // 같은 입력이면 같은 행렬이 나오므로 비트 단위로 비교 (Decal / Receiver 중 하나라도 움직이면 다시 생성)
+    if (Entry.SourceIndices == SourceIndices &&
+        memcmp(&Entry.LocalToDecalBox, &LocalToDecalBox, sizeof(FMatrix)) == 0)
+    {
+        return Entry;
+    }
+
+    RetireIndexBuffer(Entry.IndexBuffer, &CommandList);
+    Entry.LocalToDecalBox = LocalToDecalBox;
+    Entry.SourceIndices = SourceIndices;
+    Entry.NumIndices = 0;
+    ++ClipRebuilds;
+
+    TArray<uint32> ClippedIndices;
+    FStaticMesh* StaticMesh = nullptr;
+    if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Prim))
+    {
+        if (UStaticMesh* MeshAsset = StaticMeshComp->GetStaticMesh())
+        {
+            StaticMesh = MeshAsset->GetStaticMeshAsset();
+        }
+    }
+
+    if (StaticMesh && &StaticMesh->Indices == SourceIndices)
+    {
+        FDecalMeshBuilder::BuildClippedIndices(*StaticMesh, LocalToDecalBox, ClippedIndices);
+    }
+    else if (const TArray<FNormalVertex>* SourceVertices = Prim->GetVerticesData())
+    {
+        // 기본 도형은 BVH가 없고 삼각형 수도 적으므로 전부 검사
+        FDecalMeshBuilder::BuildClippedIndicesBruteForce(*SourceVertices, *SourceIndices, LocalToDecalBox, ClippedIndices);
+    }
+
+    if (!ClippedIndices.empty())
+    {
+        Entry.NumIndices = static_cast<uint32>(ClippedIndices.size());
+        Entry.IndexBuffer = FRenderResourceFactory::CreateIndexBuffer(ClippedIndices.data(),
+            static_cast<uint32>(ClippedIndices.size() * sizeof(uint32)));
+        if (!Entry.IndexBuffer)
+        {
+            Entry.NumIndices = 0;
+        }
+    }
+
+    return Entry;
+}
+
+void FDecalPass::PruneClipCache(FRenderCommandList& CommandList)
+{
+    for (auto DecalIt = ClipCache.begin(); DecalIt != ClipCache.end();)
+    {
+        TMap<UPrimitiveComponent*, FDecalClipCacheEntry>& Receivers = DecalIt->second;
+        for (auto ReceiverIt = Receivers.begin(); ReceiverIt != Receivers.end();)
+        {
+            if (ReceiverIt->second.LastUsedFrame != ClipFrame)
+            {
+                RetireIndexBuffer(ReceiverIt->second.IndexBuffer, &CommandList);
+                ReceiverIt = Receivers.erase(ReceiverIt);
+            }
+            else
+            {
+                ++ReceiverIt;
+            }
+        }
+
+        DecalIt = Receivers.empty() ? ClipCache.erase(DecalIt) : std::next(DecalIt);
+    }
+}
+
+void FDecalPass::ReleaseClipCache(FRenderCommandList* InCommandList)
+{
+    for (auto& [Decal, Receivers] : ClipCache)
+    {
+        for (auto& [Receiver, Entry] : Receivers)
+        {
+            RetireIndexBuffer(Entry.IndexBuffer, InCommandList);
+        }
+    }
+    ClipCache.clear();
+}
+
 void FDecalPass::Release()
 {
+    ReleaseClipCache(nullptr);
     SafeRelease(ConstantBufferPrim);
     SafeRelease(ConstantBufferDecal);
 }
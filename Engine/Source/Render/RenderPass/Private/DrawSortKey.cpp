@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "Render/RenderPass/Public/DrawSortKey.h"
+
+void RadixSortDrawItems(TArray<FDrawSortItem>& InOutItems, TArray<FDrawSortItem>& InScratch)
+{
+	constexpr uint32 DigitBits = 8;
+	constexpr uint32 DigitCount = 64 / DigitBits;
+	constexpr uint32 BucketCount = 1 << DigitBits;
+
+	const size_t ItemCount = InOutItems.size();
+	if (ItemCount < 2) { return; }
+
+	// 모든 자릿수의 히스토그램을 한 번에 계산
+	uint32 Histograms[DigitCount][BucketCount] = {};
+	for (const FDrawSortItem& Item : InOutItems)
+	{
+		for (uint32 Digit = 0; Digit < DigitCount; ++Digit)
+		{
+			++Histograms[Digit][(Item.Key >> (Digit * DigitBits)) & (BucketCount - 1)];
+		}
+	}
+
+	InScratch.resize(ItemCount);
+	TArray<FDrawSortItem>* Source = &InOutItems;
+	TArray<FDrawSortItem>* Destination = &InScratch;
+
+	for (uint32 Digit = 0; Digit < DigitCount; ++Digit)
+	{
+		uint32* Histogram = Histograms[Digit];
+		const uint32 Shift = Digit * DigitBits;
+
+		// 모든 항목의 자릿수가 같으면 순서가 바뀌지 않음 (패스 / 셰이더 비트는 대부분 여기서 빠짐)
+		if (Histogram[((*Source)[0].Key >> Shift) & (BucketCount - 1)] == ItemCount)
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (uint32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (const FDrawSortItem& Item : *Source)
+		{
+			(*Destination)[Histogram[(Item.Key >> Shift) & (BucketCount - 1)]++] = Item;
+		}
+		std::swap(Source, Destination);
+	}
+
+	if (Source != &InOutItems)
+	{
+		InOutItems.swap(InScratch);
+	}
+}
@@ -1,8 +1,10 @@
 #include "pch.h"
 #include "Render/RenderPass/Public/FireBallForwardPass.h"
 #include "Render/Renderer/Public/Pipeline.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Render/Renderer/Public/Renderer.h"
+#include "Render/Renderer/Public/RenderScene.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Public/FireBallComponent.h"
@@ -21,9 +23,10 @@ FFireBallForwardPass::FFireBallForwardPass(UPipeline* InPipeline,
     CBFireBall = FRenderResourceFactory::CreateConstantBuffer<FFireBallFwdCB>();
 }
 
-void FFireBallForwardPass::Execute(FRenderingContext& Context)
+void FFireBallForwardPass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
     if (!VS || !PS || !InputLayout || !Pipeline) { return; }
+    TIME_PROFILE(FireBallForwardPass);
 
     if (Context.ViewMode == EViewModeIndex::VMI_Wireframe)
     {
@@ -42,7 +45,7 @@ void FFireBallForwardPass::Execute(FRenderingContext& Context)
 
     ID3D11RenderTargetView* rtv = URenderer::GetInstance().GetSceneColorRTV();
     ID3D11DepthStencilView* depthReadOnly = URenderer::GetInstance().GetReadOnlyDSV();
-    URenderer::GetInstance().GetDeviceContext()->OMSetRenderTargets(1, &rtv, depthReadOnly);
+    CommandList.SetRenderTargets(rtv, depthReadOnly);
 
     FPipelineInfo pipelineInfo = {
         InputLayout,
@@ -53,9 +56,9 @@ void FFireBallForwardPass::Execute(FRenderingContext& Context)
         AdditiveBlend,
         D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST
     };
-    Pipeline->UpdatePipeline(pipelineInfo);
+    CommandList.UpdatePipeline(pipelineInfo);
 
-    Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
+    CommandList.SetConstantBuffer(1, true, ConstantBufferViewProj);
 
     for (UFireBallComponent* Fire : Context.FireBalls)
     {
@@ -74,66 +77,48 @@ void FFireBallForwardPass::Execute(FRenderingContext& Context)
         cb.gRadius = Radius;
         cb.gFeather = Feather;
         cb.gHardness = 2.0f;
-        FRenderResourceFactory::UpdateConstantBufferData(CBFireBall, cb);
-        Pipeline->SetConstantBuffer(2, false, CBFireBall);
+        CommandList.UpdateConstantBuffer(CBFireBall, cb);
+        CommandList.SetConstantBuffer(2, false, CBFireBall);
 
-        for (UStaticMeshComponent* MeshComp : Context.StaticMeshes)
+        const FRenderScene& Scene = *Context.Scene;
+        auto DrawProxy = [&](uint32 InProxy)
         {
-            if (!MeshComp || !MeshComp->GetStaticMesh()) { continue; }
-            if (ID3D11Buffer* vb = MeshComp->GetVertexBuffer())
+            if (ID3D11Buffer* vb = Scene.GetVertexBuffer(InProxy))
             {
-                Pipeline->SetVertexBuffer(vb, sizeof(FNormalVertex));
+                CommandList.SetVertexBuffer(vb, sizeof(FNormalVertex));
             }
-            if (ID3D11Buffer* ib = MeshComp->GetIndexBuffer())
+            if (ID3D11Buffer* ib = Scene.GetIndexBuffer(InProxy))
             {
-                Pipeline->SetIndexBuffer(ib, sizeof(uint32));
+                CommandList.SetIndexBuffer(ib, Scene.GetIndexStride(InProxy));
             }
 
-            //cb.gNoNormalCull = (Fire->GetOwner() == MeshComp->GetOwner()) ? 1.0f : 0.0f;
-            FRenderResourceFactory::UpdateConstantBufferData(CBFireBall, cb);
-            Pipeline->SetConstantBuffer(2, false, CBFireBall);
+            //cb.gNoNormalCull = (Fire->GetOwner() == Scene.GetComponent(InProxy)->GetOwner()) ? 1.0f : 0.0f;
+            CommandList.UpdateConstantBuffer(CBFireBall, cb);
+            CommandList.SetConstantBuffer(2, false, CBFireBall);
 
-            FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, MeshComp->GetWorldTransformMatrix());
-            Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
+            CommandList.UpdateConstantBuffer(ConstantBufferModel, Scene.GetWorldMatrix(InProxy));
+            CommandList.SetConstantBuffer(0, true, ConstantBufferModel);
 
-            if (MeshComp->GetIndexBuffer() && MeshComp->GetNumIndices() > 0)
+            if (Scene.GetIndexBuffer(InProxy) && Scene.GetNumIndices(InProxy) > 0)
             {
-                Pipeline->DrawIndexed(MeshComp->GetNumIndices(), 0, 0);
+                CommandList.DrawIndexed(Scene.GetNumIndices(InProxy), 0, 0);
             }
-            else if (MeshComp->GetVertexBuffer() && MeshComp->GetNumVertices() > 0)
+            else if (Scene.GetVertexBuffer(InProxy) && Scene.GetNumVertices(InProxy) > 0)
             {
-                Pipeline->Draw(MeshComp->GetNumVertices(), 0);
+                CommandList.Draw(Scene.GetNumVertices(InProxy), 0);
             }
-        }
+        };
 
-        for (UPrimitiveComponent* Prim : Context.DefaultPrimitives)
+        for (uint32 Proxy : Context.StaticMeshProxies)
         {
-            if (!Prim || !Prim->IsVisible()) { continue; }
-
-            if (ID3D11Buffer* vb = Prim->GetVertexBuffer())
-            {
-                Pipeline->SetVertexBuffer(vb, sizeof(FNormalVertex));
-            }
-            if (ID3D11Buffer* ib = Prim->GetIndexBuffer())
-            {
-                Pipeline->SetIndexBuffer(ib, sizeof(uint32));
-            }
-
-            //cb.gNoNormalCull = (Fire->GetOwner() == Prim->GetOwner()) ? 1.0f : 0.0f;
-            FRenderResourceFactory::UpdateConstantBufferData(CBFireBall, cb);
-            Pipeline->SetConstantBuffer(2, false, CBFireBall);
-
-            FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, Prim->GetWorldTransformMatrix());
-            Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
+            if (!Scene.GetStaticMesh(Proxy)) { continue; }
+            DrawProxy(Proxy);
+        }
 
-            if (Prim->GetIndexBuffer() && Prim->GetNumIndices() > 0)
-            {
-                Pipeline->DrawIndexed(Prim->GetNumIndices(), 0, 0);
-            }
-            else if (Prim->GetVertexBuffer() && Prim->GetNumVertices() > 0)
-            {
-                Pipeline->Draw(Prim->GetNumVertices(), 0);
-            }
+        for (uint32 Proxy : Context.PrimitiveProxies)
+        {
+            if (!Scene.IsVisible(Proxy)) { continue; }
+            DrawProxy(Proxy);
         }
     }
 }
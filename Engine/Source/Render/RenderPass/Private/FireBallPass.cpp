@@ -31,9 +31,10 @@ FFireBallPass::FFireBallPass(UPipeline* InPipeline,
     URenderer::GetInstance().GetDevice()->CreateDepthStencilState(&d, &DS_AlwaysRead);
 }
 
-void FFireBallPass::Execute(FRenderingContext& Context)
+void FFireBallPass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
     if (!VS || !PS || !InputLayout || !Pipeline) { return; }
+    TIME_PROFILE(FireBallPass);
 
     auto* ctx = URenderer::GetInstance().GetDeviceContext();
 
@@ -55,8 +56,8 @@ void FFireBallPass::Execute(FRenderingContext& Context)
     //ctx->VSSetShaderResources(0, 1, &nullSRV);
     //ctx->OMSetRenderTargets(1, &rtv, depthReadOnlyDSV);
 
-    ctx->PSSetShaderResources(5, 1, &depthSRV);
-    ctx->PSSetSamplers(5, 1, &DepthSampler);
+    Pipeline->SetTexture(5, false, depthSRV);
+    Pipeline->SetSamplerState(5, false, DepthSampler);
 
     for (UFireBallComponent* Fire : Context.FireBalls)
     {
@@ -181,7 +182,9 @@ void FFireBallPass::Execute(FRenderingContext& Context)
         }
    }
 
-   ctx->PSSetShaderResources(5, 1, &nullSRV);
+   // 깊이 DSV를 다시 쓰기 가능으로 바인딩하기 전에 SRV 해제를 디바이스에 반영
+   Pipeline->SetTexture(5, false, nullptr);
+   Pipeline->FlushBindings();
 
    ctx->OMSetRenderTargets(1, &rtv, depthDSV);
 }
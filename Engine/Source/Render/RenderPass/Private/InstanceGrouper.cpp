@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "Render/RenderPass/Public/InstanceGrouper.h"
+
+void FInstanceGrouper::Reset()
+{
+	Groups.clear();
+	InstanceItems.clear();
+}
+
+void FInstanceGrouper::BuildSingles(uint32 InItemCount)
+{
+	Reset();
+	Groups.reserve(InItemCount);
+	InstanceItems.reserve(InItemCount);
+	for (uint32 Index = 0; Index < InItemCount; ++Index)
+	{
+		Groups.push_back({ Index, 1 });
+		InstanceItems.push_back(Index);
+	}
+}
+
+uint32 FInstanceGrouper::GetInstancedGroupCount() const
+{
+	uint32 Count = 0;
+	for (const FInstanceGroup& Group : Groups)
+	{
+		if (Group.IsInstanced())
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+void FInstanceGrouper::ScatterRun(uint32 InRunBegin, uint32 InRunEnd, uint32 InMinInstances, uint32 InMaxInstances)
+{
+	const uint32 BucketCount = static_cast<uint32>(Representatives.size());
+	const uint32 RunStart = static_cast<uint32>(InstanceItems.size());
+
+	BucketOffsets.assign(BucketCount + 1, 0);
+	for (uint32 Local = 0; Local < InRunEnd - InRunBegin; ++Local)
+	{
+		++BucketOffsets[BucketOf[Local] + 1];
+	}
+	for (uint32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+	{
+		BucketOffsets[Bucket + 1] += BucketOffsets[Bucket];
+	}
+
+	InstanceItems.resize(RunStart + (InRunEnd - InRunBegin));
+	for (uint32 Local = 0; Local < InRunEnd - InRunBegin; ++Local)
+	{
+		InstanceItems[RunStart + BucketOffsets[BucketOf[Local]]++] = InRunBegin + Local;
+	}
+
+	// Scatter 후 BucketOffsets[Bucket]은 다음 버킷의 시작 위치
+	uint32 BucketStart = 0;
+	for (uint32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+	{
+		EmitGroups(RunStart + BucketStart, BucketOffsets[Bucket] - BucketStart, InMinInstances, InMaxInstances);
+		BucketStart = BucketOffsets[Bucket];
+	}
+}
+
+void FInstanceGrouper::EmitGroups(uint32 InFirst, uint32 InCount, uint32 InMinInstances, uint32 InMaxInstances)
+{
+	// 너무 작은 묶음은 인스턴스 버퍼 업로드가 이득이 없으므로 하나씩 그림
+	if (InCount < InMinInstances)
+	{
+		for (uint32 Offset = 0; Offset < InCount; ++Offset)
+		{
+			Groups.push_back({ InFirst + Offset, 1 });
+		}
+		return;
+	}
+
+	for (uint32 Offset = 0; Offset < InCount; Offset += InMaxInstances)
+	{
+		Groups.push_back({ InFirst + Offset, std::min(InMaxInstances, InCount - Offset) });
+	}
+}
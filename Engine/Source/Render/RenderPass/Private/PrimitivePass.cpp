@@ -1,18 +1,26 @@
 ﻿#include "pch.h"
 #include "Render/RenderPass/Public/PrimitivePass.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Render/Renderer/Public/RenderScene.h"
+#include "Render/UI/Overlay/Public/StatOverlay.h"
+#include "Editor/Public/Camera.h"
 
 FPrimitivePass::FPrimitivePass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11Buffer* InConstantBufferModel,
                                ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS,
-                               ID3D11VertexShader* InDepthVS, ID3D11PixelShader* InDepthPS, ID3D11InputLayout* InDepthLayout)
+                               ID3D11VertexShader* InDepthVS, ID3D11PixelShader* InDepthPS, ID3D11InputLayout* InDepthLayout,
+                               ID3D11VertexShader* InInstancedVS, ID3D11PixelShader* InInstancedPS, ID3D11VertexShader* InInstancedDepthVS)
         : FRenderPass(InPipeline, InConstantBufferViewProj, InConstantBufferModel), VS(InVS), PS(InPS), InputLayout(InLayout), DS(InDS),
-          DepthVS(InDepthVS), DepthPS(InDepthPS), DepthInputLayout(InDepthLayout)
+          DepthVS(InDepthVS), DepthPS(InDepthPS), DepthInputLayout(InDepthLayout),
+          InstancedVS(InInstancedVS), InstancedPS(InInstancedPS), InstancedDepthVS(InInstancedDepthVS)
 {
     ConstantBufferColor = FRenderResourceFactory::CreateConstantBuffer<FVector4>();
+    InstanceBuffer = FRenderResourceFactory::CreateStructuredBuffer(sizeof(FInstanceData), MaxInstancesPerDraw, &InstanceSRV);
 }
 
-void FPrimitivePass::Execute(FRenderingContext& Context)
+void FPrimitivePass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
+    TIME_PROFILE(PrimitivePass);
     FRenderState DefaultState;
     if (Context.ViewMode == EViewModeIndex::VMI_Wireframe)
     {
@@ -33,42 +41,154 @@ void FPrimitivePass::Execute(FRenderingContext& Context)
     }
 
     FPipelineInfo PipelineInfo = { SelectedLayout, SelectedVS, nullptr, DS, SelectedPS, nullptr };
-    Pipeline->UpdatePipeline(PipelineInfo);
-    Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
-    Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
-    Pipeline->SetConstantBuffer(2, false, ConstantBufferColor);
+    CommandList.UpdatePipeline(PipelineInfo);
+    CommandList.SetConstantBuffer(0, true, ConstantBufferModel);
+    CommandList.SetConstantBuffer(1, true, ConstantBufferViewProj);
+    CommandList.SetConstantBuffer(2, true, ConstantBufferColor);
+    CommandList.SetConstantBuffer(2, false, ConstantBufferColor);
     if (!(Context.ShowFlags & EEngineShowFlags::SF_Primitives)) return;
-    
-    for (UPrimitiveComponent* PrimitiveComponent : Context.DefaultPrimitives)
+
+    const FRenderScene& Scene = *Context.Scene;
+    const TArray<uint32>& Primitives = Context.PrimitiveProxies;
+    const FVector ViewOrigin = Context.CurrentCamera ? Context.CurrentCamera->GetLocation() : FVector();
+    const bool bWireframe = Context.ViewMode == EViewModeIndex::VMI_Wireframe;
+
+    // 1) 래스터라이저 상태 -> 도형 종류 -> 가까운 순 키 생성
+    SortItems.clear();
+    for (uint32 Index = 0; Index < static_cast<uint32>(Primitives.size()); ++Index)
     {
-        if (Context.ViewMode != EViewModeIndex::VMI_Wireframe)
-        {
-            DefaultState = PrimitiveComponent->GetRenderState();
-        }
-        
-        PipelineInfo.RasterizerState = FRenderResourceFactory::GetRasterizerState(DefaultState);
-        Pipeline->UpdatePipeline(PipelineInfo);
-        
-        FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, PrimitiveComponent->GetWorldTransformMatrix());
-        Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
-        FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferColor, PrimitiveComponent->GetColor());
-        Pipeline->SetConstantBuffer(2, true, ConstantBufferColor);
-        Pipeline->SetConstantBuffer(2, false, ConstantBufferColor);
-        Pipeline->SetVertexBuffer(PrimitiveComponent->GetVertexBuffer(), sizeof(FNormalVertex));
-
-        if (PrimitiveComponent->GetIndexBuffer() && PrimitiveComponent->GetIndicesData())
+        const uint32 Proxy = Primitives[Index];
+        const FRenderState& State = bWireframe ? DefaultState : Scene.GetRenderState(Proxy);
+        const uint32 ShaderId = static_cast<uint32>(State.CullMode) * 2 + static_cast<uint32>(State.FillMode);
+        const uint16 DepthBucket = FDrawSortKey::QuantizeDepth((Scene.GetWorldLocation(Proxy) - ViewOrigin).Length());
+        SortItems.push_back({ FDrawSortKey::Make(EDrawSortPass::Primitive, ShaderId,
+            static_cast<uint32>(Scene.GetPrimitiveType(Proxy)), 0, DepthBucket), Index, 0 });
+    }
+    RadixSortDrawItems(SortItems, SortScratch);
+
+    // 2) 같은 버퍼 / 래스터라이저 상태의 인덱스 프리미티브끼리 인스턴스 묶음 생성 (월드 행렬과 색은 인스턴스 데이터로)
+    if (Context.bInstancing && InstancedVS && InstancedPS && InstancedDepthVS)
+    {
+        Grouper.Build(SortItems, MinInstancesPerDraw, MaxInstancesPerDraw,
+            [&](const FDrawSortItem& InA, const FDrawSortItem& InB)
+            {
+                const uint32 ProxyA = Primitives[InA.Index];
+                const uint32 ProxyB = Primitives[InB.Index];
+                if (!Scene.IsIndexed(ProxyA) || !Scene.IsIndexed(ProxyB)) { return false; }
+                if (Scene.GetVertexBuffer(ProxyA) != Scene.GetVertexBuffer(ProxyB)
+                    || Scene.GetIndexBuffer(ProxyA) != Scene.GetIndexBuffer(ProxyB)
+                    || Scene.GetNumIndices(ProxyA) != Scene.GetNumIndices(ProxyB)) { return false; }
+                if (bWireframe) { return true; }
+
+                const FRenderState& StateA = Scene.GetRenderState(ProxyA);
+                const FRenderState& StateB = Scene.GetRenderState(ProxyB);
+                return StateA.CullMode == StateB.CullMode && StateA.FillMode == StateB.FillMode;
+            });
+    }
+    else
+    {
+        Grouper.BuildSingles(static_cast<uint32>(SortItems.size()));
+    }
+
+    // 3) 단일 드로우를 먼저 그리고 인스턴스 묶음은 인스턴스 셰이더로 바꿔서 그림. 바뀐 래스터라이저 상태 / 버퍼만 기록
+    FDrawSortStats Stats;
+    ID3D11RasterizerState* CurrentRasterizerState = nullptr;
+    ID3D11Buffer* CurrentVertexBuffer = nullptr;
+    ID3D11Buffer* CurrentIndexBuffer = nullptr;
+    const TArray<uint32>& InstanceItems = Grouper.GetInstanceItems();
+    for (const bool bInstancedPhase : { false, true })
+    {
+        if (bInstancedPhase)
         {
-           Pipeline->SetIndexBuffer(PrimitiveComponent->GetIndexBuffer(), 0);
-           Pipeline->DrawIndexed(PrimitiveComponent->GetNumIndices(), 0, 0);
+            if (Grouper.GetInstancedGroupCount() == 0) { break; }
+            if (Context.ViewMode == EViewModeIndex::VMI_SceneDepth)
+            {
+                PipelineInfo.VertexShader = InstancedDepthVS;
+            }
+            else
+            {
+                PipelineInfo.VertexShader = InstancedVS;
+                PipelineInfo.PixelShader = InstancedPS;
+            }
+            CurrentRasterizerState = nullptr;
+            CommandList.SetTexture(InstanceBufferSlot, true, InstanceSRV);
         }
-        else
+
+        for (const FInstanceGroup& Group : Grouper.GetGroups())
         {
-           Pipeline->Draw(PrimitiveComponent->GetNumVertices(), 0);
+            if (Group.IsInstanced() != bInstancedPhase) { continue; }
+
+            const uint32 Proxy = Primitives[SortItems[InstanceItems[Group.FirstInstance]].Index];
+            if (!bWireframe)
+            {
+                DefaultState = Scene.GetRenderState(Proxy);
+            }
+
+            ID3D11RasterizerState* RasterizerState = FRenderResourceFactory::GetRasterizerState(DefaultState);
+            if (CurrentRasterizerState != RasterizerState)
+            {
+                PipelineInfo.RasterizerState = RasterizerState;
+                CommandList.UpdatePipeline(PipelineInfo);
+                CurrentRasterizerState = RasterizerState;
+                ++Stats.PipelineChanges;
+            }
+
+            if (!bInstancedPhase)
+            {
+                CommandList.UpdateConstantBuffer(ConstantBufferModel, Scene.GetWorldMatrix(Proxy));
+                CommandList.UpdateConstantBuffer(ConstantBufferColor, Scene.GetColor(Proxy));
+                Stats.ConstantBufferUpdates += 2;
+            }
+
+            if (ID3D11Buffer* VertexBuffer = Scene.GetVertexBuffer(Proxy); CurrentVertexBuffer != VertexBuffer)
+            {
+                CommandList.SetVertexBuffer(VertexBuffer, sizeof(FNormalVertex));
+                CurrentVertexBuffer = VertexBuffer;
+                ++Stats.BufferBinds;
+            }
+
+            if (Scene.IsIndexed(Proxy))
+            {
+               if (CurrentIndexBuffer != Scene.GetIndexBuffer(Proxy))
+               {
+                  CommandList.SetIndexBuffer(Scene.GetIndexBuffer(Proxy), Scene.GetIndexStride(Proxy));
+                  CurrentIndexBuffer = Scene.GetIndexBuffer(Proxy);
+                  ++Stats.BufferBinds;
+               }
+
+               if (bInstancedPhase)
+               {
+                  // 커맨드 버퍼 안은 8바이트 정렬이므로 memcpy로 씀
+                  uint8* InstanceData = static_cast<uint8*>(CommandList.AllocateBufferUpdate(InstanceBuffer, Group.InstanceCount * sizeof(FInstanceData)));
+                  for (uint32 Instance = 0; Instance < Group.InstanceCount; ++Instance)
+                  {
+                     const uint32 InstanceProxy = Primitives[SortItems[InstanceItems[Group.FirstInstance + Instance]].Index];
+                     const FInstanceData Data = { Scene.GetWorldMatrix(InstanceProxy), Scene.GetColor(InstanceProxy) };
+                     memcpy(InstanceData + Instance * sizeof(FInstanceData), &Data, sizeof(FInstanceData));
+                  }
+                  CommandList.DrawIndexedInstanced(Scene.GetNumIndices(Proxy), Group.InstanceCount, 0, 0);
+                  ++Stats.InstancedDraws;
+                  Stats.Instances += Group.InstanceCount;
+               }
+               else
+               {
+                  CommandList.DrawIndexed(Scene.GetNumIndices(Proxy), 0, 0);
+               }
+            }
+            else
+            {
+               CommandList.Draw(Scene.GetNumVertices(Proxy), 0);
+            }
+            ++Stats.DrawCalls;
         }
     }
+
+    UStatOverlay::GetInstance().RecordDrawSortStats(EDrawSortPass::Primitive, static_cast<uint32>(SortItems.size()), Stats);
 }
 
 void FPrimitivePass::Release()
 {
     SafeRelease(ConstantBufferColor);
+    SafeRelease(InstanceSRV);
+    SafeRelease(InstanceBuffer);
 }
@@ -2,32 +2,36 @@
 #include "Render/RenderPass/Public/StaticMeshPass.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Render/Renderer/Public/Pipeline.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
+#include "Render/Renderer/Public/RenderScene.h"
+#include "Render/UI/Overlay/Public/StatOverlay.h"
+#include "Editor/Public/Camera.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Texture/Public/Texture.h"
 #include "Texture/Public/TextureRenderProxy.h"
 
 FStaticMeshPass::FStaticMeshPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11Buffer* InConstantBufferModel,
 	ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS,
-	ID3D11VertexShader* InDepthVS, ID3D11PixelShader* InDepthPS, ID3D11InputLayout* InDepthLayout)
+	ID3D11VertexShader* InDepthVS, ID3D11PixelShader* InDepthPS, ID3D11InputLayout* InDepthLayout,
+	ID3D11VertexShader* InInstancedVS, ID3D11VertexShader* InInstancedDepthVS)
 	: FRenderPass(InPipeline, InConstantBufferViewProj, InConstantBufferModel), VS(InVS), PS(InPS), InputLayout(InLayout), DS(InDS),
-	  DepthVS(InDepthVS), DepthPS(InDepthPS), DepthInputLayout(InDepthLayout)
+	  DepthVS(InDepthVS), DepthPS(InDepthPS), DepthInputLayout(InDepthLayout), InstancedVS(InInstancedVS), InstancedDepthVS(InInstancedDepthVS)
 {
 	ConstantBufferMaterial = FRenderResourceFactory::CreateConstantBuffer<FMaterialConstants>();
+	InstanceBuffer = FRenderResourceFactory::CreateStructuredBuffer(sizeof(FInstanceData), MaxInstancesPerDraw, &InstanceSRV);
 }
 
-void FStaticMeshPass::Execute(FRenderingContext& Context)
+void FStaticMeshPass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
 	if (!(Context.ShowFlags & EEngineShowFlags::SF_StaticMesh)) {	return; }
-	TArray<UStaticMeshComponent*>& MeshComponents = Context.StaticMeshes;
-	sort(MeshComponents.begin(), MeshComponents.end(),
-		[](UStaticMeshComponent* A, UStaticMeshComponent* B) {
-			int32 MeshA = A->GetStaticMesh() ? A->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			int32 MeshB = B->GetStaticMesh() ? B->GetStaticMesh()->GetAssetPathFileName().GetComparisonIndex() : 0;
-			return MeshA < MeshB;
-		});
+	TIME_PROFILE(StaticMeshPass);
+	const FRenderScene& Scene = *Context.Scene;
+	const TArray<uint32>& MeshProxies = Context.StaticMeshProxies;
 
 	FStaticMesh* CurrentMeshAsset = nullptr;
 	UMaterial* CurrentMaterial = nullptr;
+	int32 CurrentProxy = -1;
+	FDrawSortStats Stats;
 	FRenderState RenderState = UStaticMeshComponent::GetClassDefaultRenderState();
 	if (Context.ViewMode == EViewModeIndex::VMI_Wireframe)
 	{
@@ -48,91 +52,217 @@ void FStaticMeshPass::Execute(FRenderingContext& Context)
 	}
 
 	FPipelineInfo PipelineInfo = { SelectedLayout, SelectedVS, RS, DS, SelectedPS, nullptr };
-	Pipeline->UpdatePipeline(PipelineInfo);
+	CommandList.UpdatePipeline(PipelineInfo);
+	++Stats.PipelineChanges;
+	CommandList.SetConstantBuffer(0, true, ConstantBufferModel);
 
-	for (UStaticMeshComponent* MeshComp : MeshComponents) 
+	const FVector ViewOrigin = Context.CurrentCamera ? Context.CurrentCamera->GetLocation() : FVector();
+
+	// 1) 한 번의 선형 순회로 (컴포넌트, 섹션)마다 정렬 키 생성 (LOD 선택도 여기서 한 번만)
+	SortItems.clear();
+	LODIndices.resize(MeshProxies.size());
+	for (uint32 Index = 0; Index < static_cast<uint32>(MeshProxies.size()); ++Index)
 	{
-		if (!MeshComp->GetStaticMesh()) { continue; }
-		FStaticMesh* MeshAsset = MeshComp->GetStaticMesh()->GetStaticMeshAsset();
+		const uint32 Proxy = MeshProxies[Index];
+		UStaticMesh* StaticMesh = Scene.GetStaticMesh(Proxy);
+		if (!StaticMesh) { continue; }
+		FStaticMesh* MeshAsset = StaticMesh->GetStaticMeshAsset();
 		if (!MeshAsset) { continue; }
 
-		if (CurrentMeshAsset != MeshAsset)
-		{
-			Pipeline->SetVertexBuffer(MeshComp->GetVertexBuffer(), sizeof(FNormalVertex));
-			Pipeline->SetIndexBuffer(MeshComp->GetIndexBuffer(), 0);
-			CurrentMeshAsset = MeshAsset;
-		}
-		
-		FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, MeshComp->GetWorldTransformMatrix());
-		Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
+		// LOD는 같은 인덱스 버퍼 안에서 시작 위치만 다름
+		const int32 LODIndex = UStaticMeshComponent::SelectLODForBounds(*MeshAsset, Scene.GetBoundsMin(Proxy), Scene.GetBoundsMax(Proxy),
+			ViewOrigin, Context.ViewProjConstants->Projection);
+		LODIndices[Index] = LODIndex;
 
-		if (MeshAsset->MaterialInfo.empty() || MeshComp->GetStaticMesh()->GetNumMaterials() == 0)
+		const uint16 DepthBucket = FDrawSortKey::QuantizeDepth((Scene.GetWorldLocation(Proxy) - ViewOrigin).Length());
+		const uint32 MeshId = StaticMesh->GetUUID();
+
+		if (MeshAsset->MaterialInfo.empty() || StaticMesh->GetNumMaterials() == 0)
 		{
-			Pipeline->DrawIndexed(static_cast<uint32>(MeshAsset->Indices.size()), 0, 0);
+			SortItems.push_back({ FDrawSortKey::Make(EDrawSortPass::StaticMesh, 0, MeshId, 0, DepthBucket), Index, NoMaterialSection });
 			continue;
 		}
 
-		if (MeshComp->IsScrollEnabled()) 
+		// 스크롤 시간은 매 프레임 바뀌므로 프록시에 복사하지 않고 컴포넌트에 둠
+		if (Scene.IsScrollEnabled(Proxy))
 		{
+			UStaticMeshComponent* MeshComp = static_cast<UStaticMeshComponent*>(Scene.GetComponent(Proxy));
 			MeshComp->SetElapsedTime(MeshComp->GetElapsedTime() + UTimeManager::GetInstance().GetDeltaTime());
 		}
 
-		for (const FMeshSection& Section : MeshAsset->Sections)
+		const TArray<FMeshSection>& Sections = LODIndex > 0 ? MeshAsset->LODs[LODIndex - 1].Sections : MeshAsset->Sections;
+		for (uint32 SectionIndex = 0; SectionIndex < static_cast<uint32>(Sections.size()); ++SectionIndex)
 		{
-			UMaterial* Material = MeshComp->GetMaterial(Section.MaterialSlot);
-			if (CurrentMaterial != Material) {
-				FMaterialConstants MaterialConstants = {};
-				FVector AmbientColor = Material->GetAmbientColor(); MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
-				FVector DiffuseColor = Material->GetDiffuseColor(); MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
-				FVector SpecularColor = Material->GetSpecularColor(); MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
-				MaterialConstants.Ns = Material->GetSpecularExponent();
-				MaterialConstants.Ni = Material->GetRefractionIndex();
-				MaterialConstants.D = Material->GetDissolveFactor();
-				MaterialConstants.MaterialFlags = 0;
-				MaterialConstants.Time = MeshComp->GetElapsedTime();
-
-				FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferMaterial, MaterialConstants);
-				Pipeline->SetConstantBuffer(2, false, ConstantBufferMaterial);
-
-				if (UTexture* DiffuseTexture = Material->GetDiffuseTexture())
-				{
-					if(auto* Proxy = DiffuseTexture->GetRenderProxy())
+			UMaterial* Material = Scene.GetMaterial(Proxy, Sections[SectionIndex].MaterialSlot);
+			const uint32 MaterialId = Material ? Material->GetUUID() : 0;
+			SortItems.push_back({ FDrawSortKey::Make(EDrawSortPass::StaticMesh, 0, MeshId, MaterialId, DepthBucket), Index, SectionIndex });
+		}
+	}
+
+	// 2) 메시 -> 머티리얼 -> 가까운 순으로 정렬
+	RadixSortDrawItems(SortItems, SortScratch);
+
+	// 3) 같은 메시 / 섹션 / LOD / 머티리얼끼리 인스턴스 묶음 생성 (스크롤 머티리얼은 컴포넌트마다 시간이 달라 제외)
+	auto GetSections = [&](const FStaticMesh* InMeshAsset, uint32 InIndex) -> const TArray<FMeshSection>&
+	{
+		const int32 LODIndex = LODIndices[InIndex];
+		return LODIndex > 0 ? InMeshAsset->LODs[LODIndex - 1].Sections : InMeshAsset->Sections;
+	};
+
+	if (Context.bInstancing && InstancedVS && InstancedDepthVS)
+	{
+		Grouper.Build(SortItems, MinInstancesPerDraw, MaxInstancesPerDraw,
+			[&](const FDrawSortItem& InA, const FDrawSortItem& InB)
+			{
+				const uint32 ProxyA = MeshProxies[InA.Index];
+				const uint32 ProxyB = MeshProxies[InB.Index];
+				if (InA.SubIndex != InB.SubIndex || LODIndices[InA.Index] != LODIndices[InB.Index]) { return false; }
+				if (Scene.GetStaticMesh(ProxyA) != Scene.GetStaticMesh(ProxyB)) { return false; }
+				if (InA.SubIndex == NoMaterialSection) { return true; }
+				if (Scene.IsScrollEnabled(ProxyA) || Scene.IsScrollEnabled(ProxyB)) { return false; }
+
+				const uint32 MaterialSlot = GetSections(Scene.GetStaticMesh(ProxyA)->GetStaticMeshAsset(), InA.Index)[InA.SubIndex].MaterialSlot;
+				return Scene.GetMaterial(ProxyA, MaterialSlot) == Scene.GetMaterial(ProxyB, MaterialSlot);
+			});
+	}
+	else
+	{
+		Grouper.BuildSingles(static_cast<uint32>(SortItems.size()));
+	}
+
+	// 4) 단일 드로우를 키 순서대로 먼저 그리고, 인스턴스 묶음은 인스턴스 셰이더로 바꿔 한 번씩 그림 (파이프라인 전환은 최대 한 번)
+	const TArray<uint32>& InstanceItems = Grouper.GetInstanceItems();
+	for (const bool bInstancedPhase : { false, true })
+	{
+		if (bInstancedPhase)
+		{
+			if (Grouper.GetInstancedGroupCount() == 0) { break; }
+			PipelineInfo.VertexShader = Context.ViewMode == EViewModeIndex::VMI_SceneDepth ? InstancedDepthVS : InstancedVS;
+			CommandList.UpdatePipeline(PipelineInfo);
+			CommandList.SetTexture(InstanceBufferSlot, true, InstanceSRV);
+			++Stats.PipelineChanges;
+		}
+
+		for (const FInstanceGroup& Group : Grouper.GetGroups())
+		{
+			if (Group.IsInstanced() != bInstancedPhase) { continue; }
+
+			const FDrawSortItem& Item = SortItems[InstanceItems[Group.FirstInstance]];
+			const uint32 Proxy = MeshProxies[Item.Index];
+			FStaticMesh* MeshAsset = Scene.GetStaticMesh(Proxy)->GetStaticMeshAsset();
+
+			if (CurrentMeshAsset != MeshAsset)
+			{
+				CommandList.SetVertexBuffer(Scene.GetVertexBuffer(Proxy), sizeof(FNormalVertex));
+				CommandList.SetIndexBuffer(Scene.GetIndexBuffer(Proxy), Scene.GetIndexStride(Proxy));
+				CurrentMeshAsset = MeshAsset;
+				Stats.BufferBinds += 2;
+			}
+
+			// 같은 컴포넌트의 섹션이 머티리얼 순서로 떨어져 있을 수 있으므로 프록시가 바뀔 때만 월드 행렬 갱신
+			if (!bInstancedPhase && CurrentProxy != static_cast<int32>(Proxy))
+			{
+				CommandList.UpdateConstantBuffer(ConstantBufferModel, Scene.GetWorldMatrix(Proxy));
+				CurrentProxy = static_cast<int32>(Proxy);
+				++Stats.ConstantBufferUpdates;
+			}
+
+			const int32 LODIndex = LODIndices[Item.Index];
+			const FStaticMeshLOD* LOD = LODIndex > 0 ? &MeshAsset->LODs[LODIndex - 1] : nullptr;
+			const uint32 FirstIndex = LOD ? LOD->FirstIndex : 0;
+
+			uint32 IndexCount = static_cast<uint32>(LOD ? LOD->Indices.size() : MeshAsset->Indices.size());
+			uint32 StartIndex = FirstIndex;
+			if (Item.SubIndex != NoMaterialSection)
+			{
+				const FMeshSection& Section = GetSections(MeshAsset, Item.Index)[Item.SubIndex];
+				IndexCount = Section.IndexCount;
+				StartIndex = FirstIndex + Section.StartIndex;
+
+				UMaterial* Material = Scene.GetMaterial(Proxy, Section.MaterialSlot);
+				if (Material && CurrentMaterial != Material) {
+					FMaterialConstants MaterialConstants = {};
+					FVector AmbientColor = Material->GetAmbientColor(); MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
+					FVector DiffuseColor = Material->GetDiffuseColor(); MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
+					FVector SpecularColor = Material->GetSpecularColor(); MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
+					MaterialConstants.Ns = Material->GetSpecularExponent();
+					MaterialConstants.Ni = Material->GetRefractionIndex();
+					MaterialConstants.D = Material->GetDissolveFactor();
+					MaterialConstants.MaterialFlags = 0;
+					MaterialConstants.Time = Scene.IsScrollEnabled(Proxy)
+						? static_cast<UStaticMeshComponent*>(Scene.GetComponent(Proxy))->GetElapsedTime() : 0.0f;
+
+					CommandList.UpdateConstantBuffer(ConstantBufferMaterial, MaterialConstants);
+					CommandList.SetConstantBuffer(2, false, ConstantBufferMaterial);
+					++Stats.MaterialBinds;
+
+					if (UTexture* DiffuseTexture = Material->GetDiffuseTexture())
 					{
-						Pipeline->SetTexture(0, false, Proxy->GetSRV());
-						Pipeline->SetSamplerState(0, false, Proxy->GetSampler());
+						if(auto* Proxy = DiffuseTexture->GetRenderProxy())
+						{
+							CommandList.SetTexture(0, false, Proxy->GetSRV());
+							CommandList.SetSamplerState(0, false, Proxy->GetSampler());
+							Stats.TextureBinds += 2;
+						}
 					}
-				}
-				if (UTexture* AmbientTexture = Material->GetAmbientTexture())
-				{
-					if(auto* Proxy = AmbientTexture->GetRenderProxy())
+					if (UTexture* AmbientTexture = Material->GetAmbientTexture())
 					{
-						Pipeline->SetTexture(1, false, Proxy->GetSRV());
+						if(auto* Proxy = AmbientTexture->GetRenderProxy())
+						{
+							CommandList.SetTexture(1, false, Proxy->GetSRV());
+							++Stats.TextureBinds;
+						}
 					}
-				}
-				if (UTexture* SpecularTexture = Material->GetSpecularTexture())
-				{
-					if(auto* Proxy = SpecularTexture->GetRenderProxy())
+					if (UTexture* SpecularTexture = Material->GetSpecularTexture())
 					{
-						Pipeline->SetTexture(2, false, Proxy->GetSRV());
+						if(auto* Proxy = SpecularTexture->GetRenderProxy())
+						{
+							CommandList.SetTexture(2, false, Proxy->GetSRV());
+							++Stats.TextureBinds;
+						}
 					}
-				}
-				if (UTexture* AlphaTexture = Material->GetAlphaTexture())
-				{
-					if(auto* Proxy = AlphaTexture->GetRenderProxy())
+					if (UTexture* AlphaTexture = Material->GetAlphaTexture())
 					{
-						Pipeline->SetTexture(4, false, Proxy->GetSRV());
+						if(auto* Proxy = AlphaTexture->GetRenderProxy())
+						{
+							CommandList.SetTexture(4, false, Proxy->GetSRV());
+							++Stats.TextureBinds;
+						}
 					}
+			
+					CurrentMaterial = Material;
 				}
-				
-				CurrentMaterial = Material;
 			}
-			Pipeline->DrawIndexed(Section.IndexCount, Section.StartIndex, 0);
+
+			if (bInstancedPhase)
+			{
+				// 묶음의 월드 행렬을 인스턴스 버퍼로 올림 (커맨드 버퍼 안은 8바이트 정렬이므로 memcpy로 씀)
+				uint8* InstanceData = static_cast<uint8*>(CommandList.AllocateBufferUpdate(InstanceBuffer, Group.InstanceCount * sizeof(FInstanceData)));
+				for (uint32 Instance = 0; Instance < Group.InstanceCount; ++Instance)
+				{
+					const uint32 InstanceProxy = MeshProxies[SortItems[InstanceItems[Group.FirstInstance + Instance]].Index];
+					const FInstanceData Data = { Scene.GetWorldMatrix(InstanceProxy), FVector4(1.0f, 1.0f, 1.0f, 1.0f) };
+					memcpy(InstanceData + Instance * sizeof(FInstanceData), &Data, sizeof(FInstanceData));
+				}
+				CommandList.DrawIndexedInstanced(IndexCount, Group.InstanceCount, StartIndex, 0);
+				++Stats.InstancedDraws;
+				Stats.Instances += Group.InstanceCount;
+			}
+			else
+			{
+				CommandList.DrawIndexed(IndexCount, StartIndex, 0);
+			}
+			++Stats.DrawCalls;
 		}
 	}
-	Pipeline->SetConstantBuffer(2, false, nullptr);
+	CommandList.SetConstantBuffer(2, false, nullptr);
+
+	UStatOverlay::GetInstance().RecordDrawSortStats(EDrawSortPass::StaticMesh, static_cast<uint32>(SortItems.size()), Stats);
 }
 
 void FStaticMeshPass::Release()
 {
 	SafeRelease(ConstantBufferMaterial);
+	SafeRelease(InstanceSRV);
+	SafeRelease(InstanceBuffer);
 }
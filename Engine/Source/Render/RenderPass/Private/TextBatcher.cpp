@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "Render/RenderPass/Public/TextBatcher.h"
+
+static_assert(offsetof(UFontRenderer::FFontVertex, TexCoord) == sizeof(float) * 3, "위치 다음에 바로 TexCoord가 와야 함");
+
+namespace
+{
+	// 위치는 4개 float로 한 번에 쓰고(넘친 한 칸은 TexCoord.X), 바로 뒤에 TexCoord / CharIndex로 덮어씀
+	inline void WriteVertex(UFontRenderer::FFontVertex& OutVertex, __m128 InPosition, float InU, float InV, uint32 InCharIndex)
+	{
+		_mm_storeu_ps(&OutVertex.Position.X, InPosition);
+		OutVertex.TexCoord.X = InU;
+		OutVertex.TexCoord.Y = InV;
+		OutVertex.CharIndex = InCharIndex;
+	}
+}
+
+void FTextBatcher::LayoutText(const FString& InText, const FMatrix& InWorld, UFontRenderer::FFontVertex* OutVertices)
+{
+	const uint32 GlyphCount = static_cast<uint32>(InText.size());
+	if (GlyphCount == 0) { return; }
+
+	// 로컬 (0, Y, Z, 1)의 월드 위치 = Y * Row1 + Z * Row2 + Row3
+	const __m128 GlyphStep = InWorld.V[1];
+	const __m128 HalfHeight = _mm_mul_ps(InWorld.V[2], _mm_set1_ps(0.5f));
+	const __m128 Start = _mm_add_ps(_mm_mul_ps(GlyphStep, _mm_set1_ps(-0.5f * static_cast<float>(GlyphCount))), InWorld.V[3]);
+	const __m128 StartTop = _mm_add_ps(Start, HalfHeight);
+	const __m128 StartBottom = _mm_sub_ps(Start, HalfHeight);
+
+	for (uint32 Index = 0; Index < GlyphCount; ++Index)
+	{
+		// 누적 덧셈 대신 Index를 곱해서 긴 문자열도 오차가 쌓이지 않게 함
+		const __m128 LeftOffset = _mm_mul_ps(GlyphStep, _mm_set1_ps(static_cast<float>(Index)));
+		const __m128 TopLeft = _mm_add_ps(StartTop, LeftOffset);
+		const __m128 BottomLeft = _mm_add_ps(StartBottom, LeftOffset);
+		const __m128 TopRight = _mm_add_ps(TopLeft, GlyphStep);
+		const __m128 BottomRight = _mm_add_ps(BottomLeft, GlyphStep);
+		const uint32 CharIndex = static_cast<uint8>(InText[Index]);
+
+		UFontRenderer::FFontVertex* Glyph = OutVertices + Index * VerticesPerGlyph;
+		WriteVertex(Glyph[0], TopLeft, 0.0f, 0.0f, CharIndex);
+		WriteVertex(Glyph[1], TopRight, 1.0f, 0.0f, CharIndex);
+		WriteVertex(Glyph[2], BottomLeft, 0.0f, 1.0f, CharIndex);
+		WriteVertex(Glyph[3], TopRight, 1.0f, 0.0f, CharIndex);
+		WriteVertex(Glyph[4], BottomRight, 1.0f, 1.0f, CharIndex);
+		WriteVertex(Glyph[5], BottomLeft, 0.0f, 1.0f, CharIndex);
+	}
+}
+
+uint32 FTextBatcher::Reserve(uint64 InFrameNumber, uint32 InVertexCount, bool& bOutGrown)
+{
+	bOutGrown = false;
+	if (StreamFrameNumber != InFrameNumber)
+	{
+		StreamFrameNumber = InFrameNumber;
+		Cursor = 0;
+	}
+
+	if (static_cast<uint64>(Cursor) + InVertexCount > Capacity)
+	{
+		// 새 버퍼는 비어 있으므로 처음부터 씀 (이전 버퍼에 쓴 앞쪽 뷰포트의 드로우는 이미 제출됨)
+		const uint64 Needed = static_cast<uint64>(Cursor) + InVertexCount;
+		uint64 NewCapacity = std::max<uint64>(Capacity, 1);
+		while (NewCapacity < Needed)
+		{
+			NewCapacity *= 2;
+		}
+		Capacity = static_cast<uint32>(NewCapacity);
+		Cursor = 0;
+		bOutGrown = true;
+	}
+
+	const uint32 First = Cursor;
+	Cursor += InVertexCount;
+	return First;
+}
+
+namespace
+{
+	/**
+	 * @brief 기존 TextPass::RenderTextInternal의 글자별 로컬 배치 (월드 변환은 셰이더가 하던 것을 스칼라로 계산)
+	 */
+	void LayoutTextPerCharacter(const FString& InText, const FMatrix& InWorld, TArray<UFontRenderer::FFontVertex>& OutVertices)
+	{
+		auto ToWorld = [&InWorld](const FVector& InLocal)
+		{
+			const float Local[4] = { InLocal.X, InLocal.Y, InLocal.Z, 1.0f };
+			float World[3] = {};
+			for (int32 Column = 0; Column < 3; ++Column)
+			{
+				for (int32 Row = 0; Row < 4; ++Row)
+				{
+					World[Column] += Local[Row] * InWorld.Data[Row][Column];
+				}
+			}
+			return FVector(World[0], World[1], World[2]);
+		};
+
+		OutVertices.clear();
+		const size_t TextLength = InText.length();
+		const float CurrentY = 0.0f - (TextLength * 1.0f) / 2.0f;
+
+		for (size_t Index = 0; Index < TextLength; ++Index)
+		{
+			const uint32 AsciiCode = static_cast<uint32>(InText[Index]);
+			const float Y = CurrentY + Index * 1.0f;
+			const float Z = -0.5f;
+			const float CharHeight = 1.0f;
+
+			const FVector P0 = ToWorld(FVector(0.0f, Y, Z + CharHeight));
+			const FVector P1 = ToWorld(FVector(0.0f, Y + 1.0f, Z + CharHeight));
+			const FVector P2 = ToWorld(FVector(0.0f, Y, Z));
+			const FVector P3 = ToWorld(FVector(0.0f, Y + 1.0f, Z));
+
+			OutVertices.push_back({ P0, FVector2(0.0f, 0.0f), AsciiCode });
+			OutVertices.push_back({ P1, FVector2(1.0f, 0.0f), AsciiCode });
+			OutVertices.push_back({ P2, FVector2(0.0f, 1.0f), AsciiCode });
+			OutVertices.push_back({ P1, FVector2(1.0f, 0.0f), AsciiCode });
+			OutVertices.push_back({ P3, FVector2(1.0f, 1.0f), AsciiCode });
+			OutVertices.push_back({ P2, FVector2(0.0f, 1.0f), AsciiCode });
+		}
+	}
+}
+
+FTextLayoutCheckResult RunTextLayoutCheck()
+{
+	FTextLayoutCheckResult Result;
+
+	FString PrintableAscii;
+	for (char Character = ' '; Character <= '~'; ++Character)
+	{
+		PrintableAscii.push_back(Character);
+	}
+
+	// 기존 배치는 줄바꿈을 따로 처리하지 않고 한 글자로 취급했으므로 여러 줄 문자열도 같은 결과여야 함
+	const FString Texts[] =
+	{
+		"",
+		"A",
+		"UID: 12345",
+		"Hello, World!",
+		PrintableAscii,
+		"Line 1\nLine 2\r\nLine 3",
+		"\n\n",
+	};
+
+	const FMatrix Worlds[] =
+	{
+		FMatrix::Identity(),
+		FMatrix::GetModelMatrix(FVector(10.0f, -20.0f, 5.0f), FVector(15.0f, 30.0f, 45.0f), FVector(0.5f, 2.0f, 1.5f)),
+		FMatrix::GetModelMatrix(FVector(-1000.0f, 250.0f, 4000.0f), FVector(0.0f, 90.0f, 180.0f), FVector(3.0f, 3.0f, 3.0f)),
+	};
+
+	// 쓰지 않아야 할 곳을 확인하기 위한 표식
+	constexpr uint32 Sentinel = 0xDEADBEEF;
+	TArray<UFontRenderer::FFontVertex> Expected;
+	TArray<UFontRenderer::FFontVertex> Actual;
+
+	for (const FString& Text : Texts)
+	{
+		for (const FMatrix& World : Worlds)
+		{
+			LayoutTextPerCharacter(Text, World, Expected);
+
+			const uint32 VertexCount = FTextBatcher::GetVertexCount(Text);
+			Actual.assign(VertexCount + 1, UFontRenderer::FFontVertex{});
+			Actual.back().CharIndex = Sentinel;
+			FTextBatcher::LayoutText(Text, World, Actual.data());
+
+			bool bMatches = VertexCount == Expected.size() && Actual.back().CharIndex == Sentinel;
+			for (size_t Index = 0; bMatches && Index < Expected.size(); ++Index)
+			{
+				const UFontRenderer::FFontVertex& A = Actual[Index];
+				const UFontRenderer::FFontVertex& E = Expected[Index];
+
+				// 곱셈 순서가 달라 생기는 반올림 차이만 허용 (좌표 크기에 비례)
+				const float Errors[3] = { std::abs(A.Position.X - E.Position.X), std::abs(A.Position.Y - E.Position.Y),
+					std::abs(A.Position.Z - E.Position.Z) };
+				const float Magnitudes[3] = { std::abs(E.Position.X), std::abs(E.Position.Y), std::abs(E.Position.Z) };
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					Result.MaxPositionError = std::max(Result.MaxPositionError, Errors[Axis]);
+					bMatches &= Errors[Axis] <= 1e-4f * (1.0f + Magnitudes[Axis]);
+				}
+
+				bMatches &= A.TexCoord.X == E.TexCoord.X && A.TexCoord.Y == E.TexCoord.Y && A.CharIndex == E.CharIndex;
+			}
+
+			++Result.CaseCount;
+			Result.GlyphCount += static_cast<uint32>(Text.size());
+			if (!bMatches)
+			{
+				++Result.MismatchCount;
+				UE_LOG_ERROR("TextLayoutCheck: \"%s\" (%zu glyphs) does not match the per-character layout", Text.c_str(), Text.size());
+			}
+		}
+	}
+
+	return Result;
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Render/RenderPass/Public/TextPass.h"
 #include "Render/Renderer/Public/Pipeline.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Component/Public/TextComponent.h"
 #include "Component/Public/UUIDTextComponent.h"
@@ -29,12 +30,7 @@ FTextPass::FTextPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewPr
     FontSampler = FRenderResourceFactory::CreateSamplerState(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_CLAMP);
 
     // Create dynamic vertex buffer
-    D3D11_BUFFER_DESC BufferDesc = {};
-    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    BufferDesc.ByteWidth = sizeof(UFontRenderer::FFontVertex) * MAX_FONT_VERTICES;
-    BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-    URenderer::GetInstance().GetDevice()->CreateBuffer(&BufferDesc, nullptr, &DynamicVertexBuffer);
+    CreateDynamicVertexBuffer(Batcher.GetCapacity());
 
     // Create constant buffer
     FontDataConstantBuffer = FRenderResourceFactory::CreateConstantBuffer<UFontRenderer::FFontConstantBuffer>();
@@ -45,9 +41,47 @@ FTextPass::FTextPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewPr
     FontAtlasTexture = TextureComPtr.Get();
 }
 
-void FTextPass::Execute(FRenderingContext& Context)
+void FTextPass::Execute(FRenderingContext& Context, FRenderCommandList& CommandList)
 {
     if (!(Context.ShowFlags & EEngineShowFlags::SF_Text)) { return; }
+    TIME_PROFILE(TextPass);
+
+    // 그릴 문자열과 월드 행렬을 먼저 모아 전체 정점 수를 구함
+    TextItems.clear();
+    uint32 VertexCount = 0;
+    for (UTextComponent* Text : Context.Texts)
+    {
+        const FString& String = Text->GetText();
+        if (String.empty()) { continue; }
+        TextItems.push_back({ &String, Text->GetWorldTransformMatrix() });
+        VertexCount += FTextBatcher::GetVertexCount(String);
+    }
+
+    // Render UUID
+    FString UUIDString;
+    if (Context.ShowFlags & EEngineShowFlags::SF_Billboard)
+    {
+        if (UUUIDTextComponent* PickedBillboard = GEditor->GetEditorModule()->GetPickedBillboard())
+        {
+            PickedBillboard->UpdateRotationMatrix(Context.CurrentCamera->GetLocation());
+            UUIDString = "UID: " + std::to_string(PickedBillboard->GetUUID());
+            TextItems.push_back({ &UUIDString, PickedBillboard->GetRTMatrix() });
+            VertexCount += FTextBatcher::GetVertexCount(UUIDString);
+        }
+    }
+
+    if (VertexCount == 0) { return; }
+
+    bool bGrown = false;
+    const uint32 FirstVertex = Batcher.Reserve(Context.FrameNumber, VertexCount, bGrown);
+    if (bGrown)
+    {
+        // 앞 뷰포트의 리스트가 아직 이전 스트림을 그리므로 바로 해제하지 않음
+        CommandList.ReleaseAfterExecute(DynamicVertexBuffer);
+        DynamicVertexBuffer = nullptr;
+        CreateDynamicVertexBuffer(Batcher.GetCapacity());
+    }
+    if (!DynamicVertexBuffer) { return; }
 
     // Select shaders based on ViewMode
     ID3D11VertexShader* SelectedVS = FontVertexShader;
@@ -73,89 +107,41 @@ void FTextPass::Execute(FRenderingContext& Context)
     }
     PipelineInfo.BlendState = URenderer::GetInstance().GetAlphaBlendState();
     PipelineInfo.DepthStencilState = URenderer::GetInstance().GetDefaultDepthStencilState(); // Or DisabledDepthStencilState based on a flag
-    Pipeline->UpdatePipeline(PipelineInfo);
+    CommandList.UpdatePipeline(PipelineInfo);
 
     // Set constant buffers
-    Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
-    FRenderResourceFactory::UpdateConstantBufferData(FontDataConstantBuffer, ConstantBufferData);
-    Pipeline->SetConstantBuffer(2, true, FontDataConstantBuffer);
+    CommandList.SetConstantBuffer(1, true, ConstantBufferViewProj);
+    CommandList.UpdateConstantBuffer(FontDataConstantBuffer, ConstantBufferData);
+    CommandList.SetConstantBuffer(2, true, FontDataConstantBuffer);
 
     // Bind resources
-    Pipeline->SetTexture(0, false, FontAtlasTexture);
-    Pipeline->SetSamplerState(0, false, FontSampler);
-
-    for (UTextComponent* Text : Context.Texts)
+    CommandList.SetTexture(0, false, FontAtlasTexture);
+    CommandList.SetSamplerState(0, false, FontSampler);
+
+    // 모든 글자를 월드 공간으로 펼쳐 스트림에 이어 쓰고 한 번에 그림 (정점은 커맨드 버퍼에 바로 씀)
+    constexpr uint32 VertexStride = sizeof(UFontRenderer::FFontVertex);
+    UFontRenderer::FFontVertex* Vertices = static_cast<UFontRenderer::FFontVertex*>(
+        CommandList.AllocateBufferAppend(DynamicVertexBuffer, FirstVertex * VertexStride, VertexCount * VertexStride));
+    for (const FTextItem& Item : TextItems)
     {
-        RenderTextInternal(Text->GetText(), Text->GetWorldTransformMatrix());
+        FTextBatcher::LayoutText(*Item.Text, Item.World, Vertices);
+        Vertices += FTextBatcher::GetVertexCount(*Item.Text);
     }
 
-    // Render UUID
-    if (!(Context.ShowFlags & EEngineShowFlags::SF_Billboard)) { return; }
-
-    if (UUUIDTextComponent* PickedBillboard = GEditor->GetEditorModule()->GetPickedBillboard())
-    {
-        PickedBillboard->UpdateRotationMatrix(Context.CurrentCamera->GetLocation());
-        FString UUIDString = "UID: " + std::to_string(PickedBillboard->GetUUID());
-        RenderTextInternal(UUIDString, PickedBillboard->GetRTMatrix());
-    }
+    CommandList.UpdateConstantBuffer(ConstantBufferModel, FMatrix::Identity());
+    CommandList.SetConstantBuffer(0, true, ConstantBufferModel);
+    CommandList.SetVertexBuffer(DynamicVertexBuffer, VertexStride);
+    CommandList.Draw(VertexCount, FirstVertex);
 }
 
-void FTextPass::RenderTextInternal(const FString& Text, const FMatrix& WorldMatrix)
+void FTextPass::CreateDynamicVertexBuffer(uint32 InVertexCapacity)
 {
-    if (Text.empty()) return;
-
-    ID3D11DeviceContext* DeviceContext = URenderer::GetInstance().GetDeviceContext();
-
-    size_t TextLength = Text.length();
-    uint32 VertexCount = static_cast<uint32>(TextLength * 6);
-
-    if (VertexCount > MAX_FONT_VERTICES)
-    {
-        // Log warning
-        return;
-    }
-
-    // Update vertex buffer
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    if (SUCCEEDED(DeviceContext->Map(DynamicVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
-    {
-        UFontRenderer::FFontVertex* Vertices = static_cast<UFontRenderer::FFontVertex*>(mappedResource.pData);
-        float currentY = 0.0f - (TextLength * 1.0f) / 2.0f; // Assuming char width of 1.0f
-
-        for (size_t i = 0; i < TextLength; ++i)
-        {
-            char ch = Text[i];
-            uint32 asciiCode = static_cast<uint32>(ch);
-
-            // Simplified vertex generation, assuming fixed size
-            float y = currentY + i * 1.0f;
-            float z = -0.5f;
-            float charHeight = 1.0f;
-
-            FVector p0(0.0f, y, z + charHeight);
-            FVector p1(0.0f, y + 1.0f, z + charHeight);
-            FVector p2(0.0f, y, z);
-            FVector p3(0.0f, y + 1.0f, z);
-
-            Vertices[i * 6 + 0] = { p0, FVector2(0.0f, 0.0f), asciiCode };
-            Vertices[i * 6 + 1] = { p1, FVector2(1.0f, 0.0f), asciiCode };
-            Vertices[i * 6 + 2] = { p2, FVector2(0.0f, 1.0f), asciiCode };
-            Vertices[i * 6 + 3] = { p1, FVector2(1.0f, 0.0f), asciiCode };
-            Vertices[i * 6 + 4] = { p3, FVector2(1.0f, 1.0f), asciiCode };
-            Vertices[i * 6 + 5] = { p2, FVector2(0.0f, 1.0f), asciiCode };
-        }
-        DeviceContext->Unmap(DynamicVertexBuffer, 0);
-    }
-
-    // Update model constant buffer
-    FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferModel, WorldMatrix);
-    Pipeline->SetConstantBuffer(0, true, ConstantBufferModel);
-
-    // Set vertex buffer
-    Pipeline->SetVertexBuffer(DynamicVertexBuffer, sizeof(UFontRenderer::FFontVertex));
-
-    // Draw
-    Pipeline->Draw(VertexCount, 0);
+    D3D11_BUFFER_DESC BufferDesc = {};
+    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    BufferDesc.ByteWidth = sizeof(UFontRenderer::FFontVertex) * InVertexCapacity;
+    BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    URenderer::GetInstance().GetDevice()->CreateBuffer(&BufferDesc, nullptr, &DynamicVertexBuffer);
 }
 
 void FTextPass::Release()
@@ -1,12 +1,13 @@
 ﻿#pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
+#include "Render/RenderPass/Public/DrawSortKey.h"
 
 class FBillboardPass : public FRenderPass
 {
 public:
     FBillboardPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11Buffer* InConstantBufferModel,
         ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS);
-    void Execute(FRenderingContext& Context) override;
+    void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) override;
     void Release() override;
 
 private:
@@ -16,4 +17,8 @@ private:
     ID3D11DepthStencilState* DS = nullptr;
     
     ID3D11Buffer* ConstantBufferColor = nullptr;
+
+    // 프레임마다 재사용하는 정렬 버퍼
+    TArray<FDrawSortItem> SortItems;
+    TArray<FDrawSortItem> SortScratch;
 };
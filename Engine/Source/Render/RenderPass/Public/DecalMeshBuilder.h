@@ -0,0 +1,60 @@
+#pragma once
+
+struct FOBB;
+struct FStaticMesh;
+class ULevel;
+
+/**
+ * @brief Decal-Receiver 쌍마다 Decal 박스에 걸치는 삼각형만 골라 인덱스 리스트를 만드는 CPU 빌더
+ * 메시 로컬 좌표를 Decal 박스 공간([-1, 1]^3)으로 옮긴 뒤, 메시 FBVH로 후보 삼각형을 좁히고
+ * 삼각형-박스 SAT로 정확히 판정. 결과 인덱스는 원래 인덱스 버퍼의 삼각형 순서를 유지
+ * 렌더 리소스에 의존하지 않으므로 BruteForce 결과와 그대로 비교 가능
+ */
+class FDecalMeshBuilder
+{
+public:
+	/**
+	 * @brief 월드 -> Decal 박스 공간 변환 행렬
+	 * 메시 로컬 -> Decal 박스 공간은 Receiver 월드 행렬 * 이 행렬 (Decal마다 한 번만 계산)
+	 * @param InDecalOBB: 월드 공간 Decal OBB
+	 */
+	static FMatrix MakeWorldToDecalBox(const FOBB& InDecalOBB);
+
+	/**
+	 * @brief 박스 공간 삼각형이 [-1, 1]^3 박스와 겹치는지 판정 (13축 SAT)
+	 */
+	static bool TriangleOverlapsUnitBox(const FVector& InV0, const FVector& InV1, const FVector& InV2);
+
+	/**
+	 * @brief 메시 BVH를 사용해 Decal 박스와 겹치는 삼각형의 인덱스 리스트 생성
+	 * BVH가 비어 있으면 BruteForce로 대체
+	 * @return 선택된 삼각형 수
+	 */
+	static uint32 BuildClippedIndices(const FStaticMesh& InMesh, const FMatrix& InLocalToDecalBox, TArray<uint32>& OutIndices);
+
+	/**
+	 * @brief 모든 삼각형을 검사해서 Decal 박스와 겹치는 삼각형의 인덱스 리스트 생성
+	 * 기본 도형처럼 BVH가 없는 Receiver와 검증용
+	 * @return 선택된 삼각형 수
+	 */
+	static uint32 BuildClippedIndicesBruteForce(const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+		const FMatrix& InLocalToDecalBox, TArray<uint32>& OutIndices);
+};
+
+/**
+ * @brief BVH 클리핑 / BruteForce 클리핑 비교 결과
+ */
+struct FDecalClipCheckResult
+{
+	uint32 PairCount = 0;
+	uint32 MismatchCount = 0;
+	uint64 SelectedTriangles = 0;
+	uint64 SourceTriangles = 0;
+	double BVHMilliseconds = 0.0;
+	double BruteForceMilliseconds = 0.0;
+};
+
+/**
+ * @brief 레벨의 모든 Decal-StaticMesh Receiver 쌍에 대해 BVH로 고른 삼각형 집합이 BruteForce와 같은지 검사
+ */
+FDecalClipCheckResult RunDecalClipCheck(ULevel* InLevel);
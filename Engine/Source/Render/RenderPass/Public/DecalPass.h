@@ -1,6 +1,8 @@
 #pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
 
+class FRenderCommandList;
+
 // Matches the layout in DecalShader.hlsl
 struct FModelConstants
 {
@@ -20,6 +22,19 @@ struct FDecalConstants
     float Padding3;
 };
 
+/**
+ * Decal-Receiver 쌍마다 Decal 박스에 걸치는 삼각형만 담은 인덱스 버퍼
+ * LocalToDecalBox와 원본 인덱스 배열이 그대로면 (Decal, Receiver 모두 움직이지 않았으면) 재사용
+ */
+struct FDecalClipCacheEntry
+{
+    FMatrix LocalToDecalBox;
+    const TArray<uint32>* SourceIndices = nullptr;
+    ID3D11Buffer* IndexBuffer = nullptr;
+    uint32 NumIndices = 0;
+    uint64 LastUsedFrame = 0;
+};
+
 class FDecalPass : public FRenderPass
 {
 public:
@@ -29,11 +44,28 @@ public:
         ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, 
         ID3D11DepthStencilState* InDS_Read, ID3D11BlendState* InBlendState, bool bInIsAdditive
     );
-    void Execute(FRenderingContext& Context) override;
-    void DrawDecalReceiver(UPrimitiveComponent* Prim);
+    void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) override;
+    // 레벨의 Receiver 캐시와 Decal 통계를 두 DecalPass가 같이 씀
+    ERenderPassRecording GetRecordingMode() const override { return ERenderPassRecording::Shared; }
     void Release() override;
 
 private:
+    /**
+     * @brief Receiver에서 Decal 박스에 걸치는 삼각형만 그림 (인덱스 버퍼가 없는 Receiver는 전체)
+     * @return 드로우 콜을 보냈는지 여부
+     */
+    bool DrawDecalReceiver(FRenderCommandList& CommandList, UDecalComponent* Decal, const FMatrix& WorldToDecalBox, UPrimitiveComponent* Prim);
+
+    /**
+     * @brief 쌍의 클리핑 인덱스 버퍼를 가져오고, Decal이나 Receiver가 움직였으면 다시 생성
+     */
+    const FDecalClipCacheEntry& GetClippedIndices(FRenderCommandList& CommandList, UDecalComponent* Decal, const FMatrix& WorldToDecalBox, UPrimitiveComponent* Prim);
+
+    // 이번 프레임에 쓰이지 않은 쌍(보이지 않게 된 Decal, 삭제된 Receiver)의 인덱스 버퍼 해제
+    // 기록 중(Execute)에는 InCommandList를 재생한 뒤 해제, Release에서는 nullptr로 바로 해제
+    void PruneClipCache(FRenderCommandList& CommandList);
+    void ReleaseClipCache(FRenderCommandList* InCommandList);
+
     bool bIsAdditivePass = false;
     ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
@@ -43,4 +75,12 @@ private:
 
     ID3D11Buffer* ConstantBufferDecal = nullptr;
     ID3D11Buffer* ConstantBufferPrim = nullptr;
+
+    TMap<UDecalComponent*, TMap<UPrimitiveComponent*, FDecalClipCacheEntry>> ClipCache;
+    uint64 ClipFrame = 0;
+
+    // 이번 Execute의 클리핑 통계
+    uint32 ClippedTriangles = 0;
+    uint32 SourceTriangles = 0;
+    uint32 ClipRebuilds = 0;
 };
@@ -0,0 +1,106 @@
+#pragma once
+
+/**
+ * @brief 정렬 키를 쓰는 패스 (키 최상위 비트, 패스 사이의 순서)
+ */
+enum class EDrawSortPass : uint8
+{
+	StaticMesh,
+	Primitive,
+	Billboard,
+
+	Count
+};
+
+/**
+ * @brief 64비트 드로우 정렬 키
+ * 상위 비트부터 [Pass 4][Shader 4][Mesh 20][Material 20][Depth 16]
+ * 상태 변경 비용이 큰 것부터 묶이도록 배치했으므로 키 오름차순으로 그리면 같은 셰이더 / 메시 / 머티리얼이 연속됨
+ * Mesh / Material은 UUID 등 안정적인 ID의 하위 비트만 쓰므로 충돌해도 묶음이 덜 될 뿐 결과는 같음
+ */
+struct FDrawSortKey
+{
+	static constexpr uint32 PassBits = 4;
+	static constexpr uint32 ShaderBits = 4;
+	static constexpr uint32 MeshBits = 20;
+	static constexpr uint32 MaterialBits = 20;
+	static constexpr uint32 DepthBits = 16;
+	static_assert(PassBits + ShaderBits + MeshBits + MaterialBits + DepthBits == 64, "Draw sort key must fill 64 bits");
+
+	static constexpr uint32 DepthShift = 0;
+	static constexpr uint32 MaterialShift = DepthShift + DepthBits;
+	static constexpr uint32 MeshShift = MaterialShift + MaterialBits;
+	static constexpr uint32 ShaderShift = MeshShift + MeshBits;
+	static constexpr uint32 PassShift = ShaderShift + ShaderBits;
+
+	static uint64 Make(EDrawSortPass InPass, uint32 InShader, uint32 InMesh, uint32 InMaterial, uint16 InDepthBucket)
+	{
+		return (static_cast<uint64>(InPass) & Mask(PassBits)) << PassShift
+			| (static_cast<uint64>(InShader) & Mask(ShaderBits)) << ShaderShift
+			| (static_cast<uint64>(InMesh) & Mask(MeshBits)) << MeshShift
+			| (static_cast<uint64>(InMaterial) & Mask(MaterialBits)) << MaterialShift
+			| static_cast<uint64>(InDepthBucket) << DepthShift;
+	}
+
+	/**
+	 * @brief 카메라 거리를 16비트 버킷으로 양자화 (가까울수록 작음, 앞에서 뒤로 그릴 때 사용)
+	 * 양수 float의 비트 패턴은 값과 같은 순서이므로 상위 16비트(지수 + 가수 상위 7비트)만 사용 -> 거리에 대해 로그 스케일
+	 */
+	static uint16 QuantizeDepth(float InDistance)
+	{
+		if (!(InDistance > 0.0f)) { return 0; }
+		uint32 Bits;
+		memcpy(&Bits, &InDistance, sizeof(Bits));
+		return static_cast<uint16>(Bits >> 16);
+	}
+
+	// 뒤에서 앞으로 그려야 하는 경우
+	static uint16 QuantizeDepthBackToFront(float InDistance) { return static_cast<uint16>(0xFFFF - QuantizeDepth(InDistance)); }
+
+private:
+	static constexpr uint64 Mask(uint32 InBits) { return (1ULL << InBits) - 1; }
+};
+
+/**
+ * @brief 정렬 대상 하나 (키 + 패스가 해석하는 인덱스)
+ */
+struct FDrawSortItem
+{
+	uint64 Key;
+	uint32 Index;		// Context 배열 인덱스
+	uint32 SubIndex;	// 섹션 등 패스별 보조 인덱스
+};
+
+/**
+ * @brief 키 기준 LSD radix sort (8비트 자릿수 8회, 모든 항목이 같은 자릿수는 건너뜀)
+ * 안정 정렬이므로 키가 같으면 입력 순서 유지. 결과는 InOutItems에 남고 InScratch는 작업 버퍼로 재사용
+ */
+void RadixSortDrawItems(TArray<FDrawSortItem>& InOutItems, TArray<FDrawSortItem>& InScratch);
+
+/**
+ * @brief 정렬된 순서로 그리면서 센 상태 변경 / 바인딩 수 (Stat Draw 오버레이로 표시)
+ */
+struct FDrawSortStats
+{
+	uint32 DrawCalls = 0;
+	uint32 InstancedDraws = 0;		// DrawCalls 중 인스턴스 드로우
+	uint32 Instances = 0;			// 인스턴스 드로우로 그린 인스턴스 수
+	uint32 PipelineChanges = 0;		// UpdatePipeline 기록 수
+	uint32 BufferBinds = 0;			// 정점 / 인덱스 버퍼
+	uint32 MaterialBinds = 0;		// 머티리얼 상수 버퍼 갱신
+	uint32 TextureBinds = 0;		// SRV / 샘플러
+	uint32 ConstantBufferUpdates = 0;
+
+	FDrawSortStats& operator+=(const FDrawSortStats& InOther)
+	{
+		DrawCalls += InOther.DrawCalls;
+		InstancedDraws += InOther.InstancedDraws;
+		Instances += InOther.Instances;
+		PipelineChanges += InOther.PipelineChanges;
+		BufferBinds += InOther.BufferBinds;
+		MaterialBinds += InOther.MaterialBinds;
+		TextureBinds += InOther.TextureBinds;
+		ConstantBufferUpdates += InOther.ConstantBufferUpdates;
+		return *this;
+	}
+};
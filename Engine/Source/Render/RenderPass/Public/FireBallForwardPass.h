@@ -20,7 +20,7 @@ public:
         ID3D11DepthStencilState* InDepthReadState,
         ID3D11BlendState* InAdditiveBlendState);
 
-    void Execute(FRenderingContext& Context) override;
+    void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) override;
     void Release() override;
 
 private:
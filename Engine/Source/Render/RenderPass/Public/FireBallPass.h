@@ -29,7 +29,8 @@ public:
         ID3D11DepthStencilState* InDepthReadState,
         ID3D11BlendState* InAdditiveBlendState);
 
-    void Execute(FRenderingContext& Context) override;
+    void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) override;
+    ERenderPassRecording GetRecordingMode() const override { return ERenderPassRecording::Immediate; }
     void Release() override;
 
 private:
@@ -0,0 +1,107 @@
+#pragma once
+#include "Render/RenderPass/Public/DrawSortKey.h"
+
+/**
+ * @brief 인스턴스 드로우 한 번에 올리는 인스턴스 데이터 (셰이더의 FInstanceData, t8 StructuredBuffer와 같은 배치)
+ */
+struct FInstanceData
+{
+	FMatrix World;
+	FVector4 Color;		// Primitive만 사용
+};
+
+/**
+ * @brief 한 번에 그릴 드로우 묶음
+ * InstanceCount가 1이면 기존 경로로 그리고, 2 이상이면 인스턴스 드로우 한 번으로 그림
+ */
+struct FInstanceGroup
+{
+	uint32 FirstInstance;	// FInstanceGrouper::GetInstanceItems() 안의 시작 위치
+	uint32 InstanceCount;
+
+	bool IsInstanced() const { return InstanceCount > 1; }
+};
+
+/**
+ * @brief 정렬된 드로우 항목을 인스턴스 드로우 묶음으로 나누는 CPU 단계 (렌더 리소스에 의존하지 않음)
+ *
+ * 정렬 키에서 깊이를 뺀 부분(패스 / 셰이더 / 메시 / 머티리얼)이 같은 연속 구간 안에서만 묶음을 찾으므로 전체가 선형에 가깝고,
+ * 구간 안에서는 CanBatch(대표 항목, 항목)로 정확히 같은 드로우인지 (섹션, LOD 등) 다시 확인함
+ * ID 하위 비트가 충돌해 다른 메시가 한 구간에 섞여도 CanBatch에서 갈라지므로 결과는 항상 올바름
+ *
+ * 묶음 크기가 InMinInstances보다 작으면 항목마다 InstanceCount 1인 묶음으로 내보내고,
+ * InMaxInstances(인스턴스 버퍼 크기)보다 크면 나눠서 내보냄. 묶음 순서는 구간 안에서 처음 나온 순서
+ */
+class FInstanceGrouper
+{
+public:
+	template<typename TCanBatch>
+	void Build(const TArray<FDrawSortItem>& InSortedItems, uint32 InMinInstances, uint32 InMaxInstances, TCanBatch&& CanBatch)
+	{
+		Reset();
+		InMinInstances = std::max(InMinInstances, 2u);
+		InMaxInstances = std::max(InMaxInstances, 1u);
+
+		const uint32 ItemCount = static_cast<uint32>(InSortedItems.size());
+		uint32 RunBegin = 0;
+		while (RunBegin < ItemCount)
+		{
+			// 1) 깊이를 제외한 키가 같은 구간
+			const uint64 RunKey = InSortedItems[RunBegin].Key >> FDrawSortKey::MaterialShift;
+			uint32 RunEnd = RunBegin + 1;
+			while (RunEnd < ItemCount && (InSortedItems[RunEnd].Key >> FDrawSortKey::MaterialShift) == RunKey)
+			{
+				++RunEnd;
+			}
+
+			// 2) 구간 안에서 같이 그릴 수 있는 항목끼리 버킷 번호 부여 (버킷 수는 섹션 x LOD 정도로 작음)
+			//    묶을 수 없는 항목이 많아도 선형에 가깝도록 앞쪽 MaxSearchBuckets개 버킷만 비교
+			Representatives.clear();
+			BucketOf.resize(RunEnd - RunBegin);
+			for (uint32 Index = RunBegin; Index < RunEnd; ++Index)
+			{
+				const uint32 SearchCount = std::min(static_cast<uint32>(Representatives.size()), MaxSearchBuckets);
+				uint32 Bucket = 0;
+				while (Bucket < SearchCount && !CanBatch(InSortedItems[Representatives[Bucket]], InSortedItems[Index]))
+				{
+					++Bucket;
+				}
+				if (Bucket == SearchCount)
+				{
+					Bucket = static_cast<uint32>(Representatives.size());
+					Representatives.push_back(Index);
+				}
+				BucketOf[Index - RunBegin] = Bucket;
+			}
+
+			// 3) 버킷 순서대로 항목을 모아 묶음 생성 (카운팅 정렬이므로 버킷 안에서는 정렬 순서 유지)
+			ScatterRun(RunBegin, RunEnd, InMinInstances, InMaxInstances);
+
+			RunBegin = RunEnd;
+		}
+	}
+
+	// 인스턴싱을 끈 경우: 정렬 순서 그대로 항목마다 InstanceCount 1인 묶음
+	void BuildSingles(uint32 InItemCount);
+	void Reset();
+
+	const TArray<FInstanceGroup>& GetGroups() const { return Groups; }
+	// 묶음 순서로 나열한 정렬 항목 인덱스
+	const TArray<uint32>& GetInstanceItems() const { return InstanceItems; }
+
+	uint32 GetInstancedGroupCount() const;
+
+private:
+	static constexpr uint32 MaxSearchBuckets = 32;
+
+	void ScatterRun(uint32 InRunBegin, uint32 InRunEnd, uint32 InMinInstances, uint32 InMaxInstances);
+	void EmitGroups(uint32 InFirst, uint32 InCount, uint32 InMinInstances, uint32 InMaxInstances);
+
+	TArray<FInstanceGroup> Groups;
+	TArray<uint32> InstanceItems;
+
+	// 작업용 (프레임마다 재사용)
+	TArray<uint32> Representatives;
+	TArray<uint32> BucketOf;
+	TArray<uint32> BucketOffsets;
+};
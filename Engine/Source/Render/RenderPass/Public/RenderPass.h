@@ -2,6 +2,17 @@
 #include "Render/RenderPass/Public/RenderingContext.h"
 
 class UPipeline;
+class FRenderCommandList;
+
+/**
+ * @brief 뷰포트 / 패스별 커맨드 기록을 워커 스레드에서 할 수 있는지 (URenderer가 작업을 나눌 때 사용)
+ */
+enum class ERenderPassRecording : uint8
+{
+    Parallel,   // 패스 자신의 상태만 바꾸므로 다른 패스와 동시에 기록 가능
+    Shared,     // 레벨 캐시 등 패스 밖의 상태를 바꿈: Shared 패스끼리는 한 작업에서 패스 순서대로 기록
+    Immediate,  // 즉시 컨텍스트에 직접 그림: 제출 단계에서 메인 스레드가 실행
+};
 
 /**
  * @brief 특정 Primitive Type별로 달라지는 RenderPass를 관리하고 실행하도록 하는 기본 인터페이스
@@ -16,9 +27,12 @@ public:
 
     /**
      * @brief 프레임마다 실행할 렌더 함수
-     * @param Context 프레임 렌더링에 필요한 모든 정보를 담고 있는 객체
+     * @param Context 프레임 렌더링에 필요한 모든 정보를 담고 있는 객체 (같은 뷰의 다른 패스와 동시에 읽힐 수 있음)
+     * @param CommandList 이 패스가 드로우 / 상태 변경을 기록할 곳 (뷰 / 패스마다 따로 있음)
      */
-    virtual void Execute(FRenderingContext& Context) = 0;
+    virtual void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) = 0;
+
+    virtual ERenderPassRecording GetRecordingMode() const { return ERenderPassRecording::Parallel; }
 
     /**
      * @brief 생성한 객체들 해제
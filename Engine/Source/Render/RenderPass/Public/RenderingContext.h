@@ -2,21 +2,32 @@
 
 struct FRenderingContext
 {
+    // URenderer가 뷰포트마다 하나씩 두고 프레임마다 다시 채움 (배열 용량 재사용)
+    FRenderingContext() = default;
     FRenderingContext(const FViewProjConstants* InViewProj, class UCamera* InCurrentCamera, EViewModeIndex InViewMode, uint64 InShowFlags)
         : ViewProjConstants(InViewProj), CurrentCamera(InCurrentCamera), ViewMode(InViewMode), ShowFlags(InShowFlags) {}
     
-    const FViewProjConstants* ViewProjConstants;
-    UCamera* CurrentCamera;
-    EViewModeIndex ViewMode;
-    uint64 ShowFlags;
+    const FViewProjConstants* ViewProjConstants = nullptr;
+    UCamera* CurrentCamera = nullptr;
+    EViewModeIndex ViewMode = EViewModeIndex::VMI_Lit;
+    uint64 ShowFlags = 0;
+
+    // 같은 메시 / 머티리얼을 인스턴스 드로우로 묶을지 (URenderer::SetInstancingEnabled)
+    bool bInstancing = true;
+    // 같은 프레임의 뷰포트끼리 동적 스트림을 이어 쓰기 위한 프레임 번호
+    uint64 FrameNumber = 0;
+
+    // 레벨의 렌더 프록시 씬 (기록 중에는 읽기만 함)
+    const class FRenderScene* Scene = nullptr;
 
     TArray<class UPrimitiveComponent*> AllPrimitives;
+    // Render Proxies By Render Pass (Scene의 프록시 인덱스)
+    TArray<uint32> StaticMeshProxies;
+    TArray<uint32> PrimitiveProxies;
     // Components By Render Pass
-    TArray<class UStaticMeshComponent*> StaticMeshes;
     TArray<class UBillBoardComponent*> BillBoards;
 	TArray<class UTextComponent*> Texts;
 	TArray<class UDecalComponent*> AlphaDecals;
 	TArray<class UDecalComponent*> AdditiveDecals;
-	TArray<class UPrimitiveComponent*> DefaultPrimitives;
     TArray<class UFireBallComponent*> FireBalls;
 };
@@ -1,13 +1,16 @@
 ﻿#pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
+#include "Render/RenderPass/Public/DrawSortKey.h"
+#include "Render/RenderPass/Public/InstanceGrouper.h"
 
 class FStaticMeshPass : public FRenderPass
 {
 public:
     FStaticMeshPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11Buffer* InConstantBufferModel,
         ID3D11VertexShader* InVS, ID3D11PixelShader* InPS, ID3D11InputLayout* InLayout, ID3D11DepthStencilState* InDS,
-        ID3D11VertexShader* InDepthVS, ID3D11PixelShader* InDepthPS, ID3D11InputLayout* InDepthLayout);
-    void Execute(FRenderingContext& Context) override;
+        ID3D11VertexShader* InDepthVS, ID3D11PixelShader* InDepthPS, ID3D11InputLayout* InDepthLayout,
+        ID3D11VertexShader* InInstancedVS, ID3D11VertexShader* InInstancedDepthVS);
+    void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) override;
     void Release() override;
 
 private:
@@ -22,4 +25,20 @@ private:
     ID3D11InputLayout* DepthInputLayout = nullptr;
 
     ID3D11Buffer* ConstantBufferMaterial = nullptr;
+
+    // 인스턴스 드로우 (INSTANCED로 컴파일한 VS, 입력 레이아웃은 기존 것을 그대로 씀)
+    static constexpr uint32 MinInstancesPerDraw = 2;
+    static constexpr uint32 MaxInstancesPerDraw = 1024;
+    static constexpr uint32 InstanceBufferSlot = 8;
+    ID3D11VertexShader* InstancedVS = nullptr;
+    ID3D11VertexShader* InstancedDepthVS = nullptr;
+    ID3D11Buffer* InstanceBuffer = nullptr;
+    ID3D11ShaderResourceView* InstanceSRV = nullptr;
+    FInstanceGrouper Grouper;
+
+    // 프레임마다 재사용하는 정렬 버퍼 (SubIndex는 섹션 인덱스, 머티리얼이 없는 메시는 NoMaterialSection)
+    static constexpr uint32 NoMaterialSection = 0xFFFFFFFF;
+    TArray<FDrawSortItem> SortItems;
+    TArray<FDrawSortItem> SortScratch;
+    TArray<int32> LODIndices;
 };
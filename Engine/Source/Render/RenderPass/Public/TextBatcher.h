@@ -0,0 +1,58 @@
+#pragma once
+#include "Render/FontRenderer/Public/FontRenderer.h"
+
+/**
+ * @brief 보이는 텍스트를 한 프레임짜리 글자 정점 스트림에 모아 적은 드로우로 그리기 위한 CPU 단계 (렌더 리소스에 의존하지 않음)
+ *
+ * 글자 쿼드는 CPU에서 바로 월드 공간으로 펼치므로 문자열마다 모델 상수 버퍼를 바꿀 필요가 없음
+ * 스트림은 프레임마다 처음부터 쓰고(DISCARD), 같은 프레임의 다음 뷰포트는 앞부분 뒤에 이어 씀(NO_OVERWRITE)
+ * 한 프레임에 필요한 정점이 용량을 넘으면 Reserve가 알려주고, 호출자가 GetCapacity() 크기로 버퍼를 다시 만듦
+ */
+class FTextBatcher
+{
+public:
+	static constexpr uint32 VerticesPerGlyph = 6;
+
+	explicit FTextBatcher(uint32 InInitialCapacity) : Capacity(InInitialCapacity) {}
+
+	static uint32 GetVertexCount(const FString& InText) { return static_cast<uint32>(InText.size()) * VerticesPerGlyph; }
+
+	/**
+	 * @brief 문자열의 글자 쿼드를 InWorld로 변환한 정점으로 OutVertices에 씀 (GetVertexCount(InText)개)
+	 * 로컬 배치는 기존 TextPass와 같음: 글자마다 +Y로 1씩, 문자열 가운데가 원점, Z는 [-0.5, 0.5]
+	 * 모서리는 행렬 행 벡터의 선형 결합이므로 글자마다 분기 없이 SSE 곱셈 / 덧셈 몇 번으로 구함
+	 */
+	static void LayoutText(const FString& InText, const FMatrix& InWorld, UFontRenderer::FFontVertex* OutVertices);
+
+	/**
+	 * @brief 이번 프레임 스트림에서 InVertexCount개 정점 자리를 예약
+	 * @param bOutGrown: 용량이 늘었으면 true (호출자는 버퍼를 GetCapacity() 크기로 다시 만들어야 하고, 반환 위치는 0)
+	 * @return 버퍼 안의 시작 정점 위치
+	 */
+	uint32 Reserve(uint64 InFrameNumber, uint32 InVertexCount, bool& bOutGrown);
+
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 GetFrameVertexCount() const { return Cursor; }
+
+private:
+	uint32 Capacity;
+	uint32 Cursor = 0;
+	uint64 StreamFrameNumber = ~0ULL;
+};
+
+/**
+ * @brief FTextBatcher::LayoutText / 기존 글자별 배치 비교 결과
+ */
+struct FTextLayoutCheckResult
+{
+	uint32 CaseCount = 0;			// 문자열 x 월드 행렬 조합 수
+	uint32 GlyphCount = 0;
+	uint32 MismatchCount = 0;		// 정점 수, 위치, UV, 글자 인덱스 중 하나라도 다른 조합 수
+	float MaxPositionError = 0.0f;
+};
+
+/**
+ * @brief 디바이스 없이 ASCII / 여러 줄 / 빈 문자열을 여러 월드 행렬로 배치해
+ * LayoutText의 글자 쿼드가 기존 TextPass의 글자별 로컬 배치를 월드 행렬로 변환한 결과와 같은지 검사
+ */
+FTextLayoutCheckResult RunTextLayoutCheck();
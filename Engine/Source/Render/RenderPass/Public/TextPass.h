@@ -1,16 +1,18 @@
 #pragma once
 #include "Render/RenderPass/Public/RenderPass.h"
-#include "Render/FontRenderer/Public/FontRenderer.h"
+#include "Render/RenderPass/Public/TextBatcher.h"
+
+class FRenderCommandList;
 
 class FTextPass : public FRenderPass
 {
 public:
     FTextPass(UPipeline* InPipeline, ID3D11Buffer* InConstantBufferViewProj, ID3D11Buffer* InConstantBufferModel);
-    void Execute(FRenderingContext& Context) override;
+    void Execute(FRenderingContext& Context, FRenderCommandList& CommandList) override;
     void Release() override;
 
 private:
-    void RenderTextInternal(const FString& Text, const FMatrix& WorldMatrix);
+    void CreateDynamicVertexBuffer(uint32 InVertexCapacity);
 
     // Font rendering resources
     ID3D11VertexShader* FontVertexShader = nullptr;
@@ -27,5 +29,15 @@ private:
     ID3D11PixelShader* DepthPixelShader = nullptr;
     ID3D11InputLayout* DepthInputLayout = nullptr;
 
-    static constexpr uint32 MAX_FONT_VERTICES = 4096;
+    // 프레임 글자 스트림의 처음 용량 (넘으면 두 배씩 늘림)
+    static constexpr uint32 InitialFontVertices = 4096;
+    FTextBatcher Batcher{ InitialFontVertices };
+
+    // 이번 실행에서 펼칠 문자열 (프레임마다 재사용)
+    struct FTextItem
+    {
+        const FString* Text;
+        FMatrix World;
+    };
+    TArray<FTextItem> TextItems;
 };
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "Render/Renderer/Public/ConstantBufferRing.h"
+
+void FConstantBufferRing::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext, uint32 InCapacity)
+{
+	DeviceContext = InDeviceContext;
+
+	// 오프셋 바인딩과 상수 버퍼 NO_OVERWRITE Map이 모두 되어야 링을 쓸 수 있음
+	D3D11_FEATURE_DATA_D3D11_OPTIONS Options = {};
+	if (FAILED(InDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options)))
+		|| !Options.ConstantBufferOffsetting || !Options.MapNoOverwriteOnDynamicConstantBuffer)
+	{
+		UE_LOG("ConstantBufferRing: 상수 버퍼 오프셋 바인딩을 지원하지 않아 Map(DISCARD) 경로를 사용합니다");
+		return;
+	}
+
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = InCapacity;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	if (FAILED(InDevice->CreateBuffer(&Desc, nullptr, &RingBuffer)))
+	{
+		UE_LOG_ERROR("ConstantBufferRing: 링 버퍼 생성 실패 (%u bytes)", InCapacity);
+		return;
+	}
+
+	D3D11_QUERY_DESC QueryDesc = { D3D11_QUERY_EVENT, 0 };
+	for (ID3D11Query*& Query : FrameQueries)
+	{
+		if (FAILED(InDevice->CreateQuery(&QueryDesc, &Query)))
+		{
+			Release();
+			return;
+		}
+	}
+
+	Allocator.Initialize(InCapacity);
+	Stats.Capacity = InCapacity;
+}
+
+void FConstantBufferRing::Release()
+{
+	for (ID3D11Query*& Query : FrameQueries)
+	{
+		SafeRelease(Query);
+	}
+	SafeRelease(RingBuffer);
+}
+
+uint8* FConstantBufferRing::Map(uint32 InSize, uint32 InAlignment, uint32& OutOffset)
+{
+	if (!RingBuffer) { return nullptr; }
+
+	// 링보다 큰 요청은 DISCARD해도 들어가지 않으므로 펜스 기록을 버리기 전에 거절
+	if (InSize > Stats.Capacity)
+	{
+		++Stats.FallbackMaps;
+		return nullptr;
+	}
+
+	D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+	uint64 Offset = Allocator.Allocate(InSize, InAlignment);
+	if (Offset == FUploadRingAllocator::InvalidOffset || bNeedsDiscard)
+	{
+		// GPU가 링을 따라오지 못함: 버퍼를 DISCARD해서 드라이버가 새 메모리로 바꾸게 하고 처음부터 씀
+		// 이미 제출한 드로우는 드라이버가 이전 메모리를 유지하므로 안전
+		if (!bNeedsDiscard)
+		{
+			++Stats.Discards;
+		}
+		Allocator.Reset();
+		Offset = Allocator.Allocate(InSize, InAlignment);
+		MapType = D3D11_MAP_WRITE_DISCARD;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (Offset == FUploadRingAllocator::InvalidOffset || FAILED(DeviceContext->Map(RingBuffer, 0, MapType, 0, &Mapped)))
+	{
+		// Reset으로 진행 중인 프레임 기록을 버렸으면 다음 Map도 반드시 DISCARD해야 GPU가 읽는 상수를 덮어쓰지 않음
+		if (MapType == D3D11_MAP_WRITE_DISCARD)
+		{
+			bNeedsDiscard = true;
+		}
+		++Stats.FallbackMaps;
+		return nullptr;
+	}
+
+	bNeedsDiscard = false;
+	FrameBytes += InSize;
+	++FrameMaps;
+	OutOffset = static_cast<uint32>(Offset);
+	return static_cast<uint8*>(Mapped.pData) + Offset;
+}
+
+void FConstantBufferRing::Unmap()
+{
+	DeviceContext->Unmap(RingBuffer, 0);
+}
+
+void FConstantBufferRing::BeginFrame()
+{
+	if (!RingBuffer) { return; }
+
+	// 펜스는 순서대로 끝나므로 가장 큰 완료 값만 알면 됨
+	for (uint32 Index = 0; Index < MaxFramesInFlight; ++Index)
+	{
+		if (QueryFenceValues[Index] > CompletedFenceValue
+			&& DeviceContext->GetData(FrameQueries[Index], nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK)
+		{
+			CompletedFenceValue = QueryFenceValues[Index];
+		}
+	}
+	Allocator.Retire(CompletedFenceValue);
+
+	Stats.LastFrameBytes = FrameBytes;
+	Stats.PeakFrameBytes = std::max(Stats.PeakFrameBytes, FrameBytes);
+	Stats.LastFrameMaps = FrameMaps;
+	Stats.FramesInFlight = Allocator.GetFramesInFlight();
+	FrameBytes = 0;
+	FrameMaps = 0;
+}
+
+void FConstantBufferRing::EndFrame()
+{
+	if (!RingBuffer) { return; }
+
+	// 같은 쿼리를 다시 발행하면 이전 펜스는 버려지지만, 더 뒤의 펜스가 끝나면 이전 프레임도 끝난 것이므로 문제없음
+	const uint64 FenceValue = NextFenceValue++;
+	const uint32 Index = static_cast<uint32>(FenceValue % MaxFramesInFlight);
+	Allocator.EndFrame(FenceValue);
+	DeviceContext->End(FrameQueries[Index]);
+	QueryFenceValues[Index] = FenceValue;
+}
@@ -1,74 +1,138 @@
 #include "pch.h"
 #include "Render/Renderer/Public/Pipeline.h"
 
+#include <d3d11_1.h>
+
+namespace
+{
+	/**
+	 * @brief FPipelineStateCache가 걸러낸 바인딩을 D3D11 컨텍스트로 보내는 싱크
+	 */
+	struct FD3D11StateSink
+	{
+		ID3D11DeviceContext* DeviceContext;
+		ID3D11DeviceContext1* DeviceContext1;
+
+		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) { DeviceContext->IASetPrimitiveTopology(InTopology); }
+		void SetInputLayout(ID3D11InputLayout* InInputLayout) { DeviceContext->IASetInputLayout(InInputLayout); }
+		void SetVertexShader(ID3D11VertexShader* InVertexShader) { DeviceContext->VSSetShader(InVertexShader, nullptr, 0); }
+		void SetRasterizerState(ID3D11RasterizerState* InRasterizerState) { DeviceContext->RSSetState(InRasterizerState); }
+		void SetDepthStencilState(ID3D11DepthStencilState* InDepthStencilState) { DeviceContext->OMSetDepthStencilState(InDepthStencilState, 0); }
+		void SetPixelShader(ID3D11PixelShader* InPixelShader) { DeviceContext->PSSetShader(InPixelShader, nullptr, 0); }
+		void SetBlendState(ID3D11BlendState* InBlendState) { DeviceContext->OMSetBlendState(InBlendState, nullptr, 0xffffffff); }
+
+		void SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+		{
+			uint32 Offset = 0;
+			DeviceContext->IASetVertexBuffers(0, 1, &InBuffer, &InStride, &Offset);
+		}
+
+		void SetIndexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+		{
+			// stride가 2면 16비트 인덱스, 그 외(0 포함)는 32비트
+			DeviceContext->IASetIndexBuffer(InBuffer, InStride == sizeof(uint16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT, 0);
+		}
+
+		void SetConstantBuffers(EShaderStage InStage, uint32 InStartSlot, uint32 InCount, const FConstantBufferBinding* InBindings)
+		{
+			ID3D11Buffer* Buffers[FPipelineStateCache::MaxConstantBuffers];
+			uint32 FirstConstants[FPipelineStateCache::MaxConstantBuffers];
+			uint32 NumConstants[FPipelineStateCache::MaxConstantBuffers];
+			for (uint32 Index = 0; Index < InCount; ++Index)
+			{
+				Buffers[Index] = InBindings[Index].Buffer;
+				FirstConstants[Index] = InBindings[Index].FirstConstant;
+				NumConstants[Index] = InBindings[Index].NumConstants;
+			}
+
+			// 캐시는 전체 바인딩과 구간 바인딩을 한 호출에 섞지 않음
+			if (InBindings[0].IsRange())
+			{
+				if (InStage == EShaderStage::Vertex)
+					DeviceContext1->VSSetConstantBuffers1(InStartSlot, InCount, Buffers, FirstConstants, NumConstants);
+				else
+					DeviceContext1->PSSetConstantBuffers1(InStartSlot, InCount, Buffers, FirstConstants, NumConstants);
+			}
+			else
+			{
+				if (InStage == EShaderStage::Vertex)
+					DeviceContext->VSSetConstantBuffers(InStartSlot, InCount, Buffers);
+				else
+					DeviceContext->PSSetConstantBuffers(InStartSlot, InCount, Buffers);
+			}
+		}
+
+		void SetShaderResources(EShaderStage InStage, uint32 InStartSlot, uint32 InCount, ID3D11ShaderResourceView* const* InViews)
+		{
+			if (InStage == EShaderStage::Vertex)
+				DeviceContext->VSSetShaderResources(InStartSlot, InCount, InViews);
+			else
+				DeviceContext->PSSetShaderResources(InStartSlot, InCount, InViews);
+		}
+
+		void SetSamplers(EShaderStage InStage, uint32 InStartSlot, uint32 InCount, ID3D11SamplerState* const* InSamplers)
+		{
+			if (InStage == EShaderStage::Vertex)
+				DeviceContext->VSSetSamplers(InStartSlot, InCount, InSamplers);
+			else
+				DeviceContext->PSSetSamplers(InStartSlot, InCount, InSamplers);
+		}
+	};
+}
+
 /// @brief 그래픽 파이프라인을 관리하는 클래스
 UPipeline::UPipeline(ID3D11DeviceContext* InDeviceContext)
 	: DeviceContext(InDeviceContext)
 {
+	// 상수 버퍼 오프셋 바인딩용 (D3D11.1 런타임이 없으면 nullptr)
+	DeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DeviceContext1));
 }
 
 UPipeline::~UPipeline()
 {
 	// Device Context는 Device Resource에서 제거
+	SafeRelease(DeviceContext1);
 }
 
 
-/// @brief 파이프라인 상태를 업데이트
+/// @brief 파이프라인 상태를 업데이트 (바뀐 상태만 다음 드로우 직전에 반영)
 void UPipeline::UpdatePipeline(FPipelineInfo Info)
 {
-	if (LastPipelineInfo.Topology != Info.Topology) {
-		DeviceContext->IASetPrimitiveTopology(Info.Topology);
-		LastPipelineInfo.Topology = Info.Topology;
-	}
-	if (LastPipelineInfo.InputLayout != Info.InputLayout) {
-		DeviceContext->IASetInputLayout(Info.InputLayout);
-		LastPipelineInfo.InputLayout = Info.InputLayout;
-	}
-	if (LastPipelineInfo.VertexShader != Info.VertexShader) {
-		DeviceContext->VSSetShader(Info.VertexShader, nullptr, 0);
-		LastPipelineInfo.VertexShader = Info.VertexShader;
-	}
-	if (LastPipelineInfo.RasterizerState != Info.RasterizerState) {
-		DeviceContext->RSSetState(Info.RasterizerState);
-		LastPipelineInfo.RasterizerState = Info.RasterizerState;
-	}
-	if (Info.DepthStencilState) {
-		DeviceContext->OMSetDepthStencilState(Info.DepthStencilState, 0);
-	}
-	if (LastPipelineInfo.PixelShader != Info.PixelShader) {
-		DeviceContext->PSSetShader(Info.PixelShader, nullptr, 0);
-		LastPipelineInfo.PixelShader = Info.PixelShader;
-	}
-	if (LastPipelineInfo.BlendState != Info.BlendState) {
-		DeviceContext->OMSetBlendState(Info.BlendState, nullptr, 0xffffffff);
-		LastPipelineInfo.BlendState = Info.BlendState;
-	}
+	StateCache.SetPipeline(Info);
 }
 
 void UPipeline::SetIndexBuffer(ID3D11Buffer* indexBuffer, uint32 stride)
 {
-	DeviceContext->IASetIndexBuffer(indexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	StateCache.SetIndexBuffer(indexBuffer, stride);
 }
 
 /// @brief 정점 버퍼를 바인딩
 void UPipeline::SetVertexBuffer(ID3D11Buffer* VertexBuffer, uint32 Stride)
 {
-	uint32 Offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	StateCache.SetVertexBuffer(VertexBuffer, Stride);
 }
 
 /// @brief 상수 버퍼를 설정
 void UPipeline::SetConstantBuffer(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer)
 {
-	if (bIsVS)
-		DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
-	else
-		DeviceContext->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+	StateCache.SetConstantBuffer(bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, Slot, { ConstantBuffer, 0, 0 });
+}
+
+void UPipeline::SetConstantBufferRange(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer, uint32 FirstConstant, uint32 NumConstants)
+{
+	StateCache.SetConstantBuffer(bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, Slot, { ConstantBuffer, FirstConstant, NumConstants });
 }
 
 /// @brief 텍스처를 설정
 void UPipeline::SetTexture(uint32 Slot, bool bIsVS, ID3D11ShaderResourceView* Srv)
 {
+	if (Slot < FPipelineStateCache::MaxShaderResources)
+	{
+		StateCache.SetShaderResource(bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, Slot, Srv);
+		return;
+	}
+
+	// 캐시 범위 밖의 슬롯은 바로 보냄
 	if (bIsVS)
 		DeviceContext->VSSetShaderResources(Slot, 1, &Srv);
 	else
@@ -78,19 +142,36 @@ void UPipeline::SetTexture(uint32 Slot, bool bIsVS, ID3D11ShaderResourceView* Sr
 /// @brief 샘플러 상태를 설정
 void UPipeline::SetSamplerState(uint32 Slot, bool bIsVS, ID3D11SamplerState* SamplerState)
 {
-	if (bIsVS)
-		DeviceContext->VSSetSamplers(Slot, 1, &SamplerState);
-	else
-		DeviceContext->PSSetSamplers(Slot, 1, &SamplerState);
+	StateCache.SetSampler(bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, Slot, SamplerState);
+}
+
+void UPipeline::FlushBindings()
+{
+	FD3D11StateSink Sink = { DeviceContext, DeviceContext1 };
+	StateCache.Flush(Sink);
+}
+
+void UPipeline::InvalidateState()
+{
+	StateCache.Invalidate();
 }
 
 /// @brief 정점 개수를 기반으로 드로우 호출
 void UPipeline::Draw(uint32 VertexCount, uint32 StartLocation)
 {
+	FlushBindings();
 	DeviceContext->Draw(VertexCount, StartLocation);
 }
 
 void UPipeline::DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32 BaseVertexLocation)
 {
+	FlushBindings();
 	DeviceContext->DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
 }
+
+/// @brief 같은 메시를 InstanceCount번 그림 (인스턴스 데이터는 셰이더가 SV_InstanceID로 읽음)
+void UPipeline::DrawIndexedInstanced(uint32 IndexCountPerInstance, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation)
+{
+	FlushBindings();
+	DeviceContext->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, 0);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "Render/Renderer/Public/PipelineStateCache.h"
+#include "Render/Renderer/Public/Pipeline.h"
+
+void FPipelineStateCache::SetPipeline(const FPipelineInfo& InInfo)
+{
+	PendingPipeline.Topology = InInfo.Topology;
+	PendingPipeline.InputLayout = InInfo.InputLayout;
+	PendingPipeline.VertexShader = InInfo.VertexShader;
+	PendingPipeline.RasterizerState = InInfo.RasterizerState;
+	PendingPipeline.PixelShader = InInfo.PixelShader;
+	PendingPipeline.BlendState = InInfo.BlendState;
+	Stats.RequestedBinds += 6;
+
+	// nullptr은 "이전 깊이 스텐실 상태 유지"
+	if (InInfo.DepthStencilState)
+	{
+		PendingPipeline.DepthStencilState = InInfo.DepthStencilState;
+		bDepthStencilRequested = true;
+		++Stats.RequestedBinds;
+	}
+	bPipelineDirty = true;
+}
+
+void FPipelineStateCache::SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+{
+	PendingVertexBuffer = { InBuffer, InStride };
+	bVertexBufferDirty = true;
+	++Stats.RequestedBinds;
+}
+
+void FPipelineStateCache::SetIndexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+{
+	PendingIndexBuffer = { InBuffer, InStride };
+	bIndexBufferDirty = true;
+	++Stats.RequestedBinds;
+}
+
+void FPipelineStateCache::SetConstantBuffer(EShaderStage InStage, uint32 InSlot, const FConstantBufferBinding& InBinding)
+{
+	ConstantBuffers[static_cast<uint32>(InStage)].Set(InSlot, InBinding);
+	++Stats.RequestedBinds;
+}
+
+void FPipelineStateCache::SetShaderResource(EShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InShaderResourceView)
+{
+	ShaderResources[static_cast<uint32>(InStage)].Set(InSlot, InShaderResourceView);
+	++Stats.RequestedBinds;
+}
+
+void FPipelineStateCache::SetSampler(EShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSamplerState)
+{
+	Samplers[static_cast<uint32>(InStage)].Set(InSlot, InSamplerState);
+	++Stats.RequestedBinds;
+}
+
+/**
+ * @brief 디바이스에 올라간 값을 모르는 것으로 표시 (대기 중인 요청은 그대로 두고 다음 Flush에서 보냄)
+ */
+void FPipelineStateCache::Invalidate()
+{
+	CommittedPipeline.Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;		// 아무도 설정하지 않는 값
+	CommittedPipeline.InputLayout = UnknownObject<ID3D11InputLayout>();
+	CommittedPipeline.VertexShader = UnknownObject<ID3D11VertexShader>();
+	CommittedPipeline.RasterizerState = UnknownObject<ID3D11RasterizerState>();
+	CommittedPipeline.DepthStencilState = UnknownObject<ID3D11DepthStencilState>();
+	CommittedPipeline.PixelShader = UnknownObject<ID3D11PixelShader>();
+	CommittedPipeline.BlendState = UnknownObject<ID3D11BlendState>();
+
+	CommittedVertexBuffer = { UnknownObject<ID3D11Buffer>(), 0 };
+	CommittedIndexBuffer = { UnknownObject<ID3D11Buffer>(), 0 };
+
+	for (uint32 StageIndex = 0; StageIndex < static_cast<uint32>(EShaderStage::Count); ++StageIndex)
+	{
+		ConstantBuffers[StageIndex].Invalidate({ UnknownObject<ID3D11Buffer>(), 0, 0 });
+		ShaderResources[StageIndex].Invalidate(UnknownObject<ID3D11ShaderResourceView>());
+		Samplers[StageIndex].Invalidate(UnknownObject<ID3D11SamplerState>());
+	}
+}
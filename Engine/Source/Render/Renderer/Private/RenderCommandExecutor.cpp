@@ -0,0 +1,315 @@
+#include "pch.h"
+#include "Render/Renderer/Public/RenderCommandExecutor.h"
+#include "Render/Renderer/Public/ConstantBufferRing.h"
+
+void FD3D11CommandExecutor::BeginCommandList(const FRenderCommandList& InCommandList)
+{
+	std::fill(std::begin(BoundVSConstantBuffers), std::end(BoundVSConstantBuffers), nullptr);
+	std::fill(std::begin(BoundPSConstantBuffers), std::end(BoundPSConstantBuffers), nullptr);
+	RingRanges.clear();
+	bUseRing = false;
+
+	const uint32 ConstantBytes = InCommandList.GetConstantBufferBytes();
+	if (!ConstantBufferRing || !ConstantBufferRing->IsSupported() || ConstantBytes == 0) { return; }
+
+	// 리스트의 상수를 기록 순서대로 정렬해서 한 번의 Map으로 올림 (재생할 때도 같은 순서로 구간을 소비)
+	uint32 BaseOffset = 0;
+	uint8* Destination = ConstantBufferRing->Map(ConstantBytes, FRenderCommandList::ConstantBufferAlignment, BaseOffset);
+	if (!Destination) { return; }
+
+	InCommandList.ForEachConstantBufferUpdate([&Destination](const FUpdateConstantBufferCommand& InCommand, const void* InData)
+	{
+		memcpy(Destination, InData, InCommand.DataSize);
+		Destination += FRenderCommandList::AlignConstantBufferSize(InCommand.DataSize);
+	});
+	ConstantBufferRing->Unmap();
+
+	RingCursor = BaseOffset;
+	bUseRing = true;
+}
+
+void FD3D11CommandExecutor::BindConstantBuffer(uint32 InSlot, bool bInIsVS, ID3D11Buffer* InBuffer)
+{
+	for (const FRingRange& Range : RingRanges)
+	{
+		if (Range.Buffer == InBuffer)
+		{
+			Pipeline->SetConstantBufferRange(InSlot, bInIsVS, ConstantBufferRing->GetBuffer(), Range.Offset / 16, Range.Size / 16);
+			return;
+		}
+	}
+	Pipeline->SetConstantBuffer(InSlot, bInIsVS, InBuffer);
+}
+
+void FD3D11CommandExecutor::MapDiscard(ID3D11Buffer* InBuffer, const void* InData, uint32 InDataSize)
+{
+	D3D11_MAPPED_SUBRESOURCE MappedResource = {};
+	if (SUCCEEDED(DeviceContext->Map(InBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource)))
+	{
+		memcpy(MappedResource.pData, InData, InDataSize);
+		DeviceContext->Unmap(InBuffer, 0);
+	}
+}
+
+void FD3D11CommandExecutor::Execute(const FSetPipelineCommand& InCommand)
+{
+	Pipeline->UpdatePipeline(InCommand.Info);
+}
+
+void FD3D11CommandExecutor::Execute(const FSetVertexBufferCommand& InCommand)
+{
+	Pipeline->SetVertexBuffer(InCommand.Buffer, InCommand.Stride);
+}
+
+void FD3D11CommandExecutor::Execute(const FSetIndexBufferCommand& InCommand)
+{
+	Pipeline->SetIndexBuffer(InCommand.Buffer, InCommand.Stride);
+}
+
+void FD3D11CommandExecutor::Execute(const FSetConstantBufferCommand& InCommand)
+{
+	if (InCommand.Slot < ConstantBufferSlotCount)
+	{
+		(InCommand.bIsVS ? BoundVSConstantBuffers : BoundPSConstantBuffers)[InCommand.Slot] = InCommand.Buffer;
+	}
+	BindConstantBuffer(InCommand.Slot, InCommand.bIsVS, InCommand.Buffer);
+}
+
+void FD3D11CommandExecutor::Execute(const FSetTextureCommand& InCommand)
+{
+	Pipeline->SetTexture(InCommand.Slot, InCommand.bIsVS, InCommand.ShaderResourceView);
+}
+
+void FD3D11CommandExecutor::Execute(const FSetSamplerStateCommand& InCommand)
+{
+	Pipeline->SetSamplerState(InCommand.Slot, InCommand.bIsVS, InCommand.SamplerState);
+}
+
+void FD3D11CommandExecutor::Execute(const FSetRenderTargetsCommand& InCommand)
+{
+	// 새 렌더 타깃과 겹치는 SRV 해제가 대기 중일 수 있으므로 먼저 반영
+	Pipeline->FlushBindings();
+	ID3D11RenderTargetView* RenderTargetView = InCommand.RenderTargetView;
+	DeviceContext->OMSetRenderTargets(1, &RenderTargetView, InCommand.DepthStencilView);
+}
+
+void FD3D11CommandExecutor::Execute(const FUpdateBufferCommand& InCommand, const void* InData)
+{
+	if (InCommand.DestOffset == 0)
+	{
+		MapDiscard(InCommand.Buffer, InData, InCommand.DataSize);
+		return;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE MappedResource = {};
+	if (SUCCEEDED(DeviceContext->Map(InCommand.Buffer, 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &MappedResource)))
+	{
+		memcpy(static_cast<uint8*>(MappedResource.pData) + InCommand.DestOffset, InData, InCommand.DataSize);
+		DeviceContext->Unmap(InCommand.Buffer, 0);
+	}
+}
+
+void FD3D11CommandExecutor::Execute(const FUpdateConstantBufferCommand& InCommand, const void* InData)
+{
+	if (!bUseRing)
+	{
+		MapDiscard(InCommand.Buffer, InData, InCommand.DataSize);
+		return;
+	}
+
+	// 데이터는 BeginCommandList에서 이미 올라가 있으므로 이 버퍼의 구간만 다음 것으로 옮김
+	const FRingRange NewRange = { InCommand.Buffer, RingCursor, FRenderCommandList::AlignConstantBufferSize(InCommand.DataSize) };
+	RingCursor += NewRange.Size;
+
+	auto Found = std::find_if(RingRanges.begin(), RingRanges.end(), [&](const FRingRange& Range) { return Range.Buffer == InCommand.Buffer; });
+	if (Found != RingRanges.end())
+	{
+		*Found = NewRange;
+	}
+	else
+	{
+		RingRanges.push_back(NewRange);
+	}
+
+	for (uint32 Slot = 0; Slot < ConstantBufferSlotCount; ++Slot)
+	{
+		if (BoundVSConstantBuffers[Slot] == InCommand.Buffer) { BindConstantBuffer(Slot, true, InCommand.Buffer); }
+		if (BoundPSConstantBuffers[Slot] == InCommand.Buffer) { BindConstantBuffer(Slot, false, InCommand.Buffer); }
+	}
+}
+
+void FD3D11CommandExecutor::Execute(const FDrawCommand& InCommand)
+{
+	Pipeline->Draw(InCommand.VertexCount, InCommand.StartVertexLocation);
+}
+
+void FD3D11CommandExecutor::Execute(const FDrawIndexedCommand& InCommand)
+{
+	Pipeline->DrawIndexed(InCommand.IndexCount, InCommand.StartIndexLocation, InCommand.BaseVertexLocation);
+}
+
+void FD3D11CommandExecutor::Execute(const FDrawIndexedInstancedCommand& InCommand)
+{
+	Pipeline->DrawIndexedInstanced(InCommand.IndexCountPerInstance, InCommand.InstanceCount, InCommand.StartIndexLocation, InCommand.BaseVertexLocation);
+}
+
+namespace
+{
+	/**
+	 * @brief 섀도 상태 캐시가 디바이스로 보낼 호출 중 파이프라인 상태 변경만 세는 싱크
+	 */
+	struct FNullStateSink
+	{
+		uint32& PipelineStateChanges;
+
+		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY) { ++PipelineStateChanges; }
+		void SetInputLayout(ID3D11InputLayout*) { ++PipelineStateChanges; }
+		void SetVertexShader(ID3D11VertexShader*) { ++PipelineStateChanges; }
+		void SetRasterizerState(ID3D11RasterizerState*) { ++PipelineStateChanges; }
+		void SetDepthStencilState(ID3D11DepthStencilState*) { ++PipelineStateChanges; }
+		void SetPixelShader(ID3D11PixelShader*) { ++PipelineStateChanges; }
+		void SetBlendState(ID3D11BlendState*) { ++PipelineStateChanges; }
+		void SetVertexBuffer(ID3D11Buffer*, uint32) {}
+		void SetIndexBuffer(ID3D11Buffer*, uint32) {}
+		void SetConstantBuffers(EShaderStage, uint32, uint32, const FConstantBufferBinding*) {}
+		void SetShaderResources(EShaderStage, uint32, uint32, ID3D11ShaderResourceView* const*) {}
+		void SetSamplers(EShaderStage, uint32, uint32, ID3D11SamplerState* const*) {}
+	};
+}
+
+void FNullCommandExecutor::ResetStats()
+{
+	Stats = {};
+	Stats.Signature = 0xcbf29ce484222325ULL;
+	StateCache.ResetStats();
+}
+
+FRenderCommandStats FNullCommandExecutor::GetStats() const
+{
+	FRenderCommandStats Result = Stats;
+	Result.StateCache = StateCache.GetStats();
+	return Result;
+}
+
+void FNullCommandExecutor::FlushBindings()
+{
+	FNullStateSink Sink = { Stats.PipelineStateChanges };
+	StateCache.Flush(Sink);
+}
+
+/**
+ * @brief FNV-1a로 커맨드 종류와 값을 섞음
+ */
+void FNullCommandExecutor::MixSignature(ERenderCommandType InType, uint64 InValue)
+{
+	constexpr uint64 Prime = 0x100000001b3ULL;
+	Stats.Signature = (Stats.Signature ^ static_cast<uint64>(InType)) * Prime;
+	Stats.Signature = (Stats.Signature ^ InValue) * Prime;
+}
+
+void FNullCommandExecutor::Execute(const FSetPipelineCommand& InCommand)
+{
+	// 실제로 바뀌는 상태는 드로우 직전 FlushBindings에서 셈
+	StateCache.SetPipeline(InCommand.Info);
+
+	++Stats.CommandCount;
+	MixSignature(InCommand.Type, InCommand.Info.Topology);
+}
+
+void FNullCommandExecutor::Execute(const FSetVertexBufferCommand& InCommand)
+{
+	StateCache.SetVertexBuffer(InCommand.Buffer, InCommand.Stride);
+	++Stats.CommandCount;
+	++Stats.BufferBinds;
+	MixSignature(InCommand.Type, InCommand.Stride);
+}
+
+void FNullCommandExecutor::Execute(const FSetIndexBufferCommand& InCommand)
+{
+	StateCache.SetIndexBuffer(InCommand.Buffer, InCommand.Stride);
+	++Stats.CommandCount;
+	++Stats.BufferBinds;
+	MixSignature(InCommand.Type, InCommand.Stride);
+}
+
+void FNullCommandExecutor::Execute(const FSetConstantBufferCommand& InCommand)
+{
+	StateCache.SetConstantBuffer(InCommand.bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, InCommand.Slot, { InCommand.Buffer, 0, 0 });
+	++Stats.CommandCount;
+	++Stats.ConstantBufferBinds;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.Slot) << 1) | (InCommand.bIsVS ? 1 : 0));
+}
+
+void FNullCommandExecutor::Execute(const FSetTextureCommand& InCommand)
+{
+	if (InCommand.Slot < FPipelineStateCache::MaxShaderResources)
+	{
+		StateCache.SetShaderResource(InCommand.bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, InCommand.Slot, InCommand.ShaderResourceView);
+	}
+	++Stats.CommandCount;
+	++Stats.TextureBinds;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.Slot) << 1) | (InCommand.bIsVS ? 1 : 0));
+}
+
+void FNullCommandExecutor::Execute(const FSetSamplerStateCommand& InCommand)
+{
+	StateCache.SetSampler(InCommand.bIsVS ? EShaderStage::Vertex : EShaderStage::Pixel, InCommand.Slot, InCommand.SamplerState);
+	++Stats.CommandCount;
+	++Stats.TextureBinds;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.Slot) << 1) | (InCommand.bIsVS ? 1 : 0));
+}
+
+void FNullCommandExecutor::Execute(const FSetRenderTargetsCommand& InCommand)
+{
+	FlushBindings();
+	++Stats.CommandCount;
+	++Stats.RenderTargetChanges;
+	MixSignature(InCommand.Type, 0);
+}
+
+void FNullCommandExecutor::Execute(const FUpdateBufferCommand& InCommand, const void* /*InData*/)
+{
+	++Stats.CommandCount;
+	++Stats.BufferUpdates;
+	Stats.BufferAppends += InCommand.DestOffset != 0 ? 1 : 0;
+	Stats.UploadBytes += InCommand.DataSize;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.DestOffset) << 32) | InCommand.DataSize);
+}
+
+void FNullCommandExecutor::Execute(const FUpdateConstantBufferCommand& InCommand, const void* /*InData*/)
+{
+	++Stats.CommandCount;
+	++Stats.BufferUpdates;
+	++Stats.ConstantBufferUpdates;
+	Stats.UploadBytes += InCommand.DataSize;
+	MixSignature(InCommand.Type, InCommand.DataSize);
+}
+
+void FNullCommandExecutor::Execute(const FDrawCommand& InCommand)
+{
+	FlushBindings();
+	++Stats.CommandCount;
+	++Stats.DrawCalls;
+	Stats.VertexCount += InCommand.VertexCount;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.VertexCount) << 32) | InCommand.StartVertexLocation);
+}
+
+void FNullCommandExecutor::Execute(const FDrawIndexedCommand& InCommand)
+{
+	FlushBindings();
+	++Stats.CommandCount;
+	++Stats.DrawCalls;
+	Stats.VertexCount += InCommand.IndexCount;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.IndexCount) << 32) | InCommand.StartIndexLocation);
+}
+
+void FNullCommandExecutor::Execute(const FDrawIndexedInstancedCommand& InCommand)
+{
+	FlushBindings();
+	++Stats.CommandCount;
+	++Stats.DrawCalls;
+	++Stats.InstancedDrawCalls;
+	Stats.InstanceCount += InCommand.InstanceCount;
+	Stats.VertexCount += static_cast<uint64>(InCommand.IndexCountPerInstance) * InCommand.InstanceCount;
+	MixSignature(InCommand.Type, (static_cast<uint64>(InCommand.IndexCountPerInstance) << 32) | InCommand.InstanceCount);
+}
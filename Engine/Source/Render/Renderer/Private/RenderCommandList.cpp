@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
+
+void FRenderCommandList::UpdatePipeline(const FPipelineInfo& InInfo)
+{
+	Allocate<FSetPipelineCommand>().Info = InInfo;
+}
+
+void FRenderCommandList::SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+{
+	FSetVertexBufferCommand& Command = Allocate<FSetVertexBufferCommand>();
+	Command.Buffer = InBuffer;
+	Command.Stride = InStride;
+}
+
+void FRenderCommandList::SetIndexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+{
+	FSetIndexBufferCommand& Command = Allocate<FSetIndexBufferCommand>();
+	Command.Buffer = InBuffer;
+	Command.Stride = InStride;
+}
+
+void FRenderCommandList::SetConstantBuffer(uint32 InSlot, bool bInIsVS, ID3D11Buffer* InBuffer)
+{
+	FSetConstantBufferCommand& Command = Allocate<FSetConstantBufferCommand>();
+	Command.Buffer = InBuffer;
+	Command.Slot = InSlot;
+	Command.bIsVS = bInIsVS;
+}
+
+void FRenderCommandList::SetTexture(uint32 InSlot, bool bInIsVS, ID3D11ShaderResourceView* InShaderResourceView)
+{
+	FSetTextureCommand& Command = Allocate<FSetTextureCommand>();
+	Command.ShaderResourceView = InShaderResourceView;
+	Command.Slot = InSlot;
+	Command.bIsVS = bInIsVS;
+}
+
+void FRenderCommandList::SetSamplerState(uint32 InSlot, bool bInIsVS, ID3D11SamplerState* InSamplerState)
+{
+	FSetSamplerStateCommand& Command = Allocate<FSetSamplerStateCommand>();
+	Command.SamplerState = InSamplerState;
+	Command.Slot = InSlot;
+	Command.bIsVS = bInIsVS;
+}
+
+void FRenderCommandList::SetRenderTargets(ID3D11RenderTargetView* InRenderTargetView, ID3D11DepthStencilView* InDepthStencilView)
+{
+	FSetRenderTargetsCommand& Command = Allocate<FSetRenderTargetsCommand>();
+	Command.RenderTargetView = InRenderTargetView;
+	Command.DepthStencilView = InDepthStencilView;
+}
+
+void FRenderCommandList::Draw(uint32 InVertexCount, uint32 InStartVertexLocation)
+{
+	FDrawCommand& Command = Allocate<FDrawCommand>();
+	Command.VertexCount = InVertexCount;
+	Command.StartVertexLocation = InStartVertexLocation;
+}
+
+void FRenderCommandList::DrawIndexed(uint32 InIndexCount, uint32 InStartIndexLocation, int32 InBaseVertexLocation)
+{
+	FDrawIndexedCommand& Command = Allocate<FDrawIndexedCommand>();
+	Command.IndexCount = InIndexCount;
+	Command.StartIndexLocation = InStartIndexLocation;
+	Command.BaseVertexLocation = InBaseVertexLocation;
+}
+
+void FRenderCommandList::DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndexLocation, int32 InBaseVertexLocation)
+{
+	FDrawIndexedInstancedCommand& Command = Allocate<FDrawIndexedInstancedCommand>();
+	Command.IndexCountPerInstance = InIndexCountPerInstance;
+	Command.InstanceCount = InInstanceCount;
+	Command.StartIndexLocation = InStartIndexLocation;
+	Command.BaseVertexLocation = InBaseVertexLocation;
+}
+
+void FRenderCommandList::UpdateBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InDataSize)
+{
+	memcpy(AllocateBufferUpdate(InBuffer, InDataSize), InData, InDataSize);
+}
+
+void* FRenderCommandList::AllocateBufferUpdate(ID3D11Buffer* InBuffer, uint32 InDataSize)
+{
+	return AllocateBufferAppend(InBuffer, 0, InDataSize);
+}
+
+void* FRenderCommandList::AllocateBufferAppend(ID3D11Buffer* InBuffer, uint32 InDestOffset, uint32 InDataSize)
+{
+	FUpdateBufferCommand& Command = Allocate<FUpdateBufferCommand>(InDataSize);
+	Command.Buffer = InBuffer;
+	Command.DataSize = InDataSize;
+	Command.DestOffset = InDestOffset;
+	return reinterpret_cast<uint8*>(&Command) + sizeof(FUpdateBufferCommand);
+}
+
+void FRenderCommandList::UpdateConstantBufferData(ID3D11Buffer* InBuffer, const void* InData, uint32 InDataSize)
+{
+	FUpdateConstantBufferCommand& Command = Allocate<FUpdateConstantBufferCommand>(InDataSize);
+	Command.Buffer = InBuffer;
+	Command.DataSize = InDataSize;
+	memcpy(reinterpret_cast<uint8*>(&Command) + sizeof(FUpdateConstantBufferCommand), InData, InDataSize);
+	ConstantBufferBytes += AlignConstantBufferSize(InDataSize);
+}
+
+FRenderCommandList::~FRenderCommandList()
+{
+	Reset();
+}
+
+void FRenderCommandList::Reset()
+{
+	Buffer.clear();
+	CommandCount = 0;
+	ConstantBufferBytes = 0;
+
+	for (IUnknown* Resource : PendingReleases)
+	{
+		Resource->Release();
+	}
+	PendingReleases.clear();
+}
+
+void FRenderCommandList::ReleaseAfterExecute(IUnknown* InResource)
+{
+	if (InResource)
+	{
+		PendingReleases.push_back(InResource);
+	}
+}
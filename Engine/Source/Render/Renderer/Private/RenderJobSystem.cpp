@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "Render/Renderer/Public/RenderJobSystem.h"
+
+FRenderJobSystem::~FRenderJobSystem()
+{
+	Shutdown();
+}
+
+void FRenderJobSystem::Start(uint32 InWorkerCount)
+{
+	if (!Workers.empty())
+	{
+		return;
+	}
+
+	bStopping = false;
+	Workers.reserve(InWorkerCount);
+	for (uint32 i = 0; i < InWorkerCount; ++i)
+	{
+		Workers.emplace_back(&FRenderJobSystem::WorkerLoop, this);
+	}
+}
+
+void FRenderJobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopping = true;
+	}
+	WorkCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+}
+
+void FRenderJobSystem::ParallelFor(uint32 InCount, const std::function<void(uint32)>& InJob)
+{
+	if (InCount == 0)
+	{
+		return;
+	}
+
+	if (Workers.empty() || InCount == 1)
+	{
+		for (uint32 Index = 0; Index < InCount; ++Index)
+		{
+			InJob(Index);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		Job = &InJob;
+		JobCount = InCount;
+		NextIndex.store(0, std::memory_order_relaxed);
+		++Generation;
+	}
+	WorkCondition.notify_all();
+
+	RunJobs(InJob, InCount);
+
+	// 모든 인덱스를 누군가 가져갔으므로 작업 중인 워커만 기다리면 됨
+	// 늦게 깨어난 워커가 끝난 묶음을 보지 않도록 Job을 비움
+	std::unique_lock<std::mutex> Lock(Mutex);
+	DoneCondition.wait(Lock, [this]() { return ActiveWorkers == 0; });
+	Job = nullptr;
+	JobCount = 0;
+}
+
+void FRenderJobSystem::WorkerLoop()
+{
+	FProfiler::SetThreadName("RenderWorker");
+
+	uint64 SeenGeneration = 0;
+	while (true)
+	{
+		const std::function<void(uint32)>* CurrentJob = nullptr;
+		uint32 CurrentCount = 0;
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			WorkCondition.wait(Lock, [this, SeenGeneration]() { return bStopping || Generation != SeenGeneration; });
+			if (bStopping)
+			{
+				return;
+			}
+
+			SeenGeneration = Generation;
+			if (!Job)
+			{
+				continue;
+			}
+
+			CurrentJob = Job;
+			CurrentCount = JobCount;
+			++ActiveWorkers;
+		}
+
+		RunJobs(*CurrentJob, CurrentCount);
+
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			--ActiveWorkers;
+		}
+		DoneCondition.notify_all();
+	}
+}
+
+void FRenderJobSystem::RunJobs(const std::function<void(uint32)>& InJob, uint32 InCount)
+{
+	for (uint32 Index = NextIndex.fetch_add(1, std::memory_order_relaxed); Index < InCount;
+		Index = NextIndex.fetch_add(1, std::memory_order_relaxed))
+	{
+		InJob(Index);
+	}
+}
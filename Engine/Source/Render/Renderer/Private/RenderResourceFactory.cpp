@@ -3,12 +3,13 @@
 #include "Render/Renderer/Public/Renderer.h"
 
 void FRenderResourceFactory::CreateVertexShaderAndInputLayout(const wstring& InFilePath,
-                                                              const TArray<D3D11_INPUT_ELEMENT_DESC>& InInputLayoutDescs, ID3D11VertexShader** OutVertexShader, ID3D11InputLayout** OutInputLayout)
+                                                              const TArray<D3D11_INPUT_ELEMENT_DESC>& InInputLayoutDescs, ID3D11VertexShader** OutVertexShader, ID3D11InputLayout** OutInputLayout,
+                                                              const D3D_SHADER_MACRO* InDefines)
 {
 	ID3DBlob* VertexShaderBlob = nullptr;
 	ID3DBlob* ErrorBlob = nullptr;
 
-	HRESULT Result = D3DCompileFromFile(InFilePath.data(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, "mainVS", "vs_5_0", 0, 0, &VertexShaderBlob, &ErrorBlob);
+	HRESULT Result = D3DCompileFromFile(InFilePath.data(), InDefines, D3D_COMPILE_STANDARD_FILE_INCLUDE, "mainVS", "vs_5_0", 0, 0, &VertexShaderBlob, &ErrorBlob);
 	if (FAILED(Result))
 	{
 		if (ErrorBlob) { OutputDebugStringA(static_cast<char*>(ErrorBlob->GetBufferPointer())); SafeRelease(ErrorBlob); }
@@ -41,25 +42,30 @@ ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FVector* InVertices, ui
 	}
 	D3D11_SUBRESOURCE_DATA InitData = { InVertices, 0, 0 };
 	ID3D11Buffer* VertexBuffer = nullptr;
-	URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, &InitData, &VertexBuffer);
+	URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, InVertices ? &InitData : nullptr, &VertexBuffer);
 	return VertexBuffer;
 }
 
-ID3D11Buffer* FRenderResourceFactory::CreateIndexBuffer(const void* InIndices, uint32 InByteWidth)
+ID3D11Buffer* FRenderResourceFactory::CreateIndexBuffer(const void* InIndices, uint32 InByteWidth, bool bCpuAccess)
 {
 	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_IMMUTABLE, D3D11_BIND_INDEX_BUFFER, 0, 0, 0 };
+	if (bCpuAccess)
+	{
+		Desc.Usage = D3D11_USAGE_DYNAMIC;
+		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	}
 	D3D11_SUBRESOURCE_DATA InitData = { InIndices, 0, 0 };
 	ID3D11Buffer* IndexBuffer = nullptr;
-	URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, &InitData, &IndexBuffer);
+	URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, InIndices ? &InitData : nullptr, &IndexBuffer);
 	return IndexBuffer;
 }
 
-void FRenderResourceFactory::CreatePixelShader(const wstring& InFilePath, ID3D11PixelShader** OutPixelShader)
+void FRenderResourceFactory::CreatePixelShader(const wstring& InFilePath, ID3D11PixelShader** OutPixelShader, const D3D_SHADER_MACRO* InDefines)
 {
 	ID3DBlob* PixelShaderBlob = nullptr;
 	ID3DBlob* ErrorBlob = nullptr;
 
-	HRESULT Result = D3DCompileFromFile(InFilePath.data(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE, "mainPS", "ps_5_0", 0, 0, &PixelShaderBlob, &ErrorBlob);
+	HRESULT Result = D3DCompileFromFile(InFilePath.data(), InDefines, D3D_COMPILE_STANDARD_FILE_INCLUDE, "mainPS", "ps_5_0", 0, 0, &PixelShaderBlob, &ErrorBlob);
 	if (FAILED(Result))
 	{
 		if (ErrorBlob) { OutputDebugStringA(static_cast<char*>(ErrorBlob->GetBufferPointer())); SafeRelease(ErrorBlob); }
@@ -71,6 +77,40 @@ void FRenderResourceFactory::CreatePixelShader(const wstring& InFilePath, ID3D11
 	SafeRelease(PixelShaderBlob);
 }
 
+/**
+ * @brief CPU에서 매 프레임 덮어쓰는 StructuredBuffer와 SRV 생성 (Map WRITE_DISCARD로 갱신)
+ */
+ID3D11Buffer* FRenderResourceFactory::CreateStructuredBuffer(uint32 InElementSize, uint32 InElementCount, ID3D11ShaderResourceView** OutShaderResourceView)
+{
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = InElementSize * InElementCount;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	Desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+	Desc.StructureByteStride = InElementSize;
+
+	ID3D11Buffer* Buffer = nullptr;
+	if (FAILED(URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, nullptr, &Buffer)))
+	{
+		UE_LOG_ERROR("Renderer: StructuredBuffer 생성 실패");
+		return nullptr;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+	SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
+	SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+	SRVDesc.Buffer.FirstElement = 0;
+	SRVDesc.Buffer.NumElements = InElementCount;
+	if (FAILED(URenderer::GetInstance().GetDevice()->CreateShaderResourceView(Buffer, &SRVDesc, OutShaderResourceView)))
+	{
+		UE_LOG_ERROR("Renderer: StructuredBuffer SRV 생성 실패");
+		SafeRelease(Buffer);
+		return nullptr;
+	}
+	return Buffer;
+}
+
 ID3D11SamplerState* FRenderResourceFactory::CreateSamplerState(D3D11_FILTER InFilter, D3D11_TEXTURE_ADDRESS_MODE InAddressMode)
 {
 	D3D11_SAMPLER_DESC SamplerDesc = {};
@@ -94,6 +134,7 @@ ID3D11SamplerState* FRenderResourceFactory::CreateSamplerState(D3D11_FILTER InFi
 ID3D11RasterizerState* FRenderResourceFactory::GetRasterizerState(const FRenderState& InRenderState)
 {
 	const FRasterKey Key{ ToD3D11(InRenderState.FillMode), ToD3D11(InRenderState.CullMode) };
+	std::lock_guard<std::mutex> Lock(RasterCacheMutex);
 	if (auto Iter = RasterCache.find(Key); Iter != RasterCache.end())
 	{
 		return Iter->second;
@@ -117,6 +158,7 @@ ID3D11RasterizerState* FRenderResourceFactory::GetRasterizerState(const FRenderS
 
 void FRenderResourceFactory::ReleaseRasterizerState()
 {
+	std::lock_guard<std::mutex> Lock(RasterCacheMutex);
 	for (auto& Cache : RasterCache)
 	{
 		SafeRelease(Cache.second);
@@ -146,3 +188,4 @@ D3D11_FILL_MODE FRenderResourceFactory::ToD3D11(EFillMode InFill)
 }
 
 TMap<FRenderResourceFactory::FRasterKey, ID3D11RasterizerState*, FRenderResourceFactory::FRasterKeyHasher> FRenderResourceFactory::RasterCache;
+std::mutex FRenderResourceFactory::RasterCacheMutex;
@@ -0,0 +1,400 @@
+#include "pch.h"
+#include "Render/Renderer/Public/RenderScene.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Public/BillBoardComponent.h"
+#include "Component/Public/FireBallComponent.h"
+#include "Component/Public/TextComponent.h"
+#include "Component/Public/UUIDTextComponent.h"
+#include "Level/Public/Level.h"
+#include "Actor/Public/Actor.h"
+
+namespace
+{
+	// 씬 리비전 발급용 (씬을 고치는 곳은 모두 메인 스레드)
+	uint64 GRenderSceneRevisionCounter = 0;
+}
+
+FRenderScene::FRenderScene()
+{
+	BumpRevision();
+}
+
+void FRenderScene::BumpRevision()
+{
+	Revision = ++GRenderSceneRevisionCounter;
+}
+
+void FRenderScene::AddPrimitive(UPrimitiveComponent* InComponent)
+{
+	// 재구축 예정이면 재구축이 레벨의 모든 Primitive를 추가함 (레벨 로드 / 복제 직후)
+	if (!InComponent || bNeedsRebuild)
+	{
+		return;
+	}
+
+	if (const int32 Existing = FindProxy(InComponent); Existing >= 0)
+	{
+		MarkDirty(InComponent);
+		return;
+	}
+
+	BumpRevision();
+	const uint32 Index = static_cast<uint32>(Components.size());
+	Components.push_back(InComponent);
+	Passes.push_back(ClassifyPass(InComponent));
+	Visibilities.push_back(1);
+	DirtyFlags.push_back(0);
+	WorldMatrices.emplace_back();
+	WorldLocations.emplace_back();
+	BoundsMin.emplace_back();
+	BoundsMax.emplace_back();
+	VertexBuffers.push_back(nullptr);
+	IndexBuffers.push_back(nullptr);
+	IndexStrides.push_back(sizeof(uint32));
+	NumVertices.push_back(0);
+	NumIndices.push_back(0);
+	Indexed.push_back(0);
+	RenderStates.emplace_back();
+	Colors.emplace_back();
+	PrimitiveTypes.push_back(EPrimitiveType::Cube);
+	StaticMeshes.push_back(nullptr);
+	ScrollEnabled.push_back(0);
+	MaterialOffsets.push_back(static_cast<uint32>(Materials.size()));
+	MaterialCounts.push_back(0);
+
+	InComponent->RenderProxyIndex = static_cast<int32>(Index);
+	RefreshProxy(Index);
+	++PendingUpdateCount;
+}
+
+void FRenderScene::RemovePrimitive(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+
+	int32 Found = FindProxy(InComponent);
+	if (Found < 0)
+	{
+		// 공유 컴포넌트는 다른 씬의 인덱스를 갖고 있을 수 있으므로 직접 찾음
+		auto It = std::find(Components.begin(), Components.end(), InComponent);
+		if (It == Components.end())
+		{
+			return;
+		}
+		Found = static_cast<int32>(It - Components.begin());
+	}
+
+	BumpRevision();
+	const uint32 Index = static_cast<uint32>(Found);
+	const uint32 Last = static_cast<uint32>(Components.size()) - 1;
+
+	UnusedMaterialSlots += MaterialCounts[Index];
+	if (DirtyFlags[Index])
+	{
+		DirtyProxies.erase(std::remove(DirtyProxies.begin(), DirtyProxies.end(), Index), DirtyProxies.end());
+	}
+	if (InComponent->RenderProxyIndex == Found)
+	{
+		InComponent->RenderProxyIndex = -1;
+	}
+
+	// 마지막 프록시를 빈 자리로 옮겨 배열을 빈틈없이 유지
+	if (Index != Last)
+	{
+		if (DirtyFlags[Last])
+		{
+			std::replace(DirtyProxies.begin(), DirtyProxies.end(), Last, Index);
+		}
+
+		Components[Index] = Components[Last];
+		Passes[Index] = Passes[Last];
+		Visibilities[Index] = Visibilities[Last];
+		DirtyFlags[Index] = DirtyFlags[Last];
+		WorldMatrices[Index] = WorldMatrices[Last];
+		WorldLocations[Index] = WorldLocations[Last];
+		BoundsMin[Index] = BoundsMin[Last];
+		BoundsMax[Index] = BoundsMax[Last];
+		VertexBuffers[Index] = VertexBuffers[Last];
+		IndexBuffers[Index] = IndexBuffers[Last];
+		IndexStrides[Index] = IndexStrides[Last];
+		NumVertices[Index] = NumVertices[Last];
+		NumIndices[Index] = NumIndices[Last];
+		Indexed[Index] = Indexed[Last];
+		RenderStates[Index] = RenderStates[Last];
+		Colors[Index] = Colors[Last];
+		PrimitiveTypes[Index] = PrimitiveTypes[Last];
+		StaticMeshes[Index] = StaticMeshes[Last];
+		ScrollEnabled[Index] = ScrollEnabled[Last];
+		MaterialOffsets[Index] = MaterialOffsets[Last];
+		MaterialCounts[Index] = MaterialCounts[Last];
+
+		if (Components[Index]->RenderProxyIndex == static_cast<int32>(Last))
+		{
+			Components[Index]->RenderProxyIndex = static_cast<int32>(Index);
+		}
+	}
+
+	Components.pop_back();
+	Passes.pop_back();
+	Visibilities.pop_back();
+	DirtyFlags.pop_back();
+	WorldMatrices.pop_back();
+	WorldLocations.pop_back();
+	BoundsMin.pop_back();
+	BoundsMax.pop_back();
+	VertexBuffers.pop_back();
+	IndexBuffers.pop_back();
+	IndexStrides.pop_back();
+	NumVertices.pop_back();
+	NumIndices.pop_back();
+	Indexed.pop_back();
+	RenderStates.pop_back();
+	Colors.pop_back();
+	PrimitiveTypes.pop_back();
+	StaticMeshes.pop_back();
+	ScrollEnabled.pop_back();
+	MaterialOffsets.pop_back();
+	MaterialCounts.pop_back();
+}
+
+void FRenderScene::MarkDirty(UPrimitiveComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+
+	const int32 Index = FindProxy(InComponent);
+	if (Index < 0)
+	{
+		return;
+	}
+
+	// Transform / 메시가 바뀌면 보이는 집합도 바뀔 수 있음
+	BumpRevision();
+	if (DirtyFlags[Index])
+	{
+		return;
+	}
+
+	DirtyFlags[Index] = 1;
+	DirtyProxies.push_back(static_cast<uint32>(Index));
+}
+
+void FRenderScene::Update(const ULevel* InLevel)
+{
+	FScopeCycleCounter UpdateCounter(TStatId("RenderSceneUpdate"));
+
+	if (bNeedsRebuild)
+	{
+		Rebuild(InLevel);
+	}
+	else
+	{
+		for (uint32 Index : DirtyProxies)
+		{
+			RefreshProxy(Index);
+			DirtyFlags[Index] = 0;
+		}
+		PendingUpdateCount += static_cast<uint32>(DirtyProxies.size());
+		DirtyProxies.clear();
+	}
+
+	if (UnusedMaterialSlots > 0 && UnusedMaterialSlots * 2 > Materials.size())
+	{
+		CompactMaterials();
+	}
+
+	Stats.LastFrameUpdates = PendingUpdateCount;
+	PendingUpdateCount = 0;
+	Stats.Proxies = static_cast<uint32>(Components.size());
+	Stats.MaterialSlots = static_cast<uint32>(Materials.size()) - UnusedMaterialSlots;
+	Stats.LastUpdateMs = UpdateCounter.Finish();
+}
+
+void FRenderScene::Rebuild(const ULevel* InLevel)
+{
+	TIME_PROFILE(RenderSceneRebuild);
+	Clear();
+	bNeedsRebuild = false;
+	++Stats.Rebuilds;
+	// 프록시 인덱스가 모두 바뀌므로 이전 리비전으로 만든 컨텍스트는 쓸 수 없음
+	BumpRevision();
+
+	if (!InLevel)
+	{
+		return;
+	}
+
+	for (AActor* Actor : InLevel->GetActors())
+	{
+		if (!Actor) { continue; }
+
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+			{
+				AddPrimitive(Primitive);
+			}
+		}
+	}
+
+	UE_LOG("RenderScene: %u개 프록시로 재구축", static_cast<uint32>(Components.size()));
+}
+
+void FRenderScene::Clear()
+{
+	Components.clear();
+	Passes.clear();
+	Visibilities.clear();
+	DirtyFlags.clear();
+	WorldMatrices.clear();
+	WorldLocations.clear();
+	BoundsMin.clear();
+	BoundsMax.clear();
+	VertexBuffers.clear();
+	IndexBuffers.clear();
+	IndexStrides.clear();
+	NumVertices.clear();
+	NumIndices.clear();
+	Indexed.clear();
+	RenderStates.clear();
+	Colors.clear();
+	PrimitiveTypes.clear();
+	StaticMeshes.clear();
+	ScrollEnabled.clear();
+	MaterialOffsets.clear();
+	MaterialCounts.clear();
+	Materials.clear();
+	UnusedMaterialSlots = 0;
+	DirtyProxies.clear();
+	PendingUpdateCount = 0;
+}
+
+void FRenderScene::RefreshProxy(uint32 InIndex)
+{
+	UPrimitiveComponent* Component = Components[InIndex];
+
+	// 월드 행렬 / 역행렬 / AABB 캐시를 여기서 채워 두어 워커 스레드는 읽기만 함
+	WorldMatrices[InIndex] = Component->GetWorldTransformMatrix();
+	Component->GetWorldTransformMatrixInverse();
+	WorldLocations[InIndex] = Component->GetWorldLocation();
+	Component->GetWorldAABB(BoundsMin[InIndex], BoundsMax[InIndex]);
+
+	Visibilities[InIndex] = Component->IsVisible() ? 1 : 0;
+	VertexBuffers[InIndex] = Component->GetVertexBuffer();
+	IndexBuffers[InIndex] = Component->GetIndexBuffer();
+	IndexStrides[InIndex] = Component->GetIndexStride();
+	NumVertices[InIndex] = Component->GetNumVertices();
+	NumIndices[InIndex] = Component->GetNumIndices();
+	Indexed[InIndex] = Component->GetIndexBuffer() && Component->GetIndicesData() ? 1 : 0;
+	RenderStates[InIndex] = Component->GetRenderState();
+	Colors[InIndex] = Component->GetColor();
+	PrimitiveTypes[InIndex] = Component->GetPrimitiveType();
+
+	if (Passes[InIndex] != ERenderProxyPass::StaticMesh)
+	{
+		return;
+	}
+
+	UStaticMeshComponent* MeshComponent = static_cast<UStaticMeshComponent*>(Component);
+	StaticMeshes[InIndex] = MeshComponent->GetStaticMesh();
+	ScrollEnabled[InIndex] = MeshComponent->IsScrollEnabled() ? 1 : 0;
+
+	const uint32 SlotCount = static_cast<uint32>(MeshComponent->GetNumMaterialSlots());
+	ResizeMaterialRange(InIndex, SlotCount);
+	for (uint32 Slot = 0; Slot < SlotCount; ++Slot)
+	{
+		Materials[MaterialOffsets[InIndex] + Slot] = MeshComponent->GetMaterial(static_cast<int32>(Slot));
+	}
+}
+
+void FRenderScene::ResizeMaterialRange(uint32 InIndex, uint32 InCount)
+{
+	if (MaterialCounts[InIndex] == InCount)
+	{
+		return;
+	}
+
+	UnusedMaterialSlots += MaterialCounts[InIndex];
+	MaterialOffsets[InIndex] = static_cast<uint32>(Materials.size());
+	MaterialCounts[InIndex] = InCount;
+	Materials.resize(Materials.size() + InCount, nullptr);
+}
+
+void FRenderScene::CompactMaterials()
+{
+	TArray<UMaterial*> Compacted;
+	Compacted.reserve(Materials.size() - UnusedMaterialSlots);
+	for (uint32 Index = 0; Index < static_cast<uint32>(Components.size()); ++Index)
+	{
+		const uint32 Offset = MaterialOffsets[Index];
+		MaterialOffsets[Index] = static_cast<uint32>(Compacted.size());
+		Compacted.insert(Compacted.end(), Materials.begin() + Offset, Materials.begin() + Offset + MaterialCounts[Index]);
+	}
+	Materials.swap(Compacted);
+	UnusedMaterialSlots = 0;
+}
+
+uint32 FRenderScene::CountStaleProxies() const
+{
+	uint32 StaleCount = 0;
+	for (uint32 Index = 0; Index < static_cast<uint32>(Components.size()); ++Index)
+	{
+		if (DirtyFlags[Index]) { continue; }
+
+		UPrimitiveComponent* Component = Components[Index];
+		const FVector4 Color = Component->GetColor();
+		bool bStale = memcmp(&WorldMatrices[Index], &Component->GetWorldTransformMatrix(), sizeof(FMatrix)) != 0
+			|| memcmp(&Colors[Index], &Color, sizeof(FVector4)) != 0
+			|| VertexBuffers[Index] != Component->GetVertexBuffer()
+			|| IndexBuffers[Index] != Component->GetIndexBuffer()
+			|| NumIndices[Index] != Component->GetNumIndices()
+			|| IsVisible(Index) != Component->IsVisible();
+
+		if (!bStale && Passes[Index] == ERenderProxyPass::StaticMesh)
+		{
+			UStaticMeshComponent* MeshComponent = static_cast<UStaticMeshComponent*>(Component);
+			bStale = StaticMeshes[Index] != MeshComponent->GetStaticMesh()
+				|| IsScrollEnabled(Index) != MeshComponent->IsScrollEnabled()
+				|| MaterialCounts[Index] != static_cast<uint32>(MeshComponent->GetNumMaterialSlots());
+			for (uint32 Slot = 0; !bStale && Slot < MaterialCounts[Index]; ++Slot)
+			{
+				bStale = GetMaterial(Index, static_cast<int32>(Slot)) != MeshComponent->GetMaterial(static_cast<int32>(Slot));
+			}
+		}
+
+		if (bStale)
+		{
+			++StaleCount;
+		}
+	}
+	return StaleCount;
+}
+
+ERenderProxyPass FRenderScene::ClassifyPass(UPrimitiveComponent* InComponent)
+{
+	if (Cast<UStaticMeshComponent>(InComponent))
+	{
+		return ERenderProxyPass::StaticMesh;
+	}
+	if (Cast<UBillBoardComponent>(InComponent))
+	{
+		return ERenderProxyPass::BillBoard;
+	}
+	if (Cast<UFireBallComponent>(InComponent))
+	{
+		return ERenderProxyPass::FireBall;
+	}
+	if (UTextComponent* Text = Cast<UTextComponent>(InComponent); Text && !Text->IsExactly(UUUIDTextComponent::StaticClass()))
+	{
+		return ERenderProxyPass::Text;
+	}
+	if (!InComponent->IsA(UUUIDTextComponent::StaticClass()))
+	{
+		return ERenderProxyPass::Primitive;
+	}
+	return ERenderProxyPass::None;
+}
@@ -13,12 +13,14 @@
 #include "Editor/Public/ViewportClient.h"
 #include "Editor/Public/Camera.h"
 #include "Level/Public/Level.h"
+#include "Actor/Public/Actor.h"
 #include "Manager/UI/Public/UIManager.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Render/RenderPass/Public/RenderPass.h"
 #include "Component/Mesh/Public/StaticMesh.h"
 #include "Optimization/Public/OcclusionCuller.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#include "Render/Renderer/Public/RenderScene.h"
 #include "Render/RenderPass/Public/BillboardPass.h"
 #include "Render/RenderPass/Public/PrimitivePass.h"
 #include "Render/RenderPass/Public/StaticMeshPass.h"
@@ -29,6 +31,9 @@
 
 IMPLEMENT_SINGLETON_CLASS_BASE(URenderer)
 
+// 인스턴스 드로우용 셰이더 변형 (StructuredBuffer t8 + SV_InstanceID로 월드 행렬을 읽음)
+static const D3D_SHADER_MACRO InstancedShaderDefines[] = { { "INSTANCED", "1" }, { nullptr, nullptr } };
+
 URenderer::URenderer() = default;
 
 URenderer::~URenderer() = default;
@@ -37,6 +42,11 @@ void URenderer::Init(HWND InWindowHandle)
 {
 	DeviceResources = new UDeviceResources(InWindowHandle);
 	Pipeline = new UPipeline(GetDeviceContext());
+	if (Pipeline->SupportsConstantBufferOffsets())
+	{
+		ConstantBufferRing.Initialize(GetDevice(), GetDeviceContext(), ConstantBufferRingSize);
+	}
+	CommandExecutor = new FD3D11CommandExecutor(Pipeline, GetDeviceContext(), &ConstantBufferRing);
 	ViewportClient = new FViewport();
 
 	// ?더??태 ?리소???성
@@ -67,12 +77,14 @@ void URenderer::Init(HWND InWindowHandle)
 
 	FStaticMeshPass* StaticMeshPass = new FStaticMeshPass(Pipeline, ConstantBufferViewProj, ConstantBufferModels,
 		TextureVertexShader, TexturePixelShader, TextureInputLayout, DefaultDepthStencilState,
-		DepthVertexShader, DepthPixelShader, DepthInputLayout);
+		DepthVertexShader, DepthPixelShader, DepthInputLayout,
+		InstancedTextureVertexShader, InstancedDepthVertexShader);
 	RenderPasses.push_back(StaticMeshPass);
 
 	FPrimitivePass* PrimitivePass = new FPrimitivePass(Pipeline, ConstantBufferViewProj, ConstantBufferModels,
 		DefaultVertexShader, DefaultPixelShader, DefaultInputLayout, DefaultDepthStencilState,
-		DepthVertexShader, DepthPixelShader, DepthInputLayout);
+		DepthVertexShader, DepthPixelShader, DepthInputLayout,
+		InstancedDefaultVertexShader, InstancedDefaultPixelShader, InstancedDepthVertexShader);
 	RenderPasses.push_back(PrimitivePass);
 
 	// ?파 블렌?을 ?용?는 ?반 ?칼 ?스
@@ -100,10 +112,15 @@ void URenderer::Init(HWND InWindowHandle)
 	FFireBallForwardPass* FireBallForwardPass = new FFireBallForwardPass(Pipeline, ConstantBufferViewProj, ConstantBufferModels,
 		FireBallFwdVertexShader, FireBallFwdPixelShader, FireBallFwdInputLayout, DecalDepthStencilState, AdditiveBlendState);
 	RenderPasses.push_back(FireBallForwardPass);
+
+	BuildPassRecordingJobs();
+	RenderJobs.Start(GetDefaultRenderWorkerCount());
 }
 
 void URenderer::Release()
 {
+	RenderJobs.Shutdown();
+	ViewRecordings.clear();
 	ReleaseSceneRenderTargets();
 	ReleaseConstantBuffers();
 	ReleaseDefaultShader();
@@ -123,6 +140,8 @@ void URenderer::Release()
 
 	SafeDelete(ViewportClient);
 	SafeDelete(FontRenderer);
+	SafeDelete(CommandExecutor);
+	ConstantBufferRing.Release();
 	SafeDelete(Pipeline);
 	SafeDelete(DeviceResources);
 }
@@ -209,6 +228,9 @@ void URenderer::CreateDefaultShader()
 	};
 	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/SampleShader.hlsl", DefaultLayout, &DefaultVertexShader, &DefaultInputLayout);
 	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/SampleShader.hlsl", &DefaultPixelShader);
+	// 인스턴스 변형: 입력 레이아웃은 기존 것을 그대로 쓰므로 검증만 함 (OutInputLayout = nullptr)
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/SampleShader.hlsl", DefaultLayout, &InstancedDefaultVertexShader, nullptr, InstancedShaderDefines);
+	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/SampleShader.hlsl", &InstancedDefaultPixelShader, InstancedShaderDefines);
 	Stride = sizeof(FNormalVertex);
 }
 
@@ -236,6 +258,7 @@ void URenderer::CreateTextureShader()
 	};
 	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/TextureShader.hlsl", TextureLayout, &TextureVertexShader, &TextureInputLayout);
 	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/TextureShader.hlsl", &TexturePixelShader);
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/TextureShader.hlsl", TextureLayout, &InstancedTextureVertexShader, nullptr, InstancedShaderDefines);
 }
 
 void URenderer::CreateDepthShader()
@@ -249,6 +272,7 @@ void URenderer::CreateDepthShader()
 	};
 	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/DepthShader.hlsl", DepthLayout, &DepthVertexShader, &DepthInputLayout);
 	FRenderResourceFactory::CreatePixelShader(L"Asset/Shader/DepthShader.hlsl", &DepthPixelShader);
+	FRenderResourceFactory::CreateVertexShaderAndInputLayout(L"Asset/Shader/DepthShader.hlsl", DepthLayout, &InstancedDepthVertexShader, nullptr, InstancedShaderDefines);
 }
 
 void URenderer::CreateConstantBuffers()
@@ -270,9 +294,12 @@ void URenderer::ReleaseDefaultShader()
 	SafeRelease(DefaultInputLayout);
 	SafeRelease(DefaultPixelShader);
 	SafeRelease(DefaultVertexShader);
+	SafeRelease(InstancedDefaultPixelShader);
+	SafeRelease(InstancedDefaultVertexShader);
 	SafeRelease(TextureInputLayout);
 	SafeRelease(TexturePixelShader);
 	SafeRelease(TextureVertexShader);
+	SafeRelease(InstancedTextureVertexShader);
 	SafeRelease(DecalVertexShader);
 	SafeRelease(DecalPixelShader);
 }
@@ -282,6 +309,7 @@ void URenderer::ReleaseDepthShader()
 	SafeRelease(DepthInputLayout);
 	SafeRelease(DepthPixelShader);
 	SafeRelease(DepthVertexShader);
+	SafeRelease(InstancedDepthVertexShader);
 }
 
 void URenderer::ReleaseDepthStencilState()
@@ -304,18 +332,58 @@ void URenderer::ReleaseBlendState()
 
 void URenderer::Update()
 {
+	++FrameNumber;
+	ConstantBufferRing.BeginFrame();
+	// 지난 프레임의 ImGui / D2D 오버레이가 캐시를 거치지 않고 컨텍스트 상태를 바꿨으므로 섀도 상태를 버림
+	Pipeline->InvalidateState();
 	RenderBegin();
+	UStatOverlay::GetInstance().ResetDrawSortFrame();
 
+	// 1) 그릴 뷰포트 수집
+	uint32 ViewCount = 0;
 	for (FViewportClient& ViewportClient : ViewportClient->GetViewports())
 	{
 		if (ViewportClient.GetViewportInfo().Width < 1.0f || ViewportClient.GetViewportInfo().Height < 1.0f) { continue; }
+		AddViewRecording(ViewCount++, &ViewportClient.Camera, ViewportClient.GetViewportInfo());
+	}
 
-		UCamera* CurrentCamera = &ViewportClient.Camera;
-		CurrentCamera->Update(ViewportClient.GetViewportInfo());
+	// 2) 뷰포트마다 카메라 갱신 / 컬링 / 컨텍스트 구성, 3) 패스마다 모든 뷰포트의 커맨드 기록 (워커 스레드)
+	// 기록은 커맨드 리스트에만 쓰고 디바이스 컨텍스트는 건드리지 않으므로 제출 순서만 지키면 결과가 같음
+	ULevel* CurrentLevel = GWorld->GetLevel();
+	RecordingStats.ViewCount = ViewCount;
+	RecordingStats.WorkerCount = RenderJobs.GetWorkerCount();
+	RecordingStats.RecordingJobs = static_cast<uint32>(PassRecordingJobs.size());
+	{
+		FScopeCycleCounter PrepareCounter(TStatId("PrepareViews"));
+		PrepareViews(CurrentLevel, ViewCount, true);
+		RecordingStats.PrepareMs = PrepareCounter.Finish();
+	}
+	RecordingStats.CulledViews = 0;
+	RecordingStats.RebucketedViews = 0;
+	for (uint32 ViewIndex = 0; ViewIndex < ViewCount; ++ViewIndex)
+	{
+		RecordingStats.CulledViews += ViewRecordings[ViewIndex].bCulledThisFrame ? 1 : 0;
+		RecordingStats.RebucketedViews += ViewRecordings[ViewIndex].bRebucketedThisFrame ? 1 : 0;
+	}
+	{
+		FScopeCycleCounter RecordCounter(TStatId("RecordPasses"));
+		if (CurrentLevel)
+		{
+			RecordViews(ViewCount);
+		}
+		RecordingStats.RecordMs = RecordCounter.Finish();
+	}
+
+	// 4) 뷰포트 순서대로 제출 (메인 스레드)
+	FScopeCycleCounter SubmitCounter(TStatId("SubmitViews"));
+	for (uint32 ViewIndex = 0; ViewIndex < ViewCount; ++ViewIndex)
+	{
+		FViewRecording& View = ViewRecordings[ViewIndex];
+		UCamera* CurrentCamera = View.Camera;
 		FRenderResourceFactory::UpdateConstantBufferData(ConstantBufferViewProj, CurrentCamera->GetFViewProjConstants());
 		Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
 
-		const D3D11_VIEWPORT& ClientViewport = ViewportClient.GetViewportInfo();
+		const D3D11_VIEWPORT& ClientViewport = View.Viewport;
 
 		// === Scene RT ?더? clientViewport? ?일??viewport ?용 ===
 		// Scene RT??SwapChain ?체 ?기??성?었???
@@ -329,7 +397,10 @@ void URenderer::Update()
 
 		{
 			TIME_PROFILE(RenderLevel)
-			RenderLevel(CurrentCamera);
+			if (CurrentLevel)
+			{
+				SubmitView(View, nullptr);
+			}
 		}
 
 		// === ?버??리미티??더? Scene RT???더?(FXAA ?용) ===
@@ -354,6 +425,7 @@ void URenderer::Update()
 			GEditor->GetEditorModule()->RenderGizmo(CurrentCamera);
 		}
 	}
+	RecordingStats.SubmitMs = SubmitCounter.Finish();
 
 	{
 		TIME_PROFILE(UUIManager)
@@ -365,6 +437,7 @@ void URenderer::Update()
 	}
 
 	RenderEnd();
+	ConstantBufferRing.EndFrame();
 }
 
 void URenderer::RenderBegin() const
@@ -386,56 +459,162 @@ void URenderer::RenderBegin() const
 	DeviceResources->UpdateViewport();
 }
 
-void URenderer::RenderLevel(UCamera* InCurrentCamera)
+uint32 URenderer::GetDefaultRenderWorkerCount()
 {
-	const ULevel* CurrentLevel = GWorld->GetLevel();
-	if (!CurrentLevel) { return; }
-	
-	const FViewProjConstants& ViewProj = InCurrentCamera->GetFViewProjConstants();
-	TArray<UPrimitiveComponent*> FinalVisiblePrims = InCurrentCamera->GetViewVolumeCuller().GetRenderableObjects();
+	// 메인 스레드도 작업을 가져가므로 코어 하나는 남겨 둠
+	const uint32 HardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+	return std::min(HardwareThreadCount - 1, MaxRenderWorkers);
+}
+
+void URenderer::SetRenderWorkerCount(uint32 InWorkerCount)
+{
+	RenderJobs.Shutdown();
+	RenderJobs.Start(std::min(InWorkerCount, MaxRenderWorkers));
+}
+
+void URenderer::BuildPassRecordingJobs()
+{
+	// Parallel 패스는 패스마다 작업 하나, Shared 패스는 모두 한 작업에서 패스 순서대로 기록
+	// Immediate 패스는 디바이스 컨텍스트를 직접 쓰므로 제출 단계에서 실행
+	PassRecordingJobs.clear();
+	TArray<uint32> SharedPasses;
+	for (uint32 PassIndex = 0; PassIndex < static_cast<uint32>(RenderPasses.size()); ++PassIndex)
+	{
+		switch (RenderPasses[PassIndex]->GetRecordingMode())
+		{
+		case ERenderPassRecording::Parallel:
+			PassRecordingJobs.push_back({ PassIndex });
+			break;
+		case ERenderPassRecording::Shared:
+			SharedPasses.push_back(PassIndex);
+			break;
+		case ERenderPassRecording::Immediate:
+			break;
+		}
+	}
+
+	if (!SharedPasses.empty())
+	{
+		PassRecordingJobs.push_back(std::move(SharedPasses));
+	}
+}
+
+FViewRecording& URenderer::AddViewRecording(uint32 InViewIndex, UCamera* InCamera, const D3D11_VIEWPORT& InViewport)
+{
+	if (ViewRecordings.size() <= InViewIndex)
+	{
+		ViewRecordings.resize(InViewIndex + 1);
+	}
+
+	FViewRecording& View = ViewRecordings[InViewIndex];
+	View.Camera = InCamera;
+	View.Viewport = InViewport;
+	View.PassCommandLists.resize(RenderPasses.size());
+	return View;
+}
+
+void URenderer::UpdateRenderScene(ULevel* InLevel)
+{
+	// 에디터 / PIE 레벨이 컴포넌트를 공유하므로 그리는 레벨이 바뀌면 프록시 인덱스를 이 레벨 기준으로 다시 맞춤
+	FRenderScene* Scene = InLevel->GetRenderScene();
+	if (RenderSceneLevel != InLevel)
+	{
+		Scene->MarkNeedsRebuild();
+		RenderSceneLevel = InLevel;
+	}
+
+	// 바뀐 프록시만 다시 읽으면서 해당 컴포넌트의 월드 행렬 / AABB 캐시도 채움
+	// -> 컬링과 패스 기록이 여러 스레드에서 캐시를 동시에 채우지 않음
+	Scene->Update(InLevel);
+}
+
+void URenderer::PrepareViews(ULevel* InLevel, uint32 InViewCount, bool bInUpdateCameras)
+{
+	if (InLevel)
+	{
+		UpdateRenderScene(InLevel);
+	}
+
+	RenderJobs.ParallelFor(InViewCount, [this, InLevel, bInUpdateCameras](uint32 ViewIndex)
+	{
+		FViewRecording& View = ViewRecordings[ViewIndex];
+		View.bCulledThisFrame = false;
+		if (bInUpdateCameras)
+		{
+			const uint64 CullCountBefore = View.Camera->GetViewVolumeCuller().GetCullCount();
+			View.Camera->Update(View.Viewport);
+			View.bCulledThisFrame = View.Camera->GetViewVolumeCuller().GetCullCount() != CullCountBefore;
+		}
+		if (InLevel)
+		{
+			BuildRenderingContext(InLevel, View);
+		}
+	});
+
+	if (!InLevel) { return; }
+
+	// Decal 통계는 프레임 전체(모든 뷰포트) 기준으로 한 번만 초기화
+	if (InLevel->GetShowFlags() & EEngineShowFlags::SF_Decal)
+	{
+		UStatOverlay::GetInstance().ResetDecalFrame();
+		UStatOverlay::GetInstance().RecordDecalCollection(
+			static_cast<uint32>(InLevel->GetAllDecals().size()),
+			static_cast<uint32>(InLevel->GetVisibleDecals().size())
+			);
+	}
+}
+
+void URenderer::BuildRenderingContext(const ULevel* InLevel, FViewRecording& InOutView) const
+{
+	UCamera* CurrentCamera = InOutView.Camera;
+	const FViewProjConstants& ViewProj = CurrentCamera->GetFViewProjConstants();
+	const TArray<UPrimitiveComponent*>& FinalVisiblePrims = CurrentCamera->GetViewVolumeCuller().GetRenderableObjects();
 
 	// // ?클루전 컬링 ?행
 	// TIME_PROFILE(Occlusion)
 	// static COcclusionCuller Culler;
 	// Culler.InitializeCuller(ViewProj.View, ViewProj.Projection);
 	// FinalVisiblePrims = Culler.PerformCulling(
-	// 	InCurrentCamera->GetViewVolumeCuller().GetRenderableObjects(),
-	// 	InCurrentCamera->GetLocation()
+	// 	CurrentCamera->GetViewVolumeCuller().GetRenderableObjects(),
+	// 	CurrentCamera->GetLocation()
 	// );
 	// TIME_PROFILE_END(Occlusion) 
 
 
-	FRenderingContext RenderingContext(&ViewProj, InCurrentCamera, GEditor->GetEditorModule()->GetViewMode(), CurrentLevel->GetShowFlags());
-	RenderingContext.AllPrimitives = FinalVisiblePrims;
-	for (auto& Prim : FinalVisiblePrims)
+	FRenderingContext& RenderingContext = InOutView.Context;
+	RenderingContext.ViewProjConstants = &ViewProj;
+	RenderingContext.CurrentCamera = CurrentCamera;
+	RenderingContext.ViewMode = GEditor->GetEditorModule()->GetViewMode();
+	RenderingContext.ShowFlags = InLevel->GetShowFlags();
+	RenderingContext.bInstancing = bInstancingEnabled;
+	RenderingContext.FrameNumber = FrameNumber;
+	RenderingContext.AlphaDecals.clear();
+	RenderingContext.AdditiveDecals.clear();
+
+	const FRenderScene* Scene = InLevel->GetRenderScene();
+	RenderingContext.Scene = Scene;
+
+	// 컬링 결과와 프록시 인덱스가 그대로면 지난 프레임의 버킷을 그대로 씀
+	// (씬 리비전이 같으면 프록시 추가 / 제거 / 재구축이 없었으므로 인덱스와 패스 분류도 같음)
+	const uint64 CullCount = CurrentCamera->GetViewVolumeCuller().GetCullCount();
+	const uint64 SceneRevision = Scene->GetRevision();
+	InOutView.bRebucketedThisFrame = InOutView.BucketedCamera != CurrentCamera
+		|| InOutView.BucketedCullCount != CullCount
+		|| InOutView.BucketedSceneRevision != SceneRevision;
+	if (InOutView.bRebucketedThisFrame)
 	{
-		if (auto StaticMesh = Cast<UStaticMeshComponent>(Prim))
-		{
-			RenderingContext.StaticMeshes.push_back(StaticMesh);
-		}
-		else if (auto BillBoard = Cast<UBillBoardComponent>(Prim))
-		{
-			RenderingContext.BillBoards.push_back(BillBoard);
-		}
-		else if (auto FireBall = Cast<UFireBallComponent>(Prim))
-		{
-			RenderingContext.FireBalls.push_back(FireBall);
-		}
-		else if (auto Text = Cast<UTextComponent>(Prim); Text && !Text->IsExactly(UUUIDTextComponent::StaticClass()))
-		{
-			RenderingContext.Texts.push_back(Text);
-		}
-		else if (!Prim->IsA(UUUIDTextComponent::StaticClass()))
-		{
-			RenderingContext.DefaultPrimitives.push_back(Prim);
-		}
+		InOutView.BucketedCamera = CurrentCamera;
+		InOutView.BucketedCullCount = CullCount;
+		InOutView.BucketedSceneRevision = SceneRevision;
+		BuildPrimitiveBuckets(Scene, FinalVisiblePrims, RenderingContext);
 	}
+
 	// ?집 ?에 ?래??인
-	const bool bWantsDecal = (CurrentLevel->GetShowFlags() & EEngineShowFlags::SF_Decal) != 0;
+	// 데칼 가시성은 씬 리비전과 따로 바뀌므로 매번 나눔 (데칼 수는 적음)
+	const bool bWantsDecal = (InLevel->GetShowFlags() & EEngineShowFlags::SF_Decal) != 0;
 	if (bWantsDecal)
 	{
-		UStatOverlay::GetInstance().ResetDecalFrame();
-		for (auto Decal : CurrentLevel->GetVisibleDecals())
+		for (auto Decal : InLevel->GetVisibleDecals())
 		{
 			if (Cast<USemiLightComponent>(Decal->GetParentAttachment()))
 			{
@@ -446,19 +625,131 @@ void URenderer::RenderLevel(UCamera* InCurrentCamera)
 				RenderingContext.AlphaDecals.push_back(Decal);
 			}
 		}
-		
-		UStatOverlay::GetInstance().RecordDecalCollection(
-			static_cast<uint32>(CurrentLevel->GetAllDecals().size()),
-			static_cast<uint32>(CurrentLevel->GetVisibleDecals().size())
-			);
 	}
+}
 
-	for (auto RenderPass: RenderPasses)
+void URenderer::BuildPrimitiveBuckets(const FRenderScene* InScene, const TArray<UPrimitiveComponent*>& InVisiblePrims,
+	FRenderingContext& OutContext)
+{
+	OutContext.AllPrimitives = InVisiblePrims;
+	OutContext.StaticMeshProxies.clear();
+	OutContext.PrimitiveProxies.clear();
+	OutContext.BillBoards.clear();
+	OutContext.Texts.clear();
+	OutContext.FireBalls.clear();
+
+	// 패스 분류는 프록시를 만들 때 한 번만 하므로 여기서는 Cast 없이 나눔
+	for (UPrimitiveComponent* Prim : InVisiblePrims)
 	{
-		RenderPass->Execute(RenderingContext);
+		const int32 ProxyIndex = InScene->FindProxy(Prim);
+		if (ProxyIndex < 0) { continue; }
+
+		switch (InScene->GetPass(ProxyIndex))
+		{
+		case ERenderProxyPass::StaticMesh:
+			OutContext.StaticMeshProxies.push_back(ProxyIndex);
+			break;
+		case ERenderProxyPass::Primitive:
+			OutContext.PrimitiveProxies.push_back(ProxyIndex);
+			break;
+		case ERenderProxyPass::BillBoard:
+			OutContext.BillBoards.push_back(static_cast<UBillBoardComponent*>(Prim));
+			break;
+		case ERenderProxyPass::Text:
+			OutContext.Texts.push_back(static_cast<UTextComponent*>(Prim));
+			break;
+		case ERenderProxyPass::FireBall:
+			OutContext.FireBalls.push_back(static_cast<UFireBallComponent*>(Prim));
+			break;
+		default:
+			break;
+		}
 	}
 }
 
+void URenderer::RecordViews(uint32 InViewCount)
+{
+	// 작업 하나가 맡은 패스를 모든 뷰포트에 대해 뷰포트 순서대로 기록
+	// 패스의 정렬 버퍼 / 동적 스트림은 패스마다 하나뿐이라 같은 패스를 여러 스레드가 동시에 기록하지 않음
+	RenderJobs.ParallelFor(static_cast<uint32>(PassRecordingJobs.size()), [this, InViewCount](uint32 JobIndex)
+	{
+		for (uint32 PassIndex : PassRecordingJobs[JobIndex])
+		{
+			for (uint32 ViewIndex = 0; ViewIndex < InViewCount; ++ViewIndex)
+			{
+				FViewRecording& View = ViewRecordings[ViewIndex];
+				RenderPasses[PassIndex]->Execute(View.Context, View.PassCommandLists[PassIndex]);
+			}
+		}
+	});
+}
+
+void URenderer::SubmitView(FViewRecording& InView, FNullCommandExecutor* InNullExecutor)
+{
+	// 패스마다 바로 제출해서 커맨드 리스트를 거치지 않는 코드(즉시 실행 패스, 에디터 프리미티브, 후처리)와 순서를 맞춤
+	for (uint32 PassIndex = 0; PassIndex < static_cast<uint32>(RenderPasses.size()); ++PassIndex)
+	{
+		FRenderCommandList& PassCommandList = InView.PassCommandLists[PassIndex];
+		if (RenderPasses[PassIndex]->GetRecordingMode() == ERenderPassRecording::Immediate)
+		{
+			RenderPasses[PassIndex]->Execute(InView.Context, PassCommandList);
+		}
+		SubmitCommandList(PassCommandList, InNullExecutor);
+	}
+}
+
+void URenderer::SubmitCommandList(FRenderCommandList& InCommandList, FNullCommandExecutor* InNullExecutor)
+{
+	if (!InCommandList.IsEmpty())
+	{
+		PeakCommandBytes = std::max(PeakCommandBytes, InCommandList.GetByteSize());
+		if (InNullExecutor)
+		{
+			InCommandList.Execute(*InNullExecutor);
+		}
+		else
+		{
+			CommandExecutor->BeginCommandList(InCommandList);
+			InCommandList.Execute(*CommandExecutor);
+		}
+	}
+	// 비어 있어도 해제 대기 리소스가 있을 수 있음
+	InCommandList.Reset();
+}
+
+FNullBackendBenchmarkResult URenderer::RunNullBackendBenchmark(uint32 InFrameCount)
+{
+	FNullBackendBenchmarkResult Result;
+	ULevel* CurrentLevel = GWorld->GetLevel();
+	if (!CurrentLevel || InFrameCount == 0 || ViewportClient->GetViewports().empty()) { return Result; }
+
+	FViewportClient* ActiveClient = ViewportClient->GetActiveViewportClient();
+	FViewportClient& BenchmarkClient = ActiveClient ? *ActiveClient : ViewportClient->GetViewports()[0];
+	FViewRecording& View = AddViewRecording(0, &BenchmarkClient.Camera, BenchmarkClient.GetViewportInfo());
+
+	FNullCommandExecutor NullExecutor;
+	PeakCommandBytes = 0;
+
+	double TotalMs = 0.0;
+	for (uint32 Frame = 0; Frame < InFrameCount; ++Frame)
+	{
+		++FrameNumber;
+		NullExecutor.ResetStats();
+		FScopeCycleCounter FrameCounter(TStatId("NullBackendFrame"));
+		// 카메라는 마지막 프레임의 컬링 결과를 그대로 씀
+		PrepareViews(CurrentLevel, 1, false);
+		RecordViews(1);
+		SubmitView(View, &NullExecutor);
+		TotalMs += FrameCounter.Finish();
+	}
+
+	Result.FrameCount = InFrameCount;
+	Result.AverageFrameMs = TotalMs / InFrameCount;
+	Result.PeakCommandBytes = PeakCommandBytes;
+	Result.LastFrameStats = NullExecutor.GetStats();
+	return Result;
+}
+
 void URenderer::RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride, uint32 InIndexBufferStride)
 {
     // Use the global stride if InStride is 0
@@ -491,7 +782,7 @@ void URenderer::RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const
     if (InPrimitive.IndexBuffer && InPrimitive.NumIndices > 0)
     {
         Pipeline->SetIndexBuffer(InPrimitive.IndexBuffer, InIndexBufferStride);
-        Pipeline->DrawIndexed(InPrimitive.NumIndices, 0, 0);
+        Pipeline->DrawIndexed(InPrimitive.NumIndices, InPrimitive.StartIndex, 0);
     }
     else
     {
@@ -672,8 +963,8 @@ void URenderer::ExecutePostProcess(UCamera* InCurrentCamera, const D3D11_VIEWPOR
 	Pipeline->SetConstantBuffer(0, false, ConstantBufferPostProcessParameters);
 
 	// ?스 ?스??플??(Scene Color + Scene Depth)
-	ID3D11ShaderResourceView* srvs[2] = { SceneColorSRV, SceneDepthSRV };
-	Context->PSSetShaderResources(0, 2, srvs);
+	Pipeline->SetTexture(0, false, SceneColorSRV);
+	Pipeline->SetTexture(1, false, SceneDepthSRV);
 	Pipeline->SetSamplerState(0, false, PostProcessSamplerState);
 
 	// Fullscreen Quad 그리?(RenderFog? ?일??방식)
@@ -684,8 +975,10 @@ void URenderer::ExecutePostProcess(UCamera* InCurrentCamera, const D3D11_VIEWPOR
 	Pipeline->DrawIndexed(6, 0, 0);
 
 	// SRV ?바?드(경고 방?)
-	ID3D11ShaderResourceView* NullSrvs[2] = { nullptr, nullptr };
-	Context->PSSetShaderResources(0, 2, NullSrvs);
+	// 다음 뷰포트가 Scene RT를 렌더 타깃으로 바인딩하기 전에 해제되어 있어야 하므로 바로 반영
+	Pipeline->SetTexture(0, false, nullptr);
+	Pipeline->SetTexture(1, false, nullptr);
+	Pipeline->FlushBindings();
 }
 void URenderer::UpdatePostProcessConstantBuffer()
 {
@@ -0,0 +1,214 @@
+#include "pch.h"
+#include "Render/Renderer/Public/UploadRingAllocator.h"
+
+#include <random>
+
+void FUploadRingAllocator::Initialize(uint64 InCapacity)
+{
+	Capacity = InCapacity;
+	WrapCount = 0;
+	Reset();
+}
+
+uint64 FUploadRingAllocator::Allocate(uint64 InSize, uint64 InAlignment)
+{
+	if (InSize == 0 || InSize > Capacity) { return InvalidOffset; }
+
+	// GPU가 읽는 영역도, 회수를 기다리는 프레임도 없으면 처음부터 씀 (끝부분 패딩이 생기지 않도록)
+	// 기다리는 프레임이 있으면 회수할 때 Tail이 그 프레임의 EndOffset으로 가므로 Head를 옮기면 안 됨
+	if (UsedBytes == 0 && FrameMarks.empty())
+	{
+		Head = 0;
+		Tail = 0;
+	}
+	else if (UsedBytes > 0 && Head == Tail)
+	{
+		return InvalidOffset;
+	}
+
+	const uint64 AlignedHead = (Head + InAlignment - 1) & ~(InAlignment - 1);
+	uint64 Offset = InvalidOffset;
+	uint64 Consumed = 0;
+
+	if (Head >= Tail)
+	{
+		// 사용 중인 영역이 [Tail, Head)로 이어져 있음: 뒤쪽 빈 공간, 모자라면 앞쪽 [0, Tail)
+		if (AlignedHead + InSize <= Capacity)
+		{
+			Offset = AlignedHead;
+			Consumed = AlignedHead + InSize - Head;
+		}
+		else if (InSize <= Tail)
+		{
+			Offset = 0;
+			Consumed = Capacity - Head + InSize;
+			++WrapCount;
+		}
+	}
+	else if (AlignedHead + InSize <= Tail)
+	{
+		// 이미 한 바퀴 돌아서 빈 공간은 [Head, Tail)뿐
+		Offset = AlignedHead;
+		Consumed = AlignedHead + InSize - Head;
+	}
+
+	if (Offset == InvalidOffset) { return InvalidOffset; }
+
+	Head = Offset + InSize;
+	UsedBytes += Consumed;
+	CurrentFrameBytes += Consumed;
+	return Offset;
+}
+
+void FUploadRingAllocator::EndFrame(uint64 InFenceValue)
+{
+	FrameMarks.push_back({ InFenceValue, Head, CurrentFrameBytes });
+	CurrentFrameBytes = 0;
+}
+
+void FUploadRingAllocator::Retire(uint64 InCompletedFenceValue)
+{
+	while (!FrameMarks.empty() && FrameMarks.front().FenceValue <= InCompletedFenceValue)
+	{
+		Tail = FrameMarks.front().EndOffset;
+		UsedBytes -= FrameMarks.front().Bytes;
+		FrameMarks.pop_front();
+	}
+}
+
+void FUploadRingAllocator::Reset()
+{
+	Head = 0;
+	Tail = 0;
+	UsedBytes = 0;
+	CurrentFrameBytes = 0;
+	FrameMarks.clear();
+}
+
+FUploadRingCheckResult RunUploadRingCheck(uint32 InFrameCount)
+{
+	struct FLiveAllocation
+	{
+		uint64 Offset;
+		uint64 Size;
+		uint64 FenceValue;
+	};
+
+	FUploadRingCheckResult Result;
+	std::mt19937 Random(44);
+
+	// 무작위 시나리오: 링 크기 1~64KB, GPU가 0~3 프레임 뒤처지고 가끔 멈춤
+	for (uint32 RingIndex = 0; RingIndex < 32; ++RingIndex)
+	{
+		FUploadRingAllocator Allocator;
+		const uint64 Capacity = 1024ull * (1 + Random() % 64);
+		const uint64 Lag = Random() % 4;
+		Allocator.Initialize(Capacity);
+
+		TArray<FLiveAllocation> LiveAllocations;
+		uint64 FenceValue = 0;
+		uint64 CompletedFenceValue = 0;
+
+		for (uint32 Frame = 0; Frame < InFrameCount; ++Frame)
+		{
+			if (FenceValue > Lag && Random() % 8 != 0)
+			{
+				CompletedFenceValue = std::max(CompletedFenceValue, FenceValue - Lag);
+			}
+			Allocator.Retire(CompletedFenceValue);
+			LiveAllocations.erase(std::remove_if(LiveAllocations.begin(), LiveAllocations.end(),
+				[CompletedFenceValue](const FLiveAllocation& Live) { return Live.FenceValue <= CompletedFenceValue; }),
+				LiveAllocations.end());
+
+			if (Allocator.Allocate(Capacity + 1, 16) != FUploadRingAllocator::InvalidOffset)
+			{
+				++Result.OversizeErrors;
+			}
+
+			const uint32 RequestCount = Random() % 12;
+			for (uint32 Request = 0; Request < RequestCount; ++Request)
+			{
+				const uint64 Size = 1 + Random() % (Capacity / 4);
+				const uint64 Alignment = 1ull << (Random() % 9);
+				const uint64 Offset = Allocator.Allocate(Size, Alignment);
+				if (Offset == FUploadRingAllocator::InvalidOffset)
+				{
+					++Result.RejectedCount;
+					continue;
+				}
+
+				++Result.AllocationCount;
+				if (Offset % Alignment != 0 || Offset + Size > Capacity)
+				{
+					++Result.AlignmentErrors;
+				}
+				for (const FLiveAllocation& Live : LiveAllocations)
+				{
+					if (Offset < Live.Offset + Live.Size && Live.Offset < Offset + Size)
+					{
+						++Result.OverlapErrors;
+						break;
+					}
+				}
+				LiveAllocations.push_back({ Offset, Size, FenceValue + 1 });
+			}
+
+			Allocator.EndFrame(++FenceValue);
+			if (Allocator.GetUsedBytes() > Capacity)
+			{
+				++Result.OverlapErrors;
+			}
+		}
+
+		Allocator.Retire(FenceValue);
+		if (Allocator.GetUsedBytes() != 0)
+		{
+			++Result.LeakErrors;
+		}
+
+		++Result.RingCount;
+		Result.FrameCount += InFrameCount;
+		Result.WrapCount += Allocator.GetWrapCount();
+	}
+
+	// 고정 시나리오: 256바이트 링에서 끝부분이 모자라면 0으로 되감고, 진행 중 프레임이 있으면 거절
+	{
+		FUploadRingAllocator Allocator;
+		Allocator.Initialize(256);
+		const bool bFirstFrame = Allocator.Allocate(128, 16) == 0 && Allocator.Allocate(100, 16) == 128;
+		Allocator.EndFrame(1);
+		const bool bFullWhileInFlight = Allocator.Allocate(64, 16) == FUploadRingAllocator::InvalidOffset;
+		Allocator.Retire(1);
+		const bool bRestartAtZero = Allocator.Allocate(64, 16) == 0;
+		Allocator.EndFrame(2);
+		// Head 64에서 200은 뒤쪽에 들어가지 않고 [0, Tail) 공간도 부족
+		const bool bNoRoomBehindTail = Allocator.Allocate(200, 16) == FUploadRingAllocator::InvalidOffset;
+		Allocator.Retire(2);
+		const bool bOversizeRejected = Allocator.Allocate(257, 1) == FUploadRingAllocator::InvalidOffset;
+		if (!(bFirstFrame && bFullWhileInFlight && bRestartAtZero && bNoRoomBehindTail && bOversizeRejected))
+		{
+			++Result.WrapErrors;
+		}
+
+		// 끝에 64바이트만 남은 상태에서 앞쪽이 회수되면 96바이트 요청은 0으로 되감기
+		Allocator.Initialize(256);
+		Allocator.Allocate(96, 16);
+		Allocator.EndFrame(1);
+		Allocator.Allocate(96, 16);
+		Allocator.EndFrame(2);
+		Allocator.Retire(1);
+		const bool bWrapped = Allocator.Allocate(96, 16) == 0 && Allocator.GetWrapCount() == 1;
+		if (!bWrapped)
+		{
+			++Result.WrapErrors;
+		}
+	}
+
+	if (Result.GetErrorCount() > 0)
+	{
+		UE_LOG_ERROR("UploadRingCheck: alignment %u, overlap %u, oversize %u, wrap %u, leak %u",
+			Result.AlignmentErrors, Result.OverlapErrors, Result.OversizeErrors, Result.WrapErrors, Result.LeakErrors);
+	}
+
+	return Result;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Render/Renderer/Public/UploadRingAllocator.h"
+
+/**
+ * @brief 상수 버퍼 링 통계 (render cbring)
+ */
+struct FConstantBufferRingStats
+{
+	uint32 Capacity = 0;
+	uint32 LastFrameBytes = 0;
+	uint32 PeakFrameBytes = 0;
+	uint32 LastFrameMaps = 0;		// 커맨드 리스트마다 한 번
+	uint32 Discards = 0;			// GPU가 링을 따라오지 못해 버퍼를 통째로 교체한 횟수
+	uint32 FallbackMaps = 0;		// 링에 담지 못해 버퍼마다 Map DISCARD로 올린 커맨드 리스트 수
+	uint32 FramesInFlight = 0;
+};
+
+/**
+ * @brief 프레임 단위 상수 버퍼 업로드 링 (D3D11.1 상수 버퍼 오프셋 바인딩)
+ *
+ * 큰 동적 상수 버퍼 하나에 커맨드 리스트의 상수 갱신을 모아 WRITE_NO_OVERWRITE로 한 번에 쓰고,
+ * 드로우마다 *SetConstantBuffers1로 오프셋만 바꿔 바인딩함 -> 작은 버퍼마다 Map(DISCARD)로 이름을 바꾸던 비용이 없어짐
+ * GPU가 아직 읽는 영역은 프레임마다 발행하는 이벤트 쿼리(펜스)가 끝날 때까지 덮어쓰지 않음
+ *
+ * 오프셋 바인딩을 지원하지 않는 하드웨어에서는 IsSupported()가 false이고, 호출자는 기존 Map(DISCARD) 경로를 씀
+ */
+class FConstantBufferRing
+{
+public:
+	static constexpr uint32 MaxFramesInFlight = 3;
+
+	void Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext, uint32 InCapacity);
+	void Release();
+
+	bool IsSupported() const { return RingBuffer != nullptr; }
+	ID3D11Buffer* GetBuffer() const { return RingBuffer; }
+
+	/**
+	 * @brief InSize 바이트를 할당하고 Map해서 쓸 위치를 반환 (Unmap 전까지 유효)
+	 * @return 공간이 없거나 지원하지 않으면 nullptr
+	 */
+	uint8* Map(uint32 InSize, uint32 InAlignment, uint32& OutOffset);
+	void Unmap();
+
+	// GPU가 끝낸 프레임의 영역을 회수
+	void BeginFrame();
+	// 이번 프레임의 할당을 펜스와 묶음 (Present 뒤)
+	void EndFrame();
+
+	const FConstantBufferRingStats& GetStats() const { return Stats; }
+
+private:
+	FUploadRingAllocator Allocator;
+	ID3D11DeviceContext* DeviceContext = nullptr;
+	ID3D11Buffer* RingBuffer = nullptr;
+
+	ID3D11Query* FrameQueries[MaxFramesInFlight] = {};
+	uint64 QueryFenceValues[MaxFramesInFlight] = {};
+	uint64 NextFenceValue = 1;
+	uint64 CompletedFenceValue = 0;
+
+	bool bNeedsDiscard = true;		// 첫 Map은 DISCARD
+	uint32 FrameBytes = 0;
+	uint32 FrameMaps = 0;
+	FConstantBufferRingStats Stats;
+};
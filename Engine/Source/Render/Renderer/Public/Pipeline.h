@@ -1,4 +1,7 @@
 #pragma once
+#include "Render/Renderer/Public/PipelineStateCache.h"
+
+struct ID3D11DeviceContext1;
 
 struct FPipelineInfo
 {
@@ -25,6 +28,11 @@ public:
 
 	void SetConstantBuffer(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer);
 
+	/// @brief 상수 버퍼의 일부 구간을 바인딩 (D3D11.1, 단위는 16바이트 상수이고 16의 배수)
+	void SetConstantBufferRange(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer, uint32 FirstConstant, uint32 NumConstants);
+
+	bool SupportsConstantBufferOffsets() const { return DeviceContext1 != nullptr; }
+
 	void SetTexture(uint32 Slot, bool bIsVS, ID3D11ShaderResourceView* Srv);
 
 	void SetSamplerState(uint32 Slot, bool bIsVS, ID3D11SamplerState* SamplerState);
@@ -33,7 +41,19 @@ public:
 
 	void DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32 BaseVertexLocation);
 
+	void DrawIndexedInstanced(uint32 IndexCountPerInstance, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation);
+
+	/// @brief 대기 중인 바인딩을 지금 디바이스에 반영 (드로우는 자동으로 호출, 렌더 타깃을 바꾸기 전 SRV 해제 등에 사용)
+	void FlushBindings();
+
+	/// @brief UPipeline을 거치지 않고 컨텍스트 상태를 바꾼 뒤 호출 (다음 요청은 같은 값이어도 다시 보냄)
+	void InvalidateState();
+
+	const FPipelineStateCacheStats& GetStateStats() const { return StateCache.GetStats(); }
+	void ResetStateStats() { StateCache.ResetStats(); }
+
 private:
-	FPipelineInfo LastPipelineInfo{};
+	FPipelineStateCache StateCache;
 	ID3D11DeviceContext* DeviceContext;
+	ID3D11DeviceContext1* DeviceContext1 = nullptr;
 };
@@ -0,0 +1,269 @@
+#pragma once
+
+struct FPipelineInfo;
+
+enum class EShaderStage : uint8
+{
+	Vertex,
+	Pixel,
+
+	Count
+};
+
+/**
+ * @brief 상수 버퍼 슬롯 하나의 바인딩 (NumConstants가 0이면 버퍼 전체, 아니면 D3D11.1 오프셋 바인딩)
+ */
+struct FConstantBufferBinding
+{
+	ID3D11Buffer* Buffer = nullptr;
+	uint32 FirstConstant = 0;
+	uint32 NumConstants = 0;
+
+	bool IsRange() const { return NumConstants != 0; }
+	bool operator==(const FConstantBufferBinding& InOther) const
+	{
+		return Buffer == InOther.Buffer && FirstConstant == InOther.FirstConstant && NumConstants == InOther.NumConstants;
+	}
+	bool operator!=(const FConstantBufferBinding& InOther) const { return !(*this == InOther); }
+};
+
+/**
+ * @brief 섀도 상태 캐시 통계
+ * RequestedBinds - ChangedBinds가 걸러진 요청 수, IssuedCalls는 연속 슬롯을 묶은 뒤의 디바이스 호출 수
+ */
+struct FPipelineStateCacheStats
+{
+	uint32 RequestedBinds = 0;		// Set* 요청 수 (파이프라인 상태는 필드마다 1)
+	uint32 ChangedBinds = 0;		// Flush 때 디바이스 값과 실제로 달랐던 슬롯 / 필드 수
+	uint32 IssuedCalls = 0;
+
+	uint32 GetFilteredBinds() const { return RequestedBinds - ChangedBinds; }
+
+	FPipelineStateCacheStats& operator+=(const FPipelineStateCacheStats& InOther)
+	{
+		RequestedBinds += InOther.RequestedBinds;
+		ChangedBinds += InOther.ChangedBinds;
+		IssuedCalls += InOther.IssuedCalls;
+		return *this;
+	}
+};
+
+/**
+ * @brief 디바이스 컨텍스트 바인딩의 섀도 상태 (값 비교만 하고 D3D를 호출하지 않으므로 Null 백엔드와 공유)
+ *
+ * Set*은 대기 값에 기록하고 슬롯의 더티 비트만 세움. 드로우 직전 Flush가 더티 슬롯 중
+ * 디바이스에 올라간 값과 다른 것만 골라 연속된 슬롯끼리 한 번의 싱크 호출로 넘김
+ * 깊이 스텐실 상태는 기존 UpdatePipeline처럼 nullptr이면 바꾸지 않음
+ *
+ * 캐시를 거치지 않고 컨텍스트를 건드리는 코드(D2D / ImGui 등) 뒤에는 Invalidate로 디바이스 값을 모르는 상태로 돌려야 함
+ * 그 뒤에 요청된 값은 같은 값이어도 다시 보냄
+ *
+ * 싱크(TSink)는 다음 멤버 함수를 가진 타입
+ *   SetPrimitiveTopology / SetInputLayout / SetVertexShader / SetRasterizerState / SetDepthStencilState / SetPixelShader / SetBlendState,
+ *   SetVertexBuffer(Buffer, Stride), SetIndexBuffer(Buffer, Stride),
+ *   SetConstantBuffers(Stage, StartSlot, Count, const FConstantBufferBinding*),
+ *   SetShaderResources(Stage, StartSlot, Count, ID3D11ShaderResourceView* const*), SetSamplers(Stage, StartSlot, Count, ID3D11SamplerState* const*)
+ */
+class FPipelineStateCache
+{
+public:
+	static constexpr uint32 MaxConstantBuffers = D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT;
+	static constexpr uint32 MaxShaderResources = 16;		// 엔진이 쓰는 t 레지스터 범위, 넘는 슬롯은 호출자가 바로 보냄
+	static constexpr uint32 MaxSamplers = D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT;
+
+	FPipelineStateCache() { Invalidate(); }
+
+	void SetPipeline(const FPipelineInfo& InInfo);
+	void SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride);
+	void SetIndexBuffer(ID3D11Buffer* InBuffer, uint32 InStride);
+	void SetConstantBuffer(EShaderStage InStage, uint32 InSlot, const FConstantBufferBinding& InBinding);
+	void SetShaderResource(EShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InShaderResourceView);
+	void SetSampler(EShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSamplerState);
+
+	template<typename TSink>
+	void Flush(TSink& InSink);
+
+	void Invalidate();
+
+	const FPipelineStateCacheStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = {}; }
+
+private:
+	/**
+	 * @brief 한 단계의 한 종류 슬롯 (대기 값 / 디바이스 값 / 요청이 들어온 슬롯 비트)
+	 */
+	template<typename TValue, uint32 SlotCount>
+	struct TBindingSlots
+	{
+		static_assert(SlotCount < 32, "DirtyMask는 32비트");
+
+		TValue Pending[SlotCount] = {};
+		TValue Committed[SlotCount] = {};
+		uint32 DirtyMask = 0;
+
+		void Set(uint32 InSlot, const TValue& InValue)
+		{
+			Pending[InSlot] = InValue;
+			DirtyMask |= 1u << InSlot;
+		}
+
+		/**
+		 * @brief 요청이 들어왔고 값이 바뀐 슬롯 중 이웃한 것을 InCanJoin이 허락하는 만큼 이어 붙여 InCommit(StartSlot, Count)로 넘김
+		 * @return 바뀐 슬롯 수
+		 */
+		template<typename TCanJoin, typename TCommit>
+		uint32 Flush(TCanJoin&& InCanJoin, TCommit&& InCommit)
+		{
+			auto IsChanged = [this](uint32 InSlot)
+			{
+				return (DirtyMask & (1u << InSlot)) != 0 && Pending[InSlot] != Committed[InSlot];
+			};
+
+			uint32 Changed = 0;
+			uint32 Slot = 0;
+			while (Slot < SlotCount && (DirtyMask >> Slot) != 0)
+			{
+				if (!IsChanged(Slot))
+				{
+					++Slot;
+					continue;
+				}
+
+				const uint32 RunStart = Slot;
+				while (Slot < SlotCount && IsChanged(Slot) && InCanJoin(Pending[RunStart], Pending[Slot]))
+				{
+					Committed[Slot] = Pending[Slot];
+					++Slot;
+				}
+				InCommit(RunStart, Slot - RunStart);
+				Changed += Slot - RunStart;
+			}
+			DirtyMask = 0;
+			return Changed;
+		}
+
+		void Invalidate(const TValue& InUnknown)
+		{
+			std::fill(std::begin(Committed), std::end(Committed), InUnknown);
+		}
+	};
+
+	struct FBufferBinding
+	{
+		ID3D11Buffer* Buffer = nullptr;
+		uint32 Stride = 0;
+
+		bool operator==(const FBufferBinding& InOther) const { return Buffer == InOther.Buffer && Stride == InOther.Stride; }
+		bool operator!=(const FBufferBinding& InOther) const { return !(*this == InOther); }
+	};
+
+	// Invalidate 후 디바이스 값 자리에 넣는 값 (어떤 실제 객체와도 같지 않음)
+	template<typename T>
+	static T* UnknownObject() { return reinterpret_cast<T*>(~static_cast<uintptr_t>(0)); }
+
+	// 파이프라인 상태 (필드 순서는 FPipelineInfo와 같음)
+	struct FPipelineFields
+	{
+		D3D11_PRIMITIVE_TOPOLOGY Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		ID3D11InputLayout* InputLayout = nullptr;
+		ID3D11VertexShader* VertexShader = nullptr;
+		ID3D11RasterizerState* RasterizerState = nullptr;
+		ID3D11DepthStencilState* DepthStencilState = nullptr;
+		ID3D11PixelShader* PixelShader = nullptr;
+		ID3D11BlendState* BlendState = nullptr;
+	};
+	FPipelineFields PendingPipeline;
+	FPipelineFields CommittedPipeline;
+	bool bPipelineDirty = false;
+	bool bDepthStencilRequested = false;	// 깊이 스텐실은 요청이 있을 때만 반영 (Invalidate 뒤에도 이전 요청을 되살리지 않음)
+
+	FBufferBinding PendingVertexBuffer;
+	FBufferBinding CommittedVertexBuffer;
+	FBufferBinding PendingIndexBuffer;
+	FBufferBinding CommittedIndexBuffer;
+	bool bVertexBufferDirty = false;
+	bool bIndexBufferDirty = false;
+
+	TBindingSlots<FConstantBufferBinding, MaxConstantBuffers> ConstantBuffers[static_cast<uint32>(EShaderStage::Count)];
+	TBindingSlots<ID3D11ShaderResourceView*, MaxShaderResources> ShaderResources[static_cast<uint32>(EShaderStage::Count)];
+	TBindingSlots<ID3D11SamplerState*, MaxSamplers> Samplers[static_cast<uint32>(EShaderStage::Count)];
+
+	FPipelineStateCacheStats Stats;
+};
+
+template<typename TSink>
+void FPipelineStateCache::Flush(TSink& InSink)
+{
+	if (bPipelineDirty)
+	{
+		FPipelineFields& Pending = PendingPipeline;
+		FPipelineFields& Committed = CommittedPipeline;
+		auto Commit = [this](auto& InCommitted, auto InPending, auto&& InIssue)
+		{
+			if (InCommitted == InPending) { return; }
+			InCommitted = InPending;
+			InIssue(InPending);
+			++Stats.ChangedBinds;
+			++Stats.IssuedCalls;
+		};
+		Commit(Committed.Topology, Pending.Topology, [&](auto InValue) { InSink.SetPrimitiveTopology(InValue); });
+		Commit(Committed.InputLayout, Pending.InputLayout, [&](auto InValue) { InSink.SetInputLayout(InValue); });
+		Commit(Committed.VertexShader, Pending.VertexShader, [&](auto InValue) { InSink.SetVertexShader(InValue); });
+		Commit(Committed.RasterizerState, Pending.RasterizerState, [&](auto InValue) { InSink.SetRasterizerState(InValue); });
+		if (bDepthStencilRequested)
+		{
+			Commit(Committed.DepthStencilState, Pending.DepthStencilState, [&](auto InValue) { InSink.SetDepthStencilState(InValue); });
+		}
+		Commit(Committed.PixelShader, Pending.PixelShader, [&](auto InValue) { InSink.SetPixelShader(InValue); });
+		Commit(Committed.BlendState, Pending.BlendState, [&](auto InValue) { InSink.SetBlendState(InValue); });
+		bPipelineDirty = false;
+		bDepthStencilRequested = false;
+	}
+
+	if (bVertexBufferDirty && PendingVertexBuffer != CommittedVertexBuffer)
+	{
+		CommittedVertexBuffer = PendingVertexBuffer;
+		InSink.SetVertexBuffer(PendingVertexBuffer.Buffer, PendingVertexBuffer.Stride);
+		++Stats.ChangedBinds;
+		++Stats.IssuedCalls;
+	}
+	if (bIndexBufferDirty && PendingIndexBuffer != CommittedIndexBuffer)
+	{
+		CommittedIndexBuffer = PendingIndexBuffer;
+		InSink.SetIndexBuffer(PendingIndexBuffer.Buffer, PendingIndexBuffer.Stride);
+		++Stats.ChangedBinds;
+		++Stats.IssuedCalls;
+	}
+	bVertexBufferDirty = false;
+	bIndexBufferDirty = false;
+
+	auto AlwaysJoin = [](const auto&, const auto&) { return true; };
+	for (uint32 StageIndex = 0; StageIndex < static_cast<uint32>(EShaderStage::Count); ++StageIndex)
+	{
+		const EShaderStage Stage = static_cast<EShaderStage>(StageIndex);
+
+		// 전체 바인딩과 오프셋 바인딩은 D3D 호출이 다르므로 같은 종류끼리만 묶음
+		auto& StageConstantBuffers = ConstantBuffers[StageIndex];
+		Stats.ChangedBinds += StageConstantBuffers.Flush(
+			[](const FConstantBufferBinding& InFirst, const FConstantBufferBinding& InNext) { return InFirst.IsRange() == InNext.IsRange(); },
+			[&](uint32 InStart, uint32 InCount)
+			{
+				InSink.SetConstantBuffers(Stage, InStart, InCount, &StageConstantBuffers.Pending[InStart]);
+				++Stats.IssuedCalls;
+			});
+
+		auto& StageShaderResources = ShaderResources[StageIndex];
+		Stats.ChangedBinds += StageShaderResources.Flush(AlwaysJoin, [&](uint32 InStart, uint32 InCount)
+		{
+			InSink.SetShaderResources(Stage, InStart, InCount, &StageShaderResources.Pending[InStart]);
+			++Stats.IssuedCalls;
+		});
+
+		auto& StageSamplers = Samplers[StageIndex];
+		Stats.ChangedBinds += StageSamplers.Flush(AlwaysJoin, [&](uint32 InStart, uint32 InCount)
+		{
+			InSink.SetSamplers(Stage, InStart, InCount, &StageSamplers.Pending[InStart]);
+			++Stats.IssuedCalls;
+		});
+	}
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "Render/Renderer/Public/RenderCommandList.h"
+
+class FConstantBufferRing;
+
+/**
+ * @brief FRenderCommandList를 D3D11로 재생
+ * 파이프라인 / 버퍼 바인딩은 UPipeline을 거치므로, 커맨드 리스트를 쓰지 않는 코드와 상태 캐시를 공유함
+ *
+ * 상수 버퍼 링이 있으면 BeginCommandList에서 리스트의 상수 갱신을 링에 한 번에 올리고,
+ * 재생 중에는 갱신된 버퍼가 꽂힌 슬롯을 링의 해당 구간으로 다시 바인딩함 (D3D의 "버퍼 내용이 바뀜"과 같은 결과)
+ * 링을 쓸 수 없으면 갱신마다 원래 버퍼를 Map(DISCARD)
+ */
+class FD3D11CommandExecutor
+{
+public:
+	FD3D11CommandExecutor(UPipeline* InPipeline, ID3D11DeviceContext* InDeviceContext, FConstantBufferRing* InConstantBufferRing = nullptr)
+		: Pipeline(InPipeline), DeviceContext(InDeviceContext), ConstantBufferRing(InConstantBufferRing) {}
+
+	// Execute 전에 호출 (리스트 밖에서 바인딩된 슬롯은 모르므로 슬롯 추적도 여기서 초기화)
+	void BeginCommandList(const FRenderCommandList& InCommandList);
+
+	void Execute(const FSetPipelineCommand& InCommand);
+	void Execute(const FSetVertexBufferCommand& InCommand);
+	void Execute(const FSetIndexBufferCommand& InCommand);
+	void Execute(const FSetConstantBufferCommand& InCommand);
+	void Execute(const FSetTextureCommand& InCommand);
+	void Execute(const FSetSamplerStateCommand& InCommand);
+	void Execute(const FSetRenderTargetsCommand& InCommand);
+	void Execute(const FUpdateBufferCommand& InCommand, const void* InData);
+	void Execute(const FUpdateConstantBufferCommand& InCommand, const void* InData);
+	void Execute(const FDrawCommand& InCommand);
+	void Execute(const FDrawIndexedCommand& InCommand);
+	void Execute(const FDrawIndexedInstancedCommand& InCommand);
+
+private:
+	// 링에 올라간 논리 상수 버퍼의 최신 구간
+	struct FRingRange
+	{
+		ID3D11Buffer* Buffer;
+		uint32 Offset;
+		uint32 Size;
+	};
+
+	void BindConstantBuffer(uint32 InSlot, bool bInIsVS, ID3D11Buffer* InBuffer);
+	void MapDiscard(ID3D11Buffer* InBuffer, const void* InData, uint32 InDataSize);
+
+	UPipeline* Pipeline;
+	ID3D11DeviceContext* DeviceContext;
+	FConstantBufferRing* ConstantBufferRing;
+
+	static constexpr uint32 ConstantBufferSlotCount = D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT;
+	ID3D11Buffer* BoundVSConstantBuffers[ConstantBufferSlotCount] = {};
+	ID3D11Buffer* BoundPSConstantBuffers[ConstantBufferSlotCount] = {};
+	TArray<FRingRange> RingRanges;		// 리스트 하나에서 갱신되는 버퍼는 몇 개뿐이므로 선형 탐색
+	uint32 RingCursor = 0;
+	bool bUseRing = false;
+};
+
+/**
+ * @brief 커맨드 리스트 재생 결과 통계 (한 번 이상의 Execute 누적)
+ */
+struct FRenderCommandStats
+{
+	uint32 CommandCount = 0;
+	uint32 DrawCalls = 0;
+	uint64 VertexCount = 0;				// Draw는 정점 수, DrawIndexed는 인덱스 수 (인스턴스 드로우는 인스턴스 수만큼 곱함)
+	uint32 InstancedDrawCalls = 0;		// DrawCalls 중 인스턴스 드로우
+	uint32 InstanceCount = 0;			// 인스턴스 드로우로 그린 인스턴스 합
+	uint32 PipelineStateChanges = 0;	// 섀도 상태 캐시를 통과해서 실제로 바뀌는 파이프라인 상태 수
+	uint32 BufferBinds = 0;				// 정점 / 인덱스 버퍼
+	uint32 ConstantBufferBinds = 0;
+	uint32 TextureBinds = 0;			// SRV / 샘플러
+	uint32 RenderTargetChanges = 0;
+	uint32 BufferUpdates = 0;
+	uint32 BufferAppends = 0;			// BufferUpdates 중 NO_OVERWRITE로 이어 쓴 것
+	uint32 ConstantBufferUpdates = 0;	// BufferUpdates 중 상수 버퍼 (D3D11 실행기는 링 버퍼 구간으로 돌림)
+	uint64 UploadBytes = 0;
+	uint64 Signature = 0;				// 커맨드 종류와 드로우 인자의 해시 (리소스 주소 제외, 회귀 비교용)
+	FPipelineStateCacheStats StateCache;	// UPipeline과 같은 캐시로 걸러진 / 디바이스로 나간 바인딩
+};
+
+/**
+ * @brief GPU 없이 커맨드 리스트를 재생하며 통계만 기록하는 실행기
+ * D3D 객체는 포인터 비교에만 쓰고 호출하지 않으므로 디바이스 없이 헤드리스 벤치마크 / 회귀 테스트에 사용 가능
+ * 바인딩은 UPipeline과 같은 FPipelineStateCache를 거치므로 걸러지는 호출 수도 실제 백엔드와 같음
+ */
+class FNullCommandExecutor
+{
+public:
+	FNullCommandExecutor() { ResetStats(); }
+
+	void Execute(const FSetPipelineCommand& InCommand);
+	void Execute(const FSetVertexBufferCommand& InCommand);
+	void Execute(const FSetIndexBufferCommand& InCommand);
+	void Execute(const FSetConstantBufferCommand& InCommand);
+	void Execute(const FSetTextureCommand& InCommand);
+	void Execute(const FSetSamplerStateCommand& InCommand);
+	void Execute(const FSetRenderTargetsCommand& InCommand);
+	void Execute(const FUpdateBufferCommand& InCommand, const void* InData);
+	void Execute(const FUpdateConstantBufferCommand& InCommand, const void* InData);
+	void Execute(const FDrawCommand& InCommand);
+	void Execute(const FDrawIndexedCommand& InCommand);
+	void Execute(const FDrawIndexedInstancedCommand& InCommand);
+
+	/**
+	 * @brief 통계만 초기화 (섀도 상태는 유지해서 프레임 사이의 상태 변화도 실제 백엔드와 같게 셈)
+	 */
+	void ResetStats();
+	FRenderCommandStats GetStats() const;
+
+private:
+	void MixSignature(ERenderCommandType InType, uint64 InValue);
+	void FlushBindings();
+
+	FRenderCommandStats Stats;
+	FPipelineStateCache StateCache;
+};
@@ -0,0 +1,302 @@
+#pragma once
+#include "Render/Renderer/Public/Pipeline.h"
+
+#include <type_traits>
+
+/**
+ * @brief 렌더 커맨드 종류
+ * 커맨드는 모두 POD이고 D3D 객체는 포인터로만 들고 있으므로, 기록할 때는 디바이스를 건드리지 않음
+ */
+enum class ERenderCommandType : uint8
+{
+	SetPipeline,
+	SetVertexBuffer,
+	SetIndexBuffer,
+	SetConstantBuffer,
+	SetTexture,
+	SetSamplerState,
+	SetRenderTargets,
+	UpdateBuffer,		// 뒤에 DataSize 바이트의 데이터가 붙음 (오프셋 0이면 WRITE_DISCARD, 아니면 WRITE_NO_OVERWRITE 업로드)
+	UpdateConstantBuffer,	// UpdateBuffer와 같지만 실행기가 상수 버퍼 링으로 돌릴 수 있음
+	Draw,
+	DrawIndexed,
+	DrawIndexedInstanced,
+};
+
+struct FRenderCommandHeader
+{
+	ERenderCommandType Type;
+	uint32 Size;		// 헤더부터 다음 커맨드 헤더까지의 바이트 수
+};
+
+struct FSetPipelineCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetPipeline;
+	FPipelineInfo Info;
+};
+
+struct FSetVertexBufferCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetVertexBuffer;
+	ID3D11Buffer* Buffer;
+	uint32 Stride;
+};
+
+struct FSetIndexBufferCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetIndexBuffer;
+	ID3D11Buffer* Buffer;
+	uint32 Stride;		// 2면 16비트 인덱스, 그 외는 32비트
+};
+
+struct FSetConstantBufferCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetConstantBuffer;
+	ID3D11Buffer* Buffer;
+	uint32 Slot;
+	bool bIsVS;
+};
+
+struct FSetTextureCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetTexture;
+	ID3D11ShaderResourceView* ShaderResourceView;
+	uint32 Slot;
+	bool bIsVS;
+};
+
+struct FSetSamplerStateCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetSamplerState;
+	ID3D11SamplerState* SamplerState;
+	uint32 Slot;
+	bool bIsVS;
+};
+
+struct FSetRenderTargetsCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::SetRenderTargets;
+	ID3D11RenderTargetView* RenderTargetView;
+	ID3D11DepthStencilView* DepthStencilView;
+};
+
+struct FUpdateBufferCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::UpdateBuffer;
+	ID3D11Buffer* Buffer;
+	uint32 DataSize;
+	uint32 DestOffset;		// 0이 아니면 같은 프레임에 앞쪽을 이미 쓴 스트림에 이어 붙임
+};
+
+struct FUpdateConstantBufferCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::UpdateConstantBuffer;
+	ID3D11Buffer* Buffer;
+	uint32 DataSize;
+};
+
+struct FDrawCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::Draw;
+	uint32 VertexCount;
+	uint32 StartVertexLocation;
+};
+
+struct FDrawIndexedCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::DrawIndexed;
+	uint32 IndexCount;
+	uint32 StartIndexLocation;
+	int32 BaseVertexLocation;
+};
+
+struct FDrawIndexedInstancedCommand
+{
+	static constexpr ERenderCommandType Type = ERenderCommandType::DrawIndexedInstanced;
+	uint32 IndexCountPerInstance;
+	uint32 InstanceCount;
+	uint32 StartIndexLocation;
+	int32 BaseVertexLocation;
+};
+
+/**
+ * @brief RenderPass가 기록하는 백엔드 독립 커맨드 리스트
+ * 커맨드를 하나의 선형 버퍼에 [헤더][커맨드][데이터] 순서로 이어 붙이고, Execute에서 실행기(Executor)로 그대로 재생
+ * 상수 버퍼 / 동적 버퍼 갱신 데이터도 버퍼 안에 복사해 두므로 재생 순서가 기록 순서와 같음
+ * Reset은 용량을 유지하므로 워밍업 이후에는 프레임마다 할당이 없음
+ *
+ * 실행기는 커맨드 구조체별 멤버 함수를 가진 타입이면 되고 (FD3D11CommandExecutor, FNullCommandExecutor),
+ * 템플릿으로 디스패치해서 커맨드마다 가상 호출이 없음
+ */
+class FRenderCommandList
+{
+public:
+	FRenderCommandList() = default;
+	~FRenderCommandList();
+
+	// 해제 대기 리소스를 두 번 Release하지 않도록 이동만 허용
+	FRenderCommandList(FRenderCommandList&&) = default;
+	FRenderCommandList(const FRenderCommandList&) = delete;
+	FRenderCommandList& operator=(const FRenderCommandList&) = delete;
+
+	// --- 기록 (UPipeline과 같은 인터페이스) ---
+	void UpdatePipeline(const FPipelineInfo& InInfo);
+	void SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride);
+	void SetIndexBuffer(ID3D11Buffer* InBuffer, uint32 InStride);
+	void SetConstantBuffer(uint32 InSlot, bool bInIsVS, ID3D11Buffer* InBuffer);
+	void SetTexture(uint32 InSlot, bool bInIsVS, ID3D11ShaderResourceView* InShaderResourceView);
+	void SetSamplerState(uint32 InSlot, bool bInIsVS, ID3D11SamplerState* InSamplerState);
+	void SetRenderTargets(ID3D11RenderTargetView* InRenderTargetView, ID3D11DepthStencilView* InDepthStencilView);
+	void Draw(uint32 InVertexCount, uint32 InStartVertexLocation);
+	void DrawIndexed(uint32 InIndexCount, uint32 InStartIndexLocation, int32 InBaseVertexLocation);
+	void DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndexLocation, int32 InBaseVertexLocation);
+
+	/**
+	 * @brief 동적 버퍼 전체를 InData로 덮어쓰는 커맨드 (실행 시 Map WRITE_DISCARD)
+	 */
+	void UpdateBuffer(ID3D11Buffer* InBuffer, const void* InData, uint32 InDataSize);
+
+	/**
+	 * @brief 동적 버퍼 갱신 커맨드를 만들고 데이터 영역을 반환 (다음 기록 전까지만 유효)
+	 * 정점 데이터를 임시 배열 없이 커맨드 버퍼에 바로 쓸 때 사용
+	 */
+	void* AllocateBufferUpdate(ID3D11Buffer* InBuffer, uint32 InDataSize);
+
+	/**
+	 * @brief 동적 버퍼의 InDestOffset 위치에 이어 쓰는 갱신 커맨드를 만들고 데이터 영역을 반환
+	 * 오프셋 0은 스트림의 처음이므로 DISCARD, 그 뒤는 GPU가 읽는 앞부분을 건드리지 않는 NO_OVERWRITE로 올림
+	 */
+	void* AllocateBufferAppend(ID3D11Buffer* InBuffer, uint32 InDestOffset, uint32 InDataSize);
+
+	template<typename T>
+	void UpdateConstantBuffer(ID3D11Buffer* InBuffer, const T& InData)
+	{
+		// FVector 등은 복사 생성자가 있어 trivially copyable이 아니지만, 기존 UpdateConstantBufferData처럼 바이트 복사로 올림
+		static_assert(std::is_standard_layout_v<T>, "Constant buffer data must be standard layout");
+		UpdateConstantBufferData(InBuffer, &InData, sizeof(T));
+	}
+	void UpdateConstantBufferData(ID3D11Buffer* InBuffer, const void* InData, uint32 InDataSize);
+
+	// 상수 버퍼 오프셋 바인딩 단위 (16바이트 상수 16개)
+	static constexpr uint32 ConstantBufferAlignment = 256;
+	static uint32 AlignConstantBufferSize(uint32 InSize) { return (InSize + ConstantBufferAlignment - 1) & ~(ConstantBufferAlignment - 1); }
+
+	/**
+	 * @brief 기록된 상수 버퍼 갱신을 기록 순서대로 순회 (InFunction(const FUpdateConstantBufferCommand&, const void* InData))
+	 * 실행기가 재생 전에 리스트의 상수를 링 버퍼에 한 번에 올릴 때 사용
+	 */
+	template<typename TFunction>
+	void ForEachConstantBufferUpdate(TFunction&& InFunction) const
+	{
+		const uint8* Cursor = Buffer.data();
+		const uint8* End = Cursor + Buffer.size();
+		while (Cursor < End)
+		{
+			const FRenderCommandHeader& Header = *reinterpret_cast<const FRenderCommandHeader*>(Cursor);
+			if (Header.Type == ERenderCommandType::UpdateConstantBuffer)
+			{
+				const uint8* Body = Cursor + sizeof(FRenderCommandHeader);
+				InFunction(*reinterpret_cast<const FUpdateConstantBufferCommand*>(Body), Body + sizeof(FUpdateConstantBufferCommand));
+			}
+			Cursor += Header.Size;
+		}
+	}
+
+	// --- 재생 ---
+	template<typename TExecutor>
+	void Execute(TExecutor& InExecutor) const
+	{
+		const uint8* Cursor = Buffer.data();
+		const uint8* End = Cursor + Buffer.size();
+		while (Cursor < End)
+		{
+			const FRenderCommandHeader& Header = *reinterpret_cast<const FRenderCommandHeader*>(Cursor);
+			const uint8* Body = Cursor + sizeof(FRenderCommandHeader);
+
+			switch (Header.Type)
+			{
+			case ERenderCommandType::SetPipeline:
+				InExecutor.Execute(*reinterpret_cast<const FSetPipelineCommand*>(Body));
+				break;
+			case ERenderCommandType::SetVertexBuffer:
+				InExecutor.Execute(*reinterpret_cast<const FSetVertexBufferCommand*>(Body));
+				break;
+			case ERenderCommandType::SetIndexBuffer:
+				InExecutor.Execute(*reinterpret_cast<const FSetIndexBufferCommand*>(Body));
+				break;
+			case ERenderCommandType::SetConstantBuffer:
+				InExecutor.Execute(*reinterpret_cast<const FSetConstantBufferCommand*>(Body));
+				break;
+			case ERenderCommandType::SetTexture:
+				InExecutor.Execute(*reinterpret_cast<const FSetTextureCommand*>(Body));
+				break;
+			case ERenderCommandType::SetSamplerState:
+				InExecutor.Execute(*reinterpret_cast<const FSetSamplerStateCommand*>(Body));
+				break;
+			case ERenderCommandType::SetRenderTargets:
+				InExecutor.Execute(*reinterpret_cast<const FSetRenderTargetsCommand*>(Body));
+				break;
+			case ERenderCommandType::UpdateBuffer:
+				InExecutor.Execute(*reinterpret_cast<const FUpdateBufferCommand*>(Body), Body + sizeof(FUpdateBufferCommand));
+				break;
+			case ERenderCommandType::UpdateConstantBuffer:
+				InExecutor.Execute(*reinterpret_cast<const FUpdateConstantBufferCommand*>(Body), Body + sizeof(FUpdateConstantBufferCommand));
+				break;
+			case ERenderCommandType::Draw:
+				InExecutor.Execute(*reinterpret_cast<const FDrawCommand*>(Body));
+				break;
+			case ERenderCommandType::DrawIndexed:
+				InExecutor.Execute(*reinterpret_cast<const FDrawIndexedCommand*>(Body));
+				break;
+			case ERenderCommandType::DrawIndexedInstanced:
+				InExecutor.Execute(*reinterpret_cast<const FDrawIndexedInstancedCommand*>(Body));
+				break;
+			}
+
+			Cursor += Header.Size;
+		}
+	}
+
+	void Reset();
+
+	/**
+	 * @brief 이 리스트를 재생한 뒤(Reset) InResource를 Release
+	 * 먼저 기록했지만 아직 제출하지 않은 다른 뷰의 리스트가 참조할 수 있는 버퍼를 기록 도중에 교체할 때 사용
+	 */
+	void ReleaseAfterExecute(IUnknown* InResource);
+
+	bool IsEmpty() const { return Buffer.empty(); }
+	uint32 GetCommandCount() const { return CommandCount; }
+	uint32 GetByteSize() const { return static_cast<uint32>(Buffer.size()); }
+	// 상수 갱신을 모두 오프셋 정렬해서 이어 붙였을 때의 크기
+	uint32 GetConstantBufferBytes() const { return ConstantBufferBytes; }
+
+private:
+	static constexpr uint32 CommandAlignment = alignof(void*);
+
+	template<typename TCommand>
+	TCommand& Allocate(uint32 InPayloadSize = 0)
+	{
+		static_assert(std::is_trivially_copyable_v<TCommand>, "Render commands must be POD");
+		static_assert(alignof(TCommand) <= CommandAlignment, "Render command alignment exceeds the command buffer alignment");
+
+		const uint32 BodyOffset = sizeof(FRenderCommandHeader);
+		const uint32 Size = (BodyOffset + sizeof(TCommand) + InPayloadSize + CommandAlignment - 1) & ~(CommandAlignment - 1);
+
+		const size_t Offset = Buffer.size();
+		Buffer.resize(Offset + Size);
+		++CommandCount;
+
+		FRenderCommandHeader* Header = reinterpret_cast<FRenderCommandHeader*>(Buffer.data() + Offset);
+		Header->Type = TCommand::Type;
+		Header->Size = Size;
+		return *reinterpret_cast<TCommand*>(Buffer.data() + Offset + BodyOffset);
+	}
+
+	static_assert(sizeof(FRenderCommandHeader) % alignof(void*) == 0, "Command body must stay pointer aligned");
+
+	TArray<uint8> Buffer;
+	uint32 CommandCount = 0;
+	uint32 ConstantBufferBytes = 0;
+	TArray<IUnknown*> PendingReleases;
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * @brief 렌더 스레드(메인 스레드)가 프레임마다 나눠 주는 작업을 실행하는 워커 스레드 풀
+ * 작업은 ParallelFor 한 번 동안만 존재하고, 호출한 스레드도 같이 작업을 가져가며 모두 끝나야 반환함
+ * 워커가 없으면(Start(0) 또는 병렬 기록 끔) 호출한 스레드에서 순서대로 실행
+ *
+ * 작업 안에서 ParallelFor를 다시 호출하면 안 됨 (한 번에 한 묶음만 실행)
+ */
+class FRenderJobSystem
+{
+public:
+	FRenderJobSystem() = default;
+	~FRenderJobSystem();
+
+	FRenderJobSystem(const FRenderJobSystem&) = delete;
+	FRenderJobSystem& operator=(const FRenderJobSystem&) = delete;
+
+	void Start(uint32 InWorkerCount);
+	void Shutdown();
+
+	uint32 GetWorkerCount() const { return static_cast<uint32>(Workers.size()); }
+
+	/**
+	 * @brief [0, InCount) 인덱스마다 InJob을 한 번씩 실행하고 전부 끝날 때까지 대기
+	 * 인덱스 사이의 실행 순서와 스레드는 정해져 있지 않음
+	 */
+	void ParallelFor(uint32 InCount, const std::function<void(uint32)>& InJob);
+
+private:
+	void WorkerLoop();
+	void RunJobs(const std::function<void(uint32)>& InJob, uint32 InCount);
+
+	TArray<std::thread> Workers;
+
+	std::mutex Mutex;
+	std::condition_variable WorkCondition;
+	std::condition_variable DoneCondition;
+
+	// 현재 묶음 (Mutex 안에서만 바꿈, 묶음이 끝나면 Job은 nullptr)
+	const std::function<void(uint32)>* Job = nullptr;
+	uint32 JobCount = 0;
+	uint64 Generation = 0;
+	uint32 ActiveWorkers = 0;		// 현재 묶음의 작업을 가져가고 있는 워커 수
+	std::atomic<uint32> NextIndex{ 0 };
+	bool bStopping = false;
+};
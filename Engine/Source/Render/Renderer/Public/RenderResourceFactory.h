@@ -1,16 +1,21 @@
 #pragma once
+#include <mutex>
 #include "Render/Renderer/Public/Renderer.h"
 
 class FRenderResourceFactory
 {
 public:
 	static void CreateVertexShaderAndInputLayout(const wstring& InFilePath, const TArray<D3D11_INPUT_ELEMENT_DESC>& InInputLayoutDescriptions,
-												 ID3D11VertexShader** OutVertexShader, ID3D11InputLayout** OutInputLayout);
+												 ID3D11VertexShader** OutVertexShader, ID3D11InputLayout** OutInputLayout,
+												 const D3D_SHADER_MACRO* InDefines = nullptr);
 	static ID3D11Buffer* CreateVertexBuffer(FNormalVertex* InVertices, uint32 InByteWidth);
+	// bCpuAccess면 Map(WRITE_DISCARD)으로 갱신하는 동적 버퍼, 초기 데이터는 nullptr일 수 있음
 	static ID3D11Buffer* CreateVertexBuffer(FVector* InVertices, uint32 InByteWidth, bool bCpuAccess);
-	static ID3D11Buffer* CreateIndexBuffer(const void* InIndices, uint32 InByteWidth);
-	static void CreatePixelShader(const wstring& InFilePath, ID3D11PixelShader** InPixelShader);
+	static ID3D11Buffer* CreateIndexBuffer(const void* InIndices, uint32 InByteWidth, bool bCpuAccess = false);
+	static void CreatePixelShader(const wstring& InFilePath, ID3D11PixelShader** InPixelShader, const D3D_SHADER_MACRO* InDefines = nullptr);
+	static ID3D11Buffer* CreateStructuredBuffer(uint32 InElementSize, uint32 InElementCount, ID3D11ShaderResourceView** OutShaderResourceView);
 	static ID3D11SamplerState* CreateSamplerState(D3D11_FILTER InFilter, D3D11_TEXTURE_ADDRESS_MODE InAddressMode);
+	// 패스를 워커 스레드에서 기록할 때도 호출되므로 캐시는 RasterCacheMutex로 보호
 	static ID3D11RasterizerState* GetRasterizerState(const FRenderState& InRenderState);
 	static void ReleaseRasterizerState();
 
@@ -83,4 +88,5 @@ private:
 	};
 
 	static TMap<FRasterKey, ID3D11RasterizerState*, FRasterKeyHasher> RasterCache;
+	static std::mutex RasterCacheMutex;
 };
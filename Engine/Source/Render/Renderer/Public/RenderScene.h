@@ -0,0 +1,166 @@
+#pragma once
+#include "Component/Public/PrimitiveComponent.h"
+
+class ULevel;
+class UStaticMesh;
+class UMaterial;
+
+/**
+ * @brief 프록시가 그려지는 패스 (컨텍스트 구성 시 Cast 없이 분류하기 위함)
+ */
+enum class ERenderProxyPass : uint8
+{
+	None,			// UUID 텍스트 등 패스 목록에 넣지 않는 프리미티브
+	StaticMesh,
+	Primitive,
+	BillBoard,
+	Text,
+	FireBall,
+};
+
+/**
+ * @brief 렌더 씬 통계 (render proxies)
+ */
+struct FRenderSceneStats
+{
+	uint32 Proxies = 0;
+	uint32 MaterialSlots = 0;		// 살아 있는 프록시의 머티리얼 슬롯 수
+	uint32 LastFrameUpdates = 0;	// 지난 갱신에서 다시 읽은 프록시 수 (이동 / 상태 변경 / 등록)
+	uint32 Rebuilds = 0;
+	double LastUpdateMs = 0.0;
+};
+
+/**
+ * @brief 레벨의 프리미티브를 렌더링용 프록시로 복사해 둔 씬 (SoA)
+ *
+ * 컴포넌트가 등록 / 이동 / 상태 변경될 때만 해당 프록시를 다시 읽고, 패스는 매 프레임 배열만 순회함
+ * 컬링은 여전히 컴포넌트를 반환하므로 컴포넌트의 RenderProxyIndex로 프록시를 찾음
+ *
+ * 갱신(Update)은 메인 스레드에서 뷰포트 준비 전에 하고, 기록 중에는 읽기만 함
+ * 갱신하면서 컴포넌트의 월드 행렬 / AABB 캐시도 채우므로, 워커 스레드의 컬링과 기록이 캐시를 동시에 채우지 않음
+ *
+ * 에디터 / PIE 레벨이 컴포넌트를 공유할 수 있으므로 RenderProxyIndex는 마지막으로 추가한 씬 기준이고,
+ * URenderer가 그리는 레벨이 바뀌면 MarkNeedsRebuild()로 인덱스를 다시 맞춤
+ */
+class FRenderScene
+{
+public:
+	FRenderScene();
+
+	void AddPrimitive(UPrimitiveComponent* InComponent);
+	void RemovePrimitive(UPrimitiveComponent* InComponent);
+
+	/**
+	 * @brief Transform / 메시 / 머티리얼 / 색 등이 바뀐 컴포넌트의 프록시를 다음 Update에서 다시 읽도록 등록
+	 * 이 씬에 없는 컴포넌트는 무시
+	 */
+	void MarkDirty(UPrimitiveComponent* InComponent);
+	void MarkNeedsRebuild() { bNeedsRebuild = true; }
+
+	/**
+	 * @brief 프록시 추가 / 제거 / 변경 / 재구축, 옥트리 재배치 때마다 증가하는 씬 리비전
+	 * 모든 씬이 하나의 카운터에서 값을 받으므로 다른 씬(레벨)과 리비전이 겹치지 않음
+	 * 카메라는 행렬과 이 값이 지난 컬링과 같으면 컬링 결과를 그대로 씀
+	 */
+	uint64 GetRevision() const { return Revision; }
+	void BumpRevision();
+
+	/**
+	 * @brief 바뀐 프록시만 다시 읽음 (재구축이 필요하면 레벨의 모든 액터로 다시 만듦)
+	 */
+	void Update(const ULevel* InLevel);
+
+	/**
+	 * @return 이 씬의 프록시 인덱스, 없으면 -1
+	 */
+	int32 FindProxy(const UPrimitiveComponent* InComponent) const
+	{
+		const int32 Index = InComponent->GetRenderProxyIndex();
+		return Index >= 0 && Index < static_cast<int32>(Components.size()) && Components[Index] == InComponent ? Index : -1;
+	}
+
+	uint32 GetProxyCount() const { return static_cast<uint32>(Components.size()); }
+
+	UPrimitiveComponent* GetComponent(uint32 InIndex) const { return Components[InIndex]; }
+	ERenderProxyPass GetPass(uint32 InIndex) const { return Passes[InIndex]; }
+	bool IsVisible(uint32 InIndex) const { return Visibilities[InIndex] != 0; }
+
+	const FMatrix& GetWorldMatrix(uint32 InIndex) const { return WorldMatrices[InIndex]; }
+	const FVector& GetWorldLocation(uint32 InIndex) const { return WorldLocations[InIndex]; }
+	const FVector& GetBoundsMin(uint32 InIndex) const { return BoundsMin[InIndex]; }
+	const FVector& GetBoundsMax(uint32 InIndex) const { return BoundsMax[InIndex]; }
+
+	ID3D11Buffer* GetVertexBuffer(uint32 InIndex) const { return VertexBuffers[InIndex]; }
+	ID3D11Buffer* GetIndexBuffer(uint32 InIndex) const { return IndexBuffers[InIndex]; }
+	uint32 GetIndexStride(uint32 InIndex) const { return IndexStrides[InIndex]; }
+	uint32 GetNumVertices(uint32 InIndex) const { return NumVertices[InIndex]; }
+	uint32 GetNumIndices(uint32 InIndex) const { return NumIndices[InIndex]; }
+	// 인덱스 버퍼와 CPU 인덱스가 모두 있는 경우만 인덱스 드로우 (UPrimitiveComponent 기준과 같음)
+	bool IsIndexed(uint32 InIndex) const { return Indexed[InIndex] != 0; }
+
+	// Primitive
+	const FRenderState& GetRenderState(uint32 InIndex) const { return RenderStates[InIndex]; }
+	const FVector4& GetColor(uint32 InIndex) const { return Colors[InIndex]; }
+	EPrimitiveType GetPrimitiveType(uint32 InIndex) const { return PrimitiveTypes[InIndex]; }
+
+	// StaticMesh
+	UStaticMesh* GetStaticMesh(uint32 InIndex) const { return StaticMeshes[InIndex]; }
+	bool IsScrollEnabled(uint32 InIndex) const { return ScrollEnabled[InIndex] != 0; }
+	UMaterial* GetMaterial(uint32 InIndex, int32 InSlot) const
+	{
+		return InSlot >= 0 && static_cast<uint32>(InSlot) < MaterialCounts[InIndex] ? Materials[MaterialOffsets[InIndex] + InSlot] : nullptr;
+	}
+
+	const FRenderSceneStats& GetStats() const { return Stats; }
+
+	/**
+	 * @brief 갱신 대기 중이 아닌데 컴포넌트의 현재 상태와 다른 프록시 수 (변경 통지 누락 확인용, render proxies)
+	 * 컴포넌트를 전부 다시 읽으므로 메인 스레드에서 디버그 용도로만 호출
+	 */
+	uint32 CountStaleProxies() const;
+
+private:
+	void Rebuild(const ULevel* InLevel);
+	void Clear();
+	// 컴포넌트의 현재 상태를 프록시로 복사
+	void RefreshProxy(uint32 InIndex);
+	// InIndex 프록시의 머티리얼 슬롯을 InCount개로 맞춤 (개수가 바뀌면 뒤에 새로 잡고 이전 구간은 버림)
+	void ResizeMaterialRange(uint32 InIndex, uint32 InCount);
+	void CompactMaterials();
+
+	static ERenderProxyPass ClassifyPass(UPrimitiveComponent* InComponent);
+
+	// 프록시 (인덱스가 같은 원소끼리 한 프록시)
+	TArray<UPrimitiveComponent*> Components;
+	TArray<ERenderProxyPass> Passes;
+	TArray<uint8> Visibilities;
+	TArray<uint8> DirtyFlags;
+	TArray<FMatrix> WorldMatrices;
+	TArray<FVector> WorldLocations;
+	TArray<FVector> BoundsMin;
+	TArray<FVector> BoundsMax;
+	TArray<ID3D11Buffer*> VertexBuffers;
+	TArray<ID3D11Buffer*> IndexBuffers;
+	TArray<uint32> IndexStrides;
+	TArray<uint32> NumVertices;
+	TArray<uint32> NumIndices;
+	TArray<uint8> Indexed;
+	TArray<FRenderState> RenderStates;
+	TArray<FVector4> Colors;
+	TArray<EPrimitiveType> PrimitiveTypes;
+	TArray<UStaticMesh*> StaticMeshes;
+	TArray<uint8> ScrollEnabled;
+	TArray<uint32> MaterialOffsets;
+	TArray<uint32> MaterialCounts;
+
+	// 모든 프록시의 머티리얼 슬롯을 이어 붙인 배열 (오버라이드를 반영한 최종 머티리얼)
+	TArray<UMaterial*> Materials;
+	uint32 UnusedMaterialSlots = 0;
+
+	TArray<uint32> DirtyProxies;
+	uint32 PendingUpdateCount = 0;	// 지난 Update 이후 다시 읽은 프록시 수 (등록 포함)
+	bool bNeedsRebuild = true;
+	uint64 Revision = 0;
+
+	FRenderSceneStats Stats;
+};
@@ -4,6 +4,11 @@
 #include "Component/Public/PrimitiveComponent.h"
 #include "Editor/Public/EditorPrimitive.h"
 #include "Render/Renderer/Public/Pipeline.h"
+#include "Render/Renderer/Public/RenderCommandList.h"
+#include "Render/Renderer/Public/RenderCommandExecutor.h"
+#include "Render/Renderer/Public/ConstantBufferRing.h"
+#include "Render/Renderer/Public/RenderJobSystem.h"
+#include "Render/RenderPass/Public/RenderingContext.h"
 #include "Component/Public/BillBoardComponent.h"
 #include "Component/Public/TextComponent.h"
 
@@ -18,6 +23,7 @@ class UFontRenderer;
 class FViewport;
 class UCamera;
 class UPipeline;
+class ULevel;
 
 struct FPostProcessParameters
 {
@@ -46,6 +52,51 @@ struct FPostProcessParameters
 	FMatrix InvViewProj;
 };
 
+/**
+ * @brief 뷰포트 하나의 프레임 기록 (컬링 결과와 패스별 커맨드 리스트)
+ * 기록 단계에서는 패스마다 다른 리스트에 동시에 쓰고, 제출 단계에서 패스 순서대로 재생
+ */
+struct FViewRecording
+{
+	UCamera* Camera = nullptr;
+	D3D11_VIEWPORT Viewport = {};
+	FRenderingContext Context;
+	TArray<FRenderCommandList> PassCommandLists;	// RenderPasses와 같은 순서
+
+	// Context의 프리미티브 버킷을 만든 컬링 결과 (카메라 / CullCount / 씬 리비전이 같으면 다시 나누지 않음)
+	const UCamera* BucketedCamera = nullptr;
+	uint64 BucketedCullCount = 0;
+	uint64 BucketedSceneRevision = 0;
+	bool bCulledThisFrame = false;
+	bool bRebucketedThisFrame = false;
+};
+
+/**
+ * @brief 프레임 렌더링 단계별 CPU 시간 (render mt)
+ */
+struct FRenderRecordingStats
+{
+	uint32 ViewCount = 0;
+	uint32 RecordingJobs = 0;		// 패스 기록 작업 수 (Parallel 패스마다 하나 + Shared 패스 묶음 하나)
+	uint32 WorkerCount = 0;
+	uint32 CulledViews = 0;			// 카메라나 씬이 바뀌어 다시 컬링한 뷰포트 수 (나머지는 이전 결과 사용)
+	uint32 RebucketedViews = 0;		// 프리미티브 버킷을 다시 나눈 뷰포트 수
+	double PrepareMs = 0.0;			// 뷰포트별 카메라 갱신 / 컬링 / 컨텍스트 구성
+	double RecordMs = 0.0;			// 패스별 커맨드 기록
+	double SubmitMs = 0.0;			// 뷰포트 순서대로 재생 (즉시 실행 패스, 에디터 프리미티브, 후처리, 기즈모 포함)
+};
+
+/**
+ * @brief Null 백엔드로 레벨 기록 / 재생을 반복 실행한 결과
+ */
+struct FNullBackendBenchmarkResult
+{
+	uint32 FrameCount = 0;
+	double AverageFrameMs = 0.0;		// 패스 기록 + Null 재생까지의 CPU 시간
+	uint32 PeakCommandBytes = 0;		// 패스 하나가 기록한 커맨드 버퍼의 최대 크기
+	FRenderCommandStats LastFrameStats;
+};
+
 /**
  * @brief Rendering Pipeline 전반을 처리하는 클래스
  */
@@ -86,12 +137,29 @@ public:
 	// Render
 	void Update();
 	void RenderBegin() const;
-	void RenderLevel(UCamera* InCurrentCamera);
 	void RenderEnd() const;
 	void RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride = 0, uint32 InIndexBufferStride = 0);
 
 	void OnResize(uint32 Inwidth = 0, uint32 InHeight = 0);
 
+	/**
+	 * @brief 활성 뷰포트 카메라로 현재 레벨을 InFrameCount번 기록하고 GPU 대신 Null 실행기로 재생
+	 * 드로우 콜 / 상태 변경 수와 패스 CPU 비용을 디바이스 제출 없이 측정 (회귀 비교용)
+	 */
+	FNullBackendBenchmarkResult RunNullBackendBenchmark(uint32 InFrameCount);
+
+	// 같은 메시 / 머티리얼을 인스턴스 드로우로 묶을지 (끄면 항목마다 드로우, 비교용)
+	void SetInstancingEnabled(bool bInEnabled) { bInstancingEnabled = bInEnabled; }
+	bool IsInstancingEnabled() const { return bInstancingEnabled; }
+
+	const FConstantBufferRing& GetConstantBufferRing() const { return ConstantBufferRing; }
+
+	// 컬링 / 패스 기록을 나눠 맡을 워커 스레드 수 (0이면 메인 스레드에서 같은 순서로 기록, 비교용)
+	void SetRenderWorkerCount(uint32 InWorkerCount);
+	uint32 GetRenderWorkerCount() const { return RenderJobs.GetWorkerCount(); }
+	static uint32 GetDefaultRenderWorkerCount();
+	const FRenderRecordingStats& GetRecordingStats() const { return RecordingStats; }
+
 	// Getter & Setter
 	ID3D11Device* GetDevice() const { return DeviceResources->GetDevice(); }
 	ID3D11DeviceContext* GetDeviceContext() const { return DeviceResources->GetDeviceContext(); }
@@ -135,6 +203,34 @@ public:
 private:
 	UPipeline* Pipeline = nullptr;
 	UDeviceResources* DeviceResources = nullptr;
+
+	// RenderPass가 기록한 커맨드 리스트를 재생하는 D3D11 실행기
+	FD3D11CommandExecutor* CommandExecutor = nullptr;
+	// 드로우마다의 상수 갱신을 모으는 프레임 단위 업로드 링 (오프셋 바인딩을 못 하면 비활성)
+	static constexpr uint32 ConstantBufferRingSize = 8 * 1024 * 1024;
+	FConstantBufferRing ConstantBufferRing;
+	uint32 PeakCommandBytes = 0;
+	bool bInstancingEnabled = true;
+	uint64 FrameNumber = 0;			// Update / Null 벤치마크 프레임마다 증가 (프레임 단위 업로드 스트림 구분용)
+	void SubmitCommandList(FRenderCommandList& InCommandList, FNullCommandExecutor* InNullExecutor);
+
+	// 뷰포트 x 패스 커맨드 기록 (Update와 Null 벤치마크가 같이 씀)
+	static constexpr uint32 MaxRenderWorkers = 7;
+	FRenderJobSystem RenderJobs;
+	TArray<FViewRecording> ViewRecordings;			// 앞에서부터 이번 프레임에 그릴 뷰포트
+	TArray<TArray<uint32>> PassRecordingJobs;		// 작업마다 순서대로 기록할 패스 인덱스
+	FRenderRecordingStats RecordingStats;
+	void BuildPassRecordingJobs();
+	FViewRecording& AddViewRecording(uint32 InViewIndex, UCamera* InCamera, const D3D11_VIEWPORT& InViewport);
+	// 렌더 씬의 프록시 인덱스가 맞춰진 레벨 (다른 레벨을 그리게 되면 재구축)
+	const ULevel* RenderSceneLevel = nullptr;
+	void UpdateRenderScene(ULevel* InLevel);
+	void PrepareViews(ULevel* InLevel, uint32 InViewCount, bool bInUpdateCameras);
+	void BuildRenderingContext(const ULevel* InLevel, FViewRecording& InOutView) const;
+	static void BuildPrimitiveBuckets(const FRenderScene* InScene, const TArray<UPrimitiveComponent*>& InVisiblePrims,
+		FRenderingContext& OutContext);
+	void RecordViews(uint32 InViewCount);
+	void SubmitView(FViewRecording& InView, FNullCommandExecutor* InNullExecutor);
 	UFontRenderer* FontRenderer = nullptr;
 	TArray<UPrimitiveComponent*> PrimitiveComponents;
 
@@ -163,11 +259,14 @@ private:
 	ID3D11VertexShader* DefaultVertexShader = nullptr;
 	ID3D11PixelShader* DefaultPixelShader = nullptr;
 	ID3D11InputLayout* DefaultInputLayout = nullptr;
+	ID3D11VertexShader* InstancedDefaultVertexShader = nullptr;
+	ID3D11PixelShader* InstancedDefaultPixelShader = nullptr;
 	
 	// Texture Shaders
 	ID3D11VertexShader* TextureVertexShader = nullptr;
 	ID3D11PixelShader* TexturePixelShader = nullptr;
 	ID3D11InputLayout* TextureInputLayout = nullptr;
+	ID3D11VertexShader* InstancedTextureVertexShader = nullptr;
 
 	ID3D11VertexShader* DecalVertexShader = nullptr;
 	ID3D11PixelShader* DecalPixelShader = nullptr;
@@ -177,6 +276,7 @@ private:
 	ID3D11VertexShader* DepthVertexShader = nullptr;
 	ID3D11PixelShader* DepthPixelShader = nullptr;
 	ID3D11InputLayout* DepthInputLayout = nullptr;
+	ID3D11VertexShader* InstancedDepthVertexShader = nullptr;
 
 	// PostProcess Shaders
 	ID3D11VertexShader* PostProcessVertexShader = nullptr;
@@ -0,0 +1,74 @@
+#pragma once
+
+/**
+ * @brief 프레임 펜스로 보호하는 업로드 링 버퍼의 할당 로직 (D3D에 의존하지 않음)
+ *
+ * [Tail, Head)가 GPU가 아직 읽을 수 있는 영역이고 Head부터 앞으로 할당함
+ * 끝에 남은 공간이 모자라면 남은 부분을 버리고 0으로 돌아감 (버린 공간도 그 프레임 사용량에 포함되어 같이 회수됨)
+ * EndFrame(Fence)로 그때까지의 할당을 한 프레임으로 묶고, Retire(CompletedFence)로 GPU가 끝낸 프레임의 공간을 돌려받음
+ */
+class FUploadRingAllocator
+{
+public:
+	static constexpr uint64 InvalidOffset = ~0ULL;
+
+	void Initialize(uint64 InCapacity);
+
+	/**
+	 * @brief InSize 바이트를 InAlignment(2의 거듭제곱) 경계에 할당
+	 * @return 링 안의 오프셋, GPU가 쓰는 영역과 겹쳐서 공간이 없으면 InvalidOffset
+	 */
+	uint64 Allocate(uint64 InSize, uint64 InAlignment);
+
+	void EndFrame(uint64 InFenceValue);
+	void Retire(uint64 InCompletedFenceValue);
+
+	// 링 전체를 비움 (버퍼를 DISCARD로 교체해서 이전 데이터를 GPU가 더 이상 이 메모리에서 읽지 않을 때)
+	void Reset();
+
+	uint64 GetCapacity() const { return Capacity; }
+	uint64 GetUsedBytes() const { return UsedBytes; }
+	uint32 GetWrapCount() const { return WrapCount; }
+	uint32 GetFramesInFlight() const { return static_cast<uint32>(FrameMarks.size()); }
+
+private:
+	struct FFrameMark
+	{
+		uint64 FenceValue;
+		uint64 EndOffset;	// 프레임이 끝났을 때의 Head (회수하면 Tail이 여기로 옴)
+		uint64 Bytes;		// 정렬 / 끝부분 패딩 포함
+	};
+
+	uint64 Capacity = 0;
+	uint64 Head = 0;
+	uint64 Tail = 0;
+	uint64 UsedBytes = 0;
+	uint64 CurrentFrameBytes = 0;
+	uint32 WrapCount = 0;
+	TDeque<FFrameMark> FrameMarks;
+};
+
+/**
+ * @brief FUploadRingAllocator 자체 검사 결과
+ */
+struct FUploadRingCheckResult
+{
+	uint32 RingCount = 0;
+	uint32 FrameCount = 0;
+	uint64 AllocationCount = 0;
+	uint64 RejectedCount = 0;		// 공간이 없어 거절된 정상 요청
+	uint32 WrapCount = 0;
+	uint32 AlignmentErrors = 0;		// 정렬 / 링 범위를 벗어난 오프셋
+	uint32 OverlapErrors = 0;		// GPU가 아직 읽는 프레임의 영역과 겹친 할당
+	uint32 OversizeErrors = 0;		// 용량보다 큰 요청을 받아들임
+	uint32 WrapErrors = 0;			// 고정 시나리오의 끝부분 패딩 / 되감기 결과가 다름
+	uint32 LeakErrors = 0;			// 모든 펜스가 끝났는데 사용량이 남음
+
+	uint32 GetErrorCount() const { return AlignmentErrors + OverlapErrors + OversizeErrors + WrapErrors + LeakErrors; }
+};
+
+/**
+ * @brief 디바이스 없이 가짜 펜스로 프레임(Retire -> Allocate -> EndFrame)을 돌리며 할당 결과를 검사
+ * 크기와 GPU 지연 프레임 수가 다른 링들에 무작위(고정 시드) 요청을 넣고 정렬, 진행 중 프레임과의 겹침, 되감기, 과대 요청 거절을 확인
+ */
+FUploadRingCheckResult RunUploadRingCheck(uint32 InFrameCount);
@@ -83,6 +83,7 @@ void UStatOverlay::Render()
     if (IsStatEnabled(EStatType::Picking)) RenderPicking(D2DCtx);
     if (IsStatEnabled(EStatType::Time))    RenderTimeInfo(D2DCtx);
     if (IsStatEnabled(EStatType::Decal))  RenderDecal(D2DCtx);
+    if (IsStatEnabled(EStatType::Draw))   RenderDrawSort(D2DCtx);
 
     D2DCtx->EndDraw();
     D2DCtx->SetTarget(nullptr);
@@ -117,7 +118,7 @@ void UStatOverlay::RenderMemory(ID2D1DeviceContext* d2dCtx)
     float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
 
     char Buf[64];
-    sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+    sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount.load());
     FString text = Buf;
 
     float OffsetY = IsStatEnabled(EStatType::FPS) ? 20.0f : 0.0f;
@@ -146,7 +147,8 @@ void UStatOverlay::RenderPicking(ID2D1DeviceContext* D2DCtx)
 
 void UStatOverlay::RenderTimeInfo(ID2D1DeviceContext* D2DCtx)
 {
-    const TArray<FString> ProfileKeys = FScopeCycleCounter::GetTimeProfileKeys();
+    // 마지막으로 끝난 프레임의 메인 스레드 스코프 (시작 순서, 중첩 깊이만큼 들여쓰기)
+    const TArray<FProfileStatSummary>& Summaries = FProfiler::GetInstance().GetLastFrameSummary();
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
@@ -155,19 +157,25 @@ void UStatOverlay::RenderTimeInfo(ID2D1DeviceContext* D2DCtx)
 
     float CurrentY = OverlayY + OffsetY;
     const float LineHeight = 20.0f;
+    const float IndentWidth = 16.0f;
 
-    for (const FString& Key : ProfileKeys)
+    for (const FProfileStatSummary& Summary : Summaries)
     {
-        const FTimeProfile& Profile = FScopeCycleCounter::GetTimeProfile(Key);
-
         char buf[128];
-        sprintf_s(buf, sizeof(buf), "%s: %.2f ms", Key.c_str(), Profile.Milliseconds);
+        if (Summary.CallCount > 1)
+        {
+            sprintf_s(buf, sizeof(buf), "%s: %.2f ms (x%u)", Summary.Name, Summary.Milliseconds, Summary.CallCount);
+        }
+        else
+        {
+            sprintf_s(buf, sizeof(buf), "%s: %.2f ms", Summary.Name, Summary.Milliseconds);
+        }
         FString text = buf;
 
         float r = 0.8f, g = 0.8f, b = 0.8f;
-        if (Profile.Milliseconds > 1.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
+        if (Summary.Milliseconds > 1.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
 
-        RenderText(D2DCtx, text, OverlayX, CurrentY, r, g, b);
+        RenderText(D2DCtx, text, OverlayX + IndentWidth * static_cast<float>(Summary.Depth), CurrentY, r, g, b);
         CurrentY += LineHeight;
     }
 }
@@ -246,7 +254,23 @@ void UStatOverlay::RenderDecal(ID2D1DeviceContext* ctx)
         RenderText(ctx, Line, OverlayX, Y + LineH, 0.6f, 0.9f, 1.0f);
     }
     {
-        // 3줄: 패스 시간(Last/Avg)
+        // 3줄: Receiver 캐시 적중률
+        const uint32 Lookups = DecalStats.ReceiverCacheHits + DecalStats.ReceiverCacheMisses;
+        const float HitRate = Lookups > 0 ? 100.0f * static_cast<float>(DecalStats.ReceiverCacheHits) / static_cast<float>(Lookups) : 0.0f;
+        char Line[128];
+        sprintf_s(Line, sizeof(Line), "Receiver Cache: Hit %u / Miss %u (%.1f%%), Patched %u",
+            DecalStats.ReceiverCacheHits, DecalStats.ReceiverCacheMisses, HitRate, DecalStats.PatchedReceivers);
+        RenderText(ctx, Line, OverlayX, Y + LineH * 2, 0.6f, 1.0f, 0.8f);
+    }
+    {
+        // 4줄: 삼각형 클리핑 (그린 삼각형 / 클리핑 전 삼각형)
+        char Line[128];
+        sprintf_s(Line, sizeof(Line), "Clip: Tri %u / %u, Rebuilt %u",
+            DecalStats.ClippedTriangles, DecalStats.SourceTriangles, DecalStats.ClipRebuilds);
+        RenderText(ctx, Line, OverlayX, Y + LineH * 3, 0.6f, 1.0f, 0.8f);
+    }
+    {
+        // 5줄: 패스 시간(Last/Avg)
         const float avgMs = DecalAvgMs;
         char Line[96];
         sprintf_s(Line, sizeof(Line), "LastPass: %.2f ms (Recent 10 Pass Avg %.2f)", DecalStats.LastPassMs, avgMs);
@@ -255,7 +279,7 @@ void UStatOverlay::RenderDecal(ID2D1DeviceContext* ctx)
         if (DecalStats.LastPassMs > 5.0f) { r = 1.0f; g = 0.0f; b = 0.0f; }
         else if (DecalStats.LastPassMs > 2.0f) { r = 1.0f; g = 1.0f; b = 0.0f; }
 
-        RenderText(ctx, Line, OverlayX, Y + LineH * 2, r, g, b);
+        RenderText(ctx, Line, OverlayX, Y + LineH * 4, r, g, b);
     }
 }
 
@@ -265,6 +289,10 @@ void UStatOverlay::ResetDecalFrame()
     DecalStats.DrawCalls = 0;
     DecalStats.TextureBinds = DecalStats.TextureFallbacks = 0;
     DecalStats.MaterialSeen = DecalStats.MaterialBinds = 0;
+    DecalStats.ReceiverCacheHits = DecalStats.ReceiverCacheMisses = 0;
+    DecalStats.PatchedReceivers = 0;
+    DecalStats.ClippedTriangles = DecalStats.SourceTriangles = 0;
+    DecalStats.ClipRebuilds = 0;
     DecalStats.LastPassMs = 0.0f;
     // 누적은 유지
 }
@@ -310,4 +338,67 @@ void UStatOverlay::RecordDecalMaterialStats(uint32 Seen, uint32 Binds)
 {
     DecalStats.MaterialSeen += Seen;
     DecalStats.MaterialBinds += Binds;
-}
\ No newline at end of file
+}
+
+void UStatOverlay::RecordDecalReceiverCacheStats(uint32 Hits, uint32 Misses, uint32 PatchedReceivers)
+{
+    DecalStats.ReceiverCacheHits += Hits;
+    DecalStats.ReceiverCacheMisses += Misses;
+    DecalStats.PatchedReceivers += PatchedReceivers;
+}
+
+void UStatOverlay::RecordDecalClipStats(uint32 ClippedTriangles, uint32 SourceTriangles, uint32 Rebuilds)
+{
+    DecalStats.ClippedTriangles += ClippedTriangles;
+    DecalStats.SourceTriangles += SourceTriangles;
+    DecalStats.ClipRebuilds += Rebuilds;
+}
+
+void UStatOverlay::RenderDrawSort(ID2D1DeviceContext* ctx)
+{
+    float OffsetY = 0.0f;
+    if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Time))   OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Decal))  OffsetY += 20.0f * 5;
+
+    const float LineH = 20.0f;
+    static const char* PassNames[] = { "StaticMesh", "Primitive", "Billboard" };
+    static_assert(std::size(PassNames) == static_cast<size_t>(EDrawSortPass::Count), "Draw sort pass name missing");
+
+    FDrawSortStats Total;
+    for (uint32 Pass = 0; Pass < static_cast<uint32>(EDrawSortPass::Count); ++Pass)
+    {
+        const FDrawSortStats& Stats = DrawSortStats[Pass];
+        Total += Stats;
+
+        char Line[192];
+        sprintf_s(Line, sizeof(Line), "%s: Items %u, Draws %u (Inst %u / %u), Pipeline %u, VB/IB %u, Mat %u, Tex %u, CB %u",
+            PassNames[Pass], DrawSortItems[Pass], Stats.DrawCalls, Stats.InstancedDraws, Stats.Instances, Stats.PipelineChanges,
+            Stats.BufferBinds, Stats.MaterialBinds, Stats.TextureBinds, Stats.ConstantBufferUpdates);
+        RenderText(ctx, Line, OverlayX, OverlayY + OffsetY + LineH * Pass, 0.75f, 0.85f, 1.0f);
+    }
+
+    // 상태 변경 합계 (드로우당 비율이 낮을수록 정렬이 잘 묶인 것)
+    const uint32 StateChanges = Total.PipelineChanges + Total.BufferBinds + Total.MaterialBinds + Total.TextureBinds;
+    const float PerDraw = Total.DrawCalls > 0 ? static_cast<float>(StateChanges) / static_cast<float>(Total.DrawCalls) : 0.0f;
+    char Line[128];
+    sprintf_s(Line, sizeof(Line), "Total: Draws %u (Inst %u), State changes %u (%.2f / draw)", Total.DrawCalls, Total.InstancedDraws, StateChanges, PerDraw);
+    RenderText(ctx, Line, OverlayX, OverlayY + OffsetY + LineH * static_cast<float>(EDrawSortPass::Count), 0.6f, 1.0f, 0.8f);
+}
+
+void UStatOverlay::ResetDrawSortFrame()
+{
+    for (uint32 Pass = 0; Pass < static_cast<uint32>(EDrawSortPass::Count); ++Pass)
+    {
+        DrawSortItems[Pass] = 0;
+        DrawSortStats[Pass] = {};
+    }
+}
+
+void UStatOverlay::RecordDrawSortStats(EDrawSortPass Pass, uint32 SortedItems, const FDrawSortStats& Stats)
+{
+    DrawSortItems[static_cast<uint32>(Pass)] += SortedItems;
+    DrawSortStats[static_cast<uint32>(Pass)] += Stats;
+}
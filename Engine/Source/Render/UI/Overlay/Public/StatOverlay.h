@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Render/RenderPass/Public/DrawSortKey.h"
 #include <d2d1.h>
 #include <dwrite.h>
 
@@ -11,7 +12,8 @@ enum class EStatType : uint8
 	Picking = 1 << 2,  // 4
 	Time = 1 << 3,  // 8
 	Decal = 1 << 4,
-	All = FPS | Memory | Picking | Time | Decal
+	Draw = 1 << 5,
+	All = FPS | Memory | Picking | Time | Decal | Draw
 };
 
 UCLASS()
@@ -31,6 +33,7 @@ public:
 	void ShowPicking(bool bShow) { bShow ? EnableStat(EStatType::Picking) : DisableStat(EStatType::Picking); }
 	void ShowTime(bool bShow) { bShow ? EnableStat(EStatType::Time) : DisableStat(EStatType::Time); }
 	void ShowDecal(bool bShow) { bShow ? EnableStat(EStatType::Decal) : DisableStat(EStatType::Decal); }
+	void ShowDraw(bool bShow) { bShow ? EnableStat(EStatType::Draw) : DisableStat(EStatType::Draw); }
 	void ShowAll(bool bShow) { SetStatType(bShow ? EStatType::All : EStatType::None); }
 
 	// API to update stats
@@ -43,6 +46,12 @@ public:
 	void RecordDecalTextureStats(uint32 Binds, uint32 Fallbacks);
 	void RecordDecalPassMs(float Ms);
 	void RecordDecalMaterialStats(uint32 Seen, uint32 Binds);
+	void RecordDecalReceiverCacheStats(uint32 Hits, uint32 Misses, uint32 PatchedReceivers);
+	void RecordDecalClipStats(uint32 ClippedTriangles, uint32 SourceTriangles, uint32 Rebuilds);
+
+	// API to update sorted draw stats (뷰포트가 여러 개면 프레임 안에서 누적)
+	void ResetDrawSortFrame();
+	void RecordDrawSortStats(EDrawSortPass Pass, uint32 SortedItems, const FDrawSortStats& Stats);
 private:
 	void RenderFPS(ID2D1DeviceContext* d2dCtx);
 	void RenderMemory(ID2D1DeviceContext* d2dCtx);
@@ -97,6 +106,14 @@ private:
 		uint32 MaterialSeen = 0;    // Mat 포인터가 존재했던 횟수
 		uint32 MaterialBinds = 0;   // Mat에서 텍스처가 실제로 바인딩된 횟수
 
+		uint32 ReceiverCacheHits = 0;     // Receiver 목록을 캐시에서 바로 얻은 Decal 수
+		uint32 ReceiverCacheMisses = 0;   // BVH 질의로 다시 계산한 Decal 수
+		uint32 PatchedReceivers = 0;      // 이동해서 캐시를 부분 갱신한 Receiver 수
+
+		uint32 ClippedTriangles = 0;      // Decal 박스에 걸쳐 실제로 그린 삼각형 수
+		uint32 SourceTriangles = 0;       // 클리핑 전 Receiver 전체 삼각형 수
+		uint32 ClipRebuilds = 0;          // 클리핑 인덱스 버퍼를 다시 만든 쌍 수
+
 		float LastPassMs = 0.0f;  // 최근 프레임 DecalPass 실행 시간
 		float AccumMs = 0.0f;     // 누적
 		uint32 Frames = 0;        // 누적 프레임 수
@@ -106,4 +123,9 @@ private:
 	uint32 DecalMsCount = 0;   // 누적 개수(최대 10)
 	uint32 DecalMsIndex = 0;   // 덮어쓸 위치
 	float DecalAvgMs = 0.0f;   // 최근 10개 평균
+
+	void RenderDrawSort(ID2D1DeviceContext* d2dCtx);
+
+	uint32 DrawSortItems[static_cast<uint32>(EDrawSortPass::Count)] = {};
+	FDrawSortStats DrawSortStats[static_cast<uint32>(EDrawSortPass::Count)];
 };
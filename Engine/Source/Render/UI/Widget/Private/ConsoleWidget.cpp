@@ -2,6 +2,20 @@
 #include "Render/UI/Widget/Public/ConsoleWidget.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/UELogParser.h"
+#include "Utility/Public/JsonStreamReader.h"
+#include "Level/Public/LevelBinaryFormat.h"
+#include "Level/Public/Level.h"
+#include "Render/RenderPass/Public/DecalMeshBuilder.h"
+#include "Render/RenderPass/Public/TextBatcher.h"
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/ObjFastParser.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Asset/Public/MeshCooker.h"
+#include "Manager/Asset/Public/MeshSimplifier.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Render/Renderer/Public/RenderScene.h"
+#include "Editor/Public/Editor.h"
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
 
@@ -65,6 +79,9 @@ streamsize ConsoleStreamBuffer::xsputn(const char* InString, streamsize InCount)
 
 void UConsoleWidget::RenderWidget()
 {
+	// 로그 스레드가 포맷팅한 UE_LOG 결과 반영
+	DrainAsyncLogs();
+
 	// 제어 버튼들
 	if (ImGui::Button("Clear"))
 	{
@@ -148,8 +165,36 @@ void UConsoleWidget::RenderWidget()
 
 void UConsoleWidget::Update()
 {
-	// 필요한 경우 여기에 업데이트 로직 추가할 것
-	// ImGui 위주라서 필요하지 않을 것으로 보이긴 함...
+	DrainAsyncLogs();
+}
+
+/**
+ * @brief FAsyncLogger의 로그 스레드가 포맷팅한 로그들을 가져와 콘솔에 추가
+ * LogItems는 메인 스레드에서만 접근하므로 여기서 한 번에 옮겨옴
+ */
+void UConsoleWidget::DrainAsyncLogs()
+{
+	TDeque<FLogEntry> Entries;
+	FAsyncLogger::GetInstance().DrainConsoleEntries(Entries);
+	for (FLogEntry& Entry : Entries)
+	{
+		PushLogEntry(std::move(Entry));
+	}
+}
+
+/**
+ * @brief 보관 한도를 유지하면서 로그 추가
+ */
+void UConsoleWidget::PushLogEntry(FLogEntry&& InEntry)
+{
+	LogItems.push_back(std::move(InEntry));
+	while (LogItems.size() > FAsyncLogger::MaxConsoleEntries)
+	{
+		LogItems.pop_front();
+	}
+
+	// Auto Scroll
+	bIsScrollToBottom = true;
 }
 
 void UConsoleWidget::ClearLog()
@@ -218,38 +263,39 @@ void UConsoleWidget::AddLog(ELogType InType, const char* fmt, ...)
 
 /**
  * @brief 로그를 내부적으로 처리하는 함수
- * 로그가 잘리는 현상을 방지하기 위해 동적 버퍼를 활용하여 로그를 입력 받음
+ * 대부분의 로그는 스택 버퍼로 충분하므로 한 번에 포맷팅하고,
+ * 잘리는 경우에만 필요한 크기로 다시 포맷팅
  */
 void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list InArguments)
 {
-	va_list ArgumentsCopy;
+	char StackBuffer[512];
 
-	// Get log length
+	va_list ArgumentsCopy;
 	va_copy(ArgumentsCopy, InArguments);
-	int LogLength = vsnprintf(nullptr, 0, fmt, ArgumentsCopy);
+	const int LogLength = vsnprintf(StackBuffer, sizeof(StackBuffer), fmt, ArgumentsCopy);
 	va_end(ArgumentsCopy);
 
-	// 필요한 크기만큼 동적 할당
-	// malloc 대신 overloading 함수의 영향을 받을 수 있도록 new 할당 사용
-	char* Buffer = new char[LogLength + 1];
-
-	// Make full string
-	va_copy(ArgumentsCopy, InArguments);
-	(void)vsnprintf(Buffer, LogLength + 1, fmt, ArgumentsCopy);
-	va_end(ArgumentsCopy);
+	if (LogLength < 0)
+	{
+		return;
+	}
 
-	// 기본 Info 타입으로 log 추가
 	FLogEntry LogEntry;
 	LogEntry.Type = InType;
 
-	// Log buffer 복사 후 제거
-	LogEntry.Message = FString(Buffer);
-	delete[] Buffer;
-
-	LogItems.push_back(LogEntry);
+	if (LogLength < static_cast<int>(sizeof(StackBuffer)))
+	{
+		LogEntry.Message.assign(StackBuffer, LogLength);
+	}
+	else
+	{
+		LogEntry.Message.resize(LogLength);
+		va_copy(ArgumentsCopy, InArguments);
+		(void)vsnprintf(LogEntry.Message.data(), LogLength + 1, fmt, ArgumentsCopy);
+		va_end(ArgumentsCopy);
+	}
 
-	// Auto Scroll
-	bIsScrollToBottom = true;
+	PushLogEntry(std::move(LogEntry));
 }
 
 /**
@@ -283,10 +329,7 @@ void UConsoleWidget::AddSystemLog(const char* InText, bool bInIsError)
 		LogEntry.Message.pop_back();
 	}
 
-	LogItems.push_back(LogEntry);
-
-	// Auto Scroll
-	bIsScrollToBottom = true;
+	PushLogEntry(std::move(LogEntry));
 }
 
 /**
@@ -390,8 +433,7 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 				FLogEntry LogEntry;
 				LogEntry.Type = ELogType::UELog;
 				LogEntry.Message = FString(Result.FormattedMessage);
-				LogItems.push_back(LogEntry);
-				bIsScrollToBottom = true;
+				PushLogEntry(std::move(LogEntry));
 			}
 			else
 			{
@@ -399,8 +441,7 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 				FLogEntry ErrorEntry;
 				ErrorEntry.Type = ELogType::Error;
 				ErrorEntry.Message = "UELogParser: UE_LOG 파싱 오류: " + FString(Result.ErrorMessage);
-				LogItems.push_back(ErrorEntry);
-				bIsScrollToBottom = true;
+				PushLogEntry(std::move(ErrorEntry));
 			}
 		}
 		catch (const std::exception& e)
@@ -408,16 +449,14 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 			FLogEntry ErrorEntry;
 			ErrorEntry.Type = ELogType::Error;
 			ErrorEntry.Message = "UELogParser: 예외 발생: " + FString(e.what());
-			LogItems.push_back(ErrorEntry);
-			bIsScrollToBottom = true;
+			PushLogEntry(std::move(ErrorEntry));
 		}
 		catch (...)
 		{
 			FLogEntry ErrorEntry;
 			ErrorEntry.Type = ELogType::Error;
 			ErrorEntry.Message = "UELogParser: 알 수 없는 오류가 발생했습니다.";
-			LogItems.push_back(ErrorEntry);
-			bIsScrollToBottom = true;
+			PushLogEntry(std::move(ErrorEntry));
 		}
 	}
 
@@ -438,6 +477,54 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// Log 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 4 && CommandLower.substr(0, 4) == "log ")
+	{
+		HandleLogCommand(CommandLower.substr(4));
+	}
+
+	// Level 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "level ")
+	{
+		HandleLevelCommand(CommandLower.substr(6));
+	}
+
+	// Decal 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "decal ")
+	{
+		HandleDecalCommand(CommandLower.substr(6));
+	}
+
+	// Asset 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "asset ")
+	{
+		HandleAssetCommand(CommandLower.substr(6));
+	}
+
+	// Profile 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 8 && CommandLower.substr(0, 8) == "profile ")
+	{
+		HandleProfileCommand(CommandLower.substr(8));
+	}
+
+	// Render 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 7 && CommandLower.substr(0, 7) == "render ")
+	{
+		HandleRenderCommand(CommandLower.substr(7));
+	}
+
 	// Help 명령어 입력
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -450,7 +537,29 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT DECAL - Show decal overlay");
+		AddLog(ELogType::Info, "  STAT DRAW - Show sorted draw / state change counts per pass");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  LOG BENCH [Threads] [Calls] - Measure UE_LOG enqueue cost under contention and report dropped calls");
+		AddLog(ELogType::Info, "  LOG FORMATBENCH [Iterations] - Compare vsnprintf / runtime parser / compile-time formatter");
+		AddLog(ELogType::Info, "  LEVEL LOADBENCH [Actors] - Compare DOM / streaming level load time and peak memory");
+		AddLog(ELogType::Info, "  LEVEL FORMATBENCH [Actors] - Compare JSON / binary level save and load time");
+		AddLog(ELogType::Info, "  LEVEL DUPLICATEBENCH - Compare bulk copy / copy-on-write PIE level duplication");
+		AddLog(ELogType::Info, "  LEVEL DUPLICATEMODE [full|cow] - Show or set how PIE duplicates the editor level");
+		AddLog(ELogType::Info, "  LEVEL PIECHECK [Ticks] - Run PIE in each duplicate mode, edit actors and check the editor level is unchanged");
+		AddLog(ELogType::Info, "  DECAL CLIPCHECK - Compare BVH / brute force decal triangle selection for every decal receiver");
+		AddLog(ELogType::Info, "  ASSET OBJBENCH [Path] - Compare stream / fast OBJ parser throughput (default: every OBJ in the library)");
+		AddLog(ELogType::Info, "  ASSET ACMR - Show vertex cache miss ratio before / after mesh cooking for every OBJ in the library");
+		AddLog(ELogType::Info, "  ASSET LOD - Show LOD triangle counts, errors and screen sizes for every OBJ in the library");
+		AddLog(ELogType::Info, "  ASSET FORCELOD [Index|-1] - Draw every static mesh at a fixed LOD (-1: select by screen size)");
+		AddLog(ELogType::Info, "  PROFILE DUMP [Frames] [Path] - Save recent frames as Chrome trace JSON (chrome://tracing, ui.perfetto.dev)");
+		AddLog(ELogType::Info, "  RENDER NULLBENCH [Frames] - Record the level and replay it on the null backend (draws, state changes, CPU ms)");
+		AddLog(ELogType::Info, "  RENDER CBRING - Show per-frame constant buffer ring usage (bytes, maps, discards)");
+		AddLog(ELogType::Info, "  RENDER RINGCHECK [Frames] - Drive the upload ring allocator with a fake fence and check alignment / overlap / wrap / oversize");
+		AddLog(ELogType::Info, "  RENDER TEXTCHECK - Compare batched text glyph quads with the old per-character layout");
+		AddLog(ELogType::Info, "  RENDER INSTANCING [on|off] - Show or set whether repeated static meshes / primitives are drawn instanced");
+		AddLog(ELogType::Info, "  RENDER MT [on|off|Workers] - Show or set the worker threads that cull and record viewports / passes");
+		AddLog(ELogType::Info, "  RENDER PROXIES - Show render proxy scene updates and check every proxy against its component");
+		AddLog(ELogType::Info, "  RENDER LINES - Show last frame's editor debug lines (lines, culled boxes, draws)");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -505,6 +614,11 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowDecal(true);
 		AddLog(ELogType::Success, "Decal overlay enabled");
 	}
+	else if (StatCommand == "draw")
+	{
+		StatOverlay.ShowDraw(true);
+		AddLog(ELogType::Success, "Draw overlay enabled");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll(true);
@@ -518,7 +632,521 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.c_str());
-		AddLog(ELogType::Info, "Available: stat {fps, memory, pick(picking), time, decal, all, none}");
+		AddLog(ELogType::Info, "Available: stat {fps, memory, pick(picking), time, decal, draw, all, none}");
+	}
+}
+
+/**
+ * @brief 로그 시스템 관련 명령어 처리
+ * log bench [Threads] [Calls]: 여러 스레드가 동시에 로그를 기록할 때의 호출당 기록 비용과 버려진 개수 측정
+ * log formatbench [Iterations]: vsnprintf / 런타임 파서 / 컴파일 타임 포맷터의 포맷팅 속도 비교
+ */
+void UConsoleWidget::HandleLogCommand(const FString& LogCommand)
+{
+	std::istringstream Stream(LogCommand);
+	FString SubCommand;
+	Stream >> SubCommand;
+
+	if (SubCommand == "bench")
+	{
+		uint32 ThreadCount = 4;
+		uint32 CallsPerThread = 100000;
+		Stream >> ThreadCount >> CallsPerThread;
+
+		const FLogBenchmarkResult Result = FAsyncLogger::GetInstance().RunBenchmark(ThreadCount, CallsPerThread);
+		AddLog(ELogType::Success, "Log Bench: %u threads x %u calls in %u rounds", ThreadCount, CallsPerThread, Result.RoundCount);
+		AddLog(ELogType::Info, "  Enqueue: %.1f ns/call, %.0f calls/sec", Result.EnqueueNanoseconds, Result.CallsPerSecond);
+		AddLog(Result.DroppedCount > 0 ? ELogType::Warning : ELogType::Info, "  Accepted: %llu, Dropped: %llu",
+			static_cast<unsigned long long>(Result.AcceptedCount), static_cast<unsigned long long>(Result.DroppedCount));
+	}
+	else if (SubCommand == "formatbench")
+	{
+		uint32 Iterations = 100000;
+		Stream >> Iterations;
+
+		const FUELogFormatBenchmarkResult Result = RunUELogFormatBenchmark(Iterations);
+		AddLog(ELogType::Success, "Format Bench: %u iterations (ns/call)", Iterations);
+		AddLog(ELogType::Info, "  vsnprintf:         %.1f", Result.VsnprintfNanoseconds);
+		AddLog(ELogType::Info, "  UELogParser::Parse: %.1f", Result.RuntimeParserNanoseconds);
+		AddLog(ELogType::Info, "  UELogFormat:        %.1f", Result.CompiledFormatNanoseconds);
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown log command: %s", LogCommand.c_str());
+		AddLog(ELogType::Info, "Available: log bench [Threads] [Calls], log formatbench [Iterations]");
+	}
+}
+
+/**
+ * @brief 레벨 관련 명령어 처리
+ * level loadbench [Actors]: 생성한 대형 레벨로 DOM / 스트리밍 로드의 시간 및 최대 메모리 비교
+ * level formatbench [Actors]: 같은 레벨 데이터를 JSON / 바이너리 포맷으로 저장 및 로드한 시간 비교
+ * level duplicatebench: 현재 레벨을 구조 일괄 복사 / Copy-on-write 방식으로 복제(PIE 시작)한 시간 비교
+ * level duplicatemode [full|cow]: PIE 시작 시 레벨 복제 방식 확인 및 변경
+ * level piecheck [Ticks]: 복제 방식마다 PIE에서 틱 / 이동 / 선택 / 스폰 / 삭제 후 에디터 레벨이 바뀌지 않았는지 검사
+ */
+void UConsoleWidget::HandleLevelCommand(const FString& LevelCommand)
+{
+	std::istringstream Stream(LevelCommand);
+	FString SubCommand;
+	Stream >> SubCommand;
+
+	if (SubCommand == "loadbench")
+	{
+		uint32 ActorCount = 100000;
+		Stream >> ActorCount;
+
+		const FLevelLoadBenchmarkResult Result = RunLevelLoadBenchmark(ActorCount);
+		AddLog(ELogType::Success, "Level Load Bench: %u actors, %.1f MB file", Result.ActorCount,
+			static_cast<double>(Result.FileSize) / (1024.0 * 1024.0));
+		AddLog(ELogType::Info, "  DOM:       %.1f ms, peak %.1f MB", Result.DomMilliseconds,
+			static_cast<double>(Result.DomPeakBytes) / (1024.0 * 1024.0));
+		AddLog(ELogType::Info, "  Streaming: %.1f ms, peak %.1f MB", Result.StreamMilliseconds,
+			static_cast<double>(Result.StreamPeakBytes) / (1024.0 * 1024.0));
+	}
+	else if (SubCommand == "formatbench")
+	{
+		uint32 ActorCount = 100000;
+		Stream >> ActorCount;
+
+		const FLevelFormatBenchmarkResult Result = RunLevelFormatBenchmark(ActorCount);
+		AddLog(ELogType::Success, "Level Format Bench: %u actors", Result.ActorCount);
+		AddLog(ELogType::Info, "  JSON:   save %.1f ms, load %.1f ms, %.1f MB", Result.JsonSaveMilliseconds,
+			Result.JsonLoadMilliseconds, static_cast<double>(Result.JsonFileSize) / (1024.0 * 1024.0));
+		AddLog(ELogType::Info, "  Binary: save %.1f ms, load %.1f ms, %.1f MB", Result.BinarySaveMilliseconds,
+			Result.BinaryLoadMilliseconds, static_cast<double>(Result.BinaryFileSize) / (1024.0 * 1024.0));
+	}
+	else if (SubCommand == "duplicatebench")
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel)
+		{
+			AddLog(ELogType::Error, "No level to duplicate");
+			return;
+		}
+
+		const FLevelDuplicateBenchmarkResult Result = CurrentLevel->RunDuplicateBenchmark();
+		AddLog(ELogType::Success, "Level Duplicate Bench: %u actors", Result.ActorCount);
+		AddLog(ELogType::Info, "  Bulk:          %.1f ms, %.2f MB", Result.BulkMilliseconds,
+			static_cast<double>(Result.BulkAllocatedBytes) / (1024.0 * 1024.0));
+		AddLog(ELogType::Info, "  Copy-on-write: %.1f ms, %.2f MB (%u actors shared)", Result.CopyOnWriteMilliseconds,
+			static_cast<double>(Result.CopyOnWriteAllocatedBytes) / (1024.0 * 1024.0), Result.SharedActorCount);
+	}
+	else if (SubCommand == "duplicatemode")
+	{
+		FString Mode;
+		Stream >> Mode;
+
+		if (Mode == "full")
+		{
+			ULevel::SetDuplicationMode(ELevelDuplicationMode::Full);
+		}
+		else if (Mode == "cow")
+		{
+			ULevel::SetDuplicationMode(ELevelDuplicationMode::CopyOnWrite);
+		}
+		else if (!Mode.empty())
+		{
+			AddLog(ELogType::Error, "Unknown duplicate mode: %s (full, cow)", Mode.c_str());
+			return;
+		}
+
+		AddLog(ELogType::Info, "PIE level duplicate mode: %s",
+			ULevel::GetDuplicationMode() == ELevelDuplicationMode::CopyOnWrite ? "cow" : "full");
+	}
+	else if (SubCommand == "piecheck")
+	{
+		uint32 TickCount = 60;
+		Stream >> TickCount;
+
+		FPIECheckResult Result;
+		if (!GEditor || !GEditor->RunPIECheck(TickCount, Result))
+		{
+			AddLog(ELogType::Error, "PIE check needs an editor level and no running PIE session");
+			return;
+		}
+
+		AddLog(!Result.bFullModified && !Result.bCopyOnWriteModified ? ELogType::Success : ELogType::Error,
+			"PIE Check: %u actors, %u ticks, %u actors edited per session", Result.ActorCount, Result.TickCount, Result.EditedActorCount);
+		AddLog(Result.bFullModified ? ELogType::Error : ELogType::Info, "  Full:          editor level %s",
+			Result.bFullModified ? "MODIFIED" : "unchanged");
+		AddLog(Result.bCopyOnWriteModified ? ELogType::Error : ELogType::Info, "  Copy-on-write: editor level %s",
+			Result.bCopyOnWriteModified ? "MODIFIED" : "unchanged");
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown level command: %s", LevelCommand.c_str());
+		AddLog(ELogType::Info, "Available: level loadbench [Actors], level formatbench [Actors], level duplicatebench, level duplicatemode [full|cow], level piecheck [Ticks]");
+	}
+}
+
+/**
+ * @brief Decal 관련 명령어 처리
+ * decal clipcheck: 레벨의 모든 Decal-Receiver 쌍에서 BVH로 고른 삼각형 집합이 BruteForce 결과와 같은지 검사
+ */
+void UConsoleWidget::HandleDecalCommand(const FString& DecalCommand)
+{
+	std::istringstream Stream(DecalCommand);
+	FString SubCommand;
+	Stream >> SubCommand;
+
+	if (SubCommand == "clipcheck")
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel)
+		{
+			AddLog(ELogType::Error, "No level to check");
+			return;
+		}
+
+		const FDecalClipCheckResult Result = RunDecalClipCheck(CurrentLevel);
+		AddLog(Result.MismatchCount == 0 ? ELogType::Success : ELogType::Error,
+			"Decal Clip Check: %u pairs, %u mismatches", Result.PairCount, Result.MismatchCount);
+		AddLog(ELogType::Info, "  Triangles: %llu / %llu selected",
+			static_cast<unsigned long long>(Result.SelectedTriangles), static_cast<unsigned long long>(Result.SourceTriangles));
+		AddLog(ELogType::Info, "  BVH: %.2f ms, BruteForce: %.2f ms", Result.BVHMilliseconds, Result.BruteForceMilliseconds);
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown decal command: %s", DecalCommand.c_str());
+		AddLog(ELogType::Info, "Available: decal clipcheck");
+	}
+}
+
+/**
+ * @brief Asset 관련 명령어 처리
+ * asset objbench [Path]: 기존 OBJ 파서와 빠른 파서의 처리량(MB/s)을 비교하고 결과가 같은지 검사
+ * asset acmr: 라이브러리의 모든 OBJ를 다시 쿡해서 메시별 ACMR 전후를 출력
+ * asset lod: 라이브러리의 모든 OBJ의 LOD 체인을 만들어 LOD별 삼각형 수 / 오차 / 전환 화면 크기를 출력
+ * asset forcelod [Index|-1]: 모든 StaticMesh를 지정한 LOD로 고정 (-1이면 화면 크기로 선택)
+ */
+void UConsoleWidget::HandleAssetCommand(const FString& AssetCommand)
+{
+	std::istringstream Stream(AssetCommand);
+	FString SubCommand;
+	Stream >> SubCommand;
+
+	if (SubCommand == "objbench")
+	{
+		FString PathString;
+		std::getline(Stream >> std::ws, PathString);
+
+		TArray<path> FilePaths;
+		if (!PathString.empty())
+		{
+			FilePaths.push_back(path(PathString));
+		}
+		else
+		{
+			for (const FName& StaticMeshPath : UAssetManager::GetInstance().GetStaticMeshPaths())
+			{
+				FilePaths.push_back(path(StaticMeshPath.ToString()));
+			}
+		}
+
+		const FObjParseBenchmarkResult Result = RunObjParseBenchmark(FilePaths);
+		if (Result.TotalBytes == 0)
+		{
+			AddLog(ELogType::Error, "No OBJ data parsed (%u files, %u failed)", Result.FileCount, Result.FailedCount);
+			return;
+		}
+
+		const double Megabytes = static_cast<double>(Result.TotalBytes) / (1024.0 * 1024.0);
+		AddLog(Result.MismatchCount == 0 && Result.FailedCount == 0 ? ELogType::Success : ELogType::Error,
+			"OBJ Parse Bench: %u files, %.1f MB, %u mismatches, %u failed", Result.FileCount, Megabytes,
+			Result.MismatchCount, Result.FailedCount);
+		AddLog(ELogType::Info, "  Stream: %.1f ms (%.1f MB/s)", Result.StreamMilliseconds,
+			Megabytes / std::max(Result.StreamMilliseconds / 1000.0, 1e-6));
+		AddLog(ELogType::Info, "  Fast:   %.1f ms (%.1f MB/s), %.2fx", Result.FastMilliseconds,
+			Megabytes / std::max(Result.FastMilliseconds / 1000.0, 1e-6),
+			Result.StreamMilliseconds / std::max(Result.FastMilliseconds, 1e-6));
+	}
+	else if (SubCommand == "acmr")
+	{
+		const TArray<FName>& StaticMeshPaths = UAssetManager::GetInstance().GetStaticMeshPaths();
+		double SourceSum = 0.0;
+		double CookedSum = 0.0;
+		uint32 MeshCount = 0;
+
+		for (const FName& StaticMeshPath : StaticMeshPaths)
+		{
+			const FString PathString = StaticMeshPath.ToString();
+			FMeshCookStats Stats;
+			if (!FObjManager::BuildStaticMeshAsset(PathString, FObjManager::GetDefaultConfiguration(), &Stats))
+			{
+				AddLog(ELogType::Error, "  %s: failed to load", PathString.c_str());
+				continue;
+			}
+
+			AddLog(ELogType::Info, "  %s: %u verts, %u tris, ACMR %.3f -> %.3f, %s indices",
+				path(PathString).filename().string().c_str(), Stats.VertexCount, Stats.TriangleCount,
+				Stats.SourceACMR, Stats.CookedACMR, Stats.b16BitIndices ? "16-bit" : "32-bit");
+			SourceSum += Stats.SourceACMR;
+			CookedSum += Stats.CookedACMR;
+			++MeshCount;
+		}
+
+		if (MeshCount == 0)
+		{
+			AddLog(ELogType::Error, "No static mesh cooked");
+			return;
+		}
+
+		AddLog(ELogType::Success, "Mesh Cook ACMR (FIFO %u): %u meshes, average %.3f -> %.3f",
+			FMeshCooker::ACMRCacheSize, MeshCount, SourceSum / MeshCount, CookedSum / MeshCount);
+	}
+	else if (SubCommand == "lod")
+	{
+		uint32 MeshCount = 0;
+		uint32 LODMeshCount = 0;
+		for (const FName& StaticMeshPath : UAssetManager::GetInstance().GetStaticMeshPaths())
+		{
+			const FString PathString = StaticMeshPath.ToString();
+			std::unique_ptr<FStaticMesh> StaticMesh = FObjManager::BuildStaticMeshAsset(PathString, FObjManager::GetDefaultConfiguration());
+			if (!StaticMesh)
+			{
+				AddLog(ELogType::Error, "  %s: failed to load", PathString.c_str());
+				continue;
+			}
+
+			++MeshCount;
+			FString Line = path(PathString).filename().string() + ": LOD0 " + std::to_string(StaticMesh->Indices.size() / 3) + " tris";
+			for (size_t i = 0; i < StaticMesh->LODs.size(); ++i)
+			{
+				const FStaticMeshLOD& LOD = StaticMesh->LODs[i];
+				char Buffer[128];
+				snprintf(Buffer, sizeof(Buffer), " | LOD%zu %zu tris, error %.4f, screen <= %.3f",
+					i + 1, LOD.Indices.size() / 3, LOD.Error, LOD.ScreenSize);
+				Line += Buffer;
+			}
+			if (!StaticMesh->LODs.empty())
+			{
+				++LODMeshCount;
+			}
+			AddLog(ELogType::Info, "  %s", Line.c_str());
+		}
+
+		AddLog(ELogType::Success, "Static Mesh LOD: %u of %u meshes have LODs (max screen error %.3f)",
+			LODMeshCount, MeshCount, FMeshSimplifier::MaxScreenError);
+	}
+	else if (SubCommand == "forcelod")
+	{
+		int32 ForcedLOD = -1;
+		Stream >> ForcedLOD;
+		UStaticMeshComponent::SetForcedLOD(std::max(ForcedLOD, -1));
+		AddLog(ELogType::Info, "Static mesh LOD: %s", ForcedLOD < 0 ? "screen size" : std::to_string(ForcedLOD).c_str());
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown asset command: %s", AssetCommand.c_str());
+		AddLog(ELogType::Info, "Available: asset objbench [Path], asset acmr, asset lod, asset forcelod [Index|-1]");
+	}
+}
+
+void UConsoleWidget::HandleProfileCommand(const FString& ProfileCommand)
+{
+	std::istringstream Stream(ProfileCommand);
+	FString SubCommand;
+	Stream >> SubCommand;
+
+	if (SubCommand == "dump")
+	{
+		uint32 FrameCount = FProfiler::HistoryFrameCount;
+		FString PathString = "Log/Trace.json";
+		if (FString Token; Stream >> Token)
+		{
+			if (std::all_of(Token.begin(), Token.end(), ::isdigit))
+			{
+				FrameCount = static_cast<uint32>(std::stoul(Token));
+				Stream >> PathString;
+			}
+			else
+			{
+				PathString = Token;
+			}
+		}
+
+		const FProfiler& Profiler = FProfiler::GetInstance();
+		uint32 EventCount = 0;
+		if (!Profiler.ExportChromeTrace(path(PathString), FrameCount, EventCount))
+		{
+			AddLog(ELogType::Error, "Failed to save trace: %s (%u frames recorded)", PathString.c_str(), Profiler.GetRecordedFrameCount());
+			return;
+		}
+
+		AddLog(ELogType::Success, "Trace saved: %s (%u frames, %u events, %llu dropped)", PathString.c_str(),
+			std::min(FrameCount, Profiler.GetRecordedFrameCount()), EventCount, Profiler.GetDroppedEventCount());
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown profile command: %s", ProfileCommand.c_str());
+		AddLog(ELogType::Info, "Available: profile dump [Frames] [Path]");
+	}
+}
+
+void UConsoleWidget::HandleRenderCommand(const FString& RenderCommand)
+{
+	std::istringstream Stream(RenderCommand);
+	FString SubCommand;
+	Stream >> SubCommand;
+
+	if (SubCommand == "nullbench")
+	{
+		uint32 FrameCount = 100;
+		if (FString Token; Stream >> Token && std::all_of(Token.begin(), Token.end(), ::isdigit))
+		{
+			FrameCount = std::max(1u, static_cast<uint32>(std::stoul(Token)));
+		}
+
+		const FNullBackendBenchmarkResult Result = URenderer::GetInstance().RunNullBackendBenchmark(FrameCount);
+		if (Result.FrameCount == 0)
+		{
+			AddLog(ELogType::Error, "Null backend benchmark needs a loaded level");
+			return;
+		}
+
+		const FRenderCommandStats& Stats = Result.LastFrameStats;
+		AddLog(ELogType::Success, "Null backend: %u frames, %.3f ms/frame, peak command buffer %u bytes",
+			Result.FrameCount, Result.AverageFrameMs, Result.PeakCommandBytes);
+		AddLog(ELogType::Info, "  Commands %u, Draws %u (instanced %u, %u instances), Vertices %llu, Pipeline changes %u",
+			Stats.CommandCount, Stats.DrawCalls, Stats.InstancedDrawCalls, Stats.InstanceCount, Stats.VertexCount, Stats.PipelineStateChanges);
+		AddLog(ELogType::Info, "  Binds: VB/IB %u, CB %u, SRV/Sampler %u, RT %u",
+			Stats.BufferBinds, Stats.ConstantBufferBinds, Stats.TextureBinds, Stats.RenderTargetChanges);
+		AddLog(ELogType::Info, "  State cache: %u binds requested, %u filtered, %u changed in %u device calls",
+			Stats.StateCache.RequestedBinds, Stats.StateCache.GetFilteredBinds(), Stats.StateCache.ChangedBinds, Stats.StateCache.IssuedCalls);
+		AddLog(ELogType::Info, "  Buffer updates %u (%u appends, %llu bytes), signature %016llx",
+			Stats.BufferUpdates, Stats.BufferAppends, Stats.UploadBytes, Stats.Signature);
+	}
+	else if (SubCommand == "cbring")
+	{
+		const FConstantBufferRing& Ring = URenderer::GetInstance().GetConstantBufferRing();
+		if (!Ring.IsSupported())
+		{
+			AddLog(ELogType::Warning, "Constant buffer ring: offset binding not supported, using Map(DISCARD) per update");
+			return;
+		}
+
+		const FConstantBufferRingStats& Stats = Ring.GetStats();
+		AddLog(ELogType::Success, "Constant buffer ring: %u KB, last frame %u KB in %u maps (peak %u KB)",
+			Stats.Capacity / 1024, Stats.LastFrameBytes / 1024, Stats.LastFrameMaps, Stats.PeakFrameBytes / 1024);
+		AddLog(ELogType::Info, "  Frames in flight %u, discards %u, fallback lists %u",
+			Stats.FramesInFlight, Stats.Discards, Stats.FallbackMaps);
+	}
+	else if (SubCommand == "ringcheck")
+	{
+		uint32 FrameCount = 3000;
+		Stream >> FrameCount;
+
+		const FUploadRingCheckResult Result = RunUploadRingCheck(FrameCount);
+		AddLog(Result.GetErrorCount() == 0 ? ELogType::Success : ELogType::Error,
+			"Upload Ring Check: %u rings x %u frames, %u errors", Result.RingCount, FrameCount, Result.GetErrorCount());
+		AddLog(ELogType::Info, "  Allocations %llu, rejected %llu, wraps %u",
+			static_cast<unsigned long long>(Result.AllocationCount), static_cast<unsigned long long>(Result.RejectedCount), Result.WrapCount);
+		AddLog(ELogType::Info, "  Alignment %u, overlap %u, oversize %u, wrap %u, leak %u", Result.AlignmentErrors,
+			Result.OverlapErrors, Result.OversizeErrors, Result.WrapErrors, Result.LeakErrors);
+	}
+	else if (SubCommand == "textcheck")
+	{
+		const FTextLayoutCheckResult Result = RunTextLayoutCheck();
+		AddLog(Result.MismatchCount == 0 ? ELogType::Success : ELogType::Error,
+			"Text Layout Check: %u cases, %u glyphs, %u mismatches", Result.CaseCount, Result.GlyphCount, Result.MismatchCount);
+		AddLog(ELogType::Info, "  Max position error: %g", Result.MaxPositionError);
+	}
+	else if (SubCommand == "instancing")
+	{
+		FString Mode;
+		Stream >> Mode;
+
+		if (Mode == "on")
+		{
+			URenderer::GetInstance().SetInstancingEnabled(true);
+		}
+		else if (Mode == "off")
+		{
+			URenderer::GetInstance().SetInstancingEnabled(false);
+		}
+		else if (!Mode.empty())
+		{
+			AddLog(ELogType::Error, "Unknown instancing mode: %s (on, off)", Mode.c_str());
+			return;
+		}
+
+		AddLog(ELogType::Info, "Draw instancing: %s", URenderer::GetInstance().IsInstancingEnabled() ? "on" : "off");
+	}
+	else if (SubCommand == "mt")
+	{
+		URenderer& Renderer = URenderer::GetInstance();
+		FString Mode;
+		Stream >> Mode;
+
+		if (Mode == "on")
+		{
+			Renderer.SetRenderWorkerCount(URenderer::GetDefaultRenderWorkerCount());
+		}
+		else if (Mode == "off")
+		{
+			Renderer.SetRenderWorkerCount(0);
+		}
+		else if (!Mode.empty() && std::all_of(Mode.begin(), Mode.end(), ::isdigit))
+		{
+			Renderer.SetRenderWorkerCount(static_cast<uint32>(std::stoul(Mode)));
+		}
+		else if (!Mode.empty())
+		{
+			AddLog(ELogType::Error, "Unknown mt mode: %s (on, off, worker count)", Mode.c_str());
+			return;
+		}
+
+		// 통계는 마지막으로 그린 프레임 기준 (워커 수를 바꾼 직후에는 이전 설정의 값)
+		const FRenderRecordingStats& Stats = Renderer.GetRecordingStats();
+		AddLog(ELogType::Info, "Render workers: %u (%s)", Renderer.GetRenderWorkerCount(),
+			Renderer.GetRenderWorkerCount() > 0 ? "parallel recording" : "main thread only");
+		AddLog(ELogType::Info, "  Last frame: %u views, %u recording jobs on %u workers",
+			Stats.ViewCount, Stats.RecordingJobs, Stats.WorkerCount);
+		AddLog(ELogType::Info, "  Prepare %.3f ms, record %.3f ms, submit %.3f ms",
+			Stats.PrepareMs, Stats.RecordMs, Stats.SubmitMs);
+		AddLog(ELogType::Info, "  Culled %u / %u views, rebucketed %u (others reused last frame's visible set)",
+			Stats.CulledViews, Stats.ViewCount, Stats.RebucketedViews);
+	}
+	else if (SubCommand == "proxies")
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel)
+		{
+			AddLog(ELogType::Error, "Render proxies need a loaded level");
+			return;
+		}
+
+		const FRenderScene* Scene = CurrentLevel->GetRenderScene();
+		const FRenderSceneStats& Stats = Scene->GetStats();
+		AddLog(ELogType::Info, "Render scene: %u proxies, %u material slots, %u rebuilds",
+			Stats.Proxies, Stats.MaterialSlots, Stats.Rebuilds);
+		AddLog(ELogType::Info, "  Last update: %u proxies refreshed in %.3f ms", Stats.LastFrameUpdates, Stats.LastUpdateMs);
+		AddLog(ELogType::Info, "  Scene revision: %llu", static_cast<unsigned long long>(Scene->GetRevision()));
+
+		// 통지 없이 바뀐 컴포넌트가 있으면 프록시가 이전 상태로 그려짐
+		const uint32 StaleCount = Scene->CountStaleProxies();
+		if (StaleCount == 0)
+		{
+			AddLog(ELogType::Success, "  All proxies match their components");
+		}
+		else
+		{
+			AddLog(ELogType::Warning, "  %u proxies differ from their components (missing change notification)", StaleCount);
+		}
+	}
+	else if (SubCommand == "lines")
+	{
+		// 에디터 디버그 라인은 PIE 중에는 그리지 않으므로 모두 0
+		const FBatchLineStats& Stats = GEditor->GetEditorModule()->GetBatchLineStats();
+		AddLog(ELogType::Info, "Debug lines: %u lines in %u draws over %u viewports",
+			Stats.Lines, Stats.Draws, Stats.Viewports);
+		AddLog(ELogType::Info, "  Debug boxes: %u drawn, %u culled by the view frustum", Stats.Boxes, Stats.CulledBoxes);
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown render command: %s", RenderCommand.c_str());
+		AddLog(ELogType::Info, "Available: render nullbench [Frames], render instancing [on|off], render cbring, render ringcheck [Frames], render textcheck, render mt [on|off|Workers], render proxies, render lines");
 	}
 }
 
@@ -5,6 +5,7 @@
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
 #include "Core/Public/ObjectIterator.h"
+#include "Manager/Asset/Public/AssetManager.h"
 #include "Editor/Public/Editor.h"
 #include "Actor/Public/Actor.h"
 
@@ -97,6 +98,9 @@ void UDecalComponentWidget::RenderWidget()
 
     if (ImGui::BeginCombo("Material", Preview.c_str()))
     {
+        // Material 라이브러리는 목록을 처음 열 때 로드
+        UAssetManager::GetInstance().EnsureAllMaterialsLoaded();
+
         for (TObjectIterator<UMaterial> It; It; ++It)
         {
             UMaterial* Mat = *It; if (!Mat) continue;
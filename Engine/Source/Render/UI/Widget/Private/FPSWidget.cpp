@@ -79,7 +79,7 @@ void UFPSWidget::RenderWidget()
 	if (bShowGraph)
 	{
 		ImGui::Text("동적 할당된 메모리 정보");
-		ImGui::Text("Overall Object Count: %u", TotalAllocationCount);
+		ImGui::Text("Overall Object Count: %u", TotalAllocationCount.load());
 		ImGui::Text("Overall Memory: %.3f KB", static_cast<float>(TotalAllocationBytes) / KILO);
 		ImGui::Separator();
 
@@ -667,6 +667,7 @@ path UMainBarWidget::OpenSaveFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 			FileSaveDialogPtr->SetFileTypes(ARRAYSIZE(SpecificationRange), SpecificationRange);
@@ -753,6 +754,7 @@ path UMainBarWidget::OpenLoadFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 
@@ -214,6 +214,7 @@ path USceneIOWidget::OpenSaveFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 			FileSaveDialogPtr->SetFileTypes(ARRAYSIZE(SpecificationRange), SpecificationRange);
@@ -300,6 +301,7 @@ path USceneIOWidget::OpenLoadFileDialog()
 			// 파일 타입 필터 설정
 			COMDLG_FILTERSPEC SpecificationRange[] = {
 				{L"Scene Files (*.scene)", L"*.scene"},
+				{L"Binary Scene Files (*.scenebin)", L"*.scenebin"},
 				{L"All Files (*.*)", L"*.*"}
 			};
 
@@ -57,6 +57,9 @@ void USpriteSelectionWidget::RenderWidget()
 	static int CurrentIndex = 0;
 
 	// 1) TextureCache에서 (이름, 표시용 문자열) 수집
+	// Material 텍스처는 지연 로드되므로 목록을 그리기 전에 라이브러리를 한 번 로드
+	UAssetManager::GetInstance().EnsureAllMaterialsLoaded();
+
 	struct FSpriteItem
 	{
 		FName   Name;
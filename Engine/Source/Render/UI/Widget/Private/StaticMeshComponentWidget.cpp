@@ -2,6 +2,7 @@
 #include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/AssetManager.h"
 
 #include "Level/Public/Level.h"
 #include "Core/Public/ObjectIterator.h"
@@ -81,21 +82,18 @@ void UStaticMeshComponentWidget::RenderStaticMeshSelector()
 	// 첫 번째 인자는 라벨, 두 번째 인자는 닫혀 있을 때 표시될 텍스트입니다.
 	if (ImGui::BeginCombo("Static Mesh", PreviewName.ToString().c_str()))
 	{
-		// 3. TObjectIterator로 모든 UStaticMesh 에셋을 순회합니다.
-		for (TObjectIterator<UStaticMesh> It; It; ++It)
+		// 3. 로드 여부와 관계없이 애셋 라이브러리의 모든 .obj 경로를 순회합니다.
+		for (const FName& MeshPath : UAssetManager::GetInstance().GetStaticMeshPaths())
 		{
-			UStaticMesh* MeshInList = *It;
-			if (!MeshInList) continue;
-
 			// 현재 선택된 항목인지 확인합니다.
-			const bool bIsSelected = (CurrentStaticMesh == MeshInList);
+			const bool bIsSelected = (PreviewName == MeshPath);
 
 			// 4. ImGui::Selectable로 각 항목을 만듭니다.
 			// 사용자가 이 항목을 클릭하면 if문이 true가 됩니다.
-			if (ImGui::Selectable(MeshInList->GetAssetPathFileName().ToString().c_str(), bIsSelected))
+			if (ImGui::Selectable(MeshPath.ToString().c_str(), bIsSelected))
 			{
-				// 5. 항목이 선택되면, 컴포넌트의 스태틱 메시를 교체합니다.
-				StaticMeshComponent->SetStaticMesh(MeshInList->GetAssetPathFileName());
+				// 5. 항목이 선택되면, 컴포넌트의 스태틱 메시를 교체합니다. (처음 선택된 메시는 이때 로드)
+				StaticMeshComponent->SetStaticMesh(MeshPath);
 			}
 
 			// 현재 선택된 항목에 포커스를 맞춰서 드롭다운이 열렸을 때 바로 보이게 합니다.
@@ -140,6 +138,9 @@ void UStaticMeshComponentWidget::RenderMaterialSections()
 
 void UStaticMeshComponentWidget::RenderAvailableMaterials(int32 TargetSlotIndex)
 {
+	// Material 라이브러리는 목록을 처음 열 때 로드
+	UAssetManager::GetInstance().EnsureAllMaterialsLoaded();
+
 	// 모든 UMaterial 순회
 	for (TObjectIterator<UMaterial> It; It; ++It)
 	{
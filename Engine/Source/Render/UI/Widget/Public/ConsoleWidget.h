@@ -6,12 +6,6 @@ using std::streambuf;
 class UConsoleWidget;
 struct ImGuiInputTextCallbackData;
 
-struct FLogEntry
-{
-	ELogType Type;
-	FString Message;
-};
-
 /**
  * @brief Custom Stream Buffer
  * Redirects Output to ConsoleWidget
@@ -60,6 +54,12 @@ public:
 	// Console command
 	void ProcessCommand(const char* InCommand);
 	void HandleStatCommand(const FString& StatCommand);
+	void HandleLogCommand(const FString& LogCommand);
+	void HandleLevelCommand(const FString& LevelCommand);
+	void HandleDecalCommand(const FString& DecalCommand);
+	void HandleAssetCommand(const FString& AssetCommand);
+	void HandleProfileCommand(const FString& ProfileCommand);
+	void HandleRenderCommand(const FString& RenderCommand);
 	void ExecuteTerminalCommand(const char* InCommand);
 
 	// Use external terminal
@@ -77,7 +77,8 @@ private:
 	int HistoryPosition;
 
 	// Log output
-	TArray<FLogEntry> LogItems;
+	// FAsyncLogger::MaxConsoleEntries를 넘으면 오래된 로그부터 제거
+	TDeque<FLogEntry> LogItems;
 	bool bIsAutoScroll;
 	bool bIsScrollToBottom;
 
@@ -91,4 +92,6 @@ private:
 	static ImVec4 GetColorByLogType(ELogType InType);
 
 	void AddLogInternal(ELogType InType, const char* fmt, va_list InArguments);
+	void PushLogEntry(FLogEntry&& InEntry);
+	void DrainAsyncLogs();
 };
@@ -0,0 +1,306 @@
+#include "pch.h"
+#include "Utility/Public/AsyncLogger.h"
+
+FAsyncLogger& FAsyncLogger::GetInstance()
+{
+	static FAsyncLogger Instance;
+	return Instance;
+}
+
+FAsyncLogger::FAsyncLogger()
+{
+	Cells = new FCell[RingCapacity];
+	for (uint32 Index = 0; Index < RingCapacity; ++Index)
+	{
+		Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+	}
+
+	std::error_code ErrorCode;
+	create_directories("Log", ErrorCode);
+	if (fopen_s(&LogFile, "Log/Engine.log", "w") != 0)
+	{
+		LogFile = nullptr;
+	}
+
+	Worker = std::thread(&FAsyncLogger::WorkerLoop, this);
+}
+
+FAsyncLogger::~FAsyncLogger()
+{
+	bIsRunning.store(false, std::memory_order_release);
+	WakeCondition.notify_one();
+	if (Worker.joinable())
+	{
+		Worker.join();
+	}
+
+	if (LogFile)
+	{
+		fclose(LogFile);
+		LogFile = nullptr;
+	}
+
+	delete[] Cells;
+}
+
+void FAsyncLogger::CaptureString(FLogRecord& Record, FLogArgument& Argument, std::string_view InString)
+{
+	Argument.Type = FLogArgument::EType::String;
+	Argument.PayloadOffset = Record.PayloadUsed;
+
+	// 남은 Payload보다 긴 문자열은 잘라서 저장 (널 문자 공간 확보)
+	const uint32 Available = FLogRecord::PayloadSize - Record.PayloadUsed;
+	if (Available == 0)
+	{
+		Argument.Type = FLogArgument::EType::Pointer;
+		Argument.Pointer = nullptr;
+		return;
+	}
+
+	const uint32 CopyLength = std::min(static_cast<uint32>(InString.size()), Available - 1);
+	memcpy(Record.Payload + Record.PayloadUsed, InString.data(), CopyLength);
+	Record.Payload[Record.PayloadUsed + CopyLength] = '\0';
+	Record.PayloadUsed = static_cast<uint16>(Record.PayloadUsed + CopyLength + 1);
+}
+
+void FAsyncLogger::CaptureWideString(FLogRecord& Record, FLogArgument& Argument, const wchar_t* InString)
+{
+	// wchar_t 정렬 맞추기
+	uint32 Offset = (Record.PayloadUsed + alignof(wchar_t) - 1) & ~static_cast<uint32>(alignof(wchar_t) - 1);
+	if (Offset + sizeof(wchar_t) > FLogRecord::PayloadSize)
+	{
+		Argument.Type = FLogArgument::EType::Pointer;
+		Argument.Pointer = nullptr;
+		return;
+	}
+
+	Argument.Type = FLogArgument::EType::WideString;
+	Argument.PayloadOffset = Offset;
+
+	const uint32 MaxCharacters = (FLogRecord::PayloadSize - Offset) / sizeof(wchar_t) - 1;
+	wchar_t* Destination = reinterpret_cast<wchar_t*>(Record.Payload + Offset);
+	uint32 Length = 0;
+	while (Length < MaxCharacters && InString[Length] != L'\0')
+	{
+		Destination[Length] = InString[Length];
+		++Length;
+	}
+	Destination[Length] = L'\0';
+	Record.PayloadUsed = static_cast<uint16>(Offset + (Length + 1) * sizeof(wchar_t));
+}
+
+/**
+ * @brief 레코드에 저장된 포맷팅 함수로 최종 문자열을 생성
+ * 대부분의 로그는 스택 버퍼 한 번으로 끝나고, 더 긴 로그만 필요한 길이로 다시 포맷팅
+ */
+void FAsyncLogger::FormatRecord(const FLogRecord& InRecord, FString& OutMessage)
+{
+	OutMessage.clear();
+	if (!InRecord.Formatter)
+	{
+		return;
+	}
+
+	char Buffer[512];
+	const size_t Length = InRecord.Formatter(InRecord, Buffer, sizeof(Buffer));
+	if (Length < sizeof(Buffer))
+	{
+		OutMessage.assign(Buffer, Length);
+		return;
+	}
+
+	OutMessage.resize(Length);
+	InRecord.Formatter(InRecord, OutMessage.data(), Length + 1);
+}
+
+void FAsyncLogger::WriteRecord(const FLogRecord& InRecord, const FString& InMessage)
+{
+	const char* Prefix = InRecord.Prefix ? InRecord.Prefix : "";
+
+	// stdout
+	printf("%s%s\n", Prefix, InMessage.c_str());
+
+	// 파일
+	if (LogFile)
+	{
+		fprintf(LogFile, "%s%s\n", Prefix, InMessage.c_str());
+	}
+
+	// 콘솔 위젯 (메인 스레드가 DrainConsoleEntries로 가져감)
+	std::lock_guard<std::mutex> Lock(ConsoleMutex);
+	PendingConsoleEntries.push_back(FLogEntry{ InRecord.Type, InMessage });
+	while (PendingConsoleEntries.size() > MaxConsoleEntries)
+	{
+		PendingConsoleEntries.pop_front();
+	}
+}
+
+bool FAsyncLogger::ProcessPendingRecords()
+{
+	bool bHasProcessed = false;
+	FString Message;
+	Message.reserve(256);
+
+	for (;;)
+	{
+		FCell& Cell = Cells[DequeuePosition & (RingCapacity - 1)];
+		const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+		if (Sequence != DequeuePosition + 1)
+		{
+			break;
+		}
+
+		FormatRecord(Cell.Record, Message);
+		if (!Cell.Record.bIsBenchmark)
+		{
+			WriteRecord(Cell.Record, Message);
+		}
+
+		Cell.Sequence.store(DequeuePosition + RingCapacity, std::memory_order_release);
+		++DequeuePosition;
+		ProcessedPosition.store(DequeuePosition, std::memory_order_release);
+		bHasProcessed = true;
+	}
+
+	// 버려진 로그가 있으면 한 번에 알림
+	const uint64 Dropped = DroppedCount.load(std::memory_order_relaxed);
+	if (Dropped != ReportedDroppedCount)
+	{
+		FLogRecord Notice;
+		Notice.Prefix = "[WARNING] ";
+		Notice.Type = ELogType::Warning;
+		WriteRecord(Notice, "AsyncLogger: Ring Buffer 포화로 로그 " + std::to_string(Dropped - ReportedDroppedCount) + "개가 버려졌습니다");
+		ReportedDroppedCount = Dropped;
+	}
+
+	if (bHasProcessed && LogFile)
+	{
+		fflush(LogFile);
+	}
+
+	return bHasProcessed;
+}
+
+void FAsyncLogger::WorkerLoop()
+{
+	while (bIsRunning.load(std::memory_order_acquire))
+	{
+		if (ProcessPendingRecords())
+		{
+			continue;
+		}
+
+		// 처리할 로그가 없으면 잠시 대기 (notify 누락에 대비해 짧은 타임아웃 사용)
+		std::unique_lock<std::mutex> Lock(WakeMutex);
+		bIsWorkerSleeping.store(true, std::memory_order_relaxed);
+		WakeCondition.wait_for(Lock, std::chrono::milliseconds(2));
+		bIsWorkerSleeping.store(false, std::memory_order_relaxed);
+	}
+
+	// 종료 전 남은 로그 모두 출력
+	ProcessPendingRecords();
+}
+
+void FAsyncLogger::Flush()
+{
+	const uint64 Target = EnqueuePosition.load(std::memory_order_acquire);
+	while (ProcessedPosition.load(std::memory_order_acquire) < Target)
+	{
+		WakeCondition.notify_one();
+		std::this_thread::yield();
+	}
+}
+
+void FAsyncLogger::DrainConsoleEntries(TDeque<FLogEntry>& OutEntries)
+{
+	std::lock_guard<std::mutex> Lock(ConsoleMutex);
+	while (!PendingConsoleEntries.empty())
+	{
+		OutEntries.push_back(std::move(PendingConsoleEntries.front()));
+		PendingConsoleEntries.pop_front();
+	}
+}
+
+FLogBenchmarkResult FAsyncLogger::RunBenchmark(uint32 InThreadCount, uint32 InCallsPerThread)
+{
+	FLogBenchmarkResult Result;
+	InThreadCount = std::clamp(InThreadCount, 1u, RingCapacity);
+
+	// 한 라운드에 모든 스레드가 기록하는 양이 Ring Buffer 용량을 넘지 않도록 분할
+	const uint32 CallsPerRound = std::max(1u, RingCapacity / InThreadCount);
+	const uint64 DroppedBefore = DroppedCount.load(std::memory_order_relaxed);
+	TArray<uint64> ThreadNanoseconds(InThreadCount, 0);
+	TArray<uint64> ThreadAccepted(InThreadCount, 0);
+	uint64 TotalNanoseconds = 0;
+
+	// UE_LOG와 같은 경로로 포맷팅되도록 포맷 타입에서 포맷팅 함수를 생성
+	const auto BenchmarkFormat = UE_FORMAT_STRING("Bench: %s thread %u call %u value %.3f");
+	const FLogRecord::FFormatFunction Formatter =
+		&FormatCapturedRecord<std::decay_t<decltype(BenchmarkFormat)>, const char*, uint32, uint32, float>;
+
+	Flush();
+
+	for (uint32 FirstCall = 0; FirstCall < InCallsPerThread; FirstCall += CallsPerRound)
+	{
+		const uint32 RoundCalls = std::min(CallsPerRound, InCallsPerThread - FirstCall);
+
+		std::atomic<bool> bStart{ false };
+		TArray<std::thread> Threads;
+		Threads.reserve(InThreadCount);
+		for (uint32 ThreadIndex = 0; ThreadIndex < InThreadCount; ++ThreadIndex)
+		{
+			Threads.emplace_back([this, &bStart, &ThreadNanoseconds, &ThreadAccepted, Formatter, ThreadIndex, FirstCall, RoundCalls]()
+			{
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+
+				static const char* const Name = "Benchmark";
+				uint64 Accepted = 0;
+				const auto StartTime = std::chrono::high_resolution_clock::now();
+				for (uint32 Call = FirstCall; Call < FirstCall + RoundCalls; ++Call)
+				{
+					Accepted += Enqueue(ELogType::Debug, "[DEBUG] ", Formatter, true,
+						[&](FLogRecord& Record)
+						{
+							CaptureArgument(Record, Name);
+							CaptureArgument(Record, ThreadIndex);
+							CaptureArgument(Record, Call);
+							CaptureArgument(Record, Call * 0.5f);
+						}) ? 1 : 0;
+				}
+				const auto EndTime = std::chrono::high_resolution_clock::now();
+
+				ThreadNanoseconds[ThreadIndex] = std::chrono::duration_cast<std::chrono::nanoseconds>(EndTime - StartTime).count();
+				ThreadAccepted[ThreadIndex] += Accepted;
+			});
+		}
+
+		bStart.store(true, std::memory_order_release);
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+
+		// 라운드 시간은 가장 늦게 끝난 스레드 기준, 다음 라운드 전에 Ring Buffer를 비움 (측정 제외)
+		TotalNanoseconds += *std::max_element(ThreadNanoseconds.begin(), ThreadNanoseconds.end());
+		++Result.RoundCount;
+		Flush();
+	}
+
+	for (uint64 Accepted : ThreadAccepted)
+	{
+		Result.AcceptedCount += Accepted;
+	}
+	Result.DroppedCount = DroppedCount.load(std::memory_order_relaxed) - DroppedBefore;
+
+	if (Result.AcceptedCount > 0 && TotalNanoseconds > 0)
+	{
+		// 모든 스레드가 동시에 기록하므로 스레드 하나가 호출 1회에 쓴 평균 시간으로 환산
+		const double CallsPerThread = static_cast<double>(Result.AcceptedCount) / InThreadCount;
+		Result.EnqueueNanoseconds = static_cast<double>(TotalNanoseconds) / CallsPerThread;
+		Result.CallsPerSecond = static_cast<double>(Result.AcceptedCount) * 1e9 / static_cast<double>(TotalNanoseconds);
+	}
+	return Result;
+}
@@ -0,0 +1,509 @@
+#include "pch.h"
+#include "Utility/Public/JsonStreamReader.h"
+#include "Utility/Public/JsonSerializer.h"
+
+#include <json.hpp>
+
+FJsonStreamReader::FJsonStreamReader(const FString& InFilePath, size_t InChunkSize)
+{
+	Buffer.resize(InChunkSize > 0 ? InChunkSize : 1);
+	if (fopen_s(&File, InFilePath.c_str(), "rb") != 0)
+	{
+		File = nullptr;
+		ErrorMessage = "파일을 열 수 없습니다: " + InFilePath;
+	}
+}
+
+FJsonStreamReader::~FJsonStreamReader()
+{
+	if (File)
+	{
+		fclose(File);
+		File = nullptr;
+	}
+}
+
+bool FJsonStreamReader::Refill()
+{
+	if (!File)
+	{
+		return false;
+	}
+
+	Size = fread(Buffer.data(), 1, Buffer.size(), File);
+	Position = 0;
+	return Size > 0;
+}
+
+void FJsonStreamReader::SkipWhitespace()
+{
+	for (int Character = Peek(); Character != EOF && isspace(Character); Character = Peek())
+	{
+		++Position;
+	}
+}
+
+bool FJsonStreamReader::Expect(char InCharacter)
+{
+	SkipWhitespace();
+	if (Get() != InCharacter)
+	{
+		char Message[64];
+		(void)snprintf(Message, sizeof(Message), "'%c'가 필요합니다", InCharacter);
+		return SetError(Message);
+	}
+	return true;
+}
+
+bool FJsonStreamReader::SetError(const char* InMessage)
+{
+	if (ErrorMessage.empty())
+	{
+		ErrorMessage = InMessage;
+	}
+	return false;
+}
+
+bool FJsonStreamReader::ReadObjectStart()
+{
+	if (HasError() || !Expect('{'))
+	{
+		return false;
+	}
+	ObjectHasMembers.push_back(false);
+	return true;
+}
+
+bool FJsonStreamReader::ReadNextKey(FString& OutKey)
+{
+	if (HasError())
+	{
+		return false;
+	}
+
+	if (ObjectHasMembers.empty())
+	{
+		return SetError("열린 객체가 없습니다");
+	}
+
+	SkipWhitespace();
+	if (Peek() == '}')
+	{
+		++Position;
+		ObjectHasMembers.pop_back();
+		return false;
+	}
+
+	if (ObjectHasMembers.back())
+	{
+		if (Peek() != ',')
+		{
+			return SetError("객체에 ',' 또는 '}'가 필요합니다");
+		}
+		++Position;
+		SkipWhitespace();
+	}
+
+	if (Peek() != '"')
+	{
+		return SetError("객체 키 문자열이 필요합니다");
+	}
+
+	ObjectHasMembers.back() = true;
+	return ReadString(OutKey) && Expect(':');
+}
+
+bool FJsonStreamReader::ReadValue(JSON& OutValue)
+{
+	return !HasError() && ReadValueInternal(OutValue, 0);
+}
+
+bool FJsonStreamReader::SkipValue()
+{
+	return !HasError() && SkipValueInternal(0);
+}
+
+bool FJsonStreamReader::ReadValueInternal(JSON& OutValue, uint32 InDepth)
+{
+	if (InDepth > MaxDepth)
+	{
+		return SetError("JSON 중첩이 너무 깊습니다");
+	}
+
+	SkipWhitespace();
+	const int Character = Peek();
+
+	switch (Character)
+	{
+	case '{':
+	{
+		++Position;
+		ObjectHasMembers.push_back(false);
+		OutValue = json::Object();
+		FString Key;
+		while (ReadNextKey(Key))
+		{
+			if (!ReadValueInternal(OutValue[Key], InDepth + 1))
+			{
+				return false;
+			}
+		}
+		return !HasError();
+	}
+	case '[':
+	{
+		++Position;
+		OutValue = json::Array();
+		unsigned Index = 0;
+		for (;;)
+		{
+			SkipWhitespace();
+			const int Next = Peek();
+			if (Next == ']')
+			{
+				++Position;
+				return true;
+			}
+			if (Index > 0)
+			{
+				if (Next != ',')
+				{
+					return SetError("배열에 ',' 또는 ']'가 필요합니다");
+				}
+				++Position;
+			}
+			if (!ReadValueInternal(OutValue[Index++], InDepth + 1))
+			{
+				return false;
+			}
+		}
+	}
+	case '"':
+	{
+		FString String;
+		if (!ReadString(String))
+		{
+			return false;
+		}
+		OutValue = String;
+		return true;
+	}
+	case 't':
+		OutValue = true;
+		return ReadLiteral("true");
+	case 'f':
+		OutValue = false;
+		return ReadLiteral("false");
+	case 'n':
+		OutValue = JSON();
+		return ReadLiteral("null");
+	default:
+		if (Character == '-' || (Character >= '0' && Character <= '9'))
+		{
+			return ReadNumber(OutValue);
+		}
+		return SetError("알 수 없는 JSON 값입니다");
+	}
+}
+
+bool FJsonStreamReader::SkipValueInternal(uint32 InDepth)
+{
+	if (InDepth > MaxDepth)
+	{
+		return SetError("JSON 중첩이 너무 깊습니다");
+	}
+
+	SkipWhitespace();
+	const int Character = Peek();
+
+	if (Character == '{')
+	{
+		++Position;
+		ObjectHasMembers.push_back(false);
+		FString Key;
+		while (ReadNextKey(Key))
+		{
+			if (!SkipValueInternal(InDepth + 1))
+			{
+				return false;
+			}
+		}
+		return !HasError();
+	}
+
+	if (Character == '[')
+	{
+		++Position;
+		for (bool bIsFirst = true;; bIsFirst = false)
+		{
+			SkipWhitespace();
+			const int Next = Peek();
+			if (Next == ']')
+			{
+				++Position;
+				return true;
+			}
+			if (!bIsFirst)
+			{
+				if (Next != ',')
+				{
+					return SetError("배열에 ',' 또는 ']'가 필요합니다");
+				}
+				++Position;
+			}
+			if (!SkipValueInternal(InDepth + 1))
+			{
+				return false;
+			}
+		}
+	}
+
+	// 스칼라 값은 DOM 노드 하나 정도라 그대로 읽고 버림
+	JSON Scalar;
+	return ReadValueInternal(Scalar, InDepth);
+}
+
+/**
+ * @brief 문자열 읽기
+ * 이스케이프 처리는 json.hpp의 parse_string과 동일 (\u는 원문 유지)
+ */
+bool FJsonStreamReader::ReadString(FString& OutString)
+{
+	OutString.clear();
+	if (Get() != '"')
+	{
+		return SetError("문자열 시작 '\"'가 필요합니다");
+	}
+
+	for (;;)
+	{
+		const int Character = Get();
+		if (Character == EOF)
+		{
+			return SetError("문자열이 끝나지 않았습니다");
+		}
+		if (Character == '"')
+		{
+			return true;
+		}
+		if (Character != '\\')
+		{
+			OutString.push_back(static_cast<char>(Character));
+			continue;
+		}
+
+		const int Escaped = Get();
+		switch (Escaped)
+		{
+		case '"': OutString.push_back('"'); break;
+		case '\\': OutString.push_back('\\'); break;
+		case '/': OutString.push_back('/'); break;
+		case 'b': OutString.push_back('\b'); break;
+		case 'f': OutString.push_back('\f'); break;
+		case 'n': OutString.push_back('\n'); break;
+		case 'r': OutString.push_back('\r'); break;
+		case 't': OutString.push_back('\t'); break;
+		case 'u':
+			OutString += "\\u";
+			for (int Index = 0; Index < 4; ++Index)
+			{
+				const int Hex = Get();
+				if (Hex == EOF || !isxdigit(Hex))
+				{
+					return SetError("유니코드 이스케이프에 16진수 문자가 필요합니다");
+				}
+				OutString.push_back(static_cast<char>(Hex));
+			}
+			break;
+		case EOF:
+			return SetError("문자열이 끝나지 않았습니다");
+		default:
+			OutString.push_back('\\');
+			break;
+		}
+	}
+}
+
+/**
+ * @brief 숫자 읽기
+ * json.hpp와 동일하게 소수점 또는 지수가 있으면 Floating, 없으면 Integral(long)로 저장
+ */
+bool FJsonStreamReader::ReadNumber(JSON& OutValue)
+{
+	char Number[64];
+	size_t Length = 0;
+	bool bIsFloating = false;
+
+	for (int Character = Peek(); Character != EOF; Character = Peek())
+	{
+		if (Character == '.' || Character == 'e' || Character == 'E')
+		{
+			bIsFloating = true;
+		}
+		else if (Character != '-' && Character != '+' && !(Character >= '0' && Character <= '9'))
+		{
+			break;
+		}
+
+		if (Length + 1 >= sizeof(Number))
+		{
+			return SetError("숫자가 너무 깁니다");
+		}
+		Number[Length++] = static_cast<char>(Character);
+		++Position;
+	}
+	Number[Length] = '\0';
+
+	if (bIsFloating)
+	{
+		OutValue = strtod(Number, nullptr);
+	}
+	else
+	{
+		OutValue = strtol(Number, nullptr, 10);
+	}
+	return true;
+}
+
+bool FJsonStreamReader::ReadLiteral(const char* InLiteral)
+{
+	for (const char* Cursor = InLiteral; *Cursor != '\0'; ++Cursor)
+	{
+		if (Get() != *Cursor)
+		{
+			return SetError("잘못된 리터럴입니다");
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief 벤치마크용 레벨 파일 생성
+ * SaveJsonToFile과 같은 들여쓰기 형식으로 DOM 없이 바로 기록
+ */
+static bool WriteBenchmarkLevel(const FString& InFilePath, uint32 InActorCount)
+{
+	FILE* File = nullptr;
+	if (fopen_s(&File, InFilePath.c_str(), "wb") != 0 || !File)
+	{
+		return false;
+	}
+
+	fprintf(File, "{\n  \"Actors\" : {\n");
+	for (uint32 Index = 0; Index < InActorCount; ++Index)
+	{
+		const float X = static_cast<float>(Index % 100) * 2.0f;
+		const float Y = static_cast<float>((Index / 100) % 100) * 2.0f;
+		const float Z = static_cast<float>(Index / 10000) * 2.0f;
+
+		fprintf(File,
+			"    \"%u\" : {\n"
+			"      \"Components\" : [{\n"
+			"        \"Location\" : [%f, %f, %f],\n"
+			"        \"Name\" : \"StaticMeshComponent_%u\",\n"
+			"        \"ObjStaticMeshAsset\" : \"Data/Cube.obj\",\n"
+			"        \"ParentName\" : \"\",\n"
+			"        \"Rotation\" : [0.000000, 0.000000, 0.000000],\n"
+			"        \"Scale\" : [1.000000, 1.000000, 1.000000],\n"
+			"        \"Type\" : \"StaticMeshComponent\"\n"
+			"      }],\n"
+			"      \"Type\" : \"StaticMeshActor\"\n"
+			"    }%s\n",
+			Index + 1, X, Y, Z, Index, Index + 1 < InActorCount ? "," : "");
+	}
+	fprintf(File, "  },\n  \"NextUUID\" : 0\n}\n");
+	fclose(File);
+	return true;
+}
+
+FLevelLoadBenchmarkResult RunLevelLoadBenchmark(uint32 InActorCount)
+{
+	using Clock = std::chrono::high_resolution_clock;
+
+	FLevelLoadBenchmarkResult Result;
+	const FString FilePath = (std::filesystem::temp_directory_path() / "LevelLoadBenchmark.json").string();
+	if (!WriteBenchmarkLevel(FilePath, InActorCount))
+	{
+		UE_LOG_ERROR("LevelLoadBenchmark: 벤치마크 레벨 파일 생성에 실패했습니다: %s", FilePath.c_str());
+		return Result;
+	}
+	Result.FileSize = std::filesystem::file_size(FilePath);
+
+	// 기존 방식: 파일 전체 문자열 -> 전체 DOM -> Actors 객체 복사 후 순회
+	{
+		const uint32 BaselineBytes = TotalAllocationBytes;
+		PeakAllocationBytes = TotalAllocationBytes.load();
+		const auto StartTime = Clock::now();
+
+		uint32 ActorCount = 0;
+		{
+			JSON LevelJson;
+			if (FJsonSerializer::LoadJsonFromFile(LevelJson, FilePath))
+			{
+				JSON ActorsJson;
+				if (FJsonSerializer::ReadObject(LevelJson, "Actors", ActorsJson))
+				{
+					for (auto& Pair : ActorsJson.ObjectRange())
+					{
+						FString TypeString;
+						FJsonSerializer::ReadString(Pair.second, "Type", TypeString);
+						ActorCount += TypeString.empty() ? 0 : 1;
+					}
+				}
+			}
+		}
+
+		Result.DomMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+		Result.DomPeakBytes = PeakAllocationBytes - BaselineBytes;
+		Result.ActorCount = ActorCount;
+	}
+
+	// 스트리밍 방식: 액터 하나씩 작은 DOM으로 읽고 바로 버림
+	{
+		const uint32 BaselineBytes = TotalAllocationBytes;
+		PeakAllocationBytes = TotalAllocationBytes.load();
+		const auto StartTime = Clock::now();
+
+		uint32 ActorCount = 0;
+		{
+			FJsonStreamReader Reader(FilePath);
+			FString Key;
+			if (Reader.ReadObjectStart())
+			{
+				while (Reader.ReadNextKey(Key))
+				{
+					if (Key != "Actors")
+					{
+						Reader.SkipValue();
+						continue;
+					}
+
+					FString IdString;
+					Reader.ReadObjectStart();
+					while (Reader.ReadNextKey(IdString))
+					{
+						JSON ActorJson;
+						if (!Reader.ReadValue(ActorJson))
+						{
+							break;
+						}
+						FString TypeString;
+						FJsonSerializer::ReadString(ActorJson, "Type", TypeString);
+						ActorCount += TypeString.empty() ? 0 : 1;
+					}
+				}
+			}
+		}
+
+		Result.StreamMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+		Result.StreamPeakBytes = PeakAllocationBytes - BaselineBytes;
+		if (ActorCount != Result.ActorCount)
+		{
+			UE_LOG_WARNING("LevelLoadBenchmark: 로드된 액터 수가 다릅니다 (DOM: %u, Stream: %u)", Result.ActorCount, ActorCount);
+		}
+	}
+
+	std::error_code ErrorCode;
+	std::filesystem::remove(FilePath, ErrorCode);
+	return Result;
+}
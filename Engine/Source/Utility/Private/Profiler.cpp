@@ -0,0 +1,293 @@
+#include "pch.h"
+#include "Utility/Public/Profiler.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+
+#include <string_view>
+
+FProfiler& FProfiler::GetInstance()
+{
+	static FProfiler Instance;
+	return Instance;
+}
+
+FProfiler::FProfiler()
+{
+	History.resize(HistoryFrameCount);
+	SessionStartCycles = FPlatformTime::Cycles64();
+	FrameStartCycles = SessionStartCycles;
+}
+
+/**
+ * @brief 현재 스레드의 이벤트 버퍼 (처음 호출할 때만 등록 락을 잡음)
+ * 스레드가 끝나면 버퍼는 회수 대상이 되고, 남은 이벤트를 수집한 뒤 제거됨
+ */
+FProfiler::FThreadBuffer& FProfiler::GetThreadBuffer()
+{
+	struct FThreadBufferOwner
+	{
+		FThreadBuffer* Buffer = FProfiler::GetInstance().RegisterThread();
+		~FThreadBufferOwner() { FProfiler::GetInstance().RetireThread(Buffer); }
+	};
+
+	thread_local FThreadBufferOwner Owner;
+	return *Owner.Buffer;
+}
+
+FProfiler::FThreadBuffer* FProfiler::RegisterThread()
+{
+	std::lock_guard<std::mutex> Lock(RegistryMutex);
+	auto Buffer = std::make_unique<FThreadBuffer>();
+	Buffer->ThreadIndex = NextThreadIndex++;
+	ThreadNames.emplace(Buffer->ThreadIndex, "Thread " + std::to_string(Buffer->ThreadIndex));
+
+	FThreadBuffer* Registered = Buffer.get();
+	ThreadBuffers.push_back(std::move(Buffer));
+	return Registered;
+}
+
+void FProfiler::RetireThread(FThreadBuffer* InBuffer)
+{
+	InBuffer->bRetired.store(true, std::memory_order_release);
+}
+
+uint32 FProfiler::EnterScope()
+{
+	return GetThreadBuffer().ScopeDepth++;
+}
+
+void FProfiler::LeaveScope(const char* InName, uint64 InStartCycles, uint64 InEndCycles, uint32 InDepth)
+{
+	FThreadBuffer& Buffer = GetThreadBuffer();
+
+	// TIME_PROFILE_END로 순서와 다르게 끝나도 깊이가 어긋나지 않도록 시작 시점 깊이로 복원
+	Buffer.ScopeDepth = InDepth;
+
+	const uint64 Head = Buffer.Head.load(std::memory_order_relaxed);
+	if (Head - Buffer.Tail.load(std::memory_order_acquire) >= ThreadBufferCapacity)
+	{
+		GetInstance().DroppedEventCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	FProfileEvent& Event = Buffer.Events[Head & (ThreadBufferCapacity - 1)];
+	Event.Name = InName;
+	Event.StartCycles = InStartCycles;
+	Event.EndCycles = InEndCycles;
+	Event.ThreadIndex = Buffer.ThreadIndex;
+	Event.Depth = InDepth;
+	Buffer.Head.store(Head + 1, std::memory_order_release);
+}
+
+void FProfiler::SetThreadName(const char* InName)
+{
+	const uint32 ThreadIndex = GetThreadBuffer().ThreadIndex;
+	FProfiler& Profiler = GetInstance();
+	std::lock_guard<std::mutex> Lock(Profiler.RegistryMutex);
+	Profiler.ThreadNames[ThreadIndex] = InName;
+}
+
+void FProfiler::BeginFrame()
+{
+	MainThreadIndex = GetThreadBuffer().ThreadIndex;
+	FrameStartCycles = FPlatformTime::Cycles64();
+}
+
+/**
+ * @brief 모든 스레드 버퍼에서 지금까지 끝난 이벤트를 꺼내 이번 프레임으로 저장
+ * 히스토리 슬롯의 배열을 재사용하므로 워밍업 이후에는 할당이 없음
+ */
+void FProfiler::EndFrame()
+{
+	FProfileFrame& Frame = History[HistoryCursor];
+	Frame.Events.clear();
+	Frame.FrameNumber = FrameNumber++;
+	Frame.StartCycles = FrameStartCycles;
+	Frame.EndCycles = FPlatformTime::Cycles64();
+
+	{
+		std::lock_guard<std::mutex> Lock(RegistryMutex);
+		for (auto It = ThreadBuffers.begin(); It != ThreadBuffers.end();)
+		{
+			FThreadBuffer& Buffer = **It;
+
+			// 회수 표시를 먼저 읽어야 그 전에 기록된 이벤트가 모두 보장됨
+			const bool bRetired = Buffer.bRetired.load(std::memory_order_acquire);
+			const uint64 Head = Buffer.Head.load(std::memory_order_acquire);
+			for (uint64 Tail = Buffer.Tail.load(std::memory_order_relaxed); Tail != Head; ++Tail)
+			{
+				Frame.Events.push_back(Buffer.Events[Tail & (ThreadBufferCapacity - 1)]);
+			}
+			Buffer.Tail.store(Head, std::memory_order_release);
+
+			if (bRetired)
+			{
+				It = ThreadBuffers.erase(It);
+			}
+			else
+			{
+				++It;
+			}
+		}
+	}
+
+	HistoryCursor = (HistoryCursor + 1) % HistoryFrameCount;
+	RecordedFrameCount = std::min(RecordedFrameCount + 1, HistoryFrameCount);
+
+	BuildSummary(Frame);
+}
+
+const FProfileFrame* FProfiler::GetFrame(uint32 InFramesAgo) const
+{
+	if (InFramesAgo >= RecordedFrameCount)
+	{
+		return nullptr;
+	}
+	return &History[(HistoryCursor + HistoryFrameCount - 1 - InFramesAgo) % HistoryFrameCount];
+}
+
+void FProfiler::BuildSummary(const FProfileFrame& InFrame)
+{
+	TArray<const FProfileEvent*> MainThreadEvents;
+	MainThreadEvents.reserve(InFrame.Events.size());
+	for (const FProfileEvent& Event : InFrame.Events)
+	{
+		if (Event.ThreadIndex == MainThreadIndex)
+		{
+			MainThreadEvents.push_back(&Event);
+		}
+	}
+
+	// 부모가 자식보다 늦게 끝나서 나중에 기록되므로 시작 시각 순서로 되돌림
+	std::sort(MainThreadEvents.begin(), MainThreadEvents.end(), [](const FProfileEvent* A, const FProfileEvent* B)
+	{
+		return A->StartCycles != B->StartCycles ? A->StartCycles < B->StartCycles : A->Depth < B->Depth;
+	});
+
+	// 같은 리터럴도 번역 단위가 다르면 주소가 다를 수 있으므로 합칠 때는 내용으로 비교
+	LastFrameSummary.clear();
+	TMap<std::string_view, size_t> SummaryIndex;
+	for (const FProfileEvent* Event : MainThreadEvents)
+	{
+		auto [It, bInserted] = SummaryIndex.emplace(Event->Name, LastFrameSummary.size());
+		if (bInserted)
+		{
+			LastFrameSummary.push_back({ Event->Name, Event->Depth, 0, 0.0 });
+		}
+
+		FProfileStatSummary& Summary = LastFrameSummary[It->second];
+		Summary.CallCount++;
+		Summary.Milliseconds += FPlatformTime::ToMilliseconds(Event->EndCycles - Event->StartCycles);
+	}
+}
+
+namespace
+{
+	void WriteJsonString(FILE* InFile, const char* InString)
+	{
+		fputc('"', InFile);
+		for (const char* Cursor = InString; *Cursor != '\0'; ++Cursor)
+		{
+			const unsigned char Character = static_cast<unsigned char>(*Cursor);
+			if (Character == '"' || Character == '\\')
+			{
+				fputc('\\', InFile);
+				fputc(Character, InFile);
+			}
+			else if (Character < 0x20)
+			{
+				fprintf(InFile, "\\u%04x", Character);
+			}
+			else
+			{
+				fputc(Character, InFile);
+			}
+		}
+		fputc('"', InFile);
+	}
+}
+
+/**
+ * @brief Chrome trace_event 형식 (Complete "X" 이벤트, 마이크로초) 으로 저장
+ * 프레임 경계는 메인 스레드에 "Frame N" 이벤트로 함께 기록해서 프레임 단위로 구분 가능
+ */
+bool FProfiler::ExportChromeTrace(const std::filesystem::path& InFilePath, uint32 InFrameCount, uint32& OutEventCount) const
+{
+	OutEventCount = 0;
+	const uint32 FrameCount = std::min(InFrameCount, RecordedFrameCount);
+	if (FrameCount == 0)
+	{
+		return false;
+	}
+
+	std::error_code ErrorCode;
+	if (InFilePath.has_parent_path())
+	{
+		create_directories(InFilePath.parent_path(), ErrorCode);
+	}
+
+	FILE* File = nullptr;
+	if (_wfopen_s(&File, InFilePath.c_str(), L"w") != 0 || !File)
+	{
+		return false;
+	}
+
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+	auto ToMicroseconds = [this, MicrosecondsPerCycle](uint64 InCycles)
+	{
+		return static_cast<double>(static_cast<int64>(InCycles - SessionStartCycles)) * MicrosecondsPerCycle;
+	};
+
+	fprintf(File, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	// 내보내는 프레임에 등장한 스레드 이름만 기록 (짧게 살다 끝난 스레드 이름은 계속 쌓이므로)
+	TSet<uint32> UsedThreads = { MainThreadIndex };
+	for (uint32 FramesAgo = 0; FramesAgo < FrameCount; ++FramesAgo)
+	{
+		for (const FProfileEvent& Event : GetFrame(FramesAgo)->Events)
+		{
+			UsedThreads.insert(Event.ThreadIndex);
+		}
+	}
+
+	bool bFirst = true;
+	{
+		std::lock_guard<std::mutex> Lock(RegistryMutex);
+		for (const auto& [ThreadIndex, ThreadName] : ThreadNames)
+		{
+			if (!UsedThreads.count(ThreadIndex))
+			{
+				continue;
+			}
+
+			fprintf(File, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", bFirst ? "" : ",\n", ThreadIndex);
+			WriteJsonString(File, ThreadName.c_str());
+			fprintf(File, "}}");
+			bFirst = false;
+		}
+	}
+
+	char FrameName[32];
+	for (uint32 FramesAgo = FrameCount; FramesAgo-- > 0;)
+	{
+		const FProfileFrame* Frame = GetFrame(FramesAgo);
+		snprintf(FrameName, sizeof(FrameName), "Frame %llu", static_cast<unsigned long long>(Frame->FrameNumber));
+		fprintf(File, "%s{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+			bFirst ? "" : ",\n", FrameName, ToMicroseconds(Frame->StartCycles),
+			static_cast<double>(Frame->EndCycles - Frame->StartCycles) * MicrosecondsPerCycle, MainThreadIndex);
+		bFirst = false;
+
+		for (const FProfileEvent& Event : Frame->Events)
+		{
+			fprintf(File, ",\n{\"name\":");
+			WriteJsonString(File, Event.Name);
+			fprintf(File, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+				ToMicroseconds(Event.StartCycles), static_cast<double>(Event.EndCycles - Event.StartCycles) * MicrosecondsPerCycle,
+				Event.ThreadIndex);
+			++OutEventCount;
+		}
+	}
+
+	fprintf(File, "\n]}\n");
+	fclose(File);
+	return true;
+}
@@ -1,46 +1,49 @@
 ﻿#include "pch.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 
-TMap<FString, FTimeProfile> FScopeCycleCounter::TimeProfileMap;
+#include <thread>
 
-//Map에 이미 있으면 시간, 콜스택 추가
-void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMilliseconds)
-{
-    auto It = TimeProfileMap.find(Key.Key);
-    if (It != TimeProfileMap.end())
-    {
-        TimeProfileMap[Key.Key] = FTimeProfile{ InMilliseconds, 1 };
-    }
-    else
-    {
-        TimeProfileMap[Key.Key].Milliseconds += InMilliseconds;
-        TimeProfileMap[Key.Key].CallCount++;
-    }
-}
-const FTimeProfile& FScopeCycleCounter::GetTimeProfile(const FString& Key)
-{
-    return TimeProfileMap[Key];
-}
-const TArray<FString> FScopeCycleCounter::GetTimeProfileKeys()
+#if defined(_M_X64) || defined(_M_IX86)
+	#include <intrin.h>
+	#define PROFILER_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define PROFILER_HAS_RDTSC 1
+#else
+	#define PROFILER_HAS_RDTSC 0
+#endif
+
+double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
+bool FWindowsPlatformTime::bInitialized = false;
+
+uint64 FTscPlatformTime::Cycles64()
 {
-    TArray<std::string> Keys;
-    Keys.reserve(TimeProfileMap.size());
-    for (const auto& Pair : TimeProfileMap)
-    {
-        Keys.push_back(Pair.first);
-    }
-    return Keys;
+#if PROFILER_HAS_RDTSC
+	return __rdtsc();
+#else
+	return FChronoPlatformTime::Cycles64();
+#endif
 }
-const TArray<FTimeProfile> FScopeCycleCounter::GetTimeProfileValues()
+
+/**
+ * @brief TSC 주파수를 steady_clock과 비교해서 한 번만 보정 (처음 호출할 때 약 20ms 대기)
+ */
+double FTscPlatformTime::GetSecondsPerCycle()
 {
-    TArray<FTimeProfile> Values;
-    Values.reserve(TimeProfileMap.size());
-    for (const auto& Pair : TimeProfileMap)
-    {
-        Values.push_back(Pair.second);
-    }
-    return Values;
-}
+#if PROFILER_HAS_RDTSC
+	static const double SecondsPerCycle = []()
+	{
+		const auto ClockStart = std::chrono::steady_clock::now();
+		const uint64 TscStart = __rdtsc();
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		const uint64 TscEnd = __rdtsc();
+		const auto ClockEnd = std::chrono::steady_clock::now();
 
-double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
-bool FWindowsPlatformTime::bInitialized = false;
+		const double Seconds = std::chrono::duration<double>(ClockEnd - ClockStart).count();
+		return TscEnd > TscStart ? Seconds / static_cast<double>(TscEnd - TscStart) : FChronoPlatformTime::GetSecondsPerCycle();
+	}();
+	return SecondsPerCycle;
+#else
+	return FChronoPlatformTime::GetSecondsPerCycle();
+#endif
+}
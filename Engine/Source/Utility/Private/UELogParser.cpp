@@ -601,3 +601,74 @@ UELogParser::ParseResult ParseUELogFromString(const string& InString)
 {
     return FDynamicUELogParser::ParseFromString(InString);
 }
+
+/**
+ * @brief vsnprintf 기준 측정을 위한 래퍼
+ */
+static int FormatWithVsnprintf(char* OutBuffer, size_t InBufferSize, const char* InFormat, ...)
+{
+    va_list Arguments;
+    va_start(Arguments, InFormat);
+    const int Length = vsnprintf(OutBuffer, InBufferSize, InFormat, Arguments);
+    va_end(Arguments);
+    return Length;
+}
+
+/**
+ * @brief 세 가지 포맷팅 방식의 처리량 비교
+ * 기존 런타임 파서는 폭/정밀도 지정자를 지원하지 않으므로 모두 단순 지정자만 사용한 동일 포맷으로 측정
+ */
+FUELogFormatBenchmarkResult RunUELogFormatBenchmark(uint32 InIterations)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    FUELogFormatBenchmarkResult Result;
+    if (InIterations == 0)
+    {
+        return Result;
+    }
+
+    const char* ActorName = "StaticMeshActor_12";
+    const int32 ActorId = 1024;
+    const uint32 Flags = 0xBEEFu;
+    const double Location = 128.5;
+
+    char Buffer[256];
+    size_t TotalLength = 0;
+
+    auto Measure = [InIterations](auto&& InFunction) -> double
+    {
+        const auto StartTime = Clock::now();
+        for (uint32 Iteration = 0; Iteration < InIterations; ++Iteration)
+        {
+            InFunction(Iteration);
+        }
+        const std::chrono::duration<double, std::nano> Elapsed = Clock::now() - StartTime;
+        return Elapsed.count() / InIterations;
+    };
+
+    Result.VsnprintfNanoseconds = Measure([&](uint32 InIteration)
+    {
+        TotalLength += FormatWithVsnprintf(Buffer, sizeof(Buffer), "Actor %s id=%d flags=%X iteration=%u location=%f",
+            ActorName, ActorId, Flags, InIteration, Location);
+    });
+
+    Result.RuntimeParserNanoseconds = Measure([&](uint32 InIteration)
+    {
+        const UELogParser::ParseResult ParseResult = UELogParser::Parse("Actor %s id=%d flags=%X iteration=%u location=%f",
+            ActorName, ActorId, Flags, InIteration, Location);
+        TotalLength += ParseResult.FormattedMessage.size();
+    });
+
+    Result.CompiledFormatNanoseconds = Measure([&](uint32 InIteration)
+    {
+        TotalLength += UE_FORMAT_TO(Buffer, "Actor %s id=%d flags=%X iteration=%u location=%f",
+            ActorName, ActorId, Flags, InIteration, Location);
+    });
+
+    // 측정 루프가 최적화로 제거되지 않도록 결과 길이를 사용
+    volatile size_t Sink = TotalLength;
+    (void)Sink;
+
+    return Result;
+}
@@ -0,0 +1,326 @@
+#pragma once
+#include "Global/Types.h"
+#include "Global/Enum.h"
+#include "Utility/Public/UELogFormat.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief 로그 인자 하나를 타입과 함께 보관하는 구조체
+ * 문자열은 포인터가 아닌 레코드 내부 Payload로 복사되므로 호출 스레드의 임시 문자열이 사라져도 안전
+ */
+struct FLogArgument
+{
+	enum class EType : uint8
+	{
+		Signed,
+		Unsigned,
+		Float,
+		Pointer,
+		String,
+		WideString,
+	};
+
+	union
+	{
+		int64 Signed;
+		uint64 Unsigned;
+		double Float;
+		const void* Pointer;
+		uint32 PayloadOffset;
+	};
+	EType Type;
+};
+
+/**
+ * @brief Ring Buffer에 들어가는 고정 크기 바이너리 로그 레코드
+ * 포맷 문자열은 UE_LOG 호출 지점에서 포맷 타입별로 생성된 포맷팅 함수 포인터로만 저장하고,
+ * 실제 포맷팅은 백그라운드 스레드에서 UELogFormat::FormatTo로 수행
+ */
+struct FLogRecord
+{
+	static constexpr uint32 MaxArguments = 12;
+	static constexpr uint32 PayloadSize = 256;
+
+	/**
+	 * @brief 캡처된 인자로 포맷팅하는 함수
+	 * @return 잘리지 않았다면 출력되었을 전체 길이 (snprintf와 동일)
+	 */
+	using FFormatFunction = size_t(*)(const FLogRecord& InRecord, char* OutBuffer, size_t InBufferSize);
+
+	FFormatFunction Formatter = nullptr;
+	const char* Prefix = nullptr;
+	ELogType Type = ELogType::Info;
+	uint8 ArgumentCount = 0;
+	uint16 PayloadUsed = 0;
+	bool bIsBenchmark = false;
+	FLogArgument Arguments[MaxArguments];
+	char Payload[PayloadSize];
+};
+
+/**
+ * @brief 콘솔 위젯이 가져갈 로그 한 줄
+ */
+struct FLogEntry
+{
+	ELogType Type;
+	FString Message;
+};
+
+/**
+ * @brief 로그 벤치마크 결과
+ * 호출 스레드의 기록 비용과 Ring Buffer 포화로 버려진 개수를 따로 보고
+ */
+struct FLogBenchmarkResult
+{
+	uint64 AcceptedCount = 0;
+	uint64 DroppedCount = 0;
+	uint32 RoundCount = 0;
+	double EnqueueNanoseconds = 0.0; // 기록된 호출 1회당 평균
+	double CallsPerSecond = 0.0;
+};
+
+/**
+ * @brief UE_LOG 매크로의 비동기 백엔드
+ * - 호출 스레드: 인자만 캡처해서 Lock-free MPSC Ring Buffer에 기록 (힙 할당, vsnprintf 없음)
+ * - 로그 스레드: 포맷팅 후 stdout, 로그 파일, 콘솔 위젯 대기열로 출력
+ * Ring Buffer가 가득 차면 호출 스레드를 막지 않고 해당 로그를 버린 뒤 개수만 기록
+ */
+class FAsyncLogger
+{
+public:
+	static constexpr uint32 RingCapacity = 4096; // 2의 거듭제곱이어야 함
+	static constexpr uint32 MaxConsoleEntries = 2048; // 콘솔 위젯 보관 한도
+
+	static FAsyncLogger& GetInstance();
+
+	/**
+	 * @brief UE_LOG 매크로 진입점
+	 * 포맷 문자열은 UE_FORMAT_STRING 타입으로 전달되어 지정자 개수와 인자 타입을 컴파일 타임에 검증
+	 */
+	template<typename FFormat, typename... Args>
+	static void Log(ELogType InType, const char* InPrefix, FFormat, Args&&... InArgs)
+	{
+		static_assert(sizeof...(Args) <= FLogRecord::MaxArguments, "UE_LOG: 인자 개수가 너무 많습니다");
+		UELogFormat::Validate<FFormat, std::decay_t<Args>...>();
+		GetInstance().Enqueue(InType, InPrefix, &FormatCapturedRecord<FFormat, std::decay_t<Args>...>, false,
+			[&](FLogRecord& Record) { (CaptureArgument(Record, std::forward<Args>(InArgs)), ...); });
+	}
+
+	/**
+	 * @brief 지금까지 기록된 로그가 모두 출력될 때까지 대기
+	 */
+	void Flush();
+
+	/**
+	 * @brief 로그 스레드가 콘솔 위젯용으로 포맷팅한 로그를 꺼내감 (메인 스레드 전용)
+	 */
+	void DrainConsoleEntries(TDeque<FLogEntry>& OutEntries);
+
+	/**
+	 * @brief 경합 상황에서의 로그 기록 비용 측정
+	 * Ring Buffer를 넘치지 않는 크기의 라운드로 나눠 기록하고 라운드 사이에 Flush하므로
+	 * 버리는 경로가 아닌 실제 기록 경로를 측정함 (Flush 시간은 측정에서 제외)
+	 * 측정용 레코드는 포맷팅까지만 하고 출력하지 않음
+	 */
+	FLogBenchmarkResult RunBenchmark(uint32 InThreadCount, uint32 InCallsPerThread);
+
+	uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+
+	FAsyncLogger(const FAsyncLogger&) = delete;
+	FAsyncLogger& operator=(const FAsyncLogger&) = delete;
+
+private:
+	FAsyncLogger();
+	~FAsyncLogger();
+
+	struct alignas(64) FCell
+	{
+		std::atomic<uint64> Sequence;
+		FLogRecord Record;
+	};
+
+	template<typename FCapture>
+	bool Enqueue(ELogType InType, const char* InPrefix, FLogRecord::FFormatFunction InFormatter, bool bInIsBenchmark, FCapture&& InCapture)
+	{
+		uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+		FCell* Cell = nullptr;
+		for (;;)
+		{
+			Cell = &Cells[Position & (RingCapacity - 1)];
+			const uint64 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+			if (Difference == 0)
+			{
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// 가득 참: 프레임을 막지 않고 버림
+				DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			else
+			{
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		FLogRecord& Record = Cell->Record;
+		Record.Formatter = InFormatter;
+		Record.Prefix = InPrefix;
+		Record.Type = InType;
+		Record.ArgumentCount = 0;
+		Record.PayloadUsed = 0;
+		Record.bIsBenchmark = bInIsBenchmark;
+		InCapture(Record);
+
+		Cell->Sequence.store(Position + 1, std::memory_order_release);
+
+		if (bIsWorkerSleeping.load(std::memory_order_relaxed))
+		{
+			WakeCondition.notify_one();
+		}
+		return true;
+	}
+
+	template<typename T>
+	static void CaptureArgument(FLogRecord& Record, T&& InValue)
+	{
+		using FDecayed = std::decay_t<T>;
+		FLogArgument& Argument = Record.Arguments[Record.ArgumentCount++];
+
+		if constexpr (std::is_null_pointer_v<FDecayed>)
+		{
+			Argument.Type = FLogArgument::EType::Pointer;
+			Argument.Pointer = nullptr;
+		}
+		else if constexpr (std::is_same_v<FDecayed, char*> || std::is_same_v<FDecayed, const char*>)
+		{
+			const char* String = InValue;
+			CaptureString(Record, Argument, String ? std::string_view(String) : std::string_view("(null)"));
+		}
+		else if constexpr (std::is_same_v<FDecayed, wchar_t*> || std::is_same_v<FDecayed, const wchar_t*>)
+		{
+			const wchar_t* String = InValue;
+			CaptureWideString(Record, Argument, String ? String : L"(null)");
+		}
+		else if constexpr (std::is_convertible_v<const FDecayed&, std::string_view>)
+		{
+			CaptureString(Record, Argument, std::string_view(InValue));
+		}
+		else if constexpr (std::is_floating_point_v<FDecayed>)
+		{
+			Argument.Type = FLogArgument::EType::Float;
+			Argument.Float = static_cast<double>(InValue);
+		}
+		else if constexpr (std::is_enum_v<FDecayed>)
+		{
+			Argument.Type = FLogArgument::EType::Signed;
+			Argument.Signed = static_cast<int64>(InValue);
+		}
+		else if constexpr (std::is_integral_v<FDecayed> && std::is_signed_v<FDecayed>)
+		{
+			Argument.Type = FLogArgument::EType::Signed;
+			Argument.Signed = static_cast<int64>(InValue);
+		}
+		else if constexpr (std::is_integral_v<FDecayed>)
+		{
+			Argument.Type = FLogArgument::EType::Unsigned;
+			Argument.Unsigned = static_cast<uint64>(InValue);
+		}
+		else if constexpr (std::is_pointer_v<FDecayed> || std::is_null_pointer_v<FDecayed>)
+		{
+			Argument.Type = FLogArgument::EType::Pointer;
+			Argument.Pointer = InValue;
+		}
+		else
+		{
+			static_assert(std::is_pointer_v<FDecayed>, "UE_LOG: printf로 출력할 수 없는 인자 타입입니다");
+		}
+	}
+
+	static void CaptureString(FLogRecord& Record, FLogArgument& Argument, std::string_view InString);
+	static void CaptureWideString(FLogRecord& Record, FLogArgument& Argument, const wchar_t* InString);
+
+	/**
+	 * @brief 캡처된 인자를 원래 인자와 같은 분류의 값으로 되돌림
+	 * 정수는 64비트, 실수는 double, 문자열은 Payload 안의 포인터로 복원되므로 UELogFormat 검증 결과가 그대로 유지됨
+	 */
+	template<typename T>
+	static auto RestoreArgument(const FLogRecord& InRecord, const FLogArgument& InArgument)
+	{
+		constexpr UELogFormat::EArgumentKind Kind = UELogFormat::GetArgumentKind<T>();
+		if constexpr (Kind == UELogFormat::EArgumentKind::String)
+		{
+			// Payload가 부족해 캡처하지 못한 문자열은 nullptr로 넘겨 "(null)"로 출력
+			return InArgument.Type == FLogArgument::EType::String ? InRecord.Payload + InArgument.PayloadOffset : nullptr;
+		}
+		else if constexpr (Kind == UELogFormat::EArgumentKind::WideString)
+		{
+			return InArgument.Type == FLogArgument::EType::WideString
+				? reinterpret_cast<const wchar_t*>(InRecord.Payload + InArgument.PayloadOffset) : nullptr;
+		}
+		else if constexpr (Kind == UELogFormat::EArgumentKind::Floating)
+		{
+			return InArgument.Float;
+		}
+		else if constexpr (Kind == UELogFormat::EArgumentKind::Integer)
+		{
+			return InArgument.Type == FLogArgument::EType::Unsigned ? static_cast<int64>(InArgument.Unsigned) : InArgument.Signed;
+		}
+		else
+		{
+			return InArgument.Pointer;
+		}
+	}
+
+	/**
+	 * @brief UE_LOG 호출 지점의 포맷 타입과 인자 타입으로 생성되는 FLogRecord::FFormatFunction
+	 * 호출 스레드에서 Validate를 통과한 조합이므로 로그 스레드는 런타임 파싱 없이 FormatTo만 호출
+	 */
+	template<typename FFormat, typename... Args>
+	static size_t FormatCapturedRecord(const FLogRecord& InRecord, char* OutBuffer, size_t InBufferSize)
+	{
+		return FormatCapturedArguments<FFormat, Args...>(InRecord, OutBuffer, InBufferSize, std::index_sequence_for<Args...>{});
+	}
+
+	template<typename FFormat, typename... Args, size_t... Indices>
+	static size_t FormatCapturedArguments(const FLogRecord& InRecord, char* OutBuffer, size_t InBufferSize, std::index_sequence<Indices...>)
+	{
+		return UELogFormat::FormatTo(OutBuffer, InBufferSize, FFormat{},
+			RestoreArgument<Args>(InRecord, InRecord.Arguments[Indices])...);
+	}
+
+	void WorkerLoop();
+	bool ProcessPendingRecords();
+	static void FormatRecord(const FLogRecord& InRecord, FString& OutMessage);
+	void WriteRecord(const FLogRecord& InRecord, const FString& InMessage);
+
+	FCell* Cells = nullptr;
+	alignas(64) std::atomic<uint64> EnqueuePosition{ 0 };
+	alignas(64) uint64 DequeuePosition = 0;
+	std::atomic<uint64> ProcessedPosition{ 0 };
+	std::atomic<uint64> DroppedCount{ 0 };
+	uint64 ReportedDroppedCount = 0;
+
+	// 로그 스레드
+	std::thread Worker;
+	std::atomic<bool> bIsRunning{ true };
+	std::atomic<bool> bIsWorkerSleeping{ false };
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+
+	// 출력 대상
+	FILE* LogFile = nullptr;
+	std::mutex ConsoleMutex;
+	TDeque<FLogEntry> PendingConsoleEntries;
+};
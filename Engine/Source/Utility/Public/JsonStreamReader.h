@@ -0,0 +1,108 @@
+#pragma once
+
+namespace json { class JSON; }
+using JSON = json::JSON;
+
+/**
+ * @brief 파일을 일정 크기씩 읽으며 JSON을 앞에서부터 차례로 파싱하는 Pull 방식 리더
+ * 파일 전체를 문자열로 올리거나 문서 전체 DOM을 만들지 않고,
+ * 호출자가 필요한 값(예: 액터 하나)만 ReadValue로 작은 DOM을 만들어 처리한 뒤 버릴 수 있음
+ * 숫자/문자열 해석 규칙은 json.hpp의 JSON::Load와 동일하게 유지
+ */
+class FJsonStreamReader
+{
+public:
+	explicit FJsonStreamReader(const FString& InFilePath, size_t InChunkSize = 64 * 1024);
+	~FJsonStreamReader();
+
+	FJsonStreamReader(const FJsonStreamReader&) = delete;
+	FJsonStreamReader& operator=(const FJsonStreamReader&) = delete;
+
+	bool IsOpen() const { return File != nullptr; }
+	bool HasError() const { return !ErrorMessage.empty(); }
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+
+	/**
+	 * @brief 객체 시작 '{' 읽기
+	 */
+	bool ReadObjectStart();
+
+	/**
+	 * @brief 현재 객체의 다음 키 읽기
+	 * 첫 멤버가 아니면 ',' 하나를 요구하며, 빠지거나 중복된 ','와 끝의 ','는 DOM 파서와 같이 오류로 처리
+	 * @return 키를 읽었으면 true, 객체가 끝났거나('}' 소비) 오류가 있으면 false
+	 */
+	bool ReadNextKey(FString& OutKey);
+
+	/**
+	 * @brief 다음 값 하나를 DOM으로 읽기 (하위 트리 전체)
+	 */
+	bool ReadValue(JSON& OutValue);
+
+	/**
+	 * @brief 다음 값 하나를 DOM 생성 없이 건너뛰기
+	 */
+	bool SkipValue();
+
+private:
+	static constexpr uint32 MaxDepth = 256;
+
+	int Peek()
+	{
+		if (Position == Size && !Refill())
+		{
+			return EOF;
+		}
+		return static_cast<unsigned char>(Buffer[Position]);
+	}
+
+	int Get()
+	{
+		const int Character = Peek();
+		if (Character != EOF)
+		{
+			++Position;
+		}
+		return Character;
+	}
+
+	bool Refill();
+	void SkipWhitespace();
+	bool Expect(char InCharacter);
+	bool SetError(const char* InMessage);
+
+	bool ReadValueInternal(JSON& OutValue, uint32 InDepth);
+	bool SkipValueInternal(uint32 InDepth);
+	bool ReadString(FString& OutString);
+	bool ReadNumber(JSON& OutValue);
+	bool ReadLiteral(const char* InLiteral);
+
+	FILE* File = nullptr;
+	TArray<char> Buffer;
+	size_t Position = 0;
+	size_t Size = 0;
+	FString ErrorMessage;
+
+	// 열려 있는 객체마다 멤버를 하나 이상 읽었는지 여부 (',' 검사용)
+	TArray<bool> ObjectHasMembers;
+};
+
+/**
+ * @brief 레벨 로드 방식별 측정 결과
+ */
+struct FLevelLoadBenchmarkResult
+{
+	uint32 ActorCount = 0;
+	uint64 FileSize = 0;
+	double DomMilliseconds = 0.0;
+	double StreamMilliseconds = 0.0;
+	uint64 DomPeakBytes = 0;
+	uint64 StreamPeakBytes = 0;
+};
+
+/**
+ * @brief 액터 InActorCount개짜리 레벨 파일을 생성한 뒤
+ * 기존 DOM 로드(LoadJsonFromFile + JSON::Load)와 스트리밍 로드의 파싱 시간 및 최대 메모리 사용량 비교
+ * 실제 액터 스폰은 양쪽 모두 동일하므로 제외하고, 액터 단위 데이터를 꺼내는 시점까지 측정
+ */
+FLevelLoadBenchmarkResult RunLevelLoadBenchmark(uint32 InActorCount);
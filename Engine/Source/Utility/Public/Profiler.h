@@ -0,0 +1,129 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief 끝난 스코프 하나 (FScopeCycleCounter가 기록)
+ */
+struct FProfileEvent
+{
+	const char* Name = nullptr;
+	uint64 StartCycles = 0;
+	uint64 EndCycles = 0;
+	uint32 ThreadIndex = 0;
+	uint32 Depth = 0;
+};
+
+/**
+ * @brief 한 프레임 동안 모든 스레드에서 끝난 이벤트
+ */
+struct FProfileFrame
+{
+	uint64 FrameNumber = 0;
+	uint64 StartCycles = 0;
+	uint64 EndCycles = 0;
+	TArray<FProfileEvent> Events;
+};
+
+/**
+ * @brief 오버레이 표시용 스탯 합계 (같은 이름은 한 줄로 합침)
+ */
+struct FProfileStatSummary
+{
+	const char* Name = nullptr;
+	uint32 Depth = 0;
+	uint32 CallCount = 0;
+	double Milliseconds = 0.0;
+};
+
+/**
+ * @brief 계층형 프레임 프로파일러
+ * - 기록: 스레드마다 고정 크기 SPSC 링 버퍼에 이벤트를 쓰기만 함 (락, 힙 할당, 문자열 비교 없음)
+ * - 수집: 메인 스레드가 EndFrame에서 모든 스레드 버퍼를 비워 프레임 히스토리 링에 저장
+ * - 출력: 마지막 프레임 합계(StatOverlay), Chrome trace_event JSON (chrome://tracing, Perfetto)
+ * 버퍼가 가득 차면 호출 스레드를 막지 않고 이벤트를 버린 뒤 개수만 기록
+ */
+class FProfiler
+{
+public:
+	static constexpr uint32 ThreadBufferCapacity = 8192; // 2의 거듭제곱이어야 함
+	static constexpr uint32 HistoryFrameCount = 120;
+
+	static FProfiler& GetInstance();
+
+	// --- 호출 스레드 ---
+	/**
+	 * @brief 스코프 시작, 현재 스레드의 중첩 깊이를 반환
+	 */
+	static uint32 EnterScope();
+	static void LeaveScope(const char* InName, uint64 InStartCycles, uint64 InEndCycles, uint32 InDepth);
+
+	/**
+	 * @brief trace에 표시할 현재 스레드 이름 (문자열은 복사됨)
+	 */
+	static void SetThreadName(const char* InName);
+
+	// --- 메인 스레드 ---
+	void BeginFrame();
+	void EndFrame();
+
+	/**
+	 * @brief InFramesAgo 프레임 전의 기록 (0 = 마지막으로 끝난 프레임), 없으면 nullptr
+	 */
+	const FProfileFrame* GetFrame(uint32 InFramesAgo) const;
+
+	/**
+	 * @brief 마지막 프레임의 메인 스레드 이벤트를 시작 순서대로 이름별로 합산
+	 */
+	const TArray<FProfileStatSummary>& GetLastFrameSummary() const { return LastFrameSummary; }
+
+	/**
+	 * @brief 최근 InFrameCount 프레임을 Chrome trace_event JSON으로 저장
+	 */
+	bool ExportChromeTrace(const std::filesystem::path& InFilePath, uint32 InFrameCount, uint32& OutEventCount) const;
+
+	uint64 GetDroppedEventCount() const { return DroppedEventCount.load(std::memory_order_relaxed); }
+	uint32 GetRecordedFrameCount() const { return RecordedFrameCount; }
+
+	FProfiler(const FProfiler&) = delete;
+	FProfiler& operator=(const FProfiler&) = delete;
+
+private:
+	FProfiler();
+	~FProfiler() = default;
+
+	struct FThreadBuffer
+	{
+		FProfileEvent Events[ThreadBufferCapacity];
+		std::atomic<uint64> Head{ 0 };		// 기록 스레드만 증가
+		std::atomic<uint64> Tail{ 0 };		// 수집 스레드만 증가
+		std::atomic<bool> bRetired{ false };	// 스레드 종료 후 남은 이벤트만 수집하고 제거
+		uint32 ThreadIndex = 0;
+		uint32 ScopeDepth = 0;				// 기록 스레드 전용
+	};
+
+	static FThreadBuffer& GetThreadBuffer();
+	FThreadBuffer* RegisterThread();
+	void RetireThread(FThreadBuffer* InBuffer);
+	void BuildSummary(const FProfileFrame& InFrame);
+
+	mutable std::mutex RegistryMutex;	// 스레드 등록/해제, 수집, 내보내기에서만 사용
+	TArray<std::unique_ptr<FThreadBuffer>> ThreadBuffers;
+	TMap<uint32, FString> ThreadNames;
+	uint32 NextThreadIndex = 0;
+	uint32 MainThreadIndex = 0;
+
+	TArray<FProfileFrame> History;
+	uint32 HistoryCursor = 0;			// 다음에 쓸 슬롯
+	uint32 RecordedFrameCount = 0;
+	uint64 FrameNumber = 0;
+	uint64 FrameStartCycles = 0;
+	uint64 SessionStartCycles = 0;
+
+	TArray<FProfileStatSummary> LastFrameSummary;
+	std::atomic<uint64> DroppedEventCount{ 0 };
+};
@@ -1,5 +1,8 @@
 ﻿#pragma once
 #include "Global/Types.h"
+#include "Utility/Public/Profiler.h"
+
+#include <chrono>
 
 #ifdef _DEVELOP //_DEVELOP 이 정의 되어 있을때만 측정
 	#define TIME_PROFILE(Key) FScopeCycleCounter Key##Counter(#Key);
@@ -66,49 +69,88 @@ public:
 	}
 };
 
-struct TStatId
+/**
+ * @brief std::chrono::steady_clock 기반 이식 가능한 타이머 (FWindowsPlatformTime과 같은 인터페이스)
+ */
+class FChronoPlatformTime
 {
-	FString Key;
-	TStatId() = default;
-	TStatId(const FString& InKey) : Key(InKey) {}
+public:
+	static double GetSecondsPerCycle()
+	{
+		return static_cast<double>(std::chrono::steady_clock::period::num) / std::chrono::steady_clock::period::den;
+	}
+	static double ToMilliseconds(uint64 CycleDiff)
+	{
+		return static_cast<double>(CycleDiff) * GetSecondsPerCycle() * 1000.0;
+	}
+	static uint64 Cycles64()
+	{
+		return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+	}
 };
 
-struct FTimeProfile
+/**
+ * @brief rdtsc 기반 타이머 (호출 비용이 가장 낮음)
+ * invariant TSC를 가정하고, 처음 사용할 때 steady_clock으로 주파수를 한 번 보정
+ */
+class FTscPlatformTime
 {
-	double Milliseconds;
-	uint32 CallCount;
-
-	const char* GetConstChar() const
+public:
+	static double GetSecondsPerCycle();
+	static double ToMilliseconds(uint64 CycleDiff)
 	{
-		static char buffer[64]; // static으로 해야 반환 가능
-		snprintf(buffer, sizeof(buffer), " : %.3fms, Call : %d", Milliseconds, CallCount);
-		return buffer;
+		return static_cast<double>(CycleDiff) * GetSecondsPerCycle() * 1000.0;
 	}
+	static uint64 Cycles64();
 };
 
+// 프로파일러가 쓰는 타이머 (PROFILER_TIMER_RDTSC / PROFILER_TIMER_CHRONO로 교체 가능)
+#if defined(PROFILER_TIMER_RDTSC)
+typedef FTscPlatformTime FPlatformTime;
+#elif defined(PROFILER_TIMER_CHRONO) || !defined(_WIN32)
+typedef FChronoPlatformTime FPlatformTime;
+#else
 typedef FWindowsPlatformTime FPlatformTime;
+#endif
+
+/**
+ * @brief 스탯 이름 (문자열 리터럴 등 프로그램 종료까지 유효한 문자열의 포인터만 보관)
+ * 측정할 때는 포인터만 기록하고 문자열 비교/할당은 하지 않음
+ */
+struct TStatId
+{
+	const char* Name = nullptr;
+	constexpr TStatId() = default;
+	constexpr TStatId(const char* InName) : Name(InName) {}
+
+	bool IsValid() const { return Name != nullptr; }
+};
 
+/**
+ * @brief 스코프 시간 측정
+ * 스탯 이름이 있으면 끝날 때 FProfiler의 호출 스레드 버퍼에 중첩 깊이와 함께 이벤트를 기록
+ */
 class FScopeCycleCounter
 {
 public:
 	FScopeCycleCounter(TStatId StatId)
 		: StartCycles(FPlatformTime::Cycles64()) //생성 시 사이클 저장
 		, UsedStatId(StatId) //키값 저장
+		, Depth(StatId.IsValid() ? FProfiler::EnterScope() : 0)
 	{
 	}
 	FScopeCycleCounter() : StartCycles(FPlatformTime::Cycles64()), UsedStatId()
 	{
 	}
 
-	FScopeCycleCounter(const FString& Key) : StartCycles(FPlatformTime::Cycles64()), UsedStatId(TStatId(Key))
-	{
-	}
-
 	~FScopeCycleCounter()
 	{
 		Finish();
 	}
 
+	FScopeCycleCounter(const FScopeCycleCounter&) = delete;
+	FScopeCycleCounter& operator=(const FScopeCycleCounter&) = delete;
+
 	double Finish()
 	{
 		if (bIsFinish == true)
@@ -119,24 +161,16 @@ public:
 		const uint64 EndCycles = FPlatformTime::Cycles64();
 		const uint64 CycleDiff = EndCycles - StartCycles;
 
-		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
-		if (UsedStatId.Key.empty() == false)
+		if (UsedStatId.IsValid())
 		{
-			AddTimeProfile(UsedStatId, Milliseconds); //키 값이 있을경우 Map에 저장
+			FProfiler::LeaveScope(UsedStatId.Name, StartCycles, EndCycles, Depth); //키 값이 있을경우 프로파일러에 기록
 		}
-		return Milliseconds;
+		return FPlatformTime::ToMilliseconds(CycleDiff);
 	}
 
-	static void AddTimeProfile(const TStatId& Key, double InMilliseconds);
-	static void TimeProfileInit();
-
-	static const FTimeProfile& GetTimeProfile(const FString& Key); 
-	static const TArray<FString> GetTimeProfileKeys();
-	static const TArray<FTimeProfile> GetTimeProfileValues();
-
 private:
-	static TMap<FString, FTimeProfile> TimeProfileMap;
 	bool bIsFinish = false;
 	uint64 StartCycles;
 	TStatId UsedStatId;
-};
\ No newline at end of file
+	uint32 Depth = 0;
+};
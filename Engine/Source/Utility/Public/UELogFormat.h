@@ -0,0 +1,815 @@
+#pragma once
+#include "Global/Types.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 포맷 문자열을 함수 안에서 타입으로 감싸는 매크로
+ * C++17에서는 문자열 리터럴을 템플릿 인자로 넘길 수 없으므로,
+ * 리터럴을 반환하는 constexpr 함수를 가진 지역 구조체를 만들어 타입으로 전달함
+ */
+#define UE_FORMAT_STRING(Literal) \
+	([] { struct FFormatString { static constexpr std::string_view Get() { return Literal; } }; return FFormatString{}; }())
+
+/**
+ * @brief 컴파일 타임에 검증된 포맷 문자열로 고정 버퍼에 직접 포맷팅
+ * 사용 예: char Buffer[128]; UE_FORMAT_TO(Buffer, "Actor %s: %.2f", Name, Value);
+ */
+#define UE_FORMAT_TO(OutBuffer, Format, ...) \
+	UELogFormat::FormatTo(OutBuffer, UE_FORMAT_STRING("" Format), ##__VA_ARGS__)
+
+/**
+ * @brief printf 스타일 포맷 문자열의 컴파일 타임 파서 및 고정 버퍼 포맷터
+ * - Validate: 지정자 개수와 인자 타입을 static_assert로 검증 (UE_LOG 매크로에서도 사용)
+ * - FormatTo: 지정자마다 특수화된 코드로 호출자 버퍼에 직접 출력 (힙 할당, 런타임 파싱 없음)
+ * 콘솔에 직접 입력되는 UE_LOG 명령어처럼 런타임에만 알 수 있는 포맷은 기존 UELogParser::Parse 사용
+ */
+class UELogFormat
+{
+public:
+	/**
+	 * @brief 인자 타입 분류
+	 */
+	enum class EArgumentKind : uint8
+	{
+		Integer,
+		Floating,
+		String,
+		WideString,
+		Pointer,
+		Unsupported,
+	};
+
+	/**
+	 * @brief 검증 결과
+	 */
+	enum class EFormatError : uint8
+	{
+		None,
+		InvalidSpecifier,
+		TooFewArguments,
+		TooManyArguments,
+		TypeMismatch,
+	};
+
+	/**
+	 * @brief 컴파일 타임에 분석된 변환 지정자 하나
+	 * '%%'도 인자를 소모하지 않는 지정자로 취급해 리터럴 구간을 단순하게 유지
+	 */
+	struct FFormatSpec
+	{
+		uint32 LiteralBegin = 0;
+		uint32 LiteralEnd = 0;
+		bool bLeftAlign = false;
+		bool bZeroPad = false;
+		bool bPlusSign = false;
+		bool bSpaceSign = false;
+		bool bAlternate = false;
+		bool bWidthFromArgument = false;
+		bool bPrecisionFromArgument = false;
+		int32 Width = 0;
+		int32 Precision = -1;
+		char Length[2] = { 0, 0 };
+		char Conversion = 0;
+		uint32 WidthArgument = 0;
+		uint32 PrecisionArgument = 0;
+		uint32 ValueArgument = 0;
+	};
+
+	template <typename T>
+	static constexpr EArgumentKind GetArgumentKind()
+	{
+		using FDecayed = std::decay_t<T>;
+
+		// nullptr_t는 string_view로도 변환되므로 문자열보다 먼저 검사
+		if constexpr (std::is_null_pointer_v<FDecayed>)
+		{
+			return EArgumentKind::Pointer;
+		}
+		else if constexpr (std::is_same_v<FDecayed, char*> || std::is_same_v<FDecayed, const char*> ||
+			std::is_convertible_v<const FDecayed&, std::string_view>)
+		{
+			return EArgumentKind::String;
+		}
+		else if constexpr (std::is_same_v<FDecayed, wchar_t*> || std::is_same_v<FDecayed, const wchar_t*> ||
+			std::is_convertible_v<const FDecayed&, std::wstring_view>)
+		{
+			return EArgumentKind::WideString;
+		}
+		else if constexpr (std::is_integral_v<FDecayed> || std::is_enum_v<FDecayed>)
+		{
+			return EArgumentKind::Integer;
+		}
+		else if constexpr (std::is_floating_point_v<FDecayed>)
+		{
+			return EArgumentKind::Floating;
+		}
+		else if constexpr (std::is_pointer_v<FDecayed> || std::is_null_pointer_v<FDecayed>)
+		{
+			return EArgumentKind::Pointer;
+		}
+		else
+		{
+			return EArgumentKind::Unsupported;
+		}
+	}
+
+	/**
+	 * @brief 포맷 문자열에서 지정자 하나를 파싱
+	 * @param InFormat 포맷 문자열
+	 * @param InOutPosition '%' 위치에서 시작해 지정자 다음 위치로 이동
+	 * @param OutSpec 파싱 결과
+	 * @return 올바른 지정자인지 여부
+	 */
+	static constexpr bool ParseSpec(std::string_view InFormat, size_t& InOutPosition, FFormatSpec& OutSpec)
+	{
+		size_t Position = InOutPosition + 1;
+		const size_t Size = InFormat.size();
+
+		if (Position < Size && InFormat[Position] == '%')
+		{
+			OutSpec.Conversion = '%';
+			InOutPosition = Position + 1;
+			return true;
+		}
+
+		// Flags
+		for (; Position < Size; ++Position)
+		{
+			const char Character = InFormat[Position];
+			if (Character == '-') { OutSpec.bLeftAlign = true; }
+			else if (Character == '0') { OutSpec.bZeroPad = true; }
+			else if (Character == '+') { OutSpec.bPlusSign = true; }
+			else if (Character == ' ') { OutSpec.bSpaceSign = true; }
+			else if (Character == '#') { OutSpec.bAlternate = true; }
+			else { break; }
+		}
+
+		// Width
+		if (Position < Size && InFormat[Position] == '*')
+		{
+			OutSpec.bWidthFromArgument = true;
+			++Position;
+		}
+		else
+		{
+			for (; Position < Size && InFormat[Position] >= '0' && InFormat[Position] <= '9'; ++Position)
+			{
+				OutSpec.Width = OutSpec.Width * 10 + (InFormat[Position] - '0');
+			}
+		}
+
+		// Precision
+		if (Position < Size && InFormat[Position] == '.')
+		{
+			++Position;
+			OutSpec.Precision = 0;
+			if (Position < Size && InFormat[Position] == '*')
+			{
+				OutSpec.bPrecisionFromArgument = true;
+				++Position;
+			}
+			else
+			{
+				for (; Position < Size && InFormat[Position] >= '0' && InFormat[Position] <= '9'; ++Position)
+				{
+					OutSpec.Precision = OutSpec.Precision * 10 + (InFormat[Position] - '0');
+				}
+			}
+		}
+
+		// Length modifier (hh, h, ll, l, j, z, t, L)
+		if (Position < Size)
+		{
+			const char Character = InFormat[Position];
+			if (Character == 'h' || Character == 'l')
+			{
+				OutSpec.Length[0] = Character;
+				++Position;
+				if (Position < Size && InFormat[Position] == Character)
+				{
+					OutSpec.Length[1] = Character;
+					++Position;
+				}
+			}
+			else if (Character == 'j' || Character == 'z' || Character == 't' || Character == 'L')
+			{
+				OutSpec.Length[0] = Character;
+				++Position;
+			}
+		}
+
+		if (Position >= Size)
+		{
+			return false;
+		}
+
+		const char Conversion = InFormat[Position];
+		switch (Conversion)
+		{
+		case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+		case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+		case 's': case 'p':
+			break;
+		default:
+			// %n은 보안상 지원하지 않음
+			return false;
+		}
+
+		OutSpec.Conversion = Conversion;
+		InOutPosition = Position + 1;
+		return true;
+	}
+
+	/**
+	 * @brief 지정자가 해당 타입의 인자를 받을 수 있는지 확인
+	 */
+	static constexpr bool IsCompatible(const FFormatSpec& InSpec, EArgumentKind InKind)
+	{
+		switch (InSpec.Conversion)
+		{
+		case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+			return InKind == EArgumentKind::Integer;
+		case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+			return InKind == EArgumentKind::Floating;
+		case 's':
+			return InSpec.Length[0] == 'l' ? InKind == EArgumentKind::WideString : InKind == EArgumentKind::String;
+		case 'p':
+			return InKind == EArgumentKind::Pointer || InKind == EArgumentKind::String || InKind == EArgumentKind::WideString;
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * @brief 포맷 문자열과 인자 타입 목록을 비교 검증
+	 * @param InFormat 포맷 문자열
+	 * @param InKinds 인자 타입 배열
+	 * @param InKindCount 인자 개수
+	 */
+	static constexpr EFormatError ValidateFormat(std::string_view InFormat, const EArgumentKind* InKinds, size_t InKindCount)
+	{
+		size_t ArgumentIndex = 0;
+		size_t Position = 0;
+
+		while (Position < InFormat.size())
+		{
+			if (InFormat[Position] != '%')
+			{
+				++Position;
+				continue;
+			}
+
+			FFormatSpec Spec;
+			if (!ParseSpec(InFormat, Position, Spec))
+			{
+				return EFormatError::InvalidSpecifier;
+			}
+
+			if (Spec.Conversion == '%')
+			{
+				continue;
+			}
+
+			const bool bStars[2] = { Spec.bWidthFromArgument, Spec.bPrecisionFromArgument };
+			for (const bool bStar : bStars)
+			{
+				if (!bStar)
+				{
+					continue;
+				}
+				if (ArgumentIndex >= InKindCount)
+				{
+					return EFormatError::TooFewArguments;
+				}
+				if (InKinds[ArgumentIndex++] != EArgumentKind::Integer)
+				{
+					return EFormatError::TypeMismatch;
+				}
+			}
+
+			if (ArgumentIndex >= InKindCount)
+			{
+				return EFormatError::TooFewArguments;
+			}
+			if (!IsCompatible(Spec, InKinds[ArgumentIndex++]))
+			{
+				return EFormatError::TypeMismatch;
+			}
+		}
+
+		return ArgumentIndex == InKindCount ? EFormatError::None : EFormatError::TooManyArguments;
+	}
+
+	/**
+	 * @brief 포맷 문자열 타입(UE_FORMAT_STRING)과 인자 타입들을 컴파일 타임에 검증
+	 * 실패 시 원인별 static_assert로 컴파일 에러 발생
+	 */
+	template <typename FFormat, typename... Args>
+	static void Validate()
+	{
+		static constexpr EArgumentKind Kinds[] = { GetArgumentKind<Args>()..., EArgumentKind::Unsupported };
+		constexpr EFormatError Error = ValidateFormat(FFormat::Get(), Kinds, sizeof...(Args));
+
+		static_assert(Error != EFormatError::InvalidSpecifier, "UE_LOG: 잘못되었거나 지원하지 않는 포맷 지정자가 있습니다");
+		static_assert(Error != EFormatError::TooFewArguments, "UE_LOG: 포맷 지정자보다 인자 개수가 적습니다");
+		static_assert(Error != EFormatError::TooManyArguments, "UE_LOG: 포맷 지정자보다 인자 개수가 많습니다");
+		static_assert(Error != EFormatError::TypeMismatch, "UE_LOG: 포맷 지정자와 인자 타입이 일치하지 않습니다");
+	}
+
+	/**
+	 * @brief 컴파일 타임에 분석된 포맷 문자열
+	 * 포맷 타입마다 한 번만 생성되며, 런타임에는 지정자 배열을 읽기만 함
+	 */
+	template <typename FFormat>
+	struct TCompiledFormat
+	{
+		static constexpr std::string_view Format = FFormat::Get();
+
+		static constexpr size_t CountSpecs()
+		{
+			size_t Count = 0;
+			size_t Position = 0;
+			while (Position < Format.size())
+			{
+				if (Format[Position] != '%')
+				{
+					++Position;
+					continue;
+				}
+				FFormatSpec Spec;
+				if (!ParseSpec(Format, Position, Spec))
+				{
+					break;
+				}
+				++Count;
+			}
+			return Count;
+		}
+
+		static constexpr size_t SpecCount = CountSpecs();
+
+		static constexpr std::array<FFormatSpec, SpecCount> BuildSpecs()
+		{
+			std::array<FFormatSpec, SpecCount> Result{};
+			uint32 ArgumentIndex = 0;
+			size_t LiteralBegin = 0;
+			size_t Position = 0;
+			size_t SpecIndex = 0;
+
+			while (Position < Format.size() && SpecIndex < SpecCount)
+			{
+				if (Format[Position] != '%')
+				{
+					++Position;
+					continue;
+				}
+
+				FFormatSpec Spec;
+				Spec.LiteralBegin = static_cast<uint32>(LiteralBegin);
+				Spec.LiteralEnd = static_cast<uint32>(Position);
+				ParseSpec(Format, Position, Spec);
+
+				if (Spec.Conversion != '%')
+				{
+					if (Spec.bWidthFromArgument)
+					{
+						Spec.WidthArgument = ArgumentIndex++;
+					}
+					if (Spec.bPrecisionFromArgument)
+					{
+						Spec.PrecisionArgument = ArgumentIndex++;
+					}
+					Spec.ValueArgument = ArgumentIndex++;
+				}
+
+				Result[SpecIndex++] = Spec;
+				LiteralBegin = Position;
+			}
+			return Result;
+		}
+
+		static constexpr std::array<FFormatSpec, SpecCount> Specs = BuildSpecs();
+
+		static constexpr uint32 GetTailBegin()
+		{
+			if constexpr (SpecCount == 0)
+			{
+				return 0;
+			}
+			else
+			{
+				// 마지막 지정자 직후부터 끝까지가 꼬리 리터럴
+				size_t Position = Specs[SpecCount - 1].LiteralEnd;
+				FFormatSpec Spec;
+				ParseSpec(Format, Position, Spec);
+				return static_cast<uint32>(Position);
+			}
+		}
+
+		static constexpr uint32 TailBegin = GetTailBegin();
+	};
+
+	/**
+	 * @brief 고정 버퍼 출력기
+	 * snprintf와 동일하게 버퍼를 넘는 부분은 잘라내되 전체 길이는 계속 집계
+	 */
+	struct FFormatWriter
+	{
+		char* Buffer;
+		size_t Capacity; // 널 문자 제외
+		size_t Length = 0;
+
+		void Append(const char* InData, size_t InSize)
+		{
+			if (Length < Capacity)
+			{
+				const size_t CopySize = InSize < Capacity - Length ? InSize : Capacity - Length;
+				memcpy(Buffer + Length, InData, CopySize);
+			}
+			Length += InSize;
+		}
+
+		void AppendFill(char InCharacter, size_t InCount)
+		{
+			if (Length < Capacity)
+			{
+				const size_t FillSize = InCount < Capacity - Length ? InCount : Capacity - Length;
+				memset(Buffer + Length, InCharacter, FillSize);
+			}
+			Length += InCount;
+		}
+
+		void Terminate() const
+		{
+			Buffer[Length < Capacity ? Length : Capacity] = '\0';
+		}
+	};
+
+	/**
+	 * @brief 컴파일 타임에 검증된 포맷으로 호출자 버퍼에 직접 포맷팅
+	 * @param OutBuffer 출력 버퍼 (항상 널 문자로 끝남)
+	 * @param InBufferSize 버퍼 크기 (널 문자 포함)
+	 * @return 잘리지 않았다면 출력되었을 전체 길이 (snprintf와 동일)
+	 */
+	template <typename FFormat, typename... Args>
+	static size_t FormatTo(char* OutBuffer, size_t InBufferSize, FFormat, const Args&... InArgs)
+	{
+		Validate<FFormat, Args...>();
+
+		using FCompiled = TCompiledFormat<FFormat>;
+
+		if (InBufferSize == 0)
+		{
+			return 0;
+		}
+
+		FFormatWriter Writer{ OutBuffer, InBufferSize - 1 };
+		WriteSpecs<FCompiled>(Writer, std::make_index_sequence<FCompiled::SpecCount>{}, std::forward_as_tuple(InArgs...));
+		Writer.Append(FCompiled::Format.data() + FCompiled::TailBegin, FCompiled::Format.size() - FCompiled::TailBegin);
+		Writer.Terminate();
+		return Writer.Length;
+	}
+
+	template <size_t BufferSize, typename FFormat, typename... Args>
+	static size_t FormatTo(char (&OutBuffer)[BufferSize], FFormat InFormat, const Args&... InArgs)
+	{
+		return FormatTo(static_cast<char*>(OutBuffer), BufferSize, InFormat, InArgs...);
+	}
+
+private:
+	template <typename FCompiled, size_t... SpecIndices, typename FArguments>
+	static void WriteSpecs(FFormatWriter& Writer, std::index_sequence<SpecIndices...>, const FArguments& InArguments)
+	{
+		(WriteSpec<FCompiled, SpecIndices>(Writer, InArguments), ...);
+	}
+
+	/**
+	 * @brief 지정자 하나에 대한 출력
+	 * 지정자 정보가 constexpr이므로 변환 종류별 분기는 컴파일 타임에 결정됨
+	 */
+	template <typename FCompiled, size_t SpecIndex, typename FArguments>
+	static void WriteSpec(FFormatWriter& Writer, const FArguments& InArguments)
+	{
+		constexpr FFormatSpec Spec = FCompiled::Specs[SpecIndex];
+		Writer.Append(FCompiled::Format.data() + Spec.LiteralBegin, Spec.LiteralEnd - Spec.LiteralBegin);
+
+		if constexpr (Spec.Conversion == '%')
+		{
+			Writer.Append("%", 1);
+		}
+		else
+		{
+			static_assert(!Spec.bAlternate || Spec.Conversion == 'x' || Spec.Conversion == 'X' || Spec.Conversion == 'o',
+				"UE_FORMAT_TO: '#' 플래그는 %x, %X, %o에만 지원합니다");
+			static_assert(Spec.Conversion != 'a' && Spec.Conversion != 'A', "UE_FORMAT_TO: %a는 지원하지 않습니다");
+
+			FFormatSpec RuntimeSpec = Spec;
+			if constexpr (Spec.bWidthFromArgument)
+			{
+				const int32 Width = static_cast<int32>(std::get<Spec.WidthArgument>(InArguments));
+				RuntimeSpec.bLeftAlign = Spec.bLeftAlign || Width < 0;
+				RuntimeSpec.Width = Width < 0 ? -Width : Width;
+			}
+			if constexpr (Spec.bPrecisionFromArgument)
+			{
+				const int32 Precision = static_cast<int32>(std::get<Spec.PrecisionArgument>(InArguments));
+				RuntimeSpec.Precision = Precision < 0 ? -1 : Precision;
+			}
+
+			WriteValue<Spec.Conversion>(Writer, RuntimeSpec, std::get<Spec.ValueArgument>(InArguments));
+		}
+	}
+
+	template <char Conversion, typename T>
+	static void WriteValue(FFormatWriter& Writer, const FFormatSpec& InSpec, const T& InValue)
+	{
+		if constexpr (Conversion == 'd' || Conversion == 'i')
+		{
+			WriteInteger(Writer, InSpec, NarrowSigned(InSpec, InValue), 10, false);
+		}
+		else if constexpr (Conversion == 'u' || Conversion == 'o' || Conversion == 'x' || Conversion == 'X')
+		{
+			const uint32 Base = Conversion == 'u' ? 10 : (Conversion == 'o' ? 8 : 16);
+			WriteUnsigned(Writer, InSpec, NarrowUnsigned(InSpec, InValue), Base, Conversion == 'X');
+		}
+		else if constexpr (Conversion == 'c')
+		{
+			const char Character = static_cast<char>(InValue);
+			WritePadded(Writer, InSpec, "", 0, &Character, 1, false);
+		}
+		else if constexpr (Conversion == 's')
+		{
+			WriteString(Writer, InSpec, InValue);
+		}
+		else if constexpr (Conversion == 'p')
+		{
+			WritePointer(Writer, InSpec, reinterpret_cast<uintptr_t>(AsPointer(InValue)));
+		}
+		else
+		{
+			WriteFloat(Writer, InSpec, static_cast<double>(InValue), Conversion);
+		}
+	}
+
+	/**
+	 * @brief printf와 동일하게 길이 지정자에 맞춰 정수를 잘라냄
+	 */
+	template <typename T>
+	static int64 NarrowSigned(const FFormatSpec& InSpec, const T& InValue)
+	{
+		const auto Value = static_cast<long long>(InValue);
+		switch (InSpec.Length[0])
+		{
+		case 'h': return InSpec.Length[1] == 'h' ? static_cast<signed char>(Value) : static_cast<short>(Value);
+		case 'l': return InSpec.Length[1] == 'l' ? Value : static_cast<long>(Value);
+		case 'j': return static_cast<intmax_t>(Value);
+		case 'z': case 't': return static_cast<ptrdiff_t>(Value);
+		default: return static_cast<int>(Value);
+		}
+	}
+
+	template <typename T>
+	static uint64 NarrowUnsigned(const FFormatSpec& InSpec, const T& InValue)
+	{
+		const auto Value = static_cast<unsigned long long>(InValue);
+		switch (InSpec.Length[0])
+		{
+		case 'h': return InSpec.Length[1] == 'h' ? static_cast<unsigned char>(Value) : static_cast<unsigned short>(Value);
+		case 'l': return InSpec.Length[1] == 'l' ? Value : static_cast<unsigned long>(Value);
+		case 'j': return static_cast<uintmax_t>(Value);
+		case 'z': case 't': return static_cast<size_t>(Value);
+		default: return static_cast<unsigned int>(Value);
+		}
+	}
+
+	template <typename T>
+	static const void* AsPointer(const T& InValue)
+	{
+		if constexpr (std::is_null_pointer_v<T>)
+		{
+			return nullptr;
+		}
+		else if constexpr (std::is_pointer_v<std::decay_t<T>>)
+		{
+			return static_cast<const void*>(InValue);
+		}
+		else
+		{
+			// FString 등 문자열 객체는 내부 버퍼 주소
+			return static_cast<const void*>(std::data(InValue));
+		}
+	}
+
+	template <typename T>
+	static void WriteString(FFormatWriter& Writer, const FFormatSpec& InSpec, const T& InValue)
+	{
+		if constexpr (GetArgumentKind<T>() == EArgumentKind::WideString)
+		{
+			const std::wstring_view Wide = GetWideView(InValue);
+			size_t Count = InSpec.Precision >= 0 && static_cast<size_t>(InSpec.Precision) < Wide.size()
+				? static_cast<size_t>(InSpec.Precision) : Wide.size();
+
+			// ASCII 범위 밖 문자는 '?'로 대체 (로그 용도)
+			const size_t Padding = InSpec.Width > static_cast<int32>(Count) ? InSpec.Width - Count : 0;
+			if (!InSpec.bLeftAlign) { Writer.AppendFill(' ', Padding); }
+			for (size_t Index = 0; Index < Count; ++Index)
+			{
+				const char Character = Wide[Index] < 0x80 ? static_cast<char>(Wide[Index]) : '?';
+				Writer.Append(&Character, 1);
+			}
+			if (InSpec.bLeftAlign) { Writer.AppendFill(' ', Padding); }
+		}
+		else
+		{
+			const std::string_view String = GetStringView(InValue);
+			const size_t Count = InSpec.Precision >= 0 && static_cast<size_t>(InSpec.Precision) < String.size()
+				? static_cast<size_t>(InSpec.Precision) : String.size();
+			WritePadded(Writer, InSpec, "", 0, String.data(), Count, false);
+		}
+	}
+
+	template <typename T>
+	static std::string_view GetStringView(const T& InValue)
+	{
+		if constexpr (std::is_pointer_v<std::decay_t<T>>)
+		{
+			const char* String = InValue;
+			return String ? std::string_view(String) : std::string_view("(null)");
+		}
+		else
+		{
+			return std::string_view(InValue);
+		}
+	}
+
+	template <typename T>
+	static std::wstring_view GetWideView(const T& InValue)
+	{
+		if constexpr (std::is_pointer_v<std::decay_t<T>>)
+		{
+			const wchar_t* String = InValue;
+			return String ? std::wstring_view(String) : std::wstring_view(L"(null)");
+		}
+		else
+		{
+			return std::wstring_view(InValue);
+		}
+	}
+
+	/**
+	 * @brief 부호/접두사 + 본문을 폭과 정렬에 맞춰 출력
+	 * @param bInAllowZeroPad '0' 플래그로 부호 뒤를 0으로 채울 수 있는지 여부
+	 */
+	static void WritePadded(FFormatWriter& Writer, const FFormatSpec& InSpec, const char* InPrefix, size_t InPrefixSize,
+	                        const char* InBody, size_t InBodySize, bool bInAllowZeroPad)
+	{
+		const size_t ContentSize = InPrefixSize + InBodySize;
+		const size_t Padding = InSpec.Width > 0 && static_cast<size_t>(InSpec.Width) > ContentSize
+			? static_cast<size_t>(InSpec.Width) - ContentSize : 0;
+
+		if (InSpec.bLeftAlign)
+		{
+			Writer.Append(InPrefix, InPrefixSize);
+			Writer.Append(InBody, InBodySize);
+			Writer.AppendFill(' ', Padding);
+		}
+		else if (InSpec.bZeroPad && bInAllowZeroPad)
+		{
+			Writer.Append(InPrefix, InPrefixSize);
+			Writer.AppendFill('0', Padding);
+			Writer.Append(InBody, InBodySize);
+		}
+		else
+		{
+			Writer.AppendFill(' ', Padding);
+			Writer.Append(InPrefix, InPrefixSize);
+			Writer.Append(InBody, InBodySize);
+		}
+	}
+
+	static void WriteInteger(FFormatWriter& Writer, const FFormatSpec& InSpec, int64 InValue, uint32 InBase, bool bInUppercase)
+	{
+		const bool bIsNegative = InValue < 0;
+		const uint64 Magnitude = bIsNegative ? 0ull - static_cast<uint64>(InValue) : static_cast<uint64>(InValue);
+		const char Sign = bIsNegative ? '-' : (InSpec.bPlusSign ? '+' : (InSpec.bSpaceSign ? ' ' : 0));
+		WriteDigits(Writer, InSpec, Magnitude, InBase, bInUppercase, Sign);
+	}
+
+	static void WriteUnsigned(FFormatWriter& Writer, const FFormatSpec& InSpec, uint64 InValue, uint32 InBase, bool bInUppercase)
+	{
+		WriteDigits(Writer, InSpec, InValue, InBase, bInUppercase, 0);
+	}
+
+	static void WriteDigits(FFormatWriter& Writer, const FFormatSpec& InSpec, uint64 InValue, uint32 InBase, bool bInUppercase, char InSign)
+	{
+		// 최소 자릿수(정밀도) 만큼 앞을 0으로 채우기 위해 여유 공간 확보
+		char Digits[96];
+		constexpr size_t MaxPrecision = sizeof(Digits) - 24;
+		const size_t Precision = InSpec.Precision < 0 ? 1 : (std::min)(static_cast<size_t>(InSpec.Precision), MaxPrecision);
+
+		char Converted[24];
+		size_t ConvertedSize = 0;
+		// printf와 동일하게 정밀도 0인 0은 아무것도 출력하지 않음
+		if (!(InValue == 0 && Precision == 0))
+		{
+			const std::to_chars_result Result = std::to_chars(Converted, Converted + sizeof(Converted), InValue, static_cast<int>(InBase));
+			ConvertedSize = Result.ptr - Converted;
+			if (bInUppercase)
+			{
+				for (size_t Index = 0; Index < ConvertedSize; ++Index)
+				{
+					if (Converted[Index] >= 'a' && Converted[Index] <= 'f')
+					{
+						Converted[Index] = static_cast<char>(Converted[Index] - 'a' + 'A');
+					}
+				}
+			}
+		}
+
+		size_t LeadingZeros = Precision > ConvertedSize ? Precision - ConvertedSize : 0;
+		if (InSpec.bAlternate && InBase == 8 && LeadingZeros == 0 && (ConvertedSize == 0 || Converted[0] != '0'))
+		{
+			LeadingZeros = 1;
+		}
+
+		memset(Digits, '0', LeadingZeros);
+		memcpy(Digits + LeadingZeros, Converted, ConvertedSize);
+
+		char Prefix[3];
+		size_t PrefixSize = 0;
+		if (InSign)
+		{
+			Prefix[PrefixSize++] = InSign;
+		}
+		if (InSpec.bAlternate && InBase == 16 && InValue != 0)
+		{
+			Prefix[PrefixSize++] = '0';
+			Prefix[PrefixSize++] = bInUppercase ? 'X' : 'x';
+		}
+
+		// 정밀도가 지정되면 '0' 플래그는 무시됨
+		WritePadded(Writer, InSpec, Prefix, PrefixSize, Digits, LeadingZeros + ConvertedSize, InSpec.Precision < 0);
+	}
+
+	static void WritePointer(FFormatWriter& Writer, const FFormatSpec& InSpec, uintptr_t InAddress)
+	{
+		// 기존 UELogParser::FormatPointer와 동일한 0x + 소문자 16진수 형식
+		char Digits[2 + sizeof(uintptr_t) * 2];
+		Digits[0] = '0';
+		Digits[1] = 'x';
+		const std::to_chars_result Result = std::to_chars(Digits + 2, Digits + sizeof(Digits), static_cast<uint64>(InAddress), 16);
+		WritePadded(Writer, InSpec, "", 0, Digits, Result.ptr - Digits, false);
+	}
+
+	static void WriteFloat(FFormatWriter& Writer, const FFormatSpec& InSpec, double InValue, char InConversion)
+	{
+		// 고정 소수점 최대 자릿수(309) + 정밀도가 버퍼에 들어가도록 정밀도 제한
+		char Body[512];
+		constexpr int32 MaxPrecision = 160;
+		const int32 Precision = InSpec.Precision < 0 ? 6 : (std::min)(InSpec.Precision, MaxPrecision);
+
+		std::chars_format Format = std::chars_format::fixed;
+		if (InConversion == 'e' || InConversion == 'E')
+		{
+			Format = std::chars_format::scientific;
+		}
+		else if (InConversion == 'g' || InConversion == 'G')
+		{
+			Format = std::chars_format::general;
+		}
+
+		const std::to_chars_result Result = std::to_chars(Body, Body + sizeof(Body), InValue, Format, Precision);
+		size_t BodySize = Result.ptr - Body;
+
+		char* Digits = Body;
+		char Sign = InSpec.bPlusSign ? '+' : (InSpec.bSpaceSign ? ' ' : 0);
+		if (BodySize > 0 && Body[0] == '-')
+		{
+			Sign = '-';
+			++Digits;
+			--BodySize;
+		}
+
+		const bool bIsFinite = BodySize > 0 && Digits[0] >= '0' && Digits[0] <= '9';
+		if (InConversion == 'F' || InConversion == 'E' || InConversion == 'G')
+		{
+			for (size_t Index = 0; Index < BodySize; ++Index)
+			{
+				if (Digits[Index] >= 'a' && Digits[Index] <= 'z')
+				{
+					Digits[Index] = static_cast<char>(Digits[Index] - 'a' + 'A');
+				}
+			}
+		}
+
+		WritePadded(Writer, InSpec, &Sign, Sign ? 1 : 0, Digits, BodySize, bIsFinite);
+	}
+};
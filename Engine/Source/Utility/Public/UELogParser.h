@@ -16,6 +16,8 @@ using std::forward; // 값 종류를 유지하면서 다른 함수로 전달하
 /**
  * @brief UE_LOG Parser Class
  * printf와 최대한 호환될 수 있도록 구현 시도
+ * 콘솔에서 입력한 UE_LOG 구문처럼 런타임에만 알 수 있는 포맷 문자열을 처리하며,
+ * 코드 상의 리터럴 포맷은 UELogFormat이 컴파일 타임에 검증 및 포맷팅함
  */
 class UELogParser
 {
@@ -433,6 +435,22 @@ public:
  */
 UELogParser::ParseResult ParseUELogFromString(const FString& InString);
 
+/**
+ * @brief 포맷팅 처리량 비교 결과 (호출 1회당 평균 나노초)
+ */
+struct FUELogFormatBenchmarkResult
+{
+	double VsnprintfNanoseconds = 0.0;
+	double RuntimeParserNanoseconds = 0.0;
+	double CompiledFormatNanoseconds = 0.0;
+};
+
+/**
+ * @brief vsnprintf, 기존 런타임 파서(UELogParser::Parse), 컴파일 타임 포맷터(UELogFormat::FormatTo)의 처리량 비교
+ * @param InIterations 방식별 반복 횟수
+ */
+FUELogFormatBenchmarkResult RunUELogFormatBenchmark(uint32 InIterations);
+
 /**
  * @brief 다양한 타입을 문자열로 변환하는 범용 함수
  */
@@ -39,6 +39,7 @@
 #include "Source/Global/Vector.h"
 #include "Source/Global/CoreTypes.h"
 #include "Source/Global/Macro.h"
+#include "Source/Utility/Public/AsyncLogger.h"
 #include "Source/Global/Function.h"
 #include "Source/Utility/Public/ScopeCycleCounter.h"
 #include "Source/Editor/Public/EditorEngine.h"